@@ -21,6 +21,8 @@
 
 #include "sycldnn/conv2d/conv_type.h"
 
+#include "sycldnn/depthwise_conv2d/algorithm.h"
+
 #define BM_WITH_DIR_DTYPE(DIR, DTYPE)                                       \
   DEPTHWISE_CONVOLUTION_BENCHMARK(DIR, sycldnn::backend::SNNBackend, DTYPE, \
                                   sycldnn::conv2d::conv_type::DIR)
@@ -30,3 +32,15 @@
 BM_WITH_DIR(Forward);
 BM_WITH_DIR(InputBackprop);
 BM_WITH_DIR(FilterBackprop);
+
+// Compare the forward kernels directly, as the automatic choice depends on
+// the device. Shapes a kernel does not support are skipped.
+#define BM_FORWARD_WITH_ALGO(ALGO)                                            \
+  DEPTHWISE_CONVOLUTION_BENCHMARK(Forward##ALGO,                              \
+                                  sycldnn::backend::SNNBackend, float,        \
+                                  sycldnn::conv2d::conv_type::Forward,        \
+                                  sycldnn::depthwise_conv2d::Algorithm::ALGO)
+
+BM_FORWARD_WITH_ALGO(Direct);
+BM_FORWARD_WITH_ALGO(LocalTiled);
+BM_FORWARD_WITH_ALGO(RegisterTiled);
@@ -21,6 +21,8 @@
 #include "benchmark_params.h"
 #include "snn_depthwise_conv2d_executor.h"
 
+#include "sycldnn/depthwise_conv2d/algorithm.h"
+
 #include "src/backend/backend_provider.h"
 
 #include "bench/fixture/add_computecpp_info.h"
@@ -30,20 +32,38 @@
 #include "bench/fixture/string_reporter.h"
 #include "bench/fixture/typenames.h"
 
-template <typename Backend, typename DataType, typename ConvType>
+template <typename Backend, typename DataType, typename ConvType,
+          sycldnn::depthwise_conv2d::Algorithm Algo =
+              sycldnn::depthwise_conv2d::Algorithm::Automatic>
 class SNNDepthwiseConvolutionBenchmark
     : public sycldnn::bench::SNNDepthwiseConv2DExecutor<
-          SNNDepthwiseConvolutionBenchmark<Backend, DataType, ConvType>,
+          SNNDepthwiseConvolutionBenchmark<Backend, DataType, ConvType, Algo>,
           ConvType>,
       public sycldnn::backend::BackendProvider<Backend>,
       public sycldnn::bench::StringReporter,
       public BaseDepthwiseConvolutionBenchmark {
  private:
   using State = benchmark::State;
+  using Algorithm = sycldnn::depthwise_conv2d::Algorithm;
+
+  static char const* algorithm_name() {
+    switch (Algo) {
+      case Algorithm::Direct:
+        return "Direct";
+      case Algorithm::LocalTiled:
+        return "LocalTiled";
+      case Algorithm::RegisterTiled:
+        return "RegisterTiled";
+      case Algorithm::Automatic:
+      default:
+        return "Automatic";
+    }
+  }
 
  protected:
   void run(State& state) {
     auto params = benchmark_params::deserialize(state);
+    params.algorithm = Algo;
     this->add_statistic(std::unique_ptr<sycldnn::bench::Statistic>{
         new sycldnn::bench::MaxStatistic{}});
     this->add_statistic(std::unique_ptr<sycldnn::bench::Statistic>{
@@ -62,6 +82,7 @@ class SNNDepthwiseConvolutionBenchmark
     this->add_to_label("@conv_type", sycldnn::bench::TypeName<ConvType>::name);
     this->add_to_label("@library", "SYCL-DNN");
     this->add_to_label("@backend", backend.name());
+    this->add_to_label("@selector", algorithm_name());
     this->add_to_label("short_name", "Depthwise Convolution");
     this->add_to_label("git_hash", commit_hash);
     this->set_label(state);
@@ -69,8 +69,9 @@ sycldnn::SNNStatus launch_kernel(
 
   auto status = sycldnn::conv2d::internal::queue_tiled_kernel<
       T, Index, ConvType, TileRows, TileCols, ChannelVectorWidth,
-      FeatureVectorWidth, UseFastDiv, WindowRows, WindowCols, Stride>(
-      in_acc, fil_acc, out_acc, kernel_params, tile_info, queue);
+      FeatureVectorWidth, UseFastDiv, WindowRows, WindowCols, Stride,
+      /*Dilation=*/1>(in_acc, fil_acc, out_acc, kernel_params, tile_info,
+                      queue);
   return status;
 }
 
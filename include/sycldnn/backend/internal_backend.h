@@ -37,6 +37,10 @@ struct InternalBackend {
   using pointer_type =
       typename BackendTraits<Backend>::template internal_pointer_type<T>;
 
+  /** The internal pointer type is the same as the pointer type. */
+  template <typename T>
+  using internal_pointer_type = pointer_type<T>;
+
   /**
    * Construct a InternalBackend which forwards buffer access calls to the
    * provided backend.
@@ -60,6 +64,42 @@ struct InternalBackend {
     return underlying_backend.get_mem_object(ptr, n_elems);
   }
 
+  /**
+   * Get the buffer corresponding to the provided internal pointer of the
+   * specified size.
+   *
+   * \param [in] ptr Pointer into a SYCL buffer.
+   * \param [in] n_elems Number of elements expected to be in the buffer.
+   * \return Buffer corresponding to the provided pointer.
+   */
+  template <typename T>
+  auto get_mem_object_internal(internal_pointer_type<T> ptr, size_t n_elems)
+      -> decltype(std::declval<Backend>().get_mem_object_internal(ptr,
+                                                                  n_elems)) {
+    return underlying_backend.get_mem_object_internal(ptr, n_elems);
+  }
+
+  /**
+   * Allocate a temporary buffer through the underlying backend.
+   *
+   * \param [in] n_bytes Number of bytes to allocate.
+   * \return Pointer to the allocated buffer.
+   */
+  template <typename T>
+  internal_pointer_type<T> allocate(size_t n_bytes) {
+    return underlying_backend.template allocate<T>(n_bytes);
+  }
+
+  /**
+   * Deallocate a temporary buffer through the underlying backend.
+   *
+   * \param [in] ptr Pointer to the buffer to deallocate.
+   */
+  template <typename T>
+  void deallocate(internal_pointer_type<T> ptr) {
+    underlying_backend.deallocate(ptr);
+  }
+
   /**
    * \brief Get the underlying queue
    *
@@ -0,0 +1,141 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef SYCLDNN_INCLUDE_BATCHNORM_FOLD_H_
+#define SYCLDNN_INCLUDE_BATCHNORM_FOLD_H_
+
+/**
+ * \file
+ * Implements the \ref sycldnn::batchnorm::fold_into_conv2d() function, which
+ * rewrites the filter and bias of a convolution so that they also apply a
+ * frozen batchnorm following the convolution.
+ */
+#include "sycldnn/mem_object.h"
+#include "sycldnn/status.h"
+
+#include "sycldnn/batchnorm/params.h"
+
+#include "sycldnn/conv2d/params.h"
+
+#include "sycldnn/internal/batchnorm/launch.h"
+
+#include "sycldnn/helpers/macros.h"
+
+namespace sycldnn {
+namespace batchnorm {
+namespace internal {
+
+/**
+ * Validate that the convolution and batchnorm parameters describe a frozen
+ * batchnorm which can be folded into the convolution.
+ *
+ * If compiled with asserts, any invalid parameter will fail with an assert.
+ * Otherwise a status code \ref StatusCode::InvalidParameter will be returned.
+ *
+ * \param conv_params The convolution parameters.
+ * \param params      The batchnorm parameters.
+ * \return A SNNStatus object containing either \ref StatusCode::OK if all
+ *         parameters are valid, or \ref StatusCode::InvalidParameter otherwise.
+ */
+inline SNNStatus validate_fold_params(conv2d::Conv2DParams const& conv_params,
+                                      BatchNormParams const& params) {
+  SNN_VALIDATE_PARAM(!params.is_training,
+                     "Only a frozen batchnorm can be folded into a "
+                     "convolution.");
+  SNN_VALIDATE_PARAM(params.epsilon > 0.f,
+                     "The epsilon parameter must be greater than 0.");
+  SNN_VALIDATE_PARAM(params.channels == conv_params.features,
+                     "The batchnorm channels must match the convolution "
+                     "features.");
+  SNN_VALIDATE_PARAM(conv_params.features > 0,
+                     "The number of features must be positive.");
+  SNN_VALIDATE_PARAM(conv_params.groups > 0,
+                     "The number of groups must be positive.");
+  SNN_VALIDATE_PARAM(conv_params.channels % conv_params.groups == 0,
+                     "The number of channels must be divisible by the number "
+                     "of groups.");
+  SNN_VALIDATE_PARAM(conv_params.filter_format == FilterFormat::HWCF ||
+                         conv_params.filter_format == FilterFormat::FCHW,
+                     "Only HWCF and FCHW filters can be folded into.");
+  return StatusCode::OK;
+}
+
+}  // namespace internal
+
+/**
+ * Fold a frozen batchnorm into the convolution preceding it.
+ *
+ * The filter and bias are rewritten on the device so that the convolution
+ * followed by a bias add computes the same result as the original convolution,
+ * bias add and batchnorm:
+ *   filter' = filter * gamma / sqrt(variance + epsilon)
+ *   bias'   = (bias - mean) * gamma / sqrt(variance + epsilon) + beta
+ * where each of the batchnorm tensors is indexed by the output feature. The
+ * batchnorm can then be dropped, saving a full pass over the convolution
+ * output each time the network is run.
+ *
+ * A convolution without a bias can be folded into by providing a zero
+ * initialized bias tensor.
+ *
+ * \param filter      A pointer to the convolution filter, updated in place.
+ * \param bias        A pointer to the convolution bias, with one value for
+ *                    each feature, updated in place.
+ * \param beta        A pointer to the batchnorm beta tensor.
+ * \param gamma       A pointer to the batchnorm gamma tensor.
+ * \param mean        A pointer to the batchnorm moving mean tensor.
+ * \param variance    A pointer to the batchnorm moving variance tensor.
+ * \param conv_params The convolution parameters.
+ * \param params      The frozen batchnorm parameters.
+ * \param backend     The backend for mapping between pointer representations.
+ * \return Returns a SNNStatus containing the SYCL event tied to the kernel
+ *         launches and a StatusCode enum showing if the launch was OK or
+ *         whether it encountered some problem.
+ */
+template <typename T, typename Backend>
+SNNStatus fold_into_conv2d(
+    typename Backend::template pointer_type<T> filter,
+    typename Backend::template pointer_type<T> bias,
+    typename Backend::template pointer_type<T const> beta,
+    typename Backend::template pointer_type<T const> gamma,
+    typename Backend::template pointer_type<T const> mean,
+    typename Backend::template pointer_type<T const> variance,
+    conv2d::Conv2DParams const& conv_params, BatchNormParams const& params,
+    Backend& backend) {
+  auto validation_status = internal::validate_fold_params(conv_params, params);
+  if (validation_status.status != StatusCode::OK) {
+    return validation_status;
+  }
+
+  size_t const features = conv_params.features;
+  size_t const filter_size = static_cast<size_t>(conv_params.window_rows) *
+                             conv_params.window_cols *
+                             (conv_params.channels / conv_params.groups) *
+                             features;
+  auto filter_mem = backend.get_mem_object(filter, filter_size);
+  auto bias_mem = backend.get_mem_object(bias, features);
+  auto beta_mem = backend.get_mem_object(beta, features);
+  auto gamma_mem = backend.get_mem_object(gamma, features);
+  auto mean_mem = backend.get_mem_object(mean, features);
+  auto variance_mem = backend.get_mem_object(variance, features);
+  auto queue = backend.get_queue();
+  return internal::launch_fold_conv2d<T>(filter_mem, bias_mem, beta_mem,
+                                         gamma_mem, mean_mem, variance_mem,
+                                         conv_params, params, queue);
+}
+
+}  // namespace batchnorm
+}  // namespace sycldnn
+
+#endif  // SYCLDNN_INCLUDE_BATCHNORM_FOLD_H_
@@ -27,6 +27,8 @@
 #include "sycldnn/batchnorm/params.h"
 
 #include "sycldnn/internal/batchnorm/launch_internal.h"
+#include "sycldnn/internal/helpers/allocated_pointer.h"
+#include "sycldnn/internal/transpose/layout.h"
 
 #include "sycldnn/helpers/macros.h"
 
@@ -60,9 +62,152 @@ SNNStatus inline validate_params(BatchNormParams const& params) {
   SNN_VALIDATE_PARAM(
       params.momentum >= 0.f,
       "The momentum parameter must be greater than or equal to 0.");
+  int const channel_block = get_channel_block(params.input_format);
+  SNN_VALIDATE_PARAM(params.channels % channel_block == 0,
+                     "The number of channels must be divisible by the channel "
+                     "block size.");
   return StatusCode::OK;
 }
 
+/**
+ * Launch batchnorm on an input, gradient and output which are in a layout
+ * supported by the kernels.
+ *
+ * \param input_mem        The input tensor.
+ * \param beta_or_grad_mem The beta tensor in the forward direction, or the
+ *                         gradient tensor in the gradient direction.
+ * \param output_mem       The output tensor.
+ * \return An SNNStatus with event linked to the last kernel launch or an error
+ *         code.
+ */
+template <typename T, typename Backend, typename Direction>
+SNNStatus launch_batchnorm(
+    BaseMemObject<T const>& input_mem, BaseMemObject<T const>& beta_or_grad_mem,
+    typename Backend::template pointer_type<T const> gamma,
+    typename Backend::template pointer_type<T const> input_mean,
+    typename Backend::template pointer_type<T const> input_variance,
+    typename Backend::template pointer_type<T> running_mean_or_beta_grad,
+    typename Backend::template pointer_type<T> running_variance_or_gamma_grad,
+    BaseMemObject<T>& output_mem, BatchNormParams const& params,
+    Backend& backend) {
+  auto gamma_mem = backend.get_mem_object(gamma, params.channels);
+
+  if (!IsGradient<Direction>) {
+    auto input_mean_mem = backend.get_mem_object(input_mean, params.channels);
+    auto input_variance_mem =
+        backend.get_mem_object(input_variance, params.channels);
+    if (params.is_training) {
+      auto running_mean_mem =
+          backend.get_mem_object(running_mean_or_beta_grad, params.channels);
+      auto running_variance_mem = backend.get_mem_object(
+          running_variance_or_gamma_grad, params.channels);
+      // Launch forward training
+      return launch_forward<T, Backend>(
+          input_mem, beta_or_grad_mem, gamma_mem, input_mean_mem,
+          input_variance_mem, running_mean_mem, running_variance_mem,
+          output_mem, params, backend);
+    } else {
+      // Launch forward frozen
+      return launch_forward<T, Backend>(input_mem, beta_or_grad_mem, gamma_mem,
+                                        input_mean_mem, input_variance_mem,
+                                        output_mem, params, backend);
+    }
+  } else {
+    auto beta_grad_mem =
+        backend.get_mem_object(running_mean_or_beta_grad, params.channels);
+    auto gamma_grad_mem =
+        backend.get_mem_object(running_variance_or_gamma_grad, params.channels);
+    if (params.is_training) {
+      // Launch gradient training
+      return launch_gradient<T, Backend>(input_mem, beta_or_grad_mem,
+                                         gamma_mem, beta_grad_mem,
+                                         gamma_grad_mem, output_mem, params,
+                                         backend);
+    } else {
+      auto input_mean_mem = backend.get_mem_object(input_mean, params.channels);
+      auto input_variance_mem =
+          backend.get_mem_object(input_variance, params.channels);
+      // Launch gradient frozen
+      return launch_gradient<T, Backend>(
+          input_mem, beta_or_grad_mem, gamma_mem, input_mean_mem,
+          input_variance_mem, beta_grad_mem, gamma_grad_mem, output_mem,
+          params, backend);
+    }
+  }
+  return StatusCode::InvalidParameter;
+}
+
+/**
+ * Launch batchnorm on channel blocked NCHWc tensors, by converting the input
+ * and gradient to NHWC and converting the output back.
+ */
+template <typename T, typename Backend, typename Direction>
+SNNStatus launch_blocked(
+    BaseMemObject<T const>& input_mem, BaseMemObject<T const>& beta_or_grad_mem,
+    typename Backend::template pointer_type<T const> gamma,
+    typename Backend::template pointer_type<T const> input_mean,
+    typename Backend::template pointer_type<T const> input_variance,
+    typename Backend::template pointer_type<T> running_mean_or_beta_grad,
+    typename Backend::template pointer_type<T> running_variance_or_gamma_grad,
+    BaseMemObject<T>& output_mem, BatchNormParams const& params,
+    Backend& backend) {
+  auto n_items = get_total_size(params);
+  auto to_nhwc = transpose::internal::get_layout_transpose(
+      params.batch, params.rows, params.cols, params.channels,
+      params.input_format, DataFormat::NHWC);
+  auto from_nhwc = transpose::internal::get_layout_transpose(
+      params.batch, params.rows, params.cols, params.channels,
+      DataFormat::NHWC, params.input_format);
+  BatchNormParams nhwc_params = params;
+  nhwc_params.input_format = DataFormat::NHWC;
+  auto queue = backend.get_queue();
+
+  // The NHWC copies are only needed for this launch, so are allocated through
+  // the backend and released when they go out of scope.
+  using ::sycldnn::internal::helpers::AllocatedPointer;
+  AllocatedPointer<T, Backend> nhwc_input_ptr{sizeof(T) * n_items, backend};
+  AllocatedPointer<T, Backend> nhwc_output_ptr{sizeof(T) * n_items, backend};
+  auto nhwc_input =
+      backend.get_mem_object_internal(nhwc_input_ptr.get(), n_items);
+  auto nhwc_output =
+      backend.get_mem_object_internal(nhwc_output_ptr.get(), n_items);
+  auto status = transpose::internal::launch(
+      input_mem, nhwc_input, to_nhwc.dimensions, to_nhwc.permutation, queue);
+  if (sycldnn::StatusCode::OK != status.status) {
+    return status;
+  }
+  auto const_nhwc_input = nhwc_input.as_const();
+
+  if (IsGradient<Direction>) {
+    AllocatedPointer<T, Backend> nhwc_grad_ptr{sizeof(T) * n_items, backend};
+    auto nhwc_grad =
+        backend.get_mem_object_internal(nhwc_grad_ptr.get(), n_items);
+    status = transpose::internal::launch(beta_or_grad_mem, nhwc_grad,
+                                         to_nhwc.dimensions,
+                                         to_nhwc.permutation, queue);
+    if (sycldnn::StatusCode::OK != status.status) {
+      return status;
+    }
+    auto const_nhwc_grad = nhwc_grad.as_const();
+    status = launch_batchnorm<T, Backend, Direction>(
+        const_nhwc_input, const_nhwc_grad, gamma, input_mean, input_variance,
+        running_mean_or_beta_grad, running_variance_or_gamma_grad,
+        nhwc_output, nhwc_params, backend);
+  } else {
+    status = launch_batchnorm<T, Backend, Direction>(
+        const_nhwc_input, beta_or_grad_mem, gamma, input_mean, input_variance,
+        running_mean_or_beta_grad, running_variance_or_gamma_grad,
+        nhwc_output, nhwc_params, backend);
+  }
+  if (sycldnn::StatusCode::OK != status.status) {
+    return status;
+  }
+  auto const_nhwc_output = nhwc_output.as_const();
+  return transpose::internal::launch(const_nhwc_output, output_mem,
+                                     from_nhwc.dimensions,
+                                     from_nhwc.permutation, queue);
+}
+
 }  // namespace internal
 
 /**
@@ -123,53 +268,23 @@ SNNStatus launch(
   }
 
   auto n_items = params.batch * params.channels * params.rows * params.cols;
+  auto beta_or_grad_size =
+      internal::IsGradient<Direction> ? n_items : params.channels;
   auto input_mem = backend.get_mem_object(input, n_items);
-  auto gamma_mem = backend.get_mem_object(gamma, params.channels);
+  auto beta_or_grad_mem =
+      backend.get_mem_object(beta_or_gradient, beta_or_grad_size);
   auto output_mem = backend.get_mem_object(output, n_items);
 
-  if (!internal::IsGradient<Direction>) {
-    auto beta_mem = backend.get_mem_object(beta_or_gradient, params.channels);
-    auto input_mean_mem = backend.get_mem_object(input_mean, params.channels);
-    auto input_variance_mem =
-        backend.get_mem_object(input_variance, params.channels);
-    if (params.is_training) {
-      auto running_mean_mem =
-          backend.get_mem_object(running_mean_or_beta_grad, params.channels);
-      auto running_variance_mem = backend.get_mem_object(
-          running_variance_or_gamma_grad, params.channels);
-      // Launch forward training
-      return internal::launch_forward<T, Backend>(
-          input_mem, beta_mem, gamma_mem, input_mean_mem, input_variance_mem,
-          running_mean_mem, running_variance_mem, output_mem, params, backend);
-    } else {
-      // Launch forward frozen
-      return internal::launch_forward<T, Backend>(
-          input_mem, beta_mem, gamma_mem, input_mean_mem, input_variance_mem,
-          output_mem, params, backend);
-    }
-  } else {
-    auto gradient_mem = backend.get_mem_object(beta_or_gradient, n_items);
-    auto beta_grad_mem =
-        backend.get_mem_object(running_mean_or_beta_grad, params.channels);
-    auto gamma_grad_mem =
-        backend.get_mem_object(running_variance_or_gamma_grad, params.channels);
-    if (params.is_training) {
-      // Launch gradient training
-      return internal::launch_gradient<T, Backend>(
-          input_mem, gradient_mem, gamma_mem, beta_grad_mem, gamma_grad_mem,
-          output_mem, params, backend);
-    } else {
-      auto input_mean_mem = backend.get_mem_object(input_mean, params.channels);
-      auto input_variance_mem =
-          backend.get_mem_object(input_variance, params.channels);
-      // Launch gradient frozen
-      return internal::launch_gradient<T, Backend>(
-          input_mem, gradient_mem, gamma_mem, input_mean_mem,
-          input_variance_mem, beta_grad_mem, gamma_grad_mem, output_mem, params,
-          backend);
-    }
+  if (is_channel_blocked(params.input_format)) {
+    return internal::launch_blocked<T, Backend, Direction>(
+        input_mem, beta_or_grad_mem, gamma, input_mean, input_variance,
+        running_mean_or_beta_grad, running_variance_or_gamma_grad, output_mem,
+        params, backend);
   }
-  return StatusCode::InvalidParameter;
+  return internal::launch_batchnorm<T, Backend, Direction>(
+      input_mem, beta_or_grad_mem, gamma, input_mean, input_variance,
+      running_mean_or_beta_grad, running_variance_or_gamma_grad, output_mem,
+      params, backend);
 }
 
 /**
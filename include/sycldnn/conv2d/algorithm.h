@@ -40,7 +40,7 @@ enum class Algorithm {
   Winograd,
   /** Winograd implementation with larger tile sizes. */
   WinogradLarge,
-  /** Use a matmul for 1x1 NHWC convolutions. */
+  /** Use a matmul for 1x1 convolutions. */
   Matmul,
 };
 }  // namespace conv2d
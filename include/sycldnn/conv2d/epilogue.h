@@ -0,0 +1,67 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef SYCLDNN_INCLUDE_CONV2D_EPILOGUE_H_
+#define SYCLDNN_INCLUDE_CONV2D_EPILOGUE_H_
+
+/**
+ * \file
+ * Contains the declaration of the \ref sycldnn::conv2d::EpilogueParams
+ * structure, which describes a bias add and activation to apply to the output
+ * of a forward convolution as part of the convolution kernels.
+ */
+namespace sycldnn {
+namespace conv2d {
+
+/** The activation functions which can be fused into a convolution. */
+enum class Activation {
+  /** No activation, the output is left unchanged. */
+  None,
+  /** Rectified linear unit, computing max(x, 0). */
+  Relu,
+  /**
+   * Clamp the output between EpilogueParams::clamp_min and
+   * EpilogueParams::clamp_max. With the default bounds this computes ReLU6.
+   */
+  Clamp,
+};
+
+/**
+ * Parameter struct describing the operations applied to each output value of a
+ * forward convolution before it is written to memory.
+ *
+ * The bias is added first, followed by the activation. A default constructed
+ * EpilogueParams leaves the convolution output unchanged.
+ */
+struct EpilogueParams {
+  /**
+   * Whether to add a bias to the output. The bias tensor holds one value for
+   * each output feature.
+   */
+  bool bias = false;
+
+  /** The activation function to apply to the output. */
+  Activation activation = Activation::None;
+
+  /** The lower bound used by Activation::Clamp. */
+  float clamp_min = 0.f;
+
+  /** The upper bound used by Activation::Clamp. */
+  float clamp_max = 6.f;
+};
+
+}  // namespace conv2d
+}  // namespace sycldnn
+#endif  // SYCLDNN_INCLUDE_CONV2D_EPILOGUE_H_
@@ -0,0 +1,191 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef SYCLDNN_INCLUDE_CONV2D_IM2COL_FILTER_H_
+#define SYCLDNN_INCLUDE_CONV2D_IM2COL_FILTER_H_
+
+/**
+ * \file
+ * Contains the \ref sycldnn::conv2d::Im2colFilter handle, which holds a filter
+ * that has been packed into the layout used by the im2col matrix multiply,
+ * along with the \ref sycldnn::conv2d::pack_im2col_filter() function used to
+ * fill it.
+ */
+#include "sycldnn/status.h"
+
+#include "sycldnn/conv2d/conv_type.h"
+#include "sycldnn/conv2d/params.h"
+#include "sycldnn/conv2d/workspace_size.h"
+
+#include "sycldnn/helpers/macros.h"
+
+#include "sycldnn/internal/conv2d/im2col.h"
+
+#include <type_traits>
+
+namespace sycldnn {
+namespace conv2d {
+
+/**
+ * Handle to a filter which has been packed into the layout used by the im2col
+ * matrix multiply.
+ *
+ * On construction the handle uses the backend to allocate a buffer large
+ * enough to hold the packed filter, which is released through the backend on
+ * destruction. The packed filter itself is computed by
+ * \ref sycldnn::conv2d::pack_im2col_filter().
+ *
+ * Only the forward and input backprop convolutions are supported, as the
+ * filter backprop convolution computes the filter rather than using it. An
+ * ungrouped forward filter is packed into zero padded tile panels, so that the
+ * matrix multiply can read each block of the filter contiguously.
+ *
+ * \tparam T        The data type of the filter.
+ * \tparam ConvType The type of convolution the filter will be used in.
+ * \tparam Backend  The backend used to allocate the packed filter.
+ */
+template <typename T, typename ConvType, typename Backend>
+class Im2colFilter {
+  static_assert(!std::is_same<ConvType, conv_type::FilterBackprop>::value,
+                "Pre-packed filters are not supported for the filter "
+                "backprop convolution.");
+
+ public:
+  /** The external pointer type used to hold the packed filter. */
+  using Pointer = typename Backend::template pointer_type<T>;
+
+  /**
+   * Allocate the buffer to hold a packed filter.
+   *
+   * \param params  The convolution parameters the filter will be used with.
+   * \param backend The backend to use to allocate the packed filter.
+   */
+  Im2colFilter(Conv2DParams const& params, Backend& backend)
+      : params_{params},
+        size_{compute_size(params)},
+        pointer_{size_ > 0 ? backend.template allocate<T>(sizeof(T) * size_)
+                           : Pointer{}},
+        backend_{backend} {}
+
+  SNN_DISABLE_COPY(Im2colFilter);
+  SNN_DISABLE_MOVE(Im2colFilter);
+
+  /** Release the packed filter buffer on destruction. */
+  ~Im2colFilter() {
+    if (size_ > 0) {
+      backend_.deallocate(pointer_);
+    }
+  }
+
+  /**
+   * Check whether the filter has a packed layout for these parameters.
+   * \return Returns true if the packed filter buffer was allocated.
+   */
+  bool is_valid() const { return size_ > 0; }
+
+  /** \return The convolution parameters the filter is packed for. */
+  Conv2DParams const& params() const { return params_; }
+
+  /** \return The number of elements in the packed filter. */
+  size_t size() const { return size_; }
+
+  /** \return The pointer to the packed filter. */
+  Pointer get() const { return pointer_; }
+
+ private:
+  /**
+   * Get the number of elements in the packed filter. The tile panels of an
+   * ungrouped forward filter are padded, so may be larger than the filter.
+   */
+  static size_t compute_size(Conv2DParams const& params) {
+    if (std::is_same<ConvType, conv_type::Forward>::value &&
+        params.groups == 1) {
+      return matmul::internal::get_packed_rhs_size(
+          params.window_rows * params.window_cols * params.channels,
+          params.features);
+    }
+    return static_cast<size_t>(params.window_rows) * params.window_cols *
+           (params.channels / params.groups) * params.features;
+  }
+
+  Conv2DParams params_;
+  size_t size_;
+  Pointer pointer_;
+  Backend& backend_;
+};
+
+/**
+ * Pack a filter into the layout used by the im2col matrix multiply, storing
+ * the result in the provided Im2colFilter handle.
+ *
+ * The handle can then be passed to \ref sycldnn::conv2d::launch() for any
+ * number of convolutions using the same filter, as long as the filter is not
+ * modified.
+ *
+ * \param filter  A pointer to the memory representing the tensor of filter
+ *                coefficients.
+ * \param packed  The handle to store the packed filter in.
+ * \param backend The backend implementation, used to map between pointer
+ *                representations.
+ * \return Returns an SNNStatus containing the SYCL event tied to the packing
+ * kernel and a StatusCode enum showing if the launch was OK or whether it
+ * encountered some problem.
+ */
+template <typename T, typename ConvType, typename Backend>
+SNNStatus pack_im2col_filter(
+    typename Backend::template pointer_type<T const> filter,
+    Im2colFilter<T, ConvType, Backend>& packed, Backend& backend) {
+  if (!packed.is_valid() ||
+      packed.params().filter_format != FilterFormat::HWCF) {
+    return StatusCode::InvalidAlgorithm;
+  }
+  return internal::pack_im2col_filter<T, ConvType>(filter, packed.get(),
+                                                   packed.params(), backend);
+}
+
+/**
+ * Query the number of elements that a workspace buffer must hold in order to be
+ * used in a convolution with a pre-packed im2col filter.
+ *
+ * The packed filter is already stored in the Im2colFilter handle, so the
+ * workspace only needs to hold the input transform, along with the batched
+ * matmul output for grouped convolutions.
+ *
+ * \param params Convolution parameters describing the computation.
+ * \param filter The pre-packed filter which will be used.
+ * \return A WorkspaceSize struct containing the minimum required and
+ *         recommended number of elements that a workspace buffer should hold.
+ */
+template <typename T, typename ConvType, typename Backend>
+WorkspaceSize query_workspace_size(
+    Conv2DParams const& params,
+    Im2colFilter<T, ConvType, Backend> const& filter) {
+  if (!filter.is_valid()) {
+    return {0, 0};
+  }
+  if (params.groups != 1) {
+    size_t const size_per_image =
+        internal::im2col::get_grouped_size_per_image<ConvType>(params);
+    return {size_per_image, params.batch * size_per_image};
+  }
+  auto const tile_info = internal::im2col::get_tile_info<ConvType>(params);
+  size_t const required_size = tile_info.number * tile_info.size;
+  return {required_size, params.batch * required_size};
+}
+
+}  // namespace conv2d
+}  // namespace sycldnn
+
+#endif  // SYCLDNN_INCLUDE_CONV2D_IM2COL_FILTER_H_
@@ -16,19 +16,52 @@
 #ifndef SYCLDNN_INCLUDE_CONV2D_IMPLEMENTATION_MATMUL_H_
 #define SYCLDNN_INCLUDE_CONV2D_IMPLEMENTATION_MATMUL_H_
 
+#include "sycldnn/status.h"
+
 #include "sycldnn/conv2d/conv_type.h"
 #include "sycldnn/conv2d/params.h"
 
+#include "sycldnn/internal/conv2d/internal_pointer_set.h"
+
+#include "sycldnn/internal/helpers/allocated_pointer.h"
+#include "sycldnn/internal/helpers/internal_pointer.h"
+
+#include "sycldnn/internal/transpose/launch.h"
+
+#include <stddef.h>
+
 namespace sycldnn {
 namespace conv2d {
 
 namespace internal {
 
+/**
+ * The sizes of the matrix multiply computing a single group of a 1x1
+ * convolution, which multiplies an [m, k] matrix by a [k, n] matrix.
+ */
+struct MatmulSizes {
+  /** The number of rows in the LHS and output matrices. */
+  int m;
+  /** The number of columns in the LHS and rows in the RHS matrices. */
+  int k;
+  /** The number of columns in the RHS and output matrices. */
+  int n;
+};
+
 template <typename ConvType>
 struct MatmulLauncher;
 
 template <>
 struct MatmulLauncher<conv_type::Forward> {
+  static constexpr bool TransposeLHS = false;
+  static constexpr bool TransposeRHS = false;
+
+  /** The input is multiplied by the filter to give the output. */
+  static MatmulSizes get_group_sizes(Conv2DParams const& params) {
+    return {params.batch * params.in_rows * params.in_cols,
+            params.channels / params.groups, params.features / params.groups};
+  }
+
   template <typename T, typename Backend>
   static SNNStatus launch(
       typename Backend::template pointer_type<T const> input,
@@ -45,6 +78,18 @@ struct MatmulLauncher<conv_type::Forward> {
 
 template <>
 struct MatmulLauncher<conv_type::InputBackprop> {
+  static constexpr bool TransposeLHS = false;
+  static constexpr bool TransposeRHS = true;
+
+  /**
+   * The output gradient is multiplied by the transposed filter to give the
+   * input gradient.
+   */
+  static MatmulSizes get_group_sizes(Conv2DParams const& params) {
+    return {params.batch * params.in_rows * params.in_cols,
+            params.features / params.groups, params.channels / params.groups};
+  }
+
   template <typename T, typename Backend>
   static SNNStatus launch(
       typename Backend::template pointer_type<T const> input,
@@ -61,6 +106,19 @@ struct MatmulLauncher<conv_type::InputBackprop> {
 
 template <>
 struct MatmulLauncher<conv_type::FilterBackprop> {
+  static constexpr bool TransposeLHS = true;
+  static constexpr bool TransposeRHS = false;
+
+  /**
+   * The transposed input is multiplied by the output gradient to give the
+   * filter gradient.
+   */
+  static MatmulSizes get_group_sizes(Conv2DParams const& params) {
+    return {params.channels / params.groups,
+            params.batch * params.in_rows * params.in_cols,
+            params.features / params.groups};
+  }
+
   template <typename T, typename Backend>
   static SNNStatus launch(
       typename Backend::template pointer_type<T const> input,
@@ -75,12 +133,129 @@ struct MatmulLauncher<conv_type::FilterBackprop> {
   }
 };
 
+/**
+ * Get the number of temporary elements needed for a grouped 1x1 convolution
+ * computed as a batched matmul, which holds group major copies of both
+ * operands and of the output.
+ */
+template <typename ConvType>
+inline size_t get_grouped_matmul_size(Conv2DParams const& params) {
+  auto const sizes = MatmulLauncher<ConvType>::get_group_sizes(params);
+  return static_cast<size_t>(params.groups) *
+         (static_cast<size_t>(sizes.m) * sizes.k +
+          static_cast<size_t>(sizes.k) * sizes.n +
+          static_cast<size_t>(sizes.m) * sizes.n);
+}
+
+/**
+ * Compute a grouped 1x1 convolution as a batched matmul over the groups.
+ *
+ * Each operand and the output are row-major matrices whose columns hold the
+ * groups one after another, so are viewed as [rows, groups, columns] tensors.
+ * The operands are transposed to [groups, rows, columns] in the scratch
+ * buffer, multiplied with a single batched matmul and the result transposed
+ * back into the output.
+ */
+template <typename T, typename ConvType, typename Backend>
+SNNStatus launch_grouped_matmul_with_scratch(
+    typename Backend::template internal_pointer_type<T const> lhs,
+    typename Backend::template internal_pointer_type<T const> rhs,
+    typename Backend::template internal_pointer_type<T> output,
+    typename Backend::template internal_pointer_type<T> scratch,
+    Conv2DParams const& params, Backend& backend) {
+  using Launcher = MatmulLauncher<ConvType>;
+  using ConstPointer =
+      typename Backend::template internal_pointer_type<T const>;
+  using Pointer = typename Backend::template internal_pointer_type<T>;
+  int const groups = params.groups;
+  auto const sizes = Launcher::get_group_sizes(params);
+  cl::sycl::queue queue = backend.get_queue();
+
+  auto group_major = [&](ConstPointer in, Pointer out, int rows, int cols) {
+    size_t const size = static_cast<size_t>(rows) * groups * cols;
+    auto in_acc = backend.get_mem_object_internal(in, size);
+    auto out_acc = backend.get_mem_object_internal(out, size);
+    return transpose::internal::launch<T>(in_acc, out_acc,
+                                          {rows, groups, cols}, {1, 0, 2},
+                                          queue);
+  };
+
+  Pointer const lhs_scratch = scratch;
+  Pointer const rhs_scratch =
+      lhs_scratch + static_cast<size_t>(groups) * sizes.m * sizes.k;
+  Pointer const out_scratch =
+      rhs_scratch + static_cast<size_t>(groups) * sizes.k * sizes.n;
+
+  auto status = Launcher::TransposeLHS
+                    ? group_major(lhs, lhs_scratch, sizes.k, sizes.m)
+                    : group_major(lhs, lhs_scratch, sizes.m, sizes.k);
+  if (status.status != StatusCode::OK) {
+    return status;
+  }
+  status = Launcher::TransposeRHS
+               ? group_major(rhs, rhs_scratch, sizes.n, sizes.k)
+               : group_major(rhs, rhs_scratch, sizes.k, sizes.n);
+  if (status.status != StatusCode::OK) {
+    return status;
+  }
+  backend.template batch_matmul<Launcher::TransposeLHS,
+                                Launcher::TransposeRHS>(
+      ConstPointer{lhs_scratch}, ConstPointer{rhs_scratch}, out_scratch,
+      groups, sizes.m, sizes.k, sizes.n);
+
+  size_t const output_size = static_cast<size_t>(groups) * sizes.m * sizes.n;
+  auto matmul_acc =
+      backend.get_mem_object_internal(ConstPointer{out_scratch}, output_size);
+  auto output_acc = backend.get_mem_object_internal(output, output_size);
+  return transpose::internal::launch<T>(matmul_acc, output_acc,
+                                        {groups, sizes.m, sizes.n}, {1, 0, 2},
+                                        queue);
+}
+
+/**
+ * Compute a grouped 1x1 convolution as a batched matmul over the groups.
+ *
+ * If no workspace is provided then a temporary scratch buffer is allocated,
+ * otherwise the workspace is used for the scratch buffer.
+ */
+template <typename T, typename ConvType, typename Backend>
+SNNStatus launch_grouped_matmul(
+    typename Backend::template pointer_type<T const> input,
+    typename Backend::template pointer_type<T const> filter,
+    typename Backend::template pointer_type<T> output,
+    typename Backend::template pointer_type<T> workspace,
+    Conv2DParams const& params, size_t workspace_size, Backend& backend) {
+  using AllocatedPointer =
+      ::sycldnn::internal::helpers::AllocatedPointer<T, Backend>;
+  using InternalPointer =
+      ::sycldnn::internal::helpers::InternalPointer<T, Backend>;
+  InternalPointerSet<T, Backend> pointers{input, filter, output, backend};
+  size_t const scratch_size = get_grouped_matmul_size<ConvType>(params);
+
+  if (workspace_size == 0) {
+    AllocatedPointer scratch{sizeof(T) * scratch_size, backend};
+    return launch_grouped_matmul_with_scratch<T, ConvType>(
+        pointers.input.get(), pointers.filter.get(), pointers.output.get(),
+        scratch.get(), params, backend);
+  }
+  if (workspace_size < scratch_size) {
+    return StatusCode::InsufficientWorkspace;
+  }
+  InternalPointer scratch{workspace, backend};
+  return launch_grouped_matmul_with_scratch<T, ConvType>(
+      pointers.input.get(), pointers.filter.get(), pointers.output.get(),
+      scratch.get(), params, backend);
+}
+
 }  // namespace internal
 /**
  * Launch a matmul to compute a 1x1 2D convolution.
  *
  * Will extract the SYCL buffers and SYCL queue from the backend and forward
- * these on to the precompiled kernels.
+ * these on to the precompiled kernels. Grouped convolutions are computed with
+ * a batched matmul over the groups, which needs temporary memory. This is
+ * taken from the workspace if one is provided, or allocated through the
+ * backend otherwise.
  *
  * Returns an SNNStatus containing the SYCL event tied to the kernel launch.
  */
@@ -89,7 +264,8 @@ inline SNNStatus launch_matmul(
     typename Backend::template pointer_type<T const> input,
     typename Backend::template pointer_type<T const> filter,
     typename Backend::template pointer_type<T> output,
-    Conv2DParams const& params, Backend& backend) {
+    typename Backend::template pointer_type<T> workspace,
+    Conv2DParams const& params, size_t workspace_size, Backend& backend) {
   SNN_VALIDATE_PARAM(params.window_rows == 1,
                      "Matmul can only be used for 1x1 NHWC convolutions.");
   SNN_VALIDATE_PARAM(params.window_cols == 1,
@@ -103,6 +279,12 @@ inline SNNStatus launch_matmul(
   SNN_VALIDATE_PARAM(params.pad_cols == 0,
                      "Matmul can only be used with zero padding.");
 
+  if (params.groups != 1) {
+    SNN_VALIDATE_PARAM(params.input_format == DataFormat::NHWC,
+                       "Grouped matmul convolutions require NHWC tensors.");
+    return internal::launch_grouped_matmul<T, ConvType>(
+        input, filter, output, workspace, params, workspace_size, backend);
+  }
   return internal::MatmulLauncher<ConvType>::template launch<T>(
       input, filter, output, params, backend);
 }
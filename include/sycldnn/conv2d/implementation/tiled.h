@@ -17,6 +17,7 @@
 #define SYCLDNN_INCLUDE_CONV2D_TILED_H_
 
 #include "sycldnn/conv2d/conv_type.h"
+#include "sycldnn/conv2d/epilogue.h"
 #include "sycldnn/conv2d/params.h"
 #include "sycldnn/conv2d/sizes.h"
 
@@ -48,6 +49,33 @@ inline SNNStatus launch_tiled(
   return internal::launch_tiled<T, ConvType>(inp_access, fil_access, out_access,
                                              params, queue);
 }
+
+/**
+ * Launch the tiled implementation of a 2D forward convolution, applying the
+ * bias and activation given in the epilogue as the output is written.
+ *
+ * Returns an SNNStatus containing the SYCL event tied to the kernel launch.
+ */
+template <typename T, typename ConvType, typename Backend>
+inline SNNStatus launch_tiled(
+    typename Backend::template pointer_type<T const> input,
+    typename Backend::template pointer_type<T const> filter,
+    typename Backend::template pointer_type<T const> bias,
+    typename Backend::template pointer_type<T> output,
+    Conv2DParams const& params, EpilogueParams const& epilogue,
+    Backend& backend) {
+  auto conv_sizes = get_sizes<ConvType>(params);
+
+  auto inp_access = backend.get_mem_object(input, conv_sizes.input_size);
+  auto fil_access = backend.get_mem_object(filter, conv_sizes.filter_size);
+  auto bias_access = backend.get_mem_object(bias, params.features);
+  auto out_access = backend.get_mem_object(output, conv_sizes.output_size);
+
+  cl::sycl::queue queue = backend.get_queue();
+  return internal::launch_tiled<T, ConvType>(inp_access, fil_access,
+                                             bias_access, out_access, params,
+                                             epilogue, queue);
+}
 }  // namespace conv2d
 }  // namespace sycldnn
 #endif  // SYCLDNN_INCLUDE_CONV2D_TILED_H_
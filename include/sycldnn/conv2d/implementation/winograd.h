@@ -16,6 +16,7 @@
 #ifndef SYCLDNN_INCLUDE_CONV2D_IMPLEMENTATION_WINOGRAD_H_
 #define SYCLDNN_INCLUDE_CONV2D_IMPLEMENTATION_WINOGRAD_H_
 
+#include "sycldnn/conv2d/epilogue.h"
 #include "sycldnn/conv2d/params.h"
 
 #include "sycldnn/internal/conv2d/winograd/launch.h"
@@ -63,6 +64,57 @@ inline SNNStatus launch_winograd_large(
       input, filter, output, workspace, params, workspace_size, backend);
 }
 
+/**
+ * Launch the forward 2D convolution using the Winograd implementation, fusing
+ * a bias add and activation into the output transform.
+ *
+ * \param input          Pointer to the input buffer
+ * \param filter         Pointer to the filter buffer
+ * \param bias           Pointer to the bias buffer, only read if the epilogue
+ *                       adds a bias
+ * \param output         Pointer to the output buffer
+ * \param workspace      Pointer to the workspace buffer
+ * \param params         Convolution parameters
+ * \param epilogue       Bias and activation to apply to the output
+ * \param workspace_size Number of elements available in the workspace
+ * \param backend        Backend to use to allocate temporary buffers and
+ *                       compute matrix multiplies
+ * \return An SNNStatus containing the SYCL event tied to the kernel launch.
+ */
+template <typename T, typename ConvType, typename Backend>
+inline SNNStatus launch_winograd(
+    typename Backend::template pointer_type<T const> input,
+    typename Backend::template pointer_type<T const> filter,
+    typename Backend::template pointer_type<T const> bias,
+    typename Backend::template pointer_type<T> output,
+    typename Backend::template pointer_type<T> workspace,
+    Conv2DParams const& params, EpilogueParams const& epilogue,
+    size_t workspace_size, Backend& backend) {
+  return internal::winograd::launch<T, ConvType>(input, filter, bias, output,
+                                                 workspace, params, epilogue,
+                                                 workspace_size, backend);
+}
+
+/**
+ * Special launcher to use larger tile sizes for Winograd, fusing a bias add
+ * and activation into the output transform.
+ *
+ * \copydetails launch_winograd
+ */
+template <typename T, typename ConvType, typename Backend>
+inline SNNStatus launch_winograd_large(
+    typename Backend::template pointer_type<T const> input,
+    typename Backend::template pointer_type<T const> filter,
+    typename Backend::template pointer_type<T const> bias,
+    typename Backend::template pointer_type<T> output,
+    typename Backend::template pointer_type<T> workspace,
+    Conv2DParams const& params, EpilogueParams const& epilogue,
+    size_t workspace_size, Backend& backend) {
+  return internal::winograd::launch_large<T, ConvType>(
+      input, filter, bias, output, workspace, params, epilogue, workspace_size,
+      backend);
+}
+
 }  // namespace conv2d
 }  // namespace sycldnn
 
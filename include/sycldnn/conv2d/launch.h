@@ -19,12 +19,18 @@
 /**
  * \file
  * Implements the \ref sycldnn::conv2d::launch() function, which asynchronously
- * dispatches the SYCL kernels required to perform a 2D convolution.
+ * dispatches the SYCL kernels required to perform a 2D convolution, along with
+ * overloads which fuse a bias add and activation into the convolution or use
+ * pre-transformed Winograd or pre-packed im2col filters, and the
+ * \ref sycldnn::conv2d::convert_filter() function to pre-convert FCHW filters.
  */
 #include "sycldnn/status.h"
 
 #include "sycldnn/conv2d/algorithm.h"
+#include "sycldnn/conv2d/epilogue.h"
+#include "sycldnn/conv2d/im2col_filter.h"
 #include "sycldnn/conv2d/params.h"
+#include "sycldnn/conv2d/winograd_filter.h"
 
 #include "sycldnn/conv2d/implementation/direct.h"
 #include "sycldnn/conv2d/implementation/im2col.h"
@@ -33,42 +39,25 @@
 #include "sycldnn/conv2d/implementation/winograd.h"
 #include "sycldnn/conv2d/selector/selector.h"
 
+#include "sycldnn/internal/conv2d/epilogue.h"
+#include "sycldnn/internal/conv2d/layout.h"
+
+#include "sycldnn/transpose/launch.h"
+
+#include <type_traits>
+
 namespace sycldnn {
 namespace conv2d {
+namespace internal {
 /**
- * Launch a 2D convolution, with the implementation chosen by the Selector.
- *
- * The selector will be used to select which implementation to use, and the
- * corresponding kernels will be launched. If any additional temporary memory is
- * required then it will be allocated through the backend.
+ * Check that the convolution parameters are valid for any of the convolution
+ * algorithms.
  *
- * \param input A pointer to the memory representing the input tensor.
- * \param filter A pointer to the memory representing the tensor of filter
- *               coefficients.
- * \param output A pointer to the memory representing the output tensor.
- * \param params The convolution parameters, which describe the tensor shapes
- *               and convolution strides.
- * \param selector An instance of \ref sycldnn::conv2d::Selector, used to guide
- *                 the selection of the most appropriate convolution algorithm
- *                 for a specific target platform or problem size.
- * \param backend The backend implementation, used to provide optimized matrix
- *                multiplies and to map between pointer representations.
- * \param workspace Optional pointer to a workspace buffer for use whenever
- *                  temporary memory is required.
- * \param workspace_size The number of elements available in the workspace
- *                       buffer.
- * \return Returns an SNNStatus containing the SYCL event tied to the kernel
- * launches and a StatusCode enum showing if the launch was OK or whether it
- * encountered some problem.
+ * \param params The convolution parameters to check.
+ * \return Returns StatusCode::InvalidParameter if any of the parameters are
+ *         invalid, otherwise StatusCode::OK.
  */
-template <typename T, typename ConvType, typename Backend>
-SNNStatus launch(typename Backend::template pointer_type<T const> input,
-                 typename Backend::template pointer_type<T const> filter,
-                 typename Backend::template pointer_type<T> output,
-                 Conv2DParams const& params, Selector& selector,
-                 Backend& backend,
-                 typename Backend::template pointer_type<T> workspace = {},
-                 size_t workspace_size = 0) {
+inline SNNStatus validate_params(Conv2DParams const& params) {
   SNN_VALIDATE_PARAM(params.batch > 0,
                      "The number of batches must be positive.");
   SNN_VALIDATE_PARAM(params.channels > 0,
@@ -96,44 +85,501 @@ SNNStatus launch(typename Backend::template pointer_type<T const> input,
   SNN_VALIDATE_PARAM(
       params.pad_cols >= 0,
       "The padding in the column direction must be non-negative.");
-  SNN_VALIDATE_PARAM(params.dilation_rows == 1,
-                     "Currently SYCL-DNN only supports dilation 1.");
-  SNN_VALIDATE_PARAM(params.dilation_cols == 1,
-                     "Currently SYCL-DNN only supports dilation 1.");
+  SNN_VALIDATE_PARAM(params.dilation_rows > 0,
+                     "The dilation in the row direction must be positive.");
+  SNN_VALIDATE_PARAM(
+      params.dilation_cols > 0,
+      "The dilation in the column direction must be positive.");
+  SNN_VALIDATE_PARAM(params.groups > 0,
+                     "The number of groups must be positive.");
+  SNN_VALIDATE_PARAM(params.channels % params.groups == 0,
+                     "The number of channels must be divisible by the number "
+                     "of groups.");
+  SNN_VALIDATE_PARAM(params.features % params.groups == 0,
+                     "The number of features must be divisible by the number "
+                     "of groups.");
+  int const channel_block = get_channel_block(params.input_format);
+  SNN_VALIDATE_PARAM(params.channels % channel_block == 0,
+                     "The number of channels must be divisible by the channel "
+                     "block size.");
+  SNN_VALIDATE_PARAM(params.features % channel_block == 0,
+                     "The number of features must be divisible by the channel "
+                     "block size.");
+  return StatusCode::OK;
+}
 
-  Algorithm algo_tag = selector.select<ConvType>(params);
+/**
+ * Check that the chosen convolution algorithm supports the layouts, dilation
+ * and groups given in the convolution parameters.
+ *
+ * \param params    The convolution parameters to check.
+ * \param algo_tag  The algorithm chosen to compute the convolution.
+ * \return Returns StatusCode::InvalidParameter if the layouts are invalid,
+ *         StatusCode::InvalidAlgorithm if the algorithm does not support the
+ *         parameters, otherwise StatusCode::OK.
+ */
+inline SNNStatus validate_algorithm(Conv2DParams const& params,
+                                    Algorithm algo_tag) {
   auto implies = [](bool x, bool y) { return !x || (x && y); };
   SNN_VALIDATE_PARAM(implies(params.input_format == DataFormat::NHWC,
                              params.filter_format == FilterFormat::HWCF),
                      "Unsupported layout combination.");
-  SNN_VALIDATE_PARAM(implies(params.input_format == DataFormat::NCHW,
-                             params.filter_format == FilterFormat::FCHW),
+  SNN_VALIDATE_PARAM(implies(is_channel_blocked(params.input_format),
+                             params.filter_format == FilterFormat::HWCF),
                      "Unsupported layout combination.");
-  if (params.input_format == DataFormat::NCHW &&
-      algo_tag != Algorithm::Direct) {
+  bool const is_dilated =
+      params.dilation_rows != 1 || params.dilation_cols != 1;
+  if (is_dilated && (algo_tag == Algorithm::Winograd ||
+                     algo_tag == Algorithm::WinogradLarge)) {
     return StatusCode::InvalidAlgorithm;
   }
+  bool const is_grouped = params.groups != 1;
+  if (is_grouped && algo_tag != Algorithm::Direct &&
+      algo_tag != Algorithm::Im2col && algo_tag != Algorithm::Matmul) {
+    return StatusCode::InvalidAlgorithm;
+  }
+  return StatusCode::OK;
+}
 
+/**
+ * Launch the kernels for a 2D convolution using the given algorithm.
+ *
+ * \param input          A pointer to the input tensor.
+ * \param filter         A pointer to the filter tensor.
+ * \param output         A pointer to the output tensor.
+ * \param params         The convolution parameters.
+ * \param algo_tag       The algorithm to use to compute the convolution.
+ * \param backend        The backend implementation.
+ * \param workspace      Optional pointer to a workspace buffer.
+ * \param workspace_size The number of elements available in the workspace.
+ * \return Returns an SNNStatus containing the SYCL event tied to the kernel
+ *         launches and a StatusCode enum showing if the launch was OK or
+ *         whether it encountered some problem.
+ */
+template <typename T, typename ConvType, typename Backend>
+SNNStatus launch_algorithm(
+    typename Backend::template pointer_type<T const> input,
+    typename Backend::template pointer_type<T const> filter,
+    typename Backend::template pointer_type<T> output,
+    Conv2DParams const& params, Algorithm algo_tag, Backend& backend,
+    typename Backend::template pointer_type<T> workspace,
+    size_t workspace_size) {
   switch (algo_tag) {
     case Algorithm::Direct:
-      return launch_direct<T, ConvType>(input, filter, output, params, backend);
+      return conv2d::launch_direct<T, ConvType>(input, filter, output, params,
+                                                backend);
     case Algorithm::Tiled:
-      return launch_tiled<T, ConvType>(input, filter, output, params, backend);
+      return conv2d::launch_tiled<T, ConvType>(input, filter, output, params,
+                                               backend);
     case Algorithm::Im2col:
-      return launch_im2col<T, ConvType>(input, filter, output, workspace,
-                                        params, workspace_size, backend);
+      return conv2d::launch_im2col<T, ConvType>(
+          input, filter, output, workspace, params, workspace_size, backend);
+    case Algorithm::Winograd:
+      return conv2d::launch_winograd<T, ConvType>(
+          input, filter, output, workspace, params, workspace_size, backend);
+    case Algorithm::WinogradLarge:
+      return conv2d::launch_winograd_large<T, ConvType>(
+          input, filter, output, workspace, params, workspace_size, backend);
+    case Algorithm::Matmul:
+      return conv2d::launch_matmul<T, ConvType>(
+          input, filter, output, workspace, params, workspace_size, backend);
+    case Algorithm::NotSupported:
+    default:
+      return StatusCode::InvalidAlgorithm;
+  }
+}
+
+/**
+ * Launch the kernels for a forward 2D convolution using the given algorithm,
+ * applying the epilogue to the output.
+ *
+ * \param input          A pointer to the input tensor.
+ * \param filter         A pointer to the filter tensor.
+ * \param bias           A pointer to the bias tensor.
+ * \param output         A pointer to the output tensor.
+ * \param params         The convolution parameters.
+ * \param epilogue       The bias and activation to apply to the output.
+ * \param algo_tag       The algorithm to use to compute the convolution.
+ * \param backend        The backend implementation.
+ * \param workspace      Optional pointer to a workspace buffer.
+ * \param workspace_size The number of elements available in the workspace.
+ * \return Returns an SNNStatus containing the SYCL event tied to the kernel
+ *         launches and a StatusCode enum showing if the launch was OK or
+ *         whether it encountered some problem.
+ */
+template <typename T, typename ConvType, typename Backend>
+SNNStatus launch_algorithm(
+    typename Backend::template pointer_type<T const> input,
+    typename Backend::template pointer_type<T const> filter,
+    typename Backend::template pointer_type<T const> bias,
+    typename Backend::template pointer_type<T> output,
+    Conv2DParams const& params, EpilogueParams const& epilogue,
+    Algorithm algo_tag, Backend& backend,
+    typename Backend::template pointer_type<T> workspace,
+    size_t workspace_size) {
+  SNNStatus conv_status;
+  switch (algo_tag) {
+    case Algorithm::Direct:
+      return conv2d::launch_direct<T, ConvType>(input, filter, bias, output,
+                                                params, epilogue, backend);
+    case Algorithm::Tiled:
+      return conv2d::launch_tiled<T, ConvType>(input, filter, bias, output,
+                                               params, epilogue, backend);
     case Algorithm::Winograd:
-      return launch_winograd<T, ConvType>(input, filter, output, workspace,
-                                          params, workspace_size, backend);
+      return conv2d::launch_winograd<T, ConvType>(
+          input, filter, bias, output, workspace, params, epilogue,
+          workspace_size, backend);
     case Algorithm::WinogradLarge:
-      return launch_winograd_large<T, ConvType>(
+      return conv2d::launch_winograd_large<T, ConvType>(
+          input, filter, bias, output, workspace, params, epilogue,
+          workspace_size, backend);
+    case Algorithm::Im2col:
+      conv_status = conv2d::launch_im2col<T, ConvType>(
           input, filter, output, workspace, params, workspace_size, backend);
+      break;
     case Algorithm::Matmul:
-      return launch_matmul<T, ConvType>(input, filter, output, params, backend);
+      conv_status = conv2d::launch_matmul<T, ConvType>(
+          input, filter, output, workspace, params, workspace_size, backend);
+      break;
     case Algorithm::NotSupported:
     default:
       return StatusCode::InvalidAlgorithm;
   }
+  if (conv_status.status != StatusCode::OK || !is_enabled(epilogue)) {
+    return conv_status;
+  }
+  return launch_epilogue<T>(bias, output, epilogue, params, backend);
+}
+}  // namespace internal
+
+/**
+ * Launch a 2D convolution, with the implementation chosen by the Selector.
+ *
+ * The selector will be used to select which implementation to use, and the
+ * corresponding kernels will be launched. If any additional temporary memory is
+ * required then it will be allocated through the backend.
+ *
+ * Only the Direct algorithm computes NCHW convolutions natively. The other
+ * algorithms transpose NCHW tensors into temporary NHWC tensors, compute the
+ * convolution on those and transpose the result back into the output. The
+ * channel blocked NCHWc formats must be used with HWCF filters. The forward
+ * Direct and Tiled algorithms index them natively, while every other
+ * convolution converts them in the same way as NCHW. The temporary tensors are
+ * held in the workspace if it is large enough, see
+ * \ref sycldnn::conv2d::query_workspace_size().
+ *
+ * An NCHW convolution can also be given a filter which has already been
+ * converted to HWCF with \ref sycldnn::conv2d::convert_filter(), by setting
+ * the filter format to HWCF. This avoids transposing the filter in every
+ * launch, but always computes the convolution on NHWC tensors.
+ *
+ * \param input A pointer to the memory representing the input tensor.
+ * \param filter A pointer to the memory representing the tensor of filter
+ *               coefficients.
+ * \param output A pointer to the memory representing the output tensor.
+ * \param params The convolution parameters, which describe the tensor shapes
+ *               and convolution strides.
+ * \param selector An instance of \ref sycldnn::conv2d::Selector, used to guide
+ *                 the selection of the most appropriate convolution algorithm
+ *                 for a specific target platform or problem size.
+ * \param backend The backend implementation, used to provide optimized matrix
+ *                multiplies and to map between pointer representations.
+ * \param workspace Optional pointer to a workspace buffer for use whenever
+ *                  temporary memory is required.
+ * \param workspace_size The number of elements available in the workspace
+ *                       buffer.
+ * \return Returns an SNNStatus containing the SYCL event tied to the kernel
+ * launches and a StatusCode enum showing if the launch was OK or whether it
+ * encountered some problem.
+ */
+template <typename T, typename ConvType, typename Backend>
+SNNStatus launch(typename Backend::template pointer_type<T const> input,
+                 typename Backend::template pointer_type<T const> filter,
+                 typename Backend::template pointer_type<T> output,
+                 Conv2DParams const& params, Selector& selector,
+                 Backend& backend,
+                 typename Backend::template pointer_type<T> workspace = {},
+                 size_t workspace_size = 0) {
+  auto validation = internal::validate_params(params);
+  if (validation.status != StatusCode::OK) {
+    return validation;
+  }
+
+  Algorithm algo_tag = selector.select<ConvType>(params);
+  auto algo_status = internal::validate_algorithm(params, algo_tag);
+  if (algo_status.status != StatusCode::OK) {
+    return algo_status;
+  }
+
+  if (internal::requires_nhwc<ConvType>(params, algo_tag)) {
+    using ConstPointer = typename Backend::template pointer_type<T const>;
+    using Pointer = typename Backend::template pointer_type<T>;
+    size_t const algo_size =
+        internal::algorithm_workspace_size<ConvType>(
+            internal::get_nhwc_params(params), algo_tag)
+            .required_size;
+    return internal::launch_via_nhwc<T, ConvType>(
+        input, filter, output, workspace, params, workspace_size, algo_size,
+        backend,
+        [&](ConstPointer nhwc_input, ConstPointer nhwc_filter,
+            Pointer nhwc_output, Pointer nhwc_workspace,
+            size_t nhwc_workspace_size, Conv2DParams const& nhwc_params) {
+          return internal::launch_algorithm<T, ConvType>(
+              nhwc_input, nhwc_filter, nhwc_output, nhwc_params, algo_tag,
+              backend, nhwc_workspace, nhwc_workspace_size);
+        });
+  }
+  return internal::launch_algorithm<T, ConvType>(
+      input, filter, output, params, algo_tag, backend, workspace,
+      workspace_size);
+}
+
+/**
+ * Launch a forward 2D convolution, with the implementation chosen by the
+ * Selector, applying a bias add and activation to the output.
+ *
+ * The Direct, Tiled and Winograd algorithms apply the epilogue in their kernels
+ * as the output is written. The Im2col and Matmul algorithms compute the output
+ * with a matrix multiply provided by the backend, so the epilogue is applied in
+ * an additional kernel once the convolution is complete. For tensors which are
+ * converted to NHWC the epilogue is applied before the output is converted
+ * back.
+ *
+ * \param input A pointer to the memory representing the input tensor.
+ * \param filter A pointer to the memory representing the tensor of filter
+ *               coefficients.
+ * \param bias A pointer to the memory representing the bias tensor, holding one
+ *             value per output feature. Only read if the epilogue adds a bias.
+ * \param output A pointer to the memory representing the output tensor.
+ * \param params The convolution parameters, which describe the tensor shapes
+ *               and convolution strides.
+ * \param epilogue The bias and activation to apply to the output.
+ * \param selector An instance of \ref sycldnn::conv2d::Selector, used to guide
+ *                 the selection of the most appropriate convolution algorithm
+ *                 for a specific target platform or problem size.
+ * \param backend The backend implementation, used to provide optimized matrix
+ *                multiplies and to map between pointer representations.
+ * \param workspace Optional pointer to a workspace buffer for use whenever
+ *                  temporary memory is required.
+ * \param workspace_size The number of elements available in the workspace
+ *                       buffer.
+ * \return Returns an SNNStatus containing the SYCL event tied to the kernel
+ * launches and a StatusCode enum showing if the launch was OK or whether it
+ * encountered some problem.
+ */
+template <typename T, typename ConvType, typename Backend>
+SNNStatus launch(typename Backend::template pointer_type<T const> input,
+                 typename Backend::template pointer_type<T const> filter,
+                 typename Backend::template pointer_type<T const> bias,
+                 typename Backend::template pointer_type<T> output,
+                 Conv2DParams const& params, EpilogueParams const& epilogue,
+                 Selector& selector, Backend& backend,
+                 typename Backend::template pointer_type<T> workspace = {},
+                 size_t workspace_size = 0) {
+  static_assert(std::is_same<ConvType, conv_type::Forward>::value,
+                "An epilogue can only be applied to a forward convolution.");
+  auto validation = internal::validate_params(params);
+  if (validation.status != StatusCode::OK) {
+    return validation;
+  }
+  SNN_VALIDATE_PARAM(epilogue.activation != Activation::Clamp ||
+                         epilogue.clamp_min <= epilogue.clamp_max,
+                     "The clamp lower bound must not exceed the upper bound.");
+
+  Algorithm algo_tag = selector.select<ConvType>(params);
+  auto algo_status = internal::validate_algorithm(params, algo_tag);
+  if (algo_status.status != StatusCode::OK) {
+    return algo_status;
+  }
+
+  // The bias pointer is only read when the epilogue adds a bias, but the
+  // kernels still need a valid buffer to bind, so use the filter in its place.
+  auto bias_ptr = epilogue.bias ? bias : filter;
+  if (internal::requires_nhwc<ConvType>(params, algo_tag)) {
+    using ConstPointer = typename Backend::template pointer_type<T const>;
+    using Pointer = typename Backend::template pointer_type<T>;
+    size_t const algo_size =
+        internal::algorithm_workspace_size<ConvType>(
+            internal::get_nhwc_params(params), algo_tag)
+            .required_size;
+    return internal::launch_via_nhwc<T, ConvType>(
+        input, filter, output, workspace, params, workspace_size, algo_size,
+        backend,
+        [&](ConstPointer nhwc_input, ConstPointer nhwc_filter,
+            Pointer nhwc_output, Pointer nhwc_workspace,
+            size_t nhwc_workspace_size, Conv2DParams const& nhwc_params) {
+          return internal::launch_algorithm<T, ConvType>(
+              nhwc_input, nhwc_filter, bias_ptr, nhwc_output, nhwc_params,
+              epilogue, algo_tag, backend, nhwc_workspace,
+              nhwc_workspace_size);
+        });
+  }
+  return internal::launch_algorithm<T, ConvType>(
+      input, filter, bias_ptr, output, params, epilogue, algo_tag, backend,
+      workspace, workspace_size);
+}
+
+/**
+ * Convert an FCHW filter to the HWCF layout used by the convolution kernels.
+ *
+ * The converted filter can be passed to \ref sycldnn::conv2d::launch() for an
+ * NCHW convolution whose filter format is set to HWCF, so that the filter is
+ * not transposed again in every launch.
+ *
+ * \param filter  A pointer to the memory representing the FCHW filter.
+ * \param output  A pointer to the memory to hold the HWCF filter.
+ * \param params  The convolution parameters the filter will be used with,
+ *                with the filter format set to FCHW.
+ * \param backend The backend implementation, used to map between pointer
+ *                representations.
+ * \return Returns an SNNStatus containing the SYCL event tied to the transpose
+ * kernel and a StatusCode enum showing if the launch was OK or whether it
+ * encountered some problem.
+ */
+template <typename T, typename Backend>
+SNNStatus convert_filter(
+    typename Backend::template pointer_type<T const> filter,
+    typename Backend::template pointer_type<T> output,
+    Conv2DParams const& params, Backend& backend) {
+  auto validation = internal::validate_params(params);
+  if (validation.status != StatusCode::OK) {
+    return validation;
+  }
+  SNN_VALIDATE_PARAM(params.filter_format == FilterFormat::FCHW,
+                     "Only FCHW filters can be converted to HWCF.");
+  auto const filter_tr = internal::to_hwcf(params);
+  return transpose::launch<T>(filter, output, filter_tr.dimensions,
+                              filter_tr.permutation, backend);
+}
+
+/**
+ * Launch a 2D Winograd convolution using a filter which has already been
+ * transformed with \ref sycldnn::conv2d::transform_winograd_filter().
+ *
+ * The filter transform is skipped, so only the input transform, batched matrix
+ * multiply and output transform kernels are launched. If any additional
+ * temporary memory is required then it will be allocated through the backend.
+ *
+ * As with the untransformed Winograd convolution, only unit stride, undilated
+ * convolutions are supported, otherwise StatusCode::InvalidAlgorithm is
+ * returned.
+ *
+ * \param input A pointer to the memory representing the input tensor.
+ * \param filter The pre-transformed filter. This must have been transformed
+ *               for convolution parameters with the same filter shape as
+ *               params.
+ * \param output A pointer to the memory representing the output tensor.
+ * \param params The convolution parameters, which describe the tensor shapes
+ *               and convolution strides.
+ * \param backend The backend implementation, used to provide optimized matrix
+ *                multiplies and to map between pointer representations.
+ * \param workspace Optional pointer to a workspace buffer for use whenever
+ *                  temporary memory is required.
+ * \param workspace_size The number of elements available in the workspace
+ *                       buffer.
+ * \return Returns an SNNStatus containing the SYCL event tied to the kernel
+ * launches and a StatusCode enum showing if the launch was OK or whether it
+ * encountered some problem.
+ */
+template <typename T, typename ConvType, typename Backend>
+SNNStatus launch(typename Backend::template pointer_type<T const> input,
+                 WinogradFilter<T, ConvType, Backend> const& filter,
+                 typename Backend::template pointer_type<T> output,
+                 Conv2DParams const& params, Backend& backend,
+                 typename Backend::template pointer_type<T> workspace = {},
+                 size_t workspace_size = 0) {
+  auto validation = internal::validate_params(params);
+  if (validation.status != StatusCode::OK) {
+    return validation;
+  }
+  auto const& filter_params = filter.params();
+  SNN_VALIDATE_PARAM(filter_params.channels == params.channels,
+                     "The transformed filter has a different number of "
+                     "channels to the convolution.");
+  SNN_VALIDATE_PARAM(filter_params.features == params.features,
+                     "The transformed filter has a different number of "
+                     "features to the convolution.");
+  SNN_VALIDATE_PARAM(filter_params.window_rows == params.window_rows &&
+                         filter_params.window_cols == params.window_cols,
+                     "The transformed filter has a different window size to "
+                     "the convolution.");
+  SNN_VALIDATE_PARAM(filter_params.groups == params.groups,
+                     "The transformed filter has a different number of groups "
+                     "to the convolution.");
+  // The Winograd transforms only compute unit stride, undilated outputs.
+  bool const is_unit_stride =
+      params.stride_rows == 1 && params.stride_cols == 1;
+  bool const is_dilated =
+      params.dilation_rows != 1 || params.dilation_cols != 1;
+  if (!filter.is_valid() || params.input_format != DataFormat::NHWC ||
+      params.groups != 1 || !is_unit_stride || is_dilated) {
+    return StatusCode::InvalidAlgorithm;
+  }
+
+  if (filter.algorithm() == Algorithm::WinogradLarge) {
+    return internal::winograd::launch_transformed_large<T, ConvType>(
+        input, filter.get(), output, workspace, params, workspace_size,
+        backend);
+  }
+  return internal::winograd::launch_transformed<T, ConvType>(
+      input, filter.get(), output, workspace, params, workspace_size, backend);
+}
+
+/**
+ * Launch a 2D im2col convolution using a filter which has already been packed
+ * with \ref sycldnn::conv2d::pack_im2col_filter().
+ *
+ * The filter packing is skipped, so only the input transform and matrix
+ * multiply are launched. If any additional temporary memory is required then
+ * it will be allocated through the backend.
+ *
+ * \param input A pointer to the memory representing the input tensor.
+ * \param filter The pre-packed filter. This must have been packed for
+ *               convolution parameters with the same filter shape as params.
+ * \param output A pointer to the memory representing the output tensor.
+ * \param params The convolution parameters, which describe the tensor shapes
+ *               and convolution strides.
+ * \param backend The backend implementation, used to provide optimized matrix
+ *                multiplies and to map between pointer representations.
+ * \param workspace Optional pointer to a workspace buffer for use whenever
+ *                  temporary memory is required.
+ * \param workspace_size The number of elements available in the workspace
+ *                       buffer.
+ * \return Returns an SNNStatus containing the SYCL event tied to the kernel
+ * launches and a StatusCode enum showing if the launch was OK or whether it
+ * encountered some problem.
+ */
+template <typename T, typename ConvType, typename Backend>
+SNNStatus launch(typename Backend::template pointer_type<T const> input,
+                 Im2colFilter<T, ConvType, Backend> const& filter,
+                 typename Backend::template pointer_type<T> output,
+                 Conv2DParams const& params, Backend& backend,
+                 typename Backend::template pointer_type<T> workspace = {},
+                 size_t workspace_size = 0) {
+  auto validation = internal::validate_params(params);
+  if (validation.status != StatusCode::OK) {
+    return validation;
+  }
+  auto const& filter_params = filter.params();
+  SNN_VALIDATE_PARAM(filter_params.channels == params.channels,
+                     "The packed filter has a different number of channels "
+                     "to the convolution.");
+  SNN_VALIDATE_PARAM(filter_params.features == params.features,
+                     "The packed filter has a different number of features "
+                     "to the convolution.");
+  SNN_VALIDATE_PARAM(filter_params.window_rows == params.window_rows &&
+                         filter_params.window_cols == params.window_cols,
+                     "The packed filter has a different window size to the "
+                     "convolution.");
+  SNN_VALIDATE_PARAM(filter_params.groups == params.groups,
+                     "The packed filter has a different number of groups to "
+                     "the convolution.");
+  if (!filter.is_valid() || params.input_format != DataFormat::NHWC) {
+    return StatusCode::InvalidAlgorithm;
+  }
+
+  return internal::launch_im2col_packed<T, ConvType>(
+      input, filter.get(), output, workspace, params, workspace_size, backend);
 }
 }  // namespace conv2d
 }  // namespace sycldnn
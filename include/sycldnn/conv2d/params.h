@@ -94,6 +94,17 @@ struct Conv2DParams {
    */
   Index dilation_cols = 1;
 
+  /**
+   * The number of groups to split the channels and features into. Each group
+   * of features is computed using only the corresponding group of channels,
+   * so both channels and features must be divisible by the number of groups.
+   *
+   * The filter tensor holds channels / groups channels for each feature, so
+   * an HWCF filter has shape [window_rows, window_cols, channels / groups,
+   * features].
+   */
+  Index groups = 1;
+
   /** The data format used in the input and output tensors. */
   sycldnn::DataFormat input_format = sycldnn::DataFormat::NHWC;
 
@@ -0,0 +1,119 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef SYCLDNN_INCLUDE_CONV2D_SELECTOR_ALGORITHM_CACHE_H_
+#define SYCLDNN_INCLUDE_CONV2D_SELECTOR_ALGORITHM_CACHE_H_
+
+/**
+ * \file
+ * Contains the declaration of the \ref sycldnn::conv2d::AlgorithmCache class,
+ * which stores the convolution algorithms chosen for a set of convolution
+ * parameters and persists them to a file on disk.
+ */
+#include "sycldnn/conv2d/algorithm.h"
+#include "sycldnn/conv2d/params.h"
+
+#include <string>
+#include <unordered_map>
+
+#include "sycldnn/export.h"
+
+namespace sycldnn {
+namespace conv2d {
+
+/**
+ * Get a string representation of an algorithm.
+ * \param algo The algorithm to get the name of.
+ * \return Returns a character string containing the algorithm name.
+ */
+SNN_EXPORT char const* to_string(Algorithm algo);
+
+/**
+ * Parse an algorithm from its string representation, as given by
+ * \ref sycldnn::conv2d::to_string(Algorithm).
+ * \param name The name of the algorithm.
+ * \return Returns the matching algorithm, or Algorithm::NotSupported if the
+ *         name is not recognised.
+ */
+SNN_EXPORT Algorithm algorithm_from_string(std::string const& name);
+
+/**
+ * Construct a key uniquely identifying a convolution on a given device.
+ * \param device_id A string identifying the device and driver.
+ * \param data_type A string identifying the data type of the tensors.
+ * \param conv_type A string identifying the convolution type.
+ * \param params    The convolution parameters.
+ * \return Returns a string which can be used as a key in an AlgorithmCache.
+ */
+SNN_EXPORT std::string make_algorithm_cache_key(std::string const& device_id,
+                                                std::string const& data_type,
+                                                std::string const& conv_type,
+                                                Conv2DParams const& params);
+
+/**
+ * Cache of convolution algorithms, backed by a file on disk.
+ *
+ * Each line of the cache file contains a key, as given by
+ * \ref sycldnn::conv2d::make_algorithm_cache_key, followed by a tab and the
+ * name of the algorithm to use. New entries are appended to the file as they
+ * are added, so the cache can be shared between processes and reused on
+ * subsequent runs.
+ */
+class SNN_EXPORT AlgorithmCache {
+ public:
+  /**
+   * Construct a cache backed by the given file. Any existing entries in the
+   * file are loaded. If the filename is empty then the cache is only held in
+   * memory.
+   * \param filename The path to the cache file.
+   */
+  explicit AlgorithmCache(std::string filename);
+
+  /**
+   * Look up the algorithm stored for a key.
+   * \param key The key to search for.
+   * \return Returns the cached algorithm, or Algorithm::NotSupported if there
+   *         is no entry for the key.
+   */
+  Algorithm lookup(std::string const& key) const;
+
+  /**
+   * Add an entry to the cache, and write it to the cache file.
+   * \param key  The key to store the algorithm under.
+   * \param algo The algorithm to store.
+   * \return Returns true if the entry was successfully written to the file.
+   */
+  bool insert(std::string const& key, Algorithm algo);
+
+  /**
+   * Get the number of entries in the cache.
+   * \return The number of entries in the cache.
+   */
+  size_t size() const { return entries_.size(); }
+
+ private:
+  /** Load all entries in the cache file into memory. */
+  void load();
+
+  /** Path to the cache file. */
+  std::string filename_;
+
+  /** In-memory copy of the cache entries. */
+  std::unordered_map<std::string, Algorithm> entries_;
+};
+
+}  // namespace conv2d
+}  // namespace sycldnn
+#endif  // SYCLDNN_INCLUDE_CONV2D_SELECTOR_ALGORITHM_CACHE_H_
@@ -0,0 +1,328 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef SYCLDNN_INCLUDE_CONV2D_SELECTOR_AUTOTUNE_SELECTOR_H_
+#define SYCLDNN_INCLUDE_CONV2D_SELECTOR_AUTOTUNE_SELECTOR_H_
+
+/**
+ * \file
+ * Contains the definition of the \ref sycldnn::conv2d::AutotuneSelector class.
+ * This concrete implementation of \ref sycldnn::conv2d::Selector times each
+ * applicable convolution algorithm on the target device the first time a set
+ * of parameters is seen, and caches the fastest choice on disk.
+ */
+#include "sycldnn/status.h"
+
+#include "sycldnn/conv2d/algorithm.h"
+#include "sycldnn/conv2d/conv_type.h"
+#include "sycldnn/conv2d/launch.h"
+#include "sycldnn/conv2d/params.h"
+#include "sycldnn/conv2d/sizes.h"
+#include "sycldnn/conv2d/workspace_size.h"
+
+#include "sycldnn/conv2d/selector/algorithm_cache.h"
+#include "sycldnn/conv2d/selector/matmul_selector.h"
+#include "sycldnn/conv2d/selector/selector.h"
+#include "sycldnn/conv2d/selector/tiled_selector.h"
+#include "sycldnn/conv2d/selector/winograd_selector.h"
+
+#include "sycldnn/internal/helpers/allocated_pointer.h"
+#include "sycldnn/internal/helpers/type_name.h"
+
+#include "sycldnn/helpers/macros.h"
+
+#include <algorithm>
+#include <chrono>
+#include <limits>
+#include <memory>
+#include <string>
+#include <utility>
+
+#include <CL/sycl.hpp>
+
+namespace sycldnn {
+namespace conv2d {
+namespace internal {
+
+/** Get a short name for a convolution type, used in algorithm cache keys. */
+template <typename ConvType>
+struct ConvTypeName;
+
+/** \copydoc ConvTypeName */
+template <>
+struct ConvTypeName<conv_type::Forward> {
+  /** Name of the convolution type. */
+  static constexpr char const* value = "Forward";
+};
+
+/** \copydoc ConvTypeName */
+template <>
+struct ConvTypeName<conv_type::InputBackprop> {
+  /** Name of the convolution type. */
+  static constexpr char const* value = "InputBackprop";
+};
+
+/** \copydoc ConvTypeName */
+template <>
+struct ConvTypeName<conv_type::FilterBackprop> {
+  /** Name of the convolution type. */
+  static constexpr char const* value = "FilterBackprop";
+};
+
+/** A selector which always returns the algorithm it was constructed with. */
+class FixedSelector final : public Selector {
+ public:
+  /**
+   * Construct a selector which always returns the given algorithm.
+   * \param algo The algorithm to return.
+   */
+  explicit FixedSelector(Algorithm algo) : algo_{algo} {}
+
+  /** \copydoc Selector::select_forward */
+  Algorithm select_forward(Conv2DParams const& params) override {
+    SNN_UNUSED_VAR(params)
+    return algo_;
+  }
+
+  /** \copydoc Selector::select_input_backprop */
+  Algorithm select_input_backprop(Conv2DParams const& params) override {
+    SNN_UNUSED_VAR(params)
+    return algo_;
+  }
+
+  /** \copydoc Selector::select_filter_backprop */
+  Algorithm select_filter_backprop(Conv2DParams const& params) override {
+    SNN_UNUSED_VAR(params)
+    return algo_;
+  }
+
+  /** \copydoc Selector::name */
+  char const* name() const override { return to_string(algo_); }
+
+ private:
+  Algorithm algo_;
+};
+
+}  // namespace internal
+
+/**
+ * A selector which empirically chooses the fastest convolution algorithm.
+ *
+ * The first time a set of convolution parameters is passed to the selector,
+ * every algorithm which supports those parameters is run on the backend's
+ * device and timed. The fastest algorithm is returned, and stored in an
+ * \ref sycldnn::conv2d::AlgorithmCache keyed on the device name, driver
+ * version, data type and convolution parameters. Providing a cache file allows
+ * these choices to be reused in subsequent runs without timing the
+ * convolutions again.
+ *
+ * Any algorithm which fails to launch is skipped. If no algorithm can be timed
+ * then the choice is deferred to the fallback selector, and is not cached.
+ *
+ * \tparam T       The data type used in the convolutions.
+ * \tparam Backend The backend used to allocate temporary buffers and launch
+ *                 the convolutions.
+ */
+template <typename T, typename Backend>
+class AutotuneSelector final : public Selector {
+ public:
+  /**
+   * Construct an autotuning selector.
+   * \param backend    The backend to use to run the timed convolutions.
+   * \param fallback   Selector used when no algorithm can be timed.
+   * \param cache_file Path to the file used to persist the algorithm choices.
+   *                   If empty then the choices are only cached in memory.
+   * \param n_reps     Number of timed runs of each algorithm. The fastest run
+   *                   is used to compare the algorithms.
+   */
+  AutotuneSelector(Backend& backend, std::unique_ptr<Selector> fallback,
+                   std::string cache_file = "", int n_reps = 3)
+      : backend_{backend},
+        fallback_{std::move(fallback)},
+        cache_{std::move(cache_file)},
+        device_id_{get_device_id(backend.get_queue().get_device())},
+        n_reps_{std::max(n_reps, 1)} {}
+
+  /** \copydoc Selector::select_forward */
+  Algorithm select_forward(Conv2DParams const& params) override {
+    return select_impl<conv_type::Forward>(params);
+  }
+
+  /** \copydoc Selector::select_input_backprop */
+  Algorithm select_input_backprop(Conv2DParams const& params) override {
+    return select_impl<conv_type::InputBackprop>(params);
+  }
+
+  /** \copydoc Selector::select_filter_backprop */
+  Algorithm select_filter_backprop(Conv2DParams const& params) override {
+    return select_impl<conv_type::FilterBackprop>(params);
+  }
+
+  /** \copydoc Selector::name */
+  char const* name() const override { return "AutotuneSelector"; }
+
+ private:
+  using Pointer = typename Backend::template pointer_type<T>;
+  using ConstPointer = typename Backend::template pointer_type<T const>;
+  using Allocation = sycldnn::internal::helpers::AllocatedPointer<T, Backend>;
+
+  /** Get a string identifying the device and driver version. */
+  static std::string get_device_id(cl::sycl::device const& device) {
+    return device.get_info<cl::sycl::info::device::name>() + " (" +
+           device.get_info<cl::sycl::info::device::driver_version>() + ")";
+  }
+
+  /** Look up the algorithm in the cache, or time all algorithms if missing. */
+  template <typename ConvType>
+  Algorithm select_impl(Conv2DParams const& params) {
+    auto key = make_algorithm_cache_key(
+        device_id_, sycldnn::internal::helpers::TypeName<T>::value,
+        internal::ConvTypeName<ConvType>::value, params);
+    auto cached = cache_.lookup(key);
+    if (cached != Algorithm::NotSupported) {
+      return cached;
+    }
+    auto fastest = tune<ConvType>(params);
+    if (fastest == Algorithm::NotSupported) {
+      return fallback_->template select<ConvType>(params);
+    }
+    cache_.insert(key, fastest);
+    return fastest;
+  }
+
+  /** Get whether the given algorithm supports the convolution parameters. */
+  template <typename ConvType>
+  static bool is_supported(Algorithm algo, Conv2DParams const& params) {
+    // Only the direct, im2col and matmul convolutions support groups.
+    if (params.groups != 1 && algo != Algorithm::Direct &&
+        algo != Algorithm::Im2col && algo != Algorithm::Matmul) {
+      return false;
+    }
+    switch (algo) {
+      case Algorithm::Direct:
+      case Algorithm::Im2col:
+        return true;
+      case Algorithm::Tiled:
+        return TiledSelector{}.select<ConvType>(params) == algo;
+      case Algorithm::Winograd:
+        return WinogradSelector{}.select<ConvType>(params) == algo;
+      case Algorithm::WinogradLarge:
+        return WinogradLargeSelector{}.select<ConvType>(params) == algo;
+      case Algorithm::Matmul:
+        return MatmulSelector{}.select<ConvType>(params) == algo;
+      case Algorithm::NotSupported:
+      default:
+        return false;
+    }
+  }
+
+  /** Time all supported algorithms and return the fastest. */
+  template <typename ConvType>
+  Algorithm tune(Conv2DParams const& params) {
+    auto const sizes = get_sizes<ConvType>(params);
+    Allocation input{sizeof(T) * sizes.input_size, backend_};
+    Allocation filter{sizeof(T) * sizes.filter_size, backend_};
+    Allocation output{sizeof(T) * sizes.output_size, backend_};
+    zero_buffer(input.get(), sizes.input_size);
+    zero_buffer(filter.get(), sizes.filter_size);
+    zero_buffer(output.get(), sizes.output_size);
+
+    Algorithm fastest = Algorithm::NotSupported;
+    double fastest_time = std::numeric_limits<double>::max();
+    for (auto algo :
+         {Algorithm::Direct, Algorithm::Tiled, Algorithm::Im2col,
+          Algorithm::Winograd, Algorithm::WinogradLarge, Algorithm::Matmul}) {
+      if (!is_supported<ConvType>(algo, params)) {
+        continue;
+      }
+      double time = time_algorithm<ConvType>(algo, input.get(), filter.get(),
+                                             output.get(), params);
+      if (time < fastest_time) {
+        fastest_time = time;
+        fastest = algo;
+      }
+    }
+    return fastest;
+  }
+
+  /**
+   * Time the given algorithm, returning the fastest time in seconds over all
+   * runs or the maximum double value if the algorithm could not be launched.
+   */
+  template <typename ConvType>
+  double time_algorithm(Algorithm algo, Pointer input, Pointer filter,
+                        Pointer output, Conv2DParams const& params) {
+    auto const failed = std::numeric_limits<double>::max();
+    internal::FixedSelector selector{algo};
+    auto workspace_size =
+        internal::query_workspace_size<ConvType>(params, algo).recommended_size;
+    try {
+      std::unique_ptr<Allocation> workspace;
+      if (workspace_size > 0) {
+        workspace.reset(new Allocation{sizeof(T) * workspace_size, backend_});
+      }
+      auto run = [&]() {
+        return launch<T, ConvType>(
+            ConstPointer{input}, ConstPointer{filter}, output, params,
+            selector, backend_, workspace ? workspace->get() : Pointer{},
+            workspace_size);
+      };
+      // The first launch includes any kernel compilation, so is not timed.
+      auto status = run();
+      if (status.status != StatusCode::OK) {
+        return failed;
+      }
+      status.event.wait_and_throw();
+
+      double best = failed;
+      for (int i = 0; i < n_reps_; ++i) {
+        auto start = std::chrono::high_resolution_clock::now();
+        status = run();
+        status.event.wait_and_throw();
+        auto end = std::chrono::high_resolution_clock::now();
+        best = std::min(
+            best, std::chrono::duration<double>(end - start).count());
+      }
+      return best;
+    } catch (cl::sycl::exception const&) {
+      return failed;
+    } catch (std::exception const&) {
+      return failed;
+    }
+  }
+
+  /** Fill a temporary buffer with zeros. */
+  void zero_buffer(Pointer ptr, size_t n_elems) {
+    if (n_elems == 0) {
+      return;
+    }
+    auto mem = backend_.get_mem_object_internal(ptr, n_elems);
+    auto event = backend_.get_queue().submit([&](cl::sycl::handler& cgh) {
+      auto acc = mem.write_accessor(cgh);
+      cgh.fill(acc.get_accessor(), T{0});
+    });
+    event.wait_and_throw();
+  }
+
+  Backend& backend_;
+  std::unique_ptr<Selector> fallback_;
+  AlgorithmCache cache_;
+  std::string device_id_;
+  int n_reps_;
+};
+
+}  // namespace conv2d
+}  // namespace sycldnn
+#endif  // SYCLDNN_INCLUDE_CONV2D_SELECTOR_AUTOTUNE_SELECTOR_H_
@@ -45,8 +45,8 @@ class MatmulSelector final : public Selector {
     bool right_stride = (params.stride_rows == 1 && params.stride_cols == 1);
     bool right_window = (params.window_rows == 1 && params.window_cols == 1);
     bool right_pad = (params.pad_rows == 0 && params.pad_cols == 0);
-    bool right_format = (params.input_format == DataFormat::NHWC &&
-                         params.filter_format == FilterFormat::HWCF);
+    bool right_format = (params.filter_format == FilterFormat::FCHW) ==
+                        (params.input_format == DataFormat::NCHW);
 
     if (right_stride && right_window && right_pad && right_format) {
       return Algorithm::Matmul;
@@ -67,8 +67,8 @@ class MatmulSelector final : public Selector {
     bool right_stride = (params.stride_rows == 1 && params.stride_cols == 1);
     bool right_window = (params.window_rows == 1 && params.window_cols == 1);
     bool right_pad = (params.pad_rows == 0 && params.pad_cols == 0);
-    bool right_format = (params.input_format == DataFormat::NHWC &&
-                         params.filter_format == FilterFormat::HWCF);
+    bool right_format = (params.filter_format == FilterFormat::FCHW) ==
+                        (params.input_format == DataFormat::NCHW);
 
     if (right_stride && right_window && right_pad && right_format) {
       return Algorithm::Matmul;
@@ -89,8 +89,8 @@ class MatmulSelector final : public Selector {
     bool right_stride = (params.stride_rows == 1 && params.stride_cols == 1);
     bool right_window = (params.window_rows == 1 && params.window_cols == 1);
     bool right_pad = (params.pad_rows == 0 && params.pad_cols == 0);
-    bool right_format = (params.input_format == DataFormat::NHWC &&
-                         params.filter_format == FilterFormat::HWCF);
+    bool right_format = (params.filter_format == FilterFormat::FCHW) ==
+                        (params.input_format == DataFormat::NCHW);
 
     if (right_stride && right_window && right_pad && right_format) {
       return Algorithm::Matmul;
@@ -44,7 +44,15 @@ class TiledSelector final : public Selector {
    */
   Algorithm select_forward(Conv2DParams const& params) override {
     if (params.window_rows != params.window_cols ||
-        params.stride_rows != params.stride_cols) {
+        params.stride_rows != params.stride_cols ||
+        params.dilation_rows != params.dilation_cols || params.groups != 1) {
+      return Algorithm::NotSupported;
+    }
+    if (params.dilation_rows != 1) {
+      if (params.window_rows == 3 && params.stride_rows == 1 &&
+          params.dilation_rows == 2) {
+        return Algorithm::Tiled;
+      }
       return Algorithm::NotSupported;
     }
     if (params.window_rows == 1 && params.stride_rows == 2) {
@@ -45,6 +45,10 @@ class WinogradSelector final : public Selector {
     if (params.stride_rows != 1 && params.stride_cols != 1) {
       return Algorithm::NotSupported;
     }
+    if (params.dilation_rows != 1 || params.dilation_cols != 1 ||
+        params.groups != 1) {
+      return Algorithm::NotSupported;
+    }
     if (params.window_rows == 1 && params.window_cols == 3) {
       return Algorithm::Winograd;
     }
@@ -69,6 +73,10 @@ class WinogradSelector final : public Selector {
     if (params.stride_rows != 1 && params.stride_cols != 1) {
       return Algorithm::NotSupported;
     }
+    if (params.dilation_rows != 1 || params.dilation_cols != 1 ||
+        params.groups != 1) {
+      return Algorithm::NotSupported;
+    }
     if (params.window_rows == 1 && params.window_cols == 3) {
       return Algorithm::Winograd;
     }
@@ -93,6 +101,10 @@ class WinogradSelector final : public Selector {
     if (params.stride_rows != 1 && params.stride_cols != 1) {
       return Algorithm::NotSupported;
     }
+    if (params.dilation_rows != 1 || params.dilation_cols != 1 ||
+        params.groups != 1) {
+      return Algorithm::NotSupported;
+    }
     if (params.window_rows == 1 && params.window_cols == 3) {
       return Algorithm::Winograd;
     }
@@ -129,6 +141,10 @@ class WinogradLargeSelector final : public Selector {
     if (params.stride_rows != 1 && params.stride_cols != 1) {
       return Algorithm::NotSupported;
     }
+    if (params.dilation_rows != 1 || params.dilation_cols != 1 ||
+        params.groups != 1) {
+      return Algorithm::NotSupported;
+    }
     if (params.window_rows == 3 && params.window_cols == 3) {
       return Algorithm::WinogradLarge;
     }
@@ -148,6 +164,10 @@ class WinogradLargeSelector final : public Selector {
     if (params.stride_rows != 1 && params.stride_cols != 1) {
       return Algorithm::NotSupported;
     }
+    if (params.dilation_rows != 1 || params.dilation_cols != 1 ||
+        params.groups != 1) {
+      return Algorithm::NotSupported;
+    }
     if (params.window_rows == 3 && params.window_cols == 3) {
       return Algorithm::WinogradLarge;
     }
@@ -167,6 +187,10 @@ class WinogradLargeSelector final : public Selector {
     if (params.stride_rows != 1 && params.stride_cols != 1) {
       return Algorithm::NotSupported;
     }
+    if (params.dilation_rows != 1 || params.dilation_cols != 1 ||
+        params.groups != 1) {
+      return Algorithm::NotSupported;
+    }
     if (params.window_rows == 3 && params.window_cols == 3) {
       return Algorithm::WinogradLarge;
     }
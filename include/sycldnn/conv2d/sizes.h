@@ -112,6 +112,9 @@ inline ConvSizes get_spatial_sizes<conv_type::FilterBackprop>(
  * \brief Compute the spatial sizes (channel and/or feature) of the tensors used
  * in a convolution for the specified parameters.
  *
+ * In a grouped convolution each feature only uses channels / groups channels,
+ * so the filter tensor is smaller than in an ungrouped convolution.
+ *
  * \param params The convolution parameters, containing the tensor sizes and
  *               filter strides.
  * \return Returns a \ref sycldnn::conv2d::ConvSizes instance, containing the
@@ -125,7 +128,7 @@ template <>
 inline ConvSizes get_channel_sizes<conv_type::Forward>(
     Conv2DParams const& params) {
   size_t inp_size = params.channels;
-  size_t fil_size = params.channels * params.features;
+  size_t fil_size = params.channels / params.groups * params.features;
   size_t out_size = params.features;
   ConvSizes sizes{inp_size, fil_size, out_size};
   return sizes;
@@ -136,7 +139,7 @@ template <>
 inline ConvSizes get_channel_sizes<conv_type::InputBackprop>(
     Conv2DParams const& params) {
   size_t inp_size = params.features;
-  size_t fil_size = params.channels * params.features;
+  size_t fil_size = params.channels / params.groups * params.features;
   size_t out_size = params.channels;
   ConvSizes sizes{inp_size, fil_size, out_size};
   return sizes;
@@ -148,7 +151,7 @@ inline ConvSizes get_channel_sizes<conv_type::FilterBackprop>(
     Conv2DParams const& params) {
   size_t inp_size = params.channels;
   size_t fil_size = params.features;
-  size_t out_size = params.channels * params.features;
+  size_t out_size = params.channels / params.groups * params.features;
   ConvSizes sizes{inp_size, fil_size, out_size};
   return sizes;
 }
@@ -0,0 +1,227 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef SYCLDNN_INCLUDE_CONV2D_WINOGRAD_FILTER_H_
+#define SYCLDNN_INCLUDE_CONV2D_WINOGRAD_FILTER_H_
+
+/**
+ * \file
+ * Contains the \ref sycldnn::conv2d::WinogradFilter handle, which holds a
+ * filter that has been transformed into the Winograd domain, along with the
+ * \ref sycldnn::conv2d::transform_winograd_filter() function used to fill it.
+ *
+ * When the same filter is used in many convolutions, such as in inference,
+ * the filter can be transformed once and then passed to the overload of
+ * \ref sycldnn::conv2d::launch() which takes a WinogradFilter, avoiding the
+ * cost of transforming the filter on every launch.
+ */
+#include "sycldnn/status.h"
+
+#include "sycldnn/conv2d/algorithm.h"
+#include "sycldnn/conv2d/conv_type.h"
+#include "sycldnn/conv2d/params.h"
+#include "sycldnn/conv2d/workspace_size.h"
+
+#include "sycldnn/helpers/macros.h"
+
+#include "sycldnn/internal/conv2d/winograd/kernel_params.h"
+#include "sycldnn/internal/conv2d/winograd/launch.h"
+
+#include <type_traits>
+
+namespace sycldnn {
+namespace conv2d {
+
+/**
+ * Handle to a filter which has been transformed into the Winograd domain.
+ *
+ * On construction the handle uses the backend to allocate a buffer large
+ * enough to hold the transformed filter for the Winograd tile sizes chosen for
+ * the given algorithm and convolution parameters. The buffer is released
+ * through the backend on destruction. The transformed filter itself is computed
+ * by \ref sycldnn::conv2d::transform_winograd_filter().
+ *
+ * Only the forward and input backprop convolutions are supported, as the
+ * filter backprop convolution computes the filter rather than using it.
+ *
+ * \tparam T        The data type of the filter.
+ * \tparam ConvType The type of convolution the filter will be used in.
+ * \tparam Backend  The backend used to allocate the transformed filter.
+ */
+template <typename T, typename ConvType, typename Backend>
+class WinogradFilter {
+  static_assert(!std::is_same<ConvType, conv_type::FilterBackprop>::value,
+                "Pre-transformed filters are not supported for the filter "
+                "backprop convolution.");
+
+ public:
+  /** The external pointer type used to hold the transformed filter. */
+  using Pointer = typename Backend::template pointer_type<T>;
+
+  /**
+   * Allocate the buffer to hold a transformed filter.
+   *
+   * If the algorithm is not one of Algorithm::Winograd or
+   * Algorithm::WinogradLarge, or the filter window, dilation or groups are not
+   * supported by that algorithm, then no buffer is allocated and is_valid()
+   * will return false.
+   *
+   * \param params    The convolution parameters the filter will be used with.
+   * \param algorithm The Winograd algorithm to transform the filter for.
+   * \param backend   The backend to use to allocate the transformed filter.
+   */
+  WinogradFilter(Conv2DParams const& params, Algorithm algorithm,
+                 Backend& backend)
+      : params_{params},
+        algorithm_{algorithm},
+        size_{compute_size(params, algorithm)},
+        pointer_{size_ > 0 ? backend.template allocate<T>(sizeof(T) * size_)
+                           : Pointer{}},
+        backend_{backend} {}
+
+  SNN_DISABLE_COPY(WinogradFilter);
+  SNN_DISABLE_MOVE(WinogradFilter);
+
+  /** Release the transformed filter buffer on destruction. */
+  ~WinogradFilter() {
+    if (size_ > 0) {
+      backend_.deallocate(pointer_);
+    }
+  }
+
+  /**
+   * Check whether the filter can be transformed with the chosen algorithm.
+   * \return Returns true if the transformed filter buffer was allocated.
+   */
+  bool is_valid() const { return size_ > 0; }
+
+  /** \return The convolution parameters the filter is transformed for. */
+  Conv2DParams const& params() const { return params_; }
+
+  /** \return The Winograd algorithm the filter is transformed for. */
+  Algorithm algorithm() const { return algorithm_; }
+
+  /** \return The number of elements in the transformed filter. */
+  size_t size() const { return size_; }
+
+  /** \return The pointer to the transformed filter. */
+  Pointer get() const { return pointer_; }
+
+ private:
+  /**
+   * Get the number of elements in the transformed filter, or 0 if the
+   * algorithm cannot be used for the given parameters.
+   */
+  static size_t compute_size(Conv2DParams const& params, Algorithm algorithm) {
+    auto kernel_params = internal::winograd::get_params<ConvType>(params);
+    size_t const n_filter_elements =
+        static_cast<size_t>(kernel_params.channels) * kernel_params.features;
+    bool const is_3x3 = params.window_rows == 3 && params.window_cols == 3;
+    bool const is_3x1 = params.window_rows == 3 && params.window_cols == 1;
+    bool const is_1x3 = params.window_rows == 1 && params.window_cols == 3;
+    if (params.input_format != DataFormat::NHWC ||
+        params.dilation_rows != 1 || params.dilation_cols != 1 ||
+        params.groups != 1) {
+      return 0;
+    }
+    if (algorithm == Algorithm::Winograd) {
+      // Tile sizes must match those used in internal::winograd::launch().
+      if (is_3x3) {
+        return 4 * 4 * n_filter_elements;
+      }
+      if (is_3x1) {
+        return 4 * 1 * n_filter_elements;
+      }
+      if (is_1x3) {
+        return 1 * 4 * n_filter_elements;
+      }
+    }
+    if (algorithm == Algorithm::WinogradLarge && is_3x3) {
+      // Tile sizes must match those used in internal::winograd::launch_large().
+      return 6 * 6 * n_filter_elements;
+    }
+    return 0;
+  }
+
+  Conv2DParams params_;
+  Algorithm algorithm_;
+  size_t size_;
+  Pointer pointer_;
+  Backend& backend_;
+};
+
+/**
+ * Transform a filter into the Winograd domain, storing the result in the
+ * provided WinogradFilter handle.
+ *
+ * The handle can then be passed to \ref sycldnn::conv2d::launch() for any
+ * number of convolutions using the same filter, as long as the filter is not
+ * modified.
+ *
+ * \param filter      A pointer to the memory representing the tensor of filter
+ *                    coefficients.
+ * \param transformed The handle to store the transformed filter in.
+ * \param backend     The backend implementation, used to map between pointer
+ *                    representations.
+ * \return Returns an SNNStatus containing the SYCL event tied to the filter
+ * transform kernel and a StatusCode enum showing if the launch was OK or
+ * whether it encountered some problem.
+ */
+template <typename T, typename ConvType, typename Backend>
+SNNStatus transform_winograd_filter(
+    typename Backend::template pointer_type<T const> filter,
+    WinogradFilter<T, ConvType, Backend>& transformed, Backend& backend) {
+  if (!transformed.is_valid()) {
+    return StatusCode::InvalidAlgorithm;
+  }
+  if (transformed.algorithm() == Algorithm::WinogradLarge) {
+    return internal::winograd::transform_filter_large<T, ConvType>(
+        filter, transformed.get(), transformed.params(), backend);
+  }
+  return internal::winograd::transform_filter<T, ConvType>(
+      filter, transformed.get(), transformed.params(), backend);
+}
+
+/**
+ * Query the number of elements that a workspace buffer must hold in order to be
+ * used in a convolution with a pre-transformed filter.
+ *
+ * The transformed filter is already stored in the WinogradFilter handle, so
+ * the workspace does not need to hold a copy.
+ *
+ * \param params Convolution parameters describing the computation.
+ * \param filter The pre-transformed filter which will be used.
+ * \return A WorkspaceSize struct containing the minimum required and
+ *         recommended number of elements that a workspace buffer should hold.
+ */
+template <typename T, typename ConvType, typename Backend>
+WorkspaceSize query_workspace_size(
+    Conv2DParams const& params,
+    WinogradFilter<T, ConvType, Backend> const& filter) {
+  if (!filter.is_valid()) {
+    return {0, 0};
+  }
+  auto const sizes =
+      internal::query_workspace_size<ConvType>(params, filter.algorithm());
+  // The full workspace sizes always include a filter transform at least as
+  // large as the one held in the handle.
+  return {sizes.required_size - filter.size(),
+          sizes.recommended_size - filter.size()};
+}
+
+}  // namespace conv2d
+}  // namespace sycldnn
+
+#endif  // SYCLDNN_INCLUDE_CONV2D_WINOGRAD_FILTER_H_
@@ -20,6 +20,10 @@
 #include "sycldnn/conv2d/conv_type.h"
 #include "sycldnn/conv2d/selector/selector.h"
 
+#include "sycldnn/conv2d/implementation/matmul.h"
+
+#include "sycldnn/internal/conv2d/layout.h"
+
 #include "sycldnn/internal/conv2d/im2col/kernel_params.h"
 #include "sycldnn/internal/conv2d/im2col/tile_info.h"
 
@@ -74,6 +78,11 @@ WorkspaceSize winograd_impl_workspace_size(Conv2DParams const& params) {
 /** Get the workspace sizes for Winograd using the smaller tile sizes. */
 template <typename ConvType>
 WorkspaceSize workspace_size_for_winograd(Conv2DParams const& params) {
+  // Winograd does not support dilated or grouped convolutions.
+  if (params.dilation_rows != 1 || params.dilation_cols != 1 ||
+      params.groups != 1) {
+    return {0, 0};
+  }
   // The choice of tile sizes here should match that used in
   // src/conv2d/winoograd/launch.cc
   if (std::is_same<ConvType, conv_type::FilterBackprop>::value) {
@@ -86,6 +95,11 @@ WorkspaceSize workspace_size_for_winograd(Conv2DParams const& params) {
 /** Get the workspace sizes for Winograd using the larger tile sizes. */
 template <typename ConvType>
 WorkspaceSize workspace_size_for_winograd_large(Conv2DParams const& params) {
+  // Winograd does not support dilated or grouped convolutions.
+  if (params.dilation_rows != 1 || params.dilation_cols != 1 ||
+      params.groups != 1) {
+    return {0, 0};
+  }
   // The choice of tile sizes here should match that used in
   // src/conv2d/winoograd/launch.cc
   if (std::is_same<ConvType, conv_type::FilterBackprop>::value) {
@@ -95,10 +109,53 @@ WorkspaceSize workspace_size_for_winograd_large(Conv2DParams const& params) {
   }
 }
 
+/**
+ * Get the workspace sizes needed for a grouped Im2col convolution, which holds
+ * the packed filter followed by the transform tensors and the batched matmul
+ * output for each image.
+ */
+template <typename ConvType>
+WorkspaceSize workspace_size_for_grouped_im2col(Conv2DParams const& params) {
+  // Grouped im2col does not support the filter backprop.
+  if (std::is_same<ConvType, conv_type::FilterBackprop>::value) {
+    return {0, 0};
+  }
+  auto const tile_info = im2col::get_tile_info<ConvType>(params);
+  size_t const matmul_size =
+      std::is_same<ConvType, conv_type::InputBackprop>::value
+          ? params.channels
+          : params.features;
+  size_t const filter_size = static_cast<size_t>(params.window_rows) *
+                             params.window_cols *
+                             (params.channels / params.groups) *
+                             params.features;
+  size_t const size_per_image =
+      tile_info.number * (tile_info.size + matmul_size);
+  return {filter_size + size_per_image,
+          filter_size + params.batch * size_per_image};
+}
+
+/**
+ * Get the workspace sizes needed for a Matmul convolution. Only grouped
+ * convolutions need a workspace, to hold the group major copies of the matmul
+ * operands and output.
+ */
+template <typename ConvType>
+WorkspaceSize workspace_size_for_matmul(Conv2DParams const& params) {
+  if (params.groups == 1) {
+    return {0, 0};
+  }
+  size_t const size = internal::get_grouped_matmul_size<ConvType>(params);
+  return {size, size};
+}
+
 /** Get the workspace sizes needed for the Im2col transform tensors. */
 template <typename ConvType>
 WorkspaceSize workspace_size_for_im2col(Conv2DParams const& params) {
   auto const tile_info = im2col::get_tile_info<ConvType>(params);
+  if (params.groups != 1) {
+    return workspace_size_for_grouped_im2col<ConvType>(params);
+  }
   size_t filter_size = std::is_same<ConvType, conv_type::InputBackprop>::value
                            ? params.window_rows * params.window_cols *
                                  params.channels * params.features
@@ -108,11 +165,11 @@ WorkspaceSize workspace_size_for_im2col(Conv2DParams const& params) {
   return {required_size, recommended_size};
 }
 
-/** Get the WorkspaceSize for the specified convolution using the provided
+/** Get the WorkspaceSize for the specified NHWC convolution using the provided
  * Algorithm. */
 template <typename ConvType>
-WorkspaceSize query_workspace_size(Conv2DParams const& params,
-                                   Algorithm algorithm) {
+WorkspaceSize algorithm_workspace_size(Conv2DParams const& params,
+                                       Algorithm algorithm) {
   switch (algorithm) {
     case Algorithm::Winograd:
       return workspace_size_for_winograd<ConvType>(params);
@@ -123,21 +180,45 @@ WorkspaceSize query_workspace_size(Conv2DParams const& params,
     case Algorithm::Im2col:
       return workspace_size_for_im2col<ConvType>(params);
       break;
+    case Algorithm::Matmul:
+      return workspace_size_for_matmul<ConvType>(params);
+      break;
     case Algorithm::Direct:
     case Algorithm::Tiled:
-    case Algorithm::Matmul:
     case Algorithm::NotSupported:
       return {0, 0};
   }
   SNN_ASSERT(false, "Invalid algorithm passed to query_workspace_size.");
   return {0, 0};
 }
+
+/**
+ * Get the WorkspaceSize for the specified convolution using the provided
+ * Algorithm, including space for NHWC copies of the tensors if the algorithm
+ * cannot use them in their given layouts.
+ */
+template <typename ConvType>
+WorkspaceSize query_workspace_size(Conv2DParams const& params,
+                                   Algorithm algorithm) {
+  if (!requires_nhwc<ConvType>(params, algorithm)) {
+    return algorithm_workspace_size<ConvType>(params, algorithm);
+  }
+  auto size =
+      algorithm_workspace_size<ConvType>(get_nhwc_params(params), algorithm);
+  size_t const conversion_size = get_conversion_size<ConvType>(params);
+  return {size.required_size + conversion_size,
+          size.recommended_size + conversion_size};
+}
 }  // namespace internal
 
 /**
  * Query the number of elements that a workspace buffer must hold in order to be
  * used in a convolution computation.
  *
+ * If the selected algorithm does not support the layouts of the tensors, the
+ * sizes include space for the NHWC and HWCF copies of the tensors used by the
+ * algorithm.
+ *
  * \param params Convolution parameters describing the computation.
  * \param selector Selector to use to determine which algorithm to use.
  *
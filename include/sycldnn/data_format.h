@@ -39,8 +39,76 @@ enum class DataFormat {
    * DataFormat::NCHW where batches are the outer-most dimension, followed
    * by channels, then image height, then image width.
    */
-  NCHW
+  NCHW,
+
+  /**
+   * DataFormat::NCHW4 where the channels are split into blocks of 4. Batches
+   * are the outer-most dimension, followed by channel blocks, then image
+   * height, then image width, then the 4 channels in each block.
+   */
+  NCHW4,
+
+  /**
+   * DataFormat::NCHW8 where the channels are split into blocks of 8, laid out
+   * as in DataFormat::NCHW4.
+   */
+  NCHW8,
+
+  /**
+   * DataFormat::NCHW16 where the channels are split into blocks of 16, laid
+   * out as in DataFormat::NCHW4.
+   */
+  NCHW16
 };
+
+/**
+ * Get the number of channels in each channel block of a data format.
+ *
+ * \param format The data format.
+ * \return Returns the channel block size for the blocked NCHWc formats, or 1
+ *         for formats which do not split the channels into blocks.
+ */
+inline int get_channel_block(DataFormat format) {
+  switch (format) {
+    case DataFormat::NCHW4:
+      return 4;
+    case DataFormat::NCHW8:
+      return 8;
+    case DataFormat::NCHW16:
+      return 16;
+    case DataFormat::NHWC:
+    case DataFormat::NCHW:
+    default:
+      return 1;
+  }
+}
+
+/**
+ * Check whether a data format splits the channels into blocks.
+ *
+ * \param format The data format.
+ * \return Returns true for the blocked NCHWc formats.
+ */
+inline bool is_channel_blocked(DataFormat format) {
+  return get_channel_block(format) > 1;
+}
+
+/**
+ * Get the number of channels stored contiguously for each pixel of a tensor in
+ * either the NHWC format or one of the blocked NCHWc formats.
+ *
+ * An NHWC tensor can be viewed as a blocked tensor with a single block holding
+ * all of the channels, which allows kernels to index both formats in the same
+ * way.
+ *
+ * \param format   The data format, either NHWC or a channel blocked format.
+ * \param channels The total number of channels in the tensor.
+ * \return Returns the channel block size for the blocked formats, otherwise
+ *         the number of channels.
+ */
+inline int get_pixel_channels(DataFormat format, int channels) {
+  return is_channel_blocked(format) ? get_channel_block(format) : channels;
+}
 }  // namespace sycldnn
 
 #endif  // SYCLDNN_INCLUDE_DATA_FORMAT_H_
@@ -0,0 +1,46 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef SYCLDNN_INCLUDE_DEPTHWISE_CONV2D_ALGORITHM_H_
+#define SYCLDNN_INCLUDE_DEPTHWISE_CONV2D_ALGORITHM_H_
+
+/**
+ * \file
+ * Contains the declaration of the \ref sycldnn::depthwise_conv2d::Algorithm
+ * enumerated type, used to choose which kernel computes a depthwise
+ * convolution.
+ */
+namespace sycldnn {
+namespace depthwise_conv2d {
+/**
+ * The implemented depthwise convolution algorithms.
+ *
+ * The tiled algorithms are only available for forward convolutions with a
+ * channel multiplier of 1, square 3x3 or 5x5 windows and equal strides of 1
+ * or 2.
+ */
+enum class Algorithm {
+  /** Choose the algorithm based on the parameters and the device. */
+  Automatic,
+  /** Direct convolution computing one output per work-item. */
+  Direct,
+  /** Share input values between a work-group through local memory. */
+  LocalTiled,
+  /** Compute a tile of outputs per work-item, reusing inputs in registers. */
+  RegisterTiled,
+};
+}  // namespace depthwise_conv2d
+}  // namespace sycldnn
+#endif  // SYCLDNN_INCLUDE_DEPTHWISE_CONV2D_ALGORITHM_H_
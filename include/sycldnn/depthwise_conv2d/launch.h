@@ -31,6 +31,8 @@
 #include "sycldnn/helpers/macros.h"
 
 #include "sycldnn/internal/depthwise_conv2d/launch.h"
+#include "sycldnn/internal/depthwise_conv2d/layout.h"
+#include "sycldnn/internal/helpers/layout_conversion.h"
 
 namespace sycldnn {
 namespace depthwise_conv2d {
@@ -82,11 +84,37 @@ SNNStatus launch(typename Backend::template pointer_type<T const> input,
   SNN_VALIDATE_PARAM(
       params.pad_cols >= 0,
       "The padding in the column direction must be non-negative.");
-  SNN_VALIDATE_PARAM(params.input_format == sycldnn::DataFormat::NHWC,
-                     "Currently SYCL-DNN only supports the NHWC data format.");
+  SNN_VALIDATE_PARAM(params.input_format == sycldnn::DataFormat::NHWC ||
+                         is_channel_blocked(params.input_format),
+                     "Currently SYCL-DNN only supports the NHWC and NCHWc data "
+                     "formats.");
   SNN_VALIDATE_PARAM(
       params.filter_format == sycldnn::FilterFormat::HWCF,
       "Currently SYCL-DNN only supports the HWCF filter format.");
+  int const channel_block = get_channel_block(params.input_format);
+  SNN_VALIDATE_PARAM(params.channels % channel_block == 0,
+                     "The number of channels must be divisible by the channel "
+                     "block size.");
+
+  if (internal::requires_nhwc<ConvType>(params)) {
+    // Only the basic forward kernel reads blocked tensors, so convert them for
+    // the other kernels. There is no workspace for a depthwise convolution, so
+    // the NHWC copies are allocated through the backend.
+    using ConstPointer = typename Backend::template pointer_type<T const>;
+    using Pointer = typename Backend::template pointer_type<T>;
+    DepthwiseConv2DParams nhwc_params = params;
+    nhwc_params.input_format = sycldnn::DataFormat::NHWC;
+    auto transposes = internal::get_layout_transposes<ConvType>(params);
+    return ::sycldnn::internal::helpers::launch_with_converted_layouts<T>(
+        input, filter, output, transposes.input, transposes.filter,
+        transposes.output, Pointer{}, 0, 0, backend,
+        [&](ConstPointer nhwc_input, ConstPointer nhwc_filter,
+            Pointer nhwc_output, Pointer /*workspace*/,
+            size_t /*workspace_size*/) {
+          return launch<T, ConvType>(nhwc_input, nhwc_filter, nhwc_output,
+                                     nhwc_params, backend);
+        });
+  }
 
   auto conv_sizes = get_sizes<ConvType>(params);
 
@@ -19,6 +19,8 @@
 #include "sycldnn/data_format.h"
 #include "sycldnn/filter_format.h"
 
+#include "sycldnn/depthwise_conv2d/algorithm.h"
+
 /**
  * \file
  * Contains the declaration of the
@@ -91,6 +93,13 @@ struct DepthwiseConv2DParams {
 
   /** The data format used in the filter tensor. */
   sycldnn::FilterFormat filter_format = sycldnn::FilterFormat::HWCF;
+
+  /**
+   * The algorithm used to compute the convolution. If the requested algorithm
+   * does not support these parameters then launching the convolution returns
+   * StatusCode::InvalidAlgorithm.
+   */
+  Algorithm algorithm = Algorithm::Automatic;
 };
 
 }  // namespace depthwise_conv2d
@@ -68,9 +68,51 @@ PaddingAndOutput<Index> calculate_padding(Index input, Index window,
   }
 }
 
+namespace internal {
+
+/**
+ * Get the number of rows spanned by the dilated filter window.
+ *
+ * Parameter structs which do not contain a dilation are treated as having a
+ * dilation of 1.
+ */
+template <typename Params>
+auto dilated_window_rows(Params const& params, int)
+    -> decltype(params.dilation_rows) {
+  return (params.window_rows - 1) * params.dilation_rows + 1;
+}
+
+/** \copydoc dilated_window_rows() */
+template <typename Params>
+auto dilated_window_rows(Params const& params, long)
+    -> decltype(params.window_rows) {
+  return params.window_rows;
+}
+
+/**
+ * Get the number of columns spanned by the dilated filter window.
+ *
+ * Parameter structs which do not contain a dilation are treated as having a
+ * dilation of 1.
+ */
+template <typename Params>
+auto dilated_window_cols(Params const& params, int)
+    -> decltype(params.dilation_cols) {
+  return (params.window_cols - 1) * params.dilation_cols + 1;
+}
+
+/** \copydoc dilated_window_cols() */
+template <typename Params>
+auto dilated_window_cols(Params const& params, long)
+    -> decltype(params.window_cols) {
+  return params.window_cols;
+}
+
+}  // namespace internal
+
 /**
  * Add the padding and output sizes to a parameter struct from the input
- * sizes, window sizes and strides.
+ * sizes, window sizes, strides and, if the struct contains them, dilations.
  * \param params The parameters that the output will be based on.
  * \param type The type of padding that should be used to calculate the actual
  *             size of padding to be used in the convolution.
@@ -79,12 +121,14 @@ PaddingAndOutput<Index> calculate_padding(Index input, Index window,
 template <typename Params>
 Params add_padding_to(Params params, PaddingMode type) {
   auto row_padding = sycldnn::helpers::calculate_padding(
-      params.in_rows, params.window_rows, params.stride_rows, type);
+      params.in_rows, internal::dilated_window_rows(params, 0),
+      params.stride_rows, type);
   params.out_rows = row_padding.output;
   params.pad_rows = row_padding.padding;
 
   auto col_padding = sycldnn::helpers::calculate_padding(
-      params.in_cols, params.window_cols, params.stride_cols, type);
+      params.in_cols, internal::dilated_window_cols(params, 0),
+      params.stride_cols, type);
   params.out_cols = col_padding.output;
   params.pad_cols = col_padding.padding;
 
@@ -0,0 +1,282 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef SYCLDNN_INCLUDE_INTERNAL_BATCHNORM_LAUNCH_H_
+#define SYCLDNN_INCLUDE_INTERNAL_BATCHNORM_LAUNCH_H_
+
+#include "sycldnn/mem_object.h"
+#include "sycldnn/status.h"
+
+#include "sycldnn/batchnorm/params.h"
+#include "sycldnn/conv2d/params.h"
+
+#include "sycldnn/helpers/ratio.h"
+#include "sycldnn/internal/helpers/stat_type.h"
+
+#include <CL/sycl.hpp>
+
+#include <stddef.h>
+#include <algorithm>
+#include <cstdint>
+
+#include "sycldnn/export.h"
+
+namespace sycldnn {
+namespace batchnorm {
+namespace internal {
+
+using ::sycldnn::internal::helpers::StatMemObject;
+
+/** The number of work-items to aim for when computing partial statistics. */
+constexpr int target_stat_threads = 16384;
+/** The minimum number of values reduced by each work-item. */
+constexpr int min_values_per_chunk = 16;
+
+/**
+ * Get the number of chunks to split each channel's reduction into, so that
+ * there are enough work-items to fill the device without each one reducing
+ * too few values.
+ */
+template <typename Index>
+Index get_n_chunks(Index n_reduce, Index channels) {
+  Index const wanted = helpers::round_ratio_up(
+      static_cast<Index>(target_stat_threads), channels);
+  Index const max_chunks = helpers::round_ratio_up(
+      n_reduce, static_cast<Index>(min_values_per_chunk));
+  return std::max(static_cast<Index>(1), std::min(wanted, max_chunks));
+}
+
+/**
+ * Get the number of partial values computed for each chunk of each channel
+ * by the reduction kernels, multiplied by the number of chunks and channels.
+ */
+inline size_t get_partials_size(BatchNormParams const& params,
+                                int values_per_chunk) {
+  int64_t const channels = params.channels;
+  int64_t const n_reduce =
+      static_cast<int64_t>(params.batch) * params.rows * params.cols;
+  int64_t const n_chunks = get_n_chunks(n_reduce, channels);
+  return static_cast<size_t>(values_per_chunk * n_chunks * channels);
+}
+
+/**
+ * Get the number of accumulator values needed in the workspace of the
+ * statistics kernels, which hold the partial mean and sum of squared
+ * differences of each chunk of each channel.
+ */
+inline size_t get_statistics_workspace_size(BatchNormParams const& params) {
+  return get_partials_size(params, 2);
+}
+
+/**
+ * Get the number of accumulator values needed in the workspace of the
+ * gradient kernels, which hold the partial statistics, sum(gradient) and
+ * sum(gradient * input) of each chunk of each channel.
+ */
+inline size_t get_gradient_workspace_size(BatchNormParams const& params) {
+  return get_partials_size(params, 4);
+}
+
+/**
+ * Get the number of values needed for the per-channel coefficients which the
+ * gradient kernels pass from the reduction to the input gradient.
+ */
+inline size_t get_gradient_coefficients_size(BatchNormParams const& params) {
+  return 4 * static_cast<size_t>(params.channels);
+}
+
+/**
+ * Launch the kernels to compute the mean and variance of each channel of the
+ * input in a single pass over the input, using Welford's algorithm.
+ *
+ * Implemented in the compiled SYCL DNN library.
+ *
+ * \param input     Input tensor, in the layout given by params.input_format.
+ * \param mean      Output tensor for the mean of each channel.
+ * \param variance  Output tensor for the variance of each channel.
+ * \param workspace Temporary memory for the partial statistics, holding at
+ *                  least get_statistics_workspace_size(params) values.
+ * \param params    Batchnorm parameters describing the input shape.
+ * \param queue     SYCL queue to enqueue the kernels to.
+ * \return An SNNStatus with event linked to the last kernel launch or an error
+ *         code.
+ */
+template <typename T>
+SNN_EXPORT SNNStatus launch_batch_statistics(BaseMemObject<T const>& input,
+                                             BaseMemObject<T>& mean,
+                                             BaseMemObject<T>& variance,
+                                             StatMemObject<T>& workspace,
+                                             BatchNormParams const& params,
+                                             cl::sycl::queue& queue);
+
+/**
+ * Launch the kernels to compute the mean and variance of each channel of the
+ * input in a single pass over the input, and blend them into the running
+ * statistics as:
+ *   running = batch * (1 - momentum) + previous * momentum
+ *
+ * Implemented in the compiled SYCL DNN library.
+ *
+ * \param input            Input tensor, in the layout given by
+ *                         params.input_format.
+ * \param prev_mean        Previous running mean of each channel.
+ * \param prev_variance    Previous running variance of each channel.
+ * \param running_mean     Output tensor for the new running means.
+ * \param running_variance Output tensor for the new running variances.
+ * \param workspace        Temporary memory for the partial statistics,
+ *                         holding at least
+ *                         get_statistics_workspace_size(params) values.
+ * \param params           Batchnorm parameters describing the input shape and
+ *                         momentum.
+ * \param queue            SYCL queue to enqueue the kernels to.
+ * \return An SNNStatus with event linked to the last kernel launch or an error
+ *         code.
+ */
+template <typename T>
+SNN_EXPORT SNNStatus launch_running_statistics(
+    BaseMemObject<T const>& input, BaseMemObject<T const>& prev_mean,
+    BaseMemObject<T const>& prev_variance, BaseMemObject<T>& running_mean,
+    BaseMemObject<T>& running_variance, StatMemObject<T>& workspace,
+    BatchNormParams const& params, cl::sycl::queue& queue);
+
+/**
+ * Launch a kernel to normalize, scale and shift the input in a single pass:
+ *   output = (input - mean) / sqrt(variance + epsilon) * gamma + beta
+ *
+ * Implemented in the compiled SYCL DNN library.
+ *
+ * \param input    Input tensor, in the layout given by params.input_format.
+ * \param beta     Shift applied to each channel.
+ * \param gamma    Scale applied to each channel.
+ * \param mean     Mean of each channel.
+ * \param variance Variance of each channel.
+ * \param output   Output tensor, in the same layout as the input.
+ * \param params   Batchnorm parameters describing the input shape and epsilon.
+ * \param queue    SYCL queue to enqueue the kernel to.
+ * \return An SNNStatus with event linked to the kernel launch or an error code.
+ */
+template <typename T>
+SNN_EXPORT SNNStatus launch_normalize(
+    BaseMemObject<T const>& input, BaseMemObject<T const>& beta,
+    BaseMemObject<T const>& gamma, BaseMemObject<T const>& mean,
+    BaseMemObject<T const>& variance, BaseMemObject<T>& output,
+    BatchNormParams const& params, cl::sycl::queue& queue);
+
+/**
+ * Launch the kernels to compute the batchnorm gradients using the mean and
+ * variance of the input batch.
+ *
+ * A single fused reduction over the input and gradient computes the batch
+ * statistics along with sum(gradient) and sum(gradient * x_hat) for each
+ * channel, then a single elementwise kernel computes the input gradient.
+ *
+ * Implemented in the compiled SYCL DNN library.
+ *
+ * \param input        Input tensor, in the layout given by params.input_format.
+ * \param gradient     Gradient of the batchnorm output, in the same layout.
+ * \param gamma        Scale applied to each channel.
+ * \param beta_grad    Output tensor for the gradient of beta.
+ * \param gamma_grad   Output tensor for the gradient of gamma.
+ * \param output       Output tensor for the gradient of the input.
+ * \param workspace    Temporary memory for the partial sums, holding at least
+ *                     get_gradient_workspace_size(params) values.
+ * \param coefficients Temporary memory for the per-channel coefficients,
+ *                     holding at least get_gradient_coefficients_size(params)
+ *                     values.
+ * \param params       Batchnorm parameters describing the input shape and
+ *                     epsilon.
+ * \param queue        SYCL queue to enqueue the kernels to.
+ * \return An SNNStatus with event linked to the last kernel launch or an error
+ *         code.
+ */
+template <typename T>
+SNN_EXPORT SNNStatus launch_batch_gradient(
+    BaseMemObject<T const>& input, BaseMemObject<T const>& gradient,
+    BaseMemObject<T const>& gamma, BaseMemObject<T>& beta_grad,
+    BaseMemObject<T>& gamma_grad, BaseMemObject<T>& output,
+    StatMemObject<T>& workspace, BaseMemObject<T>& coefficients,
+    BatchNormParams const& params, cl::sycl::queue& queue);
+
+/**
+ * Launch the kernels to compute the batchnorm gradients using the provided
+ * population mean and variance.
+ *
+ * A single fused reduction over the input and gradient computes
+ * sum(gradient) and sum(gradient * x_hat) for each channel, then a single
+ * elementwise kernel computes the input gradient.
+ *
+ * Implemented in the compiled SYCL DNN library.
+ *
+ * \param input        Input tensor, in the layout given by params.input_format.
+ * \param gradient     Gradient of the batchnorm output, in the same layout.
+ * \param gamma        Scale applied to each channel.
+ * \param pop_mean     Population mean of each channel.
+ * \param pop_variance Population variance of each channel.
+ * \param beta_grad    Output tensor for the gradient of beta.
+ * \param gamma_grad   Output tensor for the gradient of gamma.
+ * \param output       Output tensor for the gradient of the input.
+ * \param workspace    Temporary memory for the partial sums, holding at least
+ *                     get_gradient_workspace_size(params) values.
+ * \param coefficients Temporary memory for the per-channel coefficients,
+ *                     holding at least get_gradient_coefficients_size(params)
+ *                     values.
+ * \param params       Batchnorm parameters describing the input shape and
+ *                     epsilon.
+ * \param queue        SYCL queue to enqueue the kernels to.
+ * \return An SNNStatus with event linked to the last kernel launch or an error
+ *         code.
+ */
+template <typename T>
+SNN_EXPORT SNNStatus launch_frozen_gradient(
+    BaseMemObject<T const>& input, BaseMemObject<T const>& gradient,
+    BaseMemObject<T const>& gamma, BaseMemObject<T const>& pop_mean,
+    BaseMemObject<T const>& pop_variance, BaseMemObject<T>& beta_grad,
+    BaseMemObject<T>& gamma_grad, BaseMemObject<T>& output,
+    StatMemObject<T>& workspace, BaseMemObject<T>& coefficients,
+    BatchNormParams const& params, cl::sycl::queue& queue);
+
+/**
+ * Launch the kernels to fold a frozen batchnorm into the filter and bias of
+ * the convolution preceding it, so that:
+ *   filter' = filter * gamma / sqrt(variance + epsilon)
+ *   bias'   = (bias - mean) * gamma / sqrt(variance + epsilon) + beta
+ *
+ * Implemented in the compiled SYCL DNN library.
+ *
+ * \param filter      Convolution filter in HWCF or FCHW format, updated in
+ *                    place.
+ * \param bias        Convolution bias, updated in place.
+ * \param beta        Shift applied to each channel by the batchnorm.
+ * \param gamma       Scale applied to each channel by the batchnorm.
+ * \param mean        Mean of each channel.
+ * \param variance    Variance of each channel.
+ * \param conv_params Parameters of the convolution to fold into.
+ * \param params      Batchnorm parameters providing epsilon.
+ * \param queue       SYCL queue to enqueue the kernels to.
+ * \return An SNNStatus with event linked to the last kernel launch or an error
+ *         code.
+ */
+template <typename T>
+SNN_EXPORT SNNStatus launch_fold_conv2d(
+    BaseMemObject<T>& filter, BaseMemObject<T>& bias,
+    BaseMemObject<T const>& beta, BaseMemObject<T const>& gamma,
+    BaseMemObject<T const>& mean, BaseMemObject<T const>& variance,
+    conv2d::Conv2DParams const& conv_params, BatchNormParams const& params,
+    cl::sycl::queue& queue);
+
+}  // namespace internal
+}  // namespace batchnorm
+}  // namespace sycldnn
+#endif  // SYCLDNN_INCLUDE_INTERNAL_BATCHNORM_LAUNCH_H_
@@ -16,6 +16,7 @@
 #ifndef SYCLDNN_INCLUDE_INTERNAL_CONV2D_DIRECT_H_
 #define SYCLDNN_INCLUDE_INTERNAL_CONV2D_DIRECT_H_
 
+#include "sycldnn/conv2d/epilogue.h"
 #include "sycldnn/conv2d/params.h"
 #include "sycldnn/helpers/macros.h"
 #include "sycldnn/mem_object.h"
@@ -37,6 +38,21 @@ SNN_EXPORT SNNStatus launch_direct(BaseMemObject<T const>& input,
                                    BaseMemObject<T>& output,
                                    Conv2DParams const& params,
                                    cl::sycl::queue& queue);
+
+/**
+ * The internal direct convolution launcher, applying an epilogue to the output
+ * of a forward convolution as it is written.
+ *
+ * Implemented in the compiled SYCL DNN library.
+ */
+template <typename T, typename ConvType>
+SNN_EXPORT SNNStatus launch_direct(BaseMemObject<T const>& input,
+                                   BaseMemObject<T const>& filter,
+                                   BaseMemObject<T const>& bias,
+                                   BaseMemObject<T>& output,
+                                   Conv2DParams const& params,
+                                   EpilogueParams const& epilogue,
+                                   cl::sycl::queue& queue);
 }  // namespace internal
 }  // namespace conv2d
 }  // namespace sycldnn
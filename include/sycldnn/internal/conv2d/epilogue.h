@@ -0,0 +1,87 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef SYCLDNN_INCLUDE_INTERNAL_CONV2D_EPILOGUE_H_
+#define SYCLDNN_INCLUDE_INTERNAL_CONV2D_EPILOGUE_H_
+
+#include "sycldnn/mem_object.h"
+#include "sycldnn/status.h"
+
+#include "sycldnn/conv2d/epilogue.h"
+#include "sycldnn/conv2d/params.h"
+
+#include <CL/sycl.hpp>
+
+#include "sycldnn/export.h"
+
+namespace sycldnn {
+namespace conv2d {
+namespace internal {
+
+/**
+ * Check whether an epilogue modifies the convolution output at all.
+ *
+ * \param epilogue The epilogue parameters to check.
+ * \return Returns true if the epilogue adds a bias or applies an activation.
+ */
+inline bool is_enabled(EpilogueParams const& epilogue) {
+  return epilogue.bias || epilogue.activation != Activation::None;
+}
+
+/**
+ * Launch a kernel to apply an epilogue in place to the NHWC output of a
+ * forward convolution.
+ *
+ * Implemented in the compiled SYCL DNN library.
+ *
+ * \param bias     Bias tensor holding one value per output feature. If the
+ *                 epilogue does not add a bias then this is not read.
+ * \param output   Output tensor of the convolution.
+ * \param epilogue Bias and activation to apply to the output.
+ * \param params   Convolution parameters describing the output shape.
+ * \param queue    SYCL queue to enqueue the kernel to.
+ * \return An SNNStatus with event linked to the kernel launch or an error code.
+ */
+template <typename T>
+SNN_EXPORT SNNStatus launch_epilogue(BaseMemObject<T const>& bias,
+                                     BaseMemObject<T>& output,
+                                     EpilogueParams const& epilogue,
+                                     Conv2DParams const& params,
+                                     cl::sycl::queue& queue);
+
+/**
+ * Extract the buffers from the backend and launch the kernel to apply an
+ * epilogue in place to the NHWC output of a forward convolution.
+ */
+template <typename T, typename Backend>
+SNNStatus launch_epilogue(
+    typename Backend::template pointer_type<T const> bias,
+    typename Backend::template pointer_type<T> output,
+    EpilogueParams const& epilogue, Conv2DParams const& params,
+    Backend& backend) {
+  size_t const output_size = static_cast<size_t>(params.batch) *
+                             params.out_rows * params.out_cols *
+                             params.features;
+  auto bias_acc = backend.get_mem_object(bias, params.features);
+  auto out_acc = backend.get_mem_object(output, output_size);
+
+  cl::sycl::queue queue = backend.get_queue();
+  return launch_epilogue<T>(bias_acc, out_acc, epilogue, params, queue);
+}
+
+}  // namespace internal
+}  // namespace conv2d
+}  // namespace sycldnn
+#endif  // SYCLDNN_INCLUDE_INTERNAL_CONV2D_EPILOGUE_H_
@@ -26,6 +26,7 @@
 
 #include "sycldnn/internal/conv2d/im2col/allocated_pointer_set.h"
 #include "sycldnn/internal/conv2d/im2col/full_pointer_set.h"
+#include "sycldnn/internal/conv2d/im2col/grouped.h"
 #include "sycldnn/internal/conv2d/im2col/kernel_params.h"
 #include "sycldnn/internal/conv2d/im2col/launch_filter_transform.h"
 #include "sycldnn/internal/conv2d/im2col/launch_input_transform.h"
@@ -33,6 +34,8 @@
 #include "sycldnn/internal/conv2d/im2col/tile_info.h"
 #include "sycldnn/internal/conv2d/im2col/workspace_pointer_set.h"
 
+#include "sycldnn/internal/matmul/launch.h"
+
 namespace sycldnn {
 namespace conv2d {
 namespace internal {
@@ -107,16 +110,15 @@ static SNNStatus launch_im2col_for_minibatch(
   return {matmul_event, StatusCode::OK};
 }
 
-/** Loop over the minibatches to compute im2col. */
+/**
+ * Loop over the minibatches to compute im2col, using a filter which is
+ * already in the layout required by the matrix multiply.
+ */
 template <typename T, typename ConvType, typename Backend>
-static SNNStatus launch_im2col_for_all_minibatches(
+static SNNStatus launch_im2col_with_packed_filter(
     FullPointerSet<T, Backend, ConvType> const& pointers,
     TileInfo const& tile_info, BatchInfo const& batch_info,
     Conv2DParams const& params, Backend& backend) {
-  auto filter_status = launch_filter_transform(pointers, params, backend);
-  if (filter_status.status != StatusCode::OK) {
-    return filter_status;
-  }
   auto kernel_params = get_kernel_params<ConvType>(params);
   kernel_params.batch = batch_info.images_per_batch;
   cl::sycl::event event;
@@ -136,6 +138,116 @@ static SNNStatus launch_im2col_for_all_minibatches(
   return SNNStatus{event, StatusCode::OK};
 }
 
+/**
+ * Launch the input transform and matmul to compute im2col for the forward
+ * pass, using an ungrouped filter packed into tile panels by pack_filter().
+ */
+template <typename T, typename Backend>
+static SNNStatus launch_im2col_blocked_for_minibatch(
+    FullPointerSet<T, Backend, conv_type::Forward> const& pointers,
+    size_t in_offset, size_t out_offset, TileInfo const& tile_info,
+    Conv2DParams const& params, Backend& backend) {
+  using ConstPointer =
+      typename FullPointerSet<T, Backend, conv_type::Forward>::ConstPointer;
+  auto status =
+      launch_input_transform(pointers, in_offset, tile_info, params, backend);
+  if (status.status != StatusCode::OK) {
+    return status;
+  }
+
+  int const n_tiles = params.batch * tile_info.number;
+  int const tile_size = tile_info.size;
+  auto transform_access = backend.get_mem_object_internal(
+      ConstPointer{pointers.transform},
+      static_cast<size_t>(n_tiles) * tile_size);
+  auto filter_access = backend.get_mem_object_internal(
+      pointers.filter,
+      matmul::internal::get_packed_rhs_size(tile_size, params.features));
+  auto output_access = backend.get_mem_object_internal(
+      pointers.output + out_offset,
+      static_cast<size_t>(n_tiles) * params.features);
+
+  cl::sycl::queue queue = backend.get_queue();
+  return matmul::internal::launch_packed_rhs<T>(
+      transform_access, filter_access, output_access, n_tiles, tile_size,
+      params.features, static_cast<T>(0), queue);
+}
+
+/**
+ * Loop over the minibatches to compute the forward pass with im2col, using a
+ * filter packed into tile panels by pack_filter().
+ */
+template <typename T, typename Backend>
+static SNNStatus launch_im2col_with_blocked_filter(
+    FullPointerSet<T, Backend, conv_type::Forward> const& pointers,
+    TileInfo const& tile_info, BatchInfo const& batch_info,
+    Conv2DParams const& params, Backend& backend) {
+  auto kernel_params = get_kernel_params<conv_type::Forward>(params);
+  kernel_params.batch = batch_info.images_per_batch;
+  cl::sycl::event event;
+  for (size_t i = 0; i < batch_info.n_batches; ++i) {
+    auto offset = calculate_offsets<conv_type::Forward>(
+        i, batch_info.images_per_batch, params);
+    if (i == batch_info.n_batches - 1) {
+      kernel_params.batch = batch_info.last_batch_size;
+    }
+    auto status = launch_im2col_blocked_for_minibatch(
+        pointers, offset.in, offset.out, tile_info, kernel_params, backend);
+    event = status.event;
+    if (status.status != StatusCode::OK) {
+      return status;
+    }
+  }
+  return SNNStatus{event, StatusCode::OK};
+}
+
+/**
+ * Loop over the minibatches to compute im2col with a filter from
+ * pack_filter(). The ungrouped forward filter is packed into tile panels,
+ * which need the matmul that reads that layout.
+ */
+template <typename T, typename ConvType, typename Backend,
+          typename std::enable_if<
+              std::is_same<ConvType, conv_type::Forward>::value, int>::type = 0>
+static SNNStatus launch_im2col_with_prepacked_filter(
+    FullPointerSet<T, Backend, ConvType> const& pointers,
+    TileInfo const& tile_info, BatchInfo const& batch_info,
+    Conv2DParams const& params, Backend& backend) {
+  return launch_im2col_with_blocked_filter(pointers, tile_info, batch_info,
+                                           params, backend);
+}
+
+/**
+ * Loop over the minibatches to compute im2col with a filter from
+ * pack_filter(). The input backprop filter is packed as a plain matrix, so
+ * the backend matmul is used.
+ */
+template <typename T, typename ConvType, typename Backend,
+          typename std::enable_if<
+              !std::is_same<ConvType, conv_type::Forward>::value,
+              int>::type = 0>
+static SNNStatus launch_im2col_with_prepacked_filter(
+    FullPointerSet<T, Backend, ConvType> const& pointers,
+    TileInfo const& tile_info, BatchInfo const& batch_info,
+    Conv2DParams const& params, Backend& backend) {
+  return launch_im2col_with_packed_filter(pointers, tile_info, batch_info,
+                                          params, backend);
+}
+
+/** Transform the filter, then loop over the minibatches to compute im2col. */
+template <typename T, typename ConvType, typename Backend>
+static SNNStatus launch_im2col_for_all_minibatches(
+    FullPointerSet<T, Backend, ConvType> const& pointers,
+    TileInfo const& tile_info, BatchInfo const& batch_info,
+    Conv2DParams const& params, Backend& backend) {
+  auto filter_status = launch_filter_transform(pointers, params, backend);
+  if (filter_status.status != StatusCode::OK) {
+    return filter_status;
+  }
+  return launch_im2col_with_packed_filter(pointers, tile_info, batch_info,
+                                          params, backend);
+}
+
 /**
  * Split the input tensor into minibatches to ensure that the temporary
  * transform buffer can be safely allocated and create SYCL buffers using the
@@ -190,13 +302,138 @@ SNNStatus launch_im2col_with_workspace(
       backend);
 }
 
+/**
+ * Use a filter which has already been packed into the matrix multiply layout
+ * with pack_filter(), allocating a temporary buffer for the input transform.
+ * Then use im2col to compute the convolution for each minibatch.
+ */
+template <typename T, typename ConvType, typename Backend>
+SNNStatus allocate_and_launch_im2col_packed(
+    typename Backend::template pointer_type<T const> input,
+    typename Backend::template pointer_type<T> packed_filter,
+    typename Backend::template pointer_type<T> output,
+    Conv2DParams const& params, Backend& backend) {
+  using InternalPointer =
+      ::sycldnn::internal::helpers::InternalPointer<T, Backend>;
+  InternalPointerSet<T, Backend> pointers{input, packed_filter, output,
+                                          backend};
+  InternalPointer filter{packed_filter, backend};
+
+  auto const tile_info = im2col::get_tile_info<ConvType>(params);
+  size_t const size_per_image = tile_info.number * tile_info.size;
+  // Only the transform buffer is needed, which matches the pointers allocated
+  // for the forward pass.
+  im2col::AllocatedPointerSet<T, Backend, conv_type::Forward> all_pointers{
+      pointers, size_per_image, params, backend};
+
+  auto const batch_info = get_batch_info(all_pointers.allocated_transform_size,
+                                         params.batch, size_per_image);
+
+  return im2col::launch_im2col_with_prepacked_filter(
+      make_packed_pointer_set<ConvType, T, Backend>(
+          all_pointers.input, filter.get(), all_pointers.transform.get(),
+          all_pointers.output),
+      tile_info, batch_info, params, backend);
+}
+
+/**
+ * Use a filter which has already been packed into the matrix multiply layout
+ * with pack_filter(), and the provided workspace for the transform data. Then
+ * use im2col to compute the convolution for each minibatch.
+ */
+template <typename T, typename ConvType, typename Backend>
+SNNStatus launch_im2col_packed_with_workspace(
+    typename Backend::template pointer_type<T const> input,
+    typename Backend::template pointer_type<T> packed_filter,
+    typename Backend::template pointer_type<T> output,
+    typename Backend::template pointer_type<T> workspace,
+    Conv2DParams const& params, size_t workspace_size, Backend& backend) {
+  using InternalPointer =
+      ::sycldnn::internal::helpers::InternalPointer<T, Backend>;
+  InternalPointerSet<T, Backend> pointers{input, packed_filter, output,
+                                          backend};
+  InternalPointer filter{packed_filter, backend};
+
+  auto const tile_info = im2col::get_tile_info<ConvType>(params);
+  size_t const size_per_image = tile_info.number * tile_info.size;
+  im2col::WorkspacePointerSet<T, Backend, conv_type::Forward> all_pointers{
+      pointers, workspace, size_per_image, params, workspace_size, backend};
+  if (all_pointers.minibatch_size == 0) {
+    return StatusCode::InsufficientWorkspace;
+  }
+
+  auto const batch_info =
+      get_batch_info(all_pointers.minibatch_size, params.batch);
+
+  return im2col::launch_im2col_with_prepacked_filter(
+      make_packed_pointer_set<ConvType, T, Backend>(
+          all_pointers.input, filter.get(), all_pointers.transform.get(),
+          all_pointers.output),
+      tile_info, batch_info, params, backend);
+}
+
 }  // namespace im2col
 
+/**
+ * Pack a filter into the layout used by the im2col matrix multiply, so that it
+ * can be reused by launch_im2col_packed() without transforming it again.
+ *
+ * For a grouped forward pass the groups are separated into a batch of
+ * matrices, while an ungrouped forward filter is split into zero padded tile
+ * panels. For the input backprop the filter is mirrored and has its channel
+ * and feature dimensions swapped.
+ */
+template <typename T, typename ConvType, typename Backend>
+SNNStatus pack_im2col_filter(
+    typename Backend::template pointer_type<T const> filter,
+    typename Backend::template pointer_type<T> packed_filter,
+    Conv2DParams const& params, Backend& backend) {
+  using ConstInternalPointer =
+      ::sycldnn::internal::helpers::InternalPointer<T const, Backend>;
+  using InternalPointer =
+      ::sycldnn::internal::helpers::InternalPointer<T, Backend>;
+  ConstInternalPointer filter_ptr{filter, backend};
+  InternalPointer packed_ptr{packed_filter, backend};
+  return im2col::pack_filter<T, ConvType>(filter_ptr.get(), packed_ptr.get(),
+                                          params, backend);
+}
+
+/**
+ * The internal im2col convolution launcher using a pre-packed filter.
+ *
+ * The filter must have been packed with pack_im2col_filter(), so only the
+ * input transform and matrix multiply are computed.
+ */
+template <typename T, typename ConvType, typename Backend>
+SNNStatus launch_im2col_packed(
+    typename Backend::template pointer_type<T const> input,
+    typename Backend::template pointer_type<T> packed_filter,
+    typename Backend::template pointer_type<T> output,
+    typename Backend::template pointer_type<T> workspace,
+    Conv2DParams const& params, size_t workspace_size, Backend& backend) {
+  if (params.groups > 1) {
+    return im2col::launch_grouped_im2col_packed<T, ConvType>(
+        input, packed_filter, output, workspace, params, workspace_size,
+        backend);
+  }
+  if (workspace_size == 0) {
+    return im2col::allocate_and_launch_im2col_packed<T, ConvType>(
+        input, packed_filter, output, params, backend);
+  } else {
+    return im2col::launch_im2col_packed_with_workspace<T, ConvType>(
+        input, packed_filter, output, workspace, params, workspace_size,
+        backend);
+  }
+}
+
 /**
  * The internal im2col convolution launcher.
  *
  * Use im2col to compute a convolution, by transforming the input data then
  * computing a matrix multiply with the filter to give the output.
+ *
+ * Grouped convolutions are computed with a batched matrix multiply over the
+ * groups, which is not supported for the filter backprop.
  */
 template <typename T, typename ConvType, typename Backend>
 SNNStatus launch_im2col(typename Backend::template pointer_type<T const> input,
@@ -205,6 +442,13 @@ SNNStatus launch_im2col(typename Backend::template pointer_type<T const> input,
                         typename Backend::template pointer_type<T> workspace,
                         Conv2DParams const& params, size_t workspace_size,
                         Backend& backend) {
+  if (params.groups > 1) {
+    if (std::is_same<ConvType, conv_type::FilterBackprop>::value) {
+      return StatusCode::InvalidAlgorithm;
+    }
+    return im2col::launch_grouped_im2col<T, ConvType>(
+        input, filter, output, workspace, params, workspace_size, backend);
+  }
   if (workspace_size == 0) {
     return im2col::allocate_and_launch_im2col<T, ConvType>(
         input, filter, output, params, backend);
@@ -16,6 +16,10 @@
 #ifndef SYCLDNN_INCLUDE_INTERNAL_CONV2D_IM2COL_FULL_POINTER_SET_H_
 #define SYCLDNN_INCLUDE_INTERNAL_CONV2D_IM2COL_FULL_POINTER_SET_H_
 
+#include "sycldnn/conv2d/conv_type.h"
+
+#include <type_traits>
+
 namespace sycldnn {
 namespace conv2d {
 namespace internal {
@@ -55,6 +59,45 @@ struct FullPointerSet<T, Backend, conv_type::InputBackprop> {
   Pointer output;
 };
 
+/**
+ * Create the set of pointers for im2col using a filter which has already been
+ * packed into the matrix multiply layout.
+ */
+template <typename ConvType, typename T, typename Backend,
+          typename std::enable_if<
+              !std::is_same<ConvType, conv_type::InputBackprop>::value,
+              int>::type = 0>
+FullPointerSet<T, Backend, ConvType> make_packed_pointer_set(
+    typename Backend::template internal_pointer_type<T const> input,
+    typename Backend::template internal_pointer_type<T> packed_filter,
+    typename Backend::template internal_pointer_type<T> transform,
+    typename Backend::template internal_pointer_type<T> output) {
+  using ConstPointer =
+      typename Backend::template internal_pointer_type<T const>;
+  return {input, ConstPointer{packed_filter}, transform, output};
+}
+
+/**
+ * Create the set of pointers for im2col input backprop using a filter which
+ * has already been packed into the matrix multiply layout.
+ *
+ * The packed filter is used as both the original and transformed filter, as
+ * the filter transform is not run.
+ */
+template <typename ConvType, typename T, typename Backend,
+          typename std::enable_if<
+              std::is_same<ConvType, conv_type::InputBackprop>::value,
+              int>::type = 0>
+FullPointerSet<T, Backend, ConvType> make_packed_pointer_set(
+    typename Backend::template internal_pointer_type<T const> input,
+    typename Backend::template internal_pointer_type<T> packed_filter,
+    typename Backend::template internal_pointer_type<T> transform,
+    typename Backend::template internal_pointer_type<T> output) {
+  using ConstPointer =
+      typename Backend::template internal_pointer_type<T const>;
+  return {input, ConstPointer{packed_filter}, packed_filter, transform, output};
+}
+
 }  // namespace im2col
 }  // namespace internal
 }  // namespace conv2d
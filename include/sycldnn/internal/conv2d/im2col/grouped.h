@@ -0,0 +1,273 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef SYCLDNN_INCLUDE_INTERNAL_CONV2D_IM2COL_GROUPED_H_
+#define SYCLDNN_INCLUDE_INTERNAL_CONV2D_IM2COL_GROUPED_H_
+
+#include "sycldnn/status.h"
+
+#include "sycldnn/conv2d/conv_type.h"
+#include "sycldnn/conv2d/params.h"
+
+#include "sycldnn/internal/conv2d/alloc_info.h"
+#include "sycldnn/internal/conv2d/batch_info.h"
+#include "sycldnn/internal/conv2d/internal_pointer_set.h"
+
+#include "sycldnn/internal/conv2d/im2col/full_pointer_set.h"
+#include "sycldnn/internal/conv2d/im2col/kernel_params.h"
+#include "sycldnn/internal/conv2d/im2col/launch_filter_transform.h"
+#include "sycldnn/internal/conv2d/im2col/launch_input_transform.h"
+#include "sycldnn/internal/conv2d/im2col/offsets.h"
+#include "sycldnn/internal/conv2d/im2col/tile_info.h"
+
+#include "sycldnn/internal/helpers/allocated_pointer.h"
+#include "sycldnn/internal/helpers/internal_pointer.h"
+
+#include "sycldnn/internal/transpose/launch.h"
+
+#include <type_traits>
+
+namespace sycldnn {
+namespace conv2d {
+namespace internal {
+namespace im2col {
+
+/**
+ * Get the number of columns in the im2col matrix multiply output, which is the
+ * number of output channels of the convolution.
+ */
+template <typename ConvType>
+inline int get_matmul_size(Conv2DParams const& params) {
+  return std::is_same<ConvType, conv_type::InputBackprop>::value
+             ? params.channels
+             : params.features;
+}
+
+/**
+ * Get the number of elements in a grouped filter, which only holds
+ * channels / groups channels for each feature.
+ */
+inline size_t get_grouped_filter_size(Conv2DParams const& params) {
+  return static_cast<size_t>(params.window_rows) * params.window_cols *
+         (params.channels / params.groups) * params.features;
+}
+
+/**
+ * Get the number of temporary elements needed for each image in a grouped
+ * im2col convolution.
+ *
+ * Each image needs space for its input transform and for the output of the
+ * batched matrix multiply, which has the groups in the outer dimension and so
+ * must be transposed into the output tensor.
+ */
+template <typename ConvType>
+inline size_t get_grouped_size_per_image(Conv2DParams const& params) {
+  auto const tile_info = get_tile_info<ConvType>(params);
+  size_t const matmul_size = get_matmul_size<ConvType>(params);
+  return tile_info.number * (tile_info.size + matmul_size);
+}
+
+/**
+ * Launch the input transform, batched matmul and output transpose to compute
+ * a grouped im2col convolution for a single minibatch.
+ *
+ * The input transform writes the tiles for each group contiguously, so the
+ * groups are computed in a single batched matmul. The matmul output holds a
+ * matrix for each group, which is transposed to interleave the groups in the
+ * output tensor.
+ */
+template <typename T, typename ConvType, typename Backend>
+static SNNStatus launch_grouped_im2col_for_minibatch(
+    FullPointerSet<T, Backend, ConvType> const& pointers,
+    typename Backend::template internal_pointer_type<T> matmul_output,
+    size_t in_offset, size_t out_offset, TileInfo const& tile_info,
+    Conv2DParams const& params, Backend& backend) {
+  using ConstPointer =
+      typename FullPointerSet<T, Backend, ConvType>::ConstPointer;
+  auto status =
+      launch_input_transform(pointers, in_offset, tile_info, params, backend);
+  if (status.status != StatusCode::OK) {
+    return status;
+  }
+
+  int const groups = params.groups;
+  int const n_tiles = params.batch * tile_info.number;
+  int const group_tile_size = tile_info.size / groups;
+  int const group_matmul_size = get_matmul_size<ConvType>(params) / groups;
+  backend.template batch_matmul<false, false>(
+      ConstPointer{pointers.transform}, ConstPointer{pointers.filter},
+      matmul_output, groups, n_tiles, group_tile_size, group_matmul_size);
+
+  size_t const output_size =
+      static_cast<size_t>(n_tiles) * groups * group_matmul_size;
+  auto matmul_acc = backend.get_mem_object_internal(ConstPointer{matmul_output},
+                                                    output_size);
+  auto output_acc = backend.get_mem_object_internal(
+      pointers.output + out_offset, output_size);
+  cl::sycl::queue queue = backend.get_queue();
+  return transpose::internal::launch<T>(matmul_acc, output_acc,
+                                        {groups, n_tiles, group_matmul_size},
+                                        {1, 0, 2}, queue);
+}
+
+/**
+ * Loop over the minibatches to compute a grouped im2col convolution using a
+ * filter which has already been packed into the batched matmul layout.
+ *
+ * The scratch buffer is split between the input transform and the matmul
+ * output, with as many images in each minibatch as will fit.
+ */
+template <typename T, typename ConvType, typename Backend>
+static SNNStatus launch_grouped_im2col_with_scratch(
+    typename Backend::template internal_pointer_type<T const> input,
+    typename Backend::template internal_pointer_type<T> packed_filter,
+    typename Backend::template internal_pointer_type<T> output,
+    typename Backend::template internal_pointer_type<T> scratch,
+    size_t scratch_size, Conv2DParams const& params, Backend& backend) {
+  auto const tile_info = get_tile_info<ConvType>(params);
+  size_t const transform_per_image = tile_info.number * tile_info.size;
+  size_t const size_per_image = get_grouped_size_per_image<ConvType>(params);
+  if (scratch_size < size_per_image) {
+    return StatusCode::InsufficientWorkspace;
+  }
+  auto const batch_info =
+      get_batch_info(scratch_size, params.batch, size_per_image);
+
+  auto const pointers = make_packed_pointer_set<ConvType, T, Backend>(
+      input, packed_filter, scratch, output);
+  auto const matmul_output =
+      scratch + batch_info.images_per_batch * transform_per_image;
+
+  auto kernel_params = get_kernel_params<ConvType>(params);
+  kernel_params.batch = batch_info.images_per_batch;
+  cl::sycl::event event;
+  for (size_t i = 0; i < batch_info.n_batches; ++i) {
+    auto offset =
+        calculate_offsets<ConvType>(i, batch_info.images_per_batch, params);
+    if (i == batch_info.n_batches - 1) {
+      kernel_params.batch = batch_info.last_batch_size;
+    }
+    auto status = launch_grouped_im2col_for_minibatch(
+        pointers, matmul_output, offset.in, offset.out, tile_info,
+        kernel_params, backend);
+    event = status.event;
+    if (status.status != StatusCode::OK) {
+      return status;
+    }
+  }
+  return SNNStatus{event, StatusCode::OK};
+}
+
+/**
+ * Compute a grouped im2col convolution using a filter which has already been
+ * packed with pack_filter().
+ *
+ * If no workspace is provided then a temporary scratch buffer is allocated,
+ * otherwise the workspace is used for the scratch buffer.
+ */
+template <typename T, typename ConvType, typename Backend>
+SNNStatus launch_grouped_im2col_packed(
+    typename Backend::template pointer_type<T const> input,
+    typename Backend::template pointer_type<T> packed_filter,
+    typename Backend::template pointer_type<T> output,
+    typename Backend::template pointer_type<T> workspace,
+    Conv2DParams const& params, size_t workspace_size, Backend& backend) {
+  using AllocatedPointer =
+      ::sycldnn::internal::helpers::AllocatedPointer<T, Backend>;
+  using InternalPointer =
+      ::sycldnn::internal::helpers::InternalPointer<T, Backend>;
+  InternalPointerSet<T, Backend> pointers{input, packed_filter, output,
+                                          backend};
+  InternalPointer filter{packed_filter, backend};
+
+  if (workspace_size == 0) {
+    size_t const size_per_image = get_grouped_size_per_image<ConvType>(params);
+    cl::sycl::device device = backend.get_queue().get_device();
+    auto const alloc_info =
+        get_alloc_info(device, params.batch, size_per_image * sizeof(T));
+    size_t const scratch_size = size_per_image * alloc_info.images_per_alloc;
+    AllocatedPointer scratch{sizeof(T) * scratch_size, backend};
+    return launch_grouped_im2col_with_scratch<T, ConvType>(
+        pointers.input.get(), filter.get(), pointers.output.get(),
+        scratch.get(), scratch_size, params, backend);
+  } else {
+    InternalPointer scratch{workspace, backend};
+    return launch_grouped_im2col_with_scratch<T, ConvType>(
+        pointers.input.get(), filter.get(), pointers.output.get(),
+        scratch.get(), workspace_size, params, backend);
+  }
+}
+
+/**
+ * Compute a grouped im2col convolution.
+ *
+ * The filter is first packed into a [groups, window * channels, features]
+ * tensor of matrices, so that all groups are computed in the same batched
+ * matmul. If a workspace is provided then the packed filter is stored at the
+ * start of the workspace, with the remainder used as scratch space.
+ */
+template <typename T, typename ConvType, typename Backend>
+SNNStatus launch_grouped_im2col(
+    typename Backend::template pointer_type<T const> input,
+    typename Backend::template pointer_type<T const> filter,
+    typename Backend::template pointer_type<T> output,
+    typename Backend::template pointer_type<T> workspace,
+    Conv2DParams const& params, size_t workspace_size, Backend& backend) {
+  using AllocatedPointer =
+      ::sycldnn::internal::helpers::AllocatedPointer<T, Backend>;
+  using InternalPointer =
+      ::sycldnn::internal::helpers::InternalPointer<T, Backend>;
+  InternalPointerSet<T, Backend> pointers{input, filter, output, backend};
+  size_t const filter_size = get_grouped_filter_size(params);
+
+  if (workspace_size == 0) {
+    AllocatedPointer packed_filter{sizeof(T) * filter_size, backend};
+    auto status = pack_filter<T, ConvType>(
+        pointers.filter.get(), packed_filter.get(), params, backend);
+    if (status.status != StatusCode::OK) {
+      return status;
+    }
+    size_t const size_per_image = get_grouped_size_per_image<ConvType>(params);
+    cl::sycl::device device = backend.get_queue().get_device();
+    auto const alloc_info =
+        get_alloc_info(device, params.batch, size_per_image * sizeof(T));
+    size_t const scratch_size = size_per_image * alloc_info.images_per_alloc;
+    AllocatedPointer scratch{sizeof(T) * scratch_size, backend};
+    return launch_grouped_im2col_with_scratch<T, ConvType>(
+        pointers.input.get(), packed_filter.get(), pointers.output.get(),
+        scratch.get(), scratch_size, params, backend);
+  } else {
+    if (workspace_size < filter_size) {
+      return StatusCode::InsufficientWorkspace;
+    }
+    InternalPointer packed_filter{workspace, backend};
+    auto status = pack_filter<T, ConvType>(
+        pointers.filter.get(), packed_filter.get(), params, backend);
+    if (status.status != StatusCode::OK) {
+      return status;
+    }
+    return launch_grouped_im2col_with_scratch<T, ConvType>(
+        pointers.input.get(), packed_filter.get(), pointers.output.get(),
+        packed_filter.get() + filter_size, workspace_size - filter_size,
+        params, backend);
+  }
+}
+
+}  // namespace im2col
+}  // namespace internal
+}  // namespace conv2d
+}  // namespace sycldnn
+
+#endif  // SYCLDNN_INCLUDE_INTERNAL_CONV2D_IM2COL_GROUPED_H_
@@ -23,6 +23,9 @@
 
 #include "sycldnn/internal/conv2d/im2col/full_pointer_set.h"
 
+#include "sycldnn/internal/matmul/launch.h"
+#include "sycldnn/internal/transpose/launch.h"
+
 #include "sycldnn/export.h"
 
 namespace sycldnn {
@@ -75,7 +78,8 @@ static SNNStatus launch_filter_transform(
     FullPointerSet<T, Backend, ConvType> const& pointers,
     Conv2DParams const& params, Backend& backend) {
   size_t const filter_size = params.window_rows * params.window_cols *
-                             params.channels * params.features;
+                             (params.channels / params.groups) *
+                             params.features;
   auto filter_access =
       backend.get_mem_object_internal(pointers.original_filter, filter_size);
 
@@ -87,6 +91,81 @@ static SNNStatus launch_filter_transform(
                                  queue);
 }
 
+/**
+ * Pack the filter into the layout used by the forward pass matrix multiply.
+ *
+ * An ungrouped HWCF filter is the [window * channels, features] right hand
+ * side of the matrix multiply, so it is split into the zero padded tile panels
+ * read by matmul::internal::launch_packed_rhs().
+ *
+ * The features of each group in a grouped filter are interleaved, so the
+ * filter is transposed to give a [groups, window * channels, features] tensor
+ * of matrices for the batched matrix multiply.
+ */
+template <typename T, typename ConvType, typename Backend,
+          typename std::enable_if<
+              !std::is_same<ConvType, conv_type::InputBackprop>::value,
+              int>::type = 0>
+SNNStatus pack_filter(
+    typename Backend::template internal_pointer_type<T const> filter,
+    typename Backend::template internal_pointer_type<T> packed_filter,
+    Conv2DParams const& params, Backend& backend) {
+  if (params.groups == 1) {
+    int const matrix_rows =
+        params.window_rows * params.window_cols * params.channels;
+    size_t const filter_size =
+        static_cast<size_t>(matrix_rows) * params.features;
+    auto filter_access = backend.get_mem_object_internal(filter, filter_size);
+    auto packed_access = backend.get_mem_object_internal(
+        packed_filter,
+        matmul::internal::get_packed_rhs_size(matrix_rows, params.features));
+
+    cl::sycl::queue queue = backend.get_queue();
+    return matmul::internal::launch_pack_rhs<T>(
+        filter_access, packed_access, matrix_rows, params.features, queue);
+  }
+  size_t const filter_size = params.window_rows * params.window_cols *
+                             (params.channels / params.groups) *
+                             params.features;
+  auto filter_access = backend.get_mem_object_internal(filter, filter_size);
+  auto packed_access =
+      backend.get_mem_object_internal(packed_filter, filter_size);
+
+  cl::sycl::queue queue = backend.get_queue();
+  int const matrix_rows = params.window_rows * params.window_cols *
+                          (params.channels / params.groups);
+  int const group_features = params.features / params.groups;
+  return transpose::internal::launch<T>(
+      filter_access, packed_access,
+      {matrix_rows, params.groups, group_features}, {1, 0, 2}, queue);
+}
+
+/**
+ * Pack the filter into the layout used by the input backprop matrix multiply,
+ * by running the input backprop filter transform.
+ *
+ * The filter transform also separates the groups in a grouped convolution, so
+ * no further transpose is needed.
+ */
+template <
+    typename T, typename ConvType, typename Backend,
+    typename std::enable_if<
+        std::is_same<ConvType, conv_type::InputBackprop>::value, int>::type = 0>
+SNNStatus pack_filter(
+    typename Backend::template internal_pointer_type<T const> filter,
+    typename Backend::template internal_pointer_type<T> packed_filter,
+    Conv2DParams const& params, Backend& backend) {
+  size_t const filter_size = params.window_rows * params.window_cols *
+                             (params.channels / params.groups) *
+                             params.features;
+  auto filter_access = backend.get_mem_object_internal(filter, filter_size);
+  auto packed_access =
+      backend.get_mem_object_internal(packed_filter, filter_size);
+
+  cl::sycl::queue queue = backend.get_queue();
+  return launch_filter_transform(filter_access, packed_access, params, queue);
+}
+
 }  // namespace im2col
 }  // namespace internal
 }  // namespace conv2d
@@ -0,0 +1,223 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef SYCLDNN_INCLUDE_INTERNAL_CONV2D_LAYOUT_H_
+#define SYCLDNN_INCLUDE_INTERNAL_CONV2D_LAYOUT_H_
+
+#include "sycldnn/data_format.h"
+#include "sycldnn/filter_format.h"
+#include "sycldnn/status.h"
+
+#include "sycldnn/conv2d/algorithm.h"
+#include "sycldnn/conv2d/conv_type.h"
+#include "sycldnn/conv2d/params.h"
+#include "sycldnn/conv2d/sizes.h"
+
+#include "sycldnn/internal/helpers/layout_conversion.h"
+#include "sycldnn/internal/transpose/layout.h"
+
+#include <stddef.h>
+#include <type_traits>
+
+namespace sycldnn {
+namespace conv2d {
+namespace internal {
+
+using transpose::internal::LayoutTranspose;
+
+/**
+ * Check whether a convolution algorithm has to be run on NHWC copies of the
+ * convolution tensors.
+ *
+ * Only the direct algorithm has NCHW kernels, which read FCHW filters. The
+ * forward direct and tiled kernels index the channel blocked formats directly
+ * with HWCF filters, while every other convolution converts them.
+ *
+ * \tparam ConvType The type of convolution.
+ * \param params    The convolution parameters.
+ * \param algo_tag  The algorithm chosen to compute the convolution.
+ * \return Returns true if the tensors need to be converted to NHWC.
+ */
+template <typename ConvType>
+bool requires_nhwc(Conv2DParams const& params, Algorithm algo_tag) {
+  if (is_channel_blocked(params.input_format)) {
+    return !std::is_same<ConvType, conv_type::Forward>::value ||
+           (algo_tag != Algorithm::Direct && algo_tag != Algorithm::Tiled);
+  }
+  return params.input_format == DataFormat::NCHW &&
+         (algo_tag != Algorithm::Direct ||
+          params.filter_format != FilterFormat::FCHW);
+}
+
+/** Get the parameters for the convolution on NHWC copies of the tensors. */
+inline Conv2DParams get_nhwc_params(Conv2DParams const& params) {
+  Conv2DParams nhwc_params = params;
+  nhwc_params.input_format = DataFormat::NHWC;
+  nhwc_params.filter_format = FilterFormat::HWCF;
+  return nhwc_params;
+}
+
+/** Get the transpose converting an NHWC data tensor to the given format. */
+inline LayoutTranspose from_nhwc(size_t batch, size_t spatial,
+                                 size_t channels, DataFormat format) {
+  return transpose::internal::get_layout_transpose(
+      static_cast<int>(batch), static_cast<int>(spatial), 1,
+      static_cast<int>(channels), DataFormat::NHWC, format);
+}
+
+/** Get the transpose converting a data tensor in the given format to NHWC. */
+inline LayoutTranspose to_nhwc(size_t batch, size_t spatial, size_t channels,
+                               DataFormat format) {
+  return transpose::internal::get_layout_transpose(
+      static_cast<int>(batch), static_cast<int>(spatial), 1,
+      static_cast<int>(channels), format, DataFormat::NHWC);
+}
+
+/** Get the transpose converting a filter in the given format to HWCF. */
+inline LayoutTranspose to_hwcf(Conv2DParams const& params) {
+  if (params.filter_format == FilterFormat::HWCF) {
+    return {};
+  }
+  return {{params.features, params.channels / params.groups,
+           params.window_rows, params.window_cols},
+          {2, 3, 1, 0}};
+}
+
+/** Get the transpose converting an HWCF filter to the given format. */
+inline LayoutTranspose from_hwcf(Conv2DParams const& params) {
+  if (params.filter_format == FilterFormat::HWCF) {
+    return {};
+  }
+  return {{params.window_rows, params.window_cols,
+           params.channels / params.groups, params.features},
+          {3, 2, 0, 1}};
+}
+
+/** Get the transpose converting the convolution input to NHWC. */
+template <typename ConvType>
+LayoutTranspose get_input_transpose(Conv2DParams const& params) {
+  auto batch = get_batch_sizes<ConvType>(params);
+  auto spatial = get_spatial_sizes<ConvType>(params);
+  auto channels = get_channel_sizes<ConvType>(params);
+  return to_nhwc(batch.input_size, spatial.input_size, channels.input_size,
+                 params.input_format);
+}
+
+/** Get the transpose converting the convolution filter to HWCF. */
+template <typename ConvType>
+LayoutTranspose get_filter_transpose(Conv2DParams const& params) {
+  return to_hwcf(params);
+}
+
+/**
+ * The filter backprop takes the output gradient in place of the filter, so
+ * convert that to NHWC.
+ */
+template <>
+inline LayoutTranspose get_filter_transpose<conv_type::FilterBackprop>(
+    Conv2DParams const& params) {
+  using ConvType = conv_type::FilterBackprop;
+  auto batch = get_batch_sizes<ConvType>(params);
+  auto spatial = get_spatial_sizes<ConvType>(params);
+  auto channels = get_channel_sizes<ConvType>(params);
+  return to_nhwc(batch.filter_size, spatial.filter_size, channels.filter_size,
+                 params.input_format);
+}
+
+/** Get the transpose converting the NHWC convolution output back. */
+template <typename ConvType>
+LayoutTranspose get_output_transpose(Conv2DParams const& params) {
+  auto batch = get_batch_sizes<ConvType>(params);
+  auto spatial = get_spatial_sizes<ConvType>(params);
+  auto channels = get_channel_sizes<ConvType>(params);
+  return from_nhwc(batch.output_size, spatial.output_size,
+                   channels.output_size, params.input_format);
+}
+
+/**
+ * The filter backprop computes the filter gradient, so convert that from HWCF
+ * back to the filter format.
+ */
+template <>
+inline LayoutTranspose get_output_transpose<conv_type::FilterBackprop>(
+    Conv2DParams const& params) {
+  return from_hwcf(params);
+}
+
+/**
+ * Get the number of workspace elements needed to hold the NHWC and HWCF copies
+ * of the convolution tensors.
+ */
+template <typename ConvType>
+size_t get_conversion_size(Conv2DParams const& params) {
+  return ::sycldnn::internal::helpers::get_conversion_size(
+      get_input_transpose<ConvType>(params),
+      get_filter_transpose<ConvType>(params),
+      get_output_transpose<ConvType>(params));
+}
+
+/**
+ * Compute a convolution with an algorithm which only supports NHWC, by
+ * converting the tensors to NHWC and HWCF and converting the output back.
+ *
+ * The NHWC and HWCF copies are held at the start of the workspace if it also
+ * has space for the algorithm's required workspace, otherwise they are
+ * allocated through the backend.
+ *
+ * \param input          A pointer to the input tensor.
+ * \param filter         A pointer to the filter tensor.
+ * \param output         A pointer to the output tensor.
+ * \param workspace      A pointer to the workspace buffer.
+ * \param params         The convolution parameters.
+ * \param workspace_size The number of elements available in the workspace.
+ * \param algo_size      The number of workspace elements required by the
+ *                       algorithm computing the NHWC convolution.
+ * \param backend        The backend used to allocate the temporary tensors.
+ * \param launch_nhwc    Functor taking the NHWC input, filter and output
+ *                       pointers, the workspace pointer and size left for the
+ *                       algorithm, and the NHWC convolution parameters, which
+ *                       launches the NHWC convolution.
+ * \return Returns an SNNStatus containing the SYCL event tied to the final
+ *         kernel launch and a StatusCode enum showing if the launch was OK or
+ *         whether it encountered some problem.
+ */
+template <typename T, typename ConvType, typename Backend, typename Launcher>
+SNNStatus launch_via_nhwc(
+    typename Backend::template pointer_type<T const> input,
+    typename Backend::template pointer_type<T const> filter,
+    typename Backend::template pointer_type<T> output,
+    typename Backend::template pointer_type<T> workspace,
+    Conv2DParams const& params, size_t workspace_size, size_t algo_size,
+    Backend& backend, Launcher&& launch_nhwc) {
+  using ConstPointer = typename Backend::template pointer_type<T const>;
+  using Pointer = typename Backend::template pointer_type<T>;
+  Conv2DParams const nhwc_params = get_nhwc_params(params);
+  return ::sycldnn::internal::helpers::launch_with_converted_layouts<T>(
+      input, filter, output, get_input_transpose<ConvType>(params),
+      get_filter_transpose<ConvType>(params),
+      get_output_transpose<ConvType>(params), workspace, workspace_size,
+      algo_size, backend,
+      [&](ConstPointer nhwc_input, ConstPointer nhwc_filter,
+          Pointer nhwc_output, Pointer nhwc_workspace,
+          size_t nhwc_workspace_size) {
+        return launch_nhwc(nhwc_input, nhwc_filter, nhwc_output,
+                           nhwc_workspace, nhwc_workspace_size, nhwc_params);
+      });
+}
+
+}  // namespace internal
+}  // namespace conv2d
+}  // namespace sycldnn
+#endif  // SYCLDNN_INCLUDE_INTERNAL_CONV2D_LAYOUT_H_
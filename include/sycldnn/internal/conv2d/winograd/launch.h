@@ -18,6 +18,7 @@
 
 #include "sycldnn/status.h"
 
+#include "sycldnn/conv2d/epilogue.h"
 #include "sycldnn/conv2d/params.h"
 
 #include "sycldnn/internal/conv2d/batch_info.h"
@@ -31,6 +32,10 @@
 #include "sycldnn/internal/conv2d/winograd/pointer_set.h"
 #include "sycldnn/internal/conv2d/winograd/tile_info.h"
 
+#include "sycldnn/internal/helpers/internal_pointer.h"
+
+#include <algorithm>
+
 #include <CL/sycl.hpp>
 
 /**
@@ -49,10 +54,14 @@ namespace internal {
 namespace winograd {
 
 /**
- * Launch the kernels to compute a convolution over all minibatches.
+ * Launch the kernels to compute a convolution over all minibatches, using a
+ * filter which has already been transformed into the Winograd domain and
+ * stored in the filter transform pointer.
  *
  * \param pointers   Full set of pointers for the convolution
+ * \param bias       Bias tensor, only read if the epilogue adds a bias
  * \param params     Kernel parameters for the convolution
+ * \param epilogue   Bias and activation to apply to the output
  * \param tile_info  Information about the number of Winograd tiles
  * \param batch_info Information about the minibatch size
  * \param backend    Backend to use for matrix multiplication
@@ -64,23 +73,17 @@ template <
     typename std::enable_if<
         !std::is_same<ConvType, conv_type::FilterBackprop>::value, int>::type =
         0>
-SNNStatus launch_with_transforms(FullPointerSet<T, Backend> const& pointers,
-                                 Conv2DParams const& params,
-                                 TileInfo const& tile_info,
-                                 BatchInfo const& batch_info,
-                                 Backend& backend) {
+SNNStatus launch_with_transformed_filter(
+    FullPointerSet<T, Backend> const& pointers,
+    typename Backend::template internal_pointer_type<T const> bias,
+    Conv2DParams const& params, EpilogueParams const& epilogue,
+    TileInfo const& tile_info, BatchInfo const& batch_info, Backend& backend) {
   constexpr int A = M + R - 1;
   constexpr int B = N + S - 1;
   constexpr bool transpose_input = false;
   // Need to transpose for the input backprop, but not for the forward pass
   constexpr bool transpose_filter =
       std::is_same<ConvType, conv_type::InputBackprop>::value;
-  auto fil_status = launch_filter_transform<T, ConvType, M, N, R, S>(
-      pointers.filter, pointers.filter_transform, params, tile_info, backend);
-  if (fil_status.status != StatusCode::OK) {
-    return fil_status;
-  }
-
   cl::sycl::event last_event;
   Conv2DParams kernel_params{params};
   kernel_params.batch = batch_info.images_per_batch;
@@ -104,8 +107,8 @@ SNNStatus launch_with_transforms(FullPointerSet<T, Backend> const& pointers,
         kernel_params.channels, kernel_params.features);
 
     auto out_status = launch_output_transform<T, ConvType, M, N, R, S>(
-        pointers.intermediate, pointers.output + offset.out, kernel_params,
-        tile_info, backend);
+        pointers.intermediate, bias, pointers.output + offset.out,
+        kernel_params, epilogue, tile_info, backend);
     if (out_status.status != StatusCode::OK) {
       return out_status;
     }
@@ -114,17 +117,50 @@ SNNStatus launch_with_transforms(FullPointerSet<T, Backend> const& pointers,
   return SNNStatus{last_event, StatusCode::OK};
 }
 
+/**
+ * Launch the kernels to compute a convolution over all minibatches.
+ *
+ * \param pointers   Full set of pointers for the convolution
+ * \param bias       Bias tensor, only read if the epilogue adds a bias
+ * \param params     Kernel parameters for the convolution
+ * \param epilogue   Bias and activation to apply to the output, ignored for
+ *                   the filter backprop
+ * \param tile_info  Information about the number of Winograd tiles
+ * \param batch_info Information about the minibatch size
+ * \param backend    Backend to use for matrix multiplication
+ * \return An SNNStatus object containing a SYCL event corresponding to the last
+ * kernel launched.
+ */
+template <
+    typename T, int M, int N, int R, int S, typename ConvType, typename Backend,
+    typename std::enable_if<
+        !std::is_same<ConvType, conv_type::FilterBackprop>::value, int>::type =
+        0>
+SNNStatus launch_with_transforms(
+    FullPointerSet<T, Backend> const& pointers,
+    typename Backend::template internal_pointer_type<T const> bias,
+    Conv2DParams const& params, EpilogueParams const& epilogue,
+    TileInfo const& tile_info, BatchInfo const& batch_info, Backend& backend) {
+  auto fil_status = launch_filter_transform<T, ConvType, M, N, R, S>(
+      pointers.filter, pointers.filter_transform, params, tile_info, backend);
+  if (fil_status.status != StatusCode::OK) {
+    return fil_status;
+  }
+  return launch_with_transformed_filter<T, M, N, R, S, ConvType>(
+      pointers, bias, params, epilogue, tile_info, batch_info, backend);
+}
+
 /** \copydoc launch_with_transforms() */
 template <
     typename T, int M, int N, int R, int S, typename ConvType, typename Backend,
     typename std::enable_if<
         std::is_same<ConvType, conv_type::FilterBackprop>::value, int>::type =
         0>
-SNNStatus launch_with_transforms(FullPointerSet<T, Backend> pointers,
-                                 Conv2DParams const& params,
-                                 TileInfo const& tile_info,
-                                 BatchInfo const& batch_info,
-                                 Backend& backend) {
+SNNStatus launch_with_transforms(
+    FullPointerSet<T, Backend> pointers,
+    typename Backend::template internal_pointer_type<T const> /*bias*/,
+    Conv2DParams const& params, EpilogueParams const& /*epilogue*/,
+    TileInfo const& tile_info, BatchInfo const& batch_info, Backend& backend) {
   constexpr int A = M + R - 1;
   constexpr int B = N + S - 1;
   constexpr bool transpose_input = true;
@@ -196,12 +232,14 @@ SNNStatus launch_with_transforms(FullPointerSet<T, Backend> pointers,
  * required temporary buffers, compute the Winograd tile sizes and then launch
  * the convolution with launch_with_transforms().
  *
- * \param input   User provided input pointer
- * \param filter  User provided filter pointer
- * \param output  User provided output pointer
- * \param params  User provided convolution parameters
- * \param backend User provided backend to handle allocations and matrix
- *                multiplies
+ * \param input    User provided input pointer
+ * \param filter   User provided filter pointer
+ * \param bias     User provided bias pointer
+ * \param output   User provided output pointer
+ * \param params   User provided convolution parameters
+ * \param epilogue Bias and activation to apply to the output
+ * \param backend  User provided backend to handle allocations and matrix
+ *                 multiplies
  * \return An SNNStatus object containing a SYCL event corresponding to the last
  * kernel launched.
  */
@@ -210,12 +248,17 @@ template <typename T, typename ConvType, int M, int N, int R, int S,
 SNNStatus allocate_and_launch_with_tiles(
     typename Backend::template pointer_type<T const> input,
     typename Backend::template pointer_type<T const> filter,
+    typename Backend::template pointer_type<T const> bias,
     typename Backend::template pointer_type<T> output,
-    Conv2DParams const& params, Backend& backend) {
+    Conv2DParams const& params, EpilogueParams const& epilogue,
+    Backend& backend) {
+  using ConstInternalPointer =
+      ::sycldnn::internal::helpers::InternalPointer<T const, Backend>;
   constexpr int A = M + R - 1;
   constexpr int B = N + S - 1;
   auto kernel_params = get_params<ConvType>(params);
   InternalPointerSet<T, Backend> input_pointers{input, filter, output, backend};
+  ConstInternalPointer bias_ptr{bias, backend};
   auto const tile_info = get_tile_info<ConvType, M, N, R, S>(kernel_params);
   AllocatedPointerSet<T, Backend> allocated_pointers{
       input_pointers, kernel_params, A * B, tile_info, backend};
@@ -223,8 +266,8 @@ SNNStatus allocate_and_launch_with_tiles(
       get_batch_info(allocated_pointers.minibatch_size, params.batch);
 
   return launch_with_transforms<T, M, N, R, S, ConvType>(
-      allocated_pointers.to_full_pointer_set(), kernel_params, tile_info,
-      batch_info, backend);
+      allocated_pointers.to_full_pointer_set(), bias_ptr.get(), kernel_params,
+      epilogue, tile_info, batch_info, backend);
 }
 
 /**
@@ -234,9 +277,11 @@ SNNStatus allocate_and_launch_with_tiles(
  *
  * \param input          User provided input pointer
  * \param filter         User provided filter pointer
+ * \param bias           User provided bias pointer
  * \param output         User provided output pointer
  * \param workspace      Pointer to user provided workspace buffer
  * \param params         User provided convolution parameters
+ * \param epilogue       Bias and activation to apply to the output
  * \param workspace_size Number of elements available in the workspace buffer
  * \param backend        User provided backend to handle allocations and matrix
  *                       multiplies
@@ -248,15 +293,20 @@ template <typename T, typename ConvType, int M, int N, int R, int S,
 SNNStatus split_workspace_and_launch_with_tiles(
     typename Backend::template pointer_type<T const> input,
     typename Backend::template pointer_type<T const> filter,
+    typename Backend::template pointer_type<T const> bias,
     typename Backend::template pointer_type<T> output,
     typename Backend::template pointer_type<T> workspace,
-    Conv2DParams const& params, size_t workspace_size, Backend& backend) {
+    Conv2DParams const& params, EpilogueParams const& epilogue,
+    size_t workspace_size, Backend& backend) {
+  using ConstInternalPointer =
+      ::sycldnn::internal::helpers::InternalPointer<T const, Backend>;
   using InternalPointer =
       ::sycldnn::internal::helpers::InternalPointer<T, Backend>;
   constexpr int A = M + R - 1;
   constexpr int B = N + S - 1;
   auto kernel_params = get_params<ConvType>(params);
   InternalPointerSet<T, Backend> input_pointers{input, filter, output, backend};
+  ConstInternalPointer bias_ptr{bias, backend};
   auto const tile_info = get_tile_info<ConvType, M, N, R, S>(kernel_params);
 
   size_t const filter_transform_size =
@@ -285,7 +335,8 @@ SNNStatus split_workspace_and_launch_with_tiles(
 
   auto batch_info = get_batch_info(minibatch_size, params.batch);
   return launch_with_transforms<T, M, N, R, S, ConvType>(
-      all_pointers, kernel_params, tile_info, batch_info, backend);
+      all_pointers, bias_ptr.get(), kernel_params, epilogue, tile_info,
+      batch_info, backend);
 }
 
 /**
@@ -298,16 +349,19 @@ template <typename T, typename ConvType, int M, int N, int R, int S,
 SNNStatus launch_with_tiles(
     typename Backend::template pointer_type<T const> input,
     typename Backend::template pointer_type<T const> filter,
+    typename Backend::template pointer_type<T const> bias,
     typename Backend::template pointer_type<T> output,
     typename Backend::template pointer_type<T> workspace,
-    Conv2DParams const& params, size_t workspace_size, Backend& backend) {
+    Conv2DParams const& params, EpilogueParams const& epilogue,
+    size_t workspace_size, Backend& backend) {
   if (workspace_size == 0) {
     return allocate_and_launch_with_tiles<T, ConvType, M, N, R, S, Backend>(
-        input, filter, output, params, backend);
+        input, filter, bias, output, params, epilogue, backend);
   } else {
     return split_workspace_and_launch_with_tiles<T, ConvType, M, N, R, S,
                                                  Backend>(
-        input, filter, output, workspace, params, workspace_size, backend);
+        input, filter, bias, output, workspace, params, epilogue,
+        workspace_size, backend);
   }
 }
 
@@ -316,12 +370,15 @@ SNNStatus launch_with_tiles(
  * available Winograd tile sizes and launch those kernels using
  * launch_with_tiles().
  *
- * \param input   User provided input pointer
- * \param filter  User provided filter pointer
- * \param output  User provided output pointer
- * \param params  User provided convolution parameters
- * \param backend User provided backend to handle allocations and matrix
- *                multiplies
+ * \param input    User provided input pointer
+ * \param filter   User provided filter pointer
+ * \param bias     User provided bias pointer, only read if the epilogue adds a
+ *                 bias
+ * \param output   User provided output pointer
+ * \param params   User provided convolution parameters
+ * \param epilogue Bias and activation to apply to the output
+ * \param backend  User provided backend to handle allocations and matrix
+ *                 multiplies
  * \return An SNNStatus object containing a SYCL event corresponding to the last
  * kernel launched.
  */
@@ -331,25 +388,47 @@ template <typename T, typename ConvType, typename Backend,
               int>::type = 0>
 SNNStatus launch(typename Backend::template pointer_type<T const> input,
                  typename Backend::template pointer_type<T const> filter,
+                 typename Backend::template pointer_type<T const> bias,
                  typename Backend::template pointer_type<T> output,
                  typename Backend::template pointer_type<T> workspace,
-                 Conv2DParams const& params, size_t workspace_size,
-                 Backend& backend) {
+                 Conv2DParams const& params, EpilogueParams const& epilogue,
+                 size_t workspace_size, Backend& backend) {
   if (params.window_rows == 3 && params.window_cols == 3) {
     return launch_with_tiles<T, ConvType, 2, 2, 3, 3>(
-        input, filter, output, workspace, params, workspace_size, backend);
+        input, filter, bias, output, workspace, params, epilogue,
+        workspace_size, backend);
   }
   if (params.window_rows == 3 && params.window_cols == 1) {
     return launch_with_tiles<T, ConvType, 2, 1, 3, 1>(
-        input, filter, output, workspace, params, workspace_size, backend);
+        input, filter, bias, output, workspace, params, epilogue,
+        workspace_size, backend);
   }
   if (params.window_rows == 1 && params.window_cols == 3) {
     return launch_with_tiles<T, ConvType, 1, 2, 1, 3>(
-        input, filter, output, workspace, params, workspace_size, backend);
+        input, filter, bias, output, workspace, params, epilogue,
+        workspace_size, backend);
   }
   return StatusCode::InvalidAlgorithm;
 }
 
+/**
+ * Launch a Winograd convolution without an epilogue. The filter is passed in
+ * place of the bias, but is never read as a bias.
+ */
+template <typename T, typename ConvType, typename Backend,
+          typename std::enable_if<
+              !std::is_same<ConvType, conv_type::FilterBackprop>::value,
+              int>::type = 0>
+SNNStatus launch(typename Backend::template pointer_type<T const> input,
+                 typename Backend::template pointer_type<T const> filter,
+                 typename Backend::template pointer_type<T> output,
+                 typename Backend::template pointer_type<T> workspace,
+                 Conv2DParams const& params, size_t workspace_size,
+                 Backend& backend) {
+  return launch<T, ConvType>(input, filter, filter, output, workspace, params,
+                             EpilogueParams{}, workspace_size, backend);
+}
+
 /** \copydoc sycldnn::conv2d::internal::winograd::launch() */
 template <typename T, typename ConvType, typename Backend,
           typename std::enable_if<
@@ -361,22 +440,50 @@ SNNStatus launch(typename Backend::template pointer_type<T const> input,
                  typename Backend::template pointer_type<T> workspace,
                  Conv2DParams const& params, size_t workspace_size,
                  Backend& backend) {
+  EpilogueParams const no_epilogue{};
   if (params.window_rows == 3 && params.window_cols == 3) {
     return launch_with_tiles<T, ConvType, 3, 3, 2, 2>(
-        input, filter, output, workspace, params, workspace_size, backend);
+        input, filter, filter, output, workspace, params, no_epilogue,
+        workspace_size, backend);
   }
   if (params.window_rows == 3 && params.window_cols == 1) {
     return launch_with_tiles<T, ConvType, 3, 1, 2, 1>(
-        input, filter, output, workspace, params, workspace_size, backend);
+        input, filter, filter, output, workspace, params, no_epilogue,
+        workspace_size, backend);
   }
   if (params.window_rows == 1 && params.window_cols == 3) {
     return launch_with_tiles<T, ConvType, 1, 3, 1, 2>(
-        input, filter, output, workspace, params, workspace_size, backend);
+        input, filter, filter, output, workspace, params, no_epilogue,
+        workspace_size, backend);
   }
   return StatusCode::InvalidAlgorithm;
 }
 
 /** \copydoc sycldnn::conv2d::internal::winograd::launch() */
+template <typename T, typename ConvType, typename Backend,
+          typename std::enable_if<
+              !std::is_same<ConvType, conv_type::FilterBackprop>::value,
+              int>::type = 0>
+SNNStatus launch_large(
+    typename Backend::template pointer_type<T const> input,
+    typename Backend::template pointer_type<T const> filter,
+    typename Backend::template pointer_type<T const> bias,
+    typename Backend::template pointer_type<T> output,
+    typename Backend::template pointer_type<T> workspace,
+    Conv2DParams const& params, EpilogueParams const& epilogue,
+    size_t workspace_size, Backend& backend) {
+  if (params.window_rows == 3 && params.window_cols == 3) {
+    return launch_with_tiles<T, ConvType, 4, 4, 3, 3>(
+        input, filter, bias, output, workspace, params, epilogue,
+        workspace_size, backend);
+  }
+  return StatusCode::InvalidAlgorithm;
+}
+
+/**
+ * Launch a Winograd convolution with large tiles and without an epilogue. The
+ * filter is passed in place of the bias, but is never read as a bias.
+ */
 template <typename T, typename ConvType, typename Backend,
           typename std::enable_if<
               !std::is_same<ConvType, conv_type::FilterBackprop>::value,
@@ -387,11 +494,9 @@ SNNStatus launch_large(typename Backend::template pointer_type<T const> input,
                        typename Backend::template pointer_type<T> workspace,
                        Conv2DParams const& params, size_t workspace_size,
                        Backend& backend) {
-  if (params.window_rows == 3 && params.window_cols == 3) {
-    return launch_with_tiles<T, ConvType, 4, 4, 3, 3>(
-        input, filter, output, workspace, params, workspace_size, backend);
-  }
-  return StatusCode::InvalidAlgorithm;
+  return launch_large<T, ConvType>(input, filter, filter, output, workspace,
+                                   params, EpilogueParams{}, workspace_size,
+                                   backend);
 }
 
 /** \copydoc sycldnn::conv2d::internal::winograd::launch() */
@@ -407,7 +512,305 @@ SNNStatus launch_large(typename Backend::template pointer_type<T const> input,
                        Backend& backend) {
   if (params.window_rows == 3 && params.window_cols == 3) {
     return launch_with_tiles<T, ConvType, 3, 3, 3, 3>(
-        input, filter, output, workspace, params, workspace_size, backend);
+        input, filter, filter, output, workspace, params, EpilogueParams{},
+        workspace_size, backend);
+  }
+  return StatusCode::InvalidAlgorithm;
+}
+
+/**
+ * Transform a filter into the Winograd domain using the tile sizes specified
+ * in the template parameters, writing the result into a user provided buffer.
+ *
+ * \param filter           User provided filter pointer
+ * \param filter_transform User provided buffer to hold the transformed filter
+ * \param params           User provided convolution parameters
+ * \param backend          User provided backend
+ * \return An SNNStatus object containing a SYCL event corresponding to the
+ * filter transform kernel.
+ */
+template <typename T, typename ConvType, int M, int N, int R, int S,
+          typename Backend>
+SNNStatus transform_filter_with_tiles(
+    typename Backend::template pointer_type<T const> filter,
+    typename Backend::template pointer_type<T> filter_transform,
+    Conv2DParams const& params, Backend& backend) {
+  using ConstInternalPointer =
+      ::sycldnn::internal::helpers::InternalPointer<T const, Backend>;
+  using InternalPointer =
+      ::sycldnn::internal::helpers::InternalPointer<T, Backend>;
+  auto kernel_params = get_params<ConvType>(params);
+  auto const tile_info = get_tile_info<ConvType, M, N, R, S>(kernel_params);
+  ConstInternalPointer filter_ptr{filter, backend};
+  InternalPointer filter_transform_ptr{filter_transform, backend};
+  return launch_filter_transform<T, ConvType, M, N, R, S>(
+      filter_ptr.get(), filter_transform_ptr.get(), kernel_params, tile_info,
+      backend);
+}
+
+/**
+ * Convert the user provided pointers into internal pointers, allocate the
+ * temporary input and intermediate buffers and then launch the convolution
+ * using an already transformed filter with launch_with_transformed_filter().
+ *
+ * \param input            User provided input pointer
+ * \param filter_transform Pointer to the pre-transformed filter
+ * \param output           User provided output pointer
+ * \param params           User provided convolution parameters
+ * \param backend          User provided backend to handle allocations and
+ *                         matrix multiplies
+ * \return An SNNStatus object containing a SYCL event corresponding to the last
+ * kernel launched.
+ */
+template <typename T, typename ConvType, int M, int N, int R, int S,
+          typename Backend>
+SNNStatus allocate_and_launch_with_transformed_filter(
+    typename Backend::template pointer_type<T const> input,
+    typename Backend::template pointer_type<T> filter_transform,
+    typename Backend::template pointer_type<T> output,
+    Conv2DParams const& params, Backend& backend) {
+  using ConstInternalPointer =
+      ::sycldnn::internal::helpers::InternalPointer<T const, Backend>;
+  using InternalPointer =
+      ::sycldnn::internal::helpers::InternalPointer<T, Backend>;
+  constexpr int A = M + R - 1;
+  constexpr int B = N + S - 1;
+  auto kernel_params = get_params<ConvType>(params);
+  auto const tile_info = get_tile_info<ConvType, M, N, R, S>(kernel_params);
+  ConstInternalPointer input_ptr{input, backend};
+  InternalPointer filter_transform_ptr{filter_transform, backend};
+  InternalPointer output_ptr{output, backend};
+  AllocatedInputPointerSet<T, Backend> allocated_pointers{
+      input_ptr.get(), filter_transform_ptr.get(), output_ptr.get(),
+      kernel_params,   A * B,                      tile_info,
+      backend};
+  auto batch_info =
+      get_batch_info(allocated_pointers.minibatch_size, params.batch);
+
+  using ConstPointer =
+      typename Backend::template internal_pointer_type<T const>;
+  return launch_with_transformed_filter<T, M, N, R, S, ConvType>(
+      allocated_pointers.to_full_pointer_set(),
+      ConstPointer{filter_transform_ptr.get()}, kernel_params,
+      EpilogueParams{}, tile_info, batch_info, backend);
+}
+
+/**
+ * Convert the user provided pointers into internal pointers, split up the
+ * workspace to use as the temporary input and intermediate buffers and then
+ * launch the convolution using an already transformed filter with
+ * launch_with_transformed_filter().
+ *
+ * \param input            User provided input pointer
+ * \param filter_transform Pointer to the pre-transformed filter
+ * \param output           User provided output pointer
+ * \param workspace        Pointer to user provided workspace buffer
+ * \param params           User provided convolution parameters
+ * \param workspace_size   Number of elements available in the workspace buffer
+ * \param backend          User provided backend to handle allocations and
+ *                         matrix multiplies
+ * \return An SNNStatus object containing a SYCL event corresponding to the last
+ * kernel launched.
+ */
+template <typename T, typename ConvType, int M, int N, int R, int S,
+          typename Backend>
+SNNStatus split_workspace_and_launch_with_transformed_filter(
+    typename Backend::template pointer_type<T const> input,
+    typename Backend::template pointer_type<T> filter_transform,
+    typename Backend::template pointer_type<T> output,
+    typename Backend::template pointer_type<T> workspace,
+    Conv2DParams const& params, size_t workspace_size, Backend& backend) {
+  using ConstInternalPointer =
+      ::sycldnn::internal::helpers::InternalPointer<T const, Backend>;
+  using InternalPointer =
+      ::sycldnn::internal::helpers::InternalPointer<T, Backend>;
+  using ConstPointer =
+      typename Backend::template internal_pointer_type<T const>;
+  constexpr int A = M + R - 1;
+  constexpr int B = N + S - 1;
+  auto kernel_params = get_params<ConvType>(params);
+  auto const tile_info = get_tile_info<ConvType, M, N, R, S>(kernel_params);
+
+  size_t const input_transform_size =
+      A * B * tile_info.number * kernel_params.channels;
+  size_t const inter_transform_size =
+      A * B * tile_info.number * kernel_params.features;
+  size_t const minibatch_size = std::min<size_t>(
+      workspace_size / (input_transform_size + inter_transform_size),
+      params.batch);
+  if (minibatch_size == 0) {
+    return StatusCode::InsufficientWorkspace;
+  }
+  size_t const mb_input_transform_size = input_transform_size * minibatch_size;
+
+  ConstInternalPointer input_ptr{input, backend};
+  InternalPointer filter_transform_ptr{filter_transform, backend};
+  InternalPointer output_ptr{output, backend};
+  InternalPointer input_transform_ptr{workspace, backend};
+  InternalPointer inter_transform_ptr{workspace + mb_input_transform_size,
+                                      backend};
+
+  auto all_pointers = FullPointerSet<T, Backend>{
+      input_ptr.get(),
+      ConstPointer{filter_transform_ptr.get()},
+      output_ptr.get(),
+      input_transform_ptr.get(),
+      filter_transform_ptr.get(),
+      inter_transform_ptr.get()};
+
+  auto batch_info = get_batch_info(minibatch_size, params.batch);
+  return launch_with_transformed_filter<T, M, N, R, S, ConvType>(
+      all_pointers, all_pointers.filter, kernel_params, EpilogueParams{},
+      tile_info, batch_info, backend);
+}
+
+/**
+ * Launch a convolution using an already transformed filter. Check whether the
+ * user provided a workspace buffer. If so then split up the workspace to use as
+ * temporary transform buffers, otherwise allocate temporary buffers to use in
+ * the computation.
+ */
+template <typename T, typename ConvType, int M, int N, int R, int S,
+          typename Backend>
+SNNStatus launch_transformed_with_tiles(
+    typename Backend::template pointer_type<T const> input,
+    typename Backend::template pointer_type<T> filter_transform,
+    typename Backend::template pointer_type<T> output,
+    typename Backend::template pointer_type<T> workspace,
+    Conv2DParams const& params, size_t workspace_size, Backend& backend) {
+  if (workspace_size == 0) {
+    return allocate_and_launch_with_transformed_filter<T, ConvType, M, N, R, S,
+                                                       Backend>(
+        input, filter_transform, output, params, backend);
+  } else {
+    return split_workspace_and_launch_with_transformed_filter<
+        T, ConvType, M, N, R, S, Backend>(input, filter_transform, output,
+                                          workspace, params, workspace_size,
+                                          backend);
+  }
+}
+
+/**
+ * Transform a filter into the Winograd domain, ready to be used in
+ * launch_transformed(). The tile sizes are chosen to match those used in
+ * launch().
+ *
+ * \param filter           User provided filter pointer
+ * \param filter_transform User provided buffer to hold the transformed filter
+ * \param params           User provided convolution parameters
+ * \param backend          User provided backend
+ * \return An SNNStatus object containing a SYCL event corresponding to the
+ * filter transform kernel.
+ */
+template <typename T, typename ConvType, typename Backend,
+          typename std::enable_if<
+              !std::is_same<ConvType, conv_type::FilterBackprop>::value,
+              int>::type = 0>
+SNNStatus transform_filter(
+    typename Backend::template pointer_type<T const> filter,
+    typename Backend::template pointer_type<T> filter_transform,
+    Conv2DParams const& params, Backend& backend) {
+  if (params.window_rows == 3 && params.window_cols == 3) {
+    return transform_filter_with_tiles<T, ConvType, 2, 2, 3, 3>(
+        filter, filter_transform, params, backend);
+  }
+  if (params.window_rows == 3 && params.window_cols == 1) {
+    return transform_filter_with_tiles<T, ConvType, 2, 1, 3, 1>(
+        filter, filter_transform, params, backend);
+  }
+  if (params.window_rows == 1 && params.window_cols == 3) {
+    return transform_filter_with_tiles<T, ConvType, 1, 2, 1, 3>(
+        filter, filter_transform, params, backend);
+  }
+  return StatusCode::InvalidAlgorithm;
+}
+
+/**
+ * Transform a filter into the Winograd domain, ready to be used in
+ * launch_transformed_large(). The tile sizes are chosen to match those used in
+ * launch_large().
+ *
+ * \copydetails transform_filter()
+ */
+template <typename T, typename ConvType, typename Backend,
+          typename std::enable_if<
+              !std::is_same<ConvType, conv_type::FilterBackprop>::value,
+              int>::type = 0>
+SNNStatus transform_filter_large(
+    typename Backend::template pointer_type<T const> filter,
+    typename Backend::template pointer_type<T> filter_transform,
+    Conv2DParams const& params, Backend& backend) {
+  if (params.window_rows == 3 && params.window_cols == 3) {
+    return transform_filter_with_tiles<T, ConvType, 4, 4, 3, 3>(
+        filter, filter_transform, params, backend);
+  }
+  return StatusCode::InvalidAlgorithm;
+}
+
+/**
+ * Launch a Winograd convolution using a filter which has already been
+ * transformed with transform_filter(), so that the filter transform is not
+ * recomputed.
+ *
+ * \param input            User provided input pointer
+ * \param filter_transform Pointer to the pre-transformed filter
+ * \param output           User provided output pointer
+ * \param workspace        Pointer to user provided workspace buffer
+ * \param params           User provided convolution parameters
+ * \param workspace_size   Number of elements available in the workspace buffer
+ * \param backend          User provided backend to handle allocations and
+ *                         matrix multiplies
+ * \return An SNNStatus object containing a SYCL event corresponding to the last
+ * kernel launched.
+ */
+template <typename T, typename ConvType, typename Backend,
+          typename std::enable_if<
+              !std::is_same<ConvType, conv_type::FilterBackprop>::value,
+              int>::type = 0>
+SNNStatus launch_transformed(
+    typename Backend::template pointer_type<T const> input,
+    typename Backend::template pointer_type<T> filter_transform,
+    typename Backend::template pointer_type<T> output,
+    typename Backend::template pointer_type<T> workspace,
+    Conv2DParams const& params, size_t workspace_size, Backend& backend) {
+  if (params.window_rows == 3 && params.window_cols == 3) {
+    return launch_transformed_with_tiles<T, ConvType, 2, 2, 3, 3>(
+        input, filter_transform, output, workspace, params, workspace_size,
+        backend);
+  }
+  if (params.window_rows == 3 && params.window_cols == 1) {
+    return launch_transformed_with_tiles<T, ConvType, 2, 1, 3, 1>(
+        input, filter_transform, output, workspace, params, workspace_size,
+        backend);
+  }
+  if (params.window_rows == 1 && params.window_cols == 3) {
+    return launch_transformed_with_tiles<T, ConvType, 1, 2, 1, 3>(
+        input, filter_transform, output, workspace, params, workspace_size,
+        backend);
+  }
+  return StatusCode::InvalidAlgorithm;
+}
+
+/**
+ * Launch a Winograd convolution using a filter which has already been
+ * transformed with transform_filter_large().
+ *
+ * \copydetails launch_transformed()
+ */
+template <typename T, typename ConvType, typename Backend,
+          typename std::enable_if<
+              !std::is_same<ConvType, conv_type::FilterBackprop>::value,
+              int>::type = 0>
+SNNStatus launch_transformed_large(
+    typename Backend::template pointer_type<T const> input,
+    typename Backend::template pointer_type<T> filter_transform,
+    typename Backend::template pointer_type<T> output,
+    typename Backend::template pointer_type<T> workspace,
+    Conv2DParams const& params, size_t workspace_size, Backend& backend) {
+  if (params.window_rows == 3 && params.window_cols == 3) {
+    return launch_transformed_with_tiles<T, ConvType, 4, 4, 3, 3>(
+        input, filter_transform, output, workspace, params, workspace_size,
+        backend);
   }
   return StatusCode::InvalidAlgorithm;
 }
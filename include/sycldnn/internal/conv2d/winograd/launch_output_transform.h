@@ -21,6 +21,7 @@
 #include "sycldnn/status.h"
 
 #include "sycldnn/conv2d/conv_type.h"
+#include "sycldnn/conv2d/epilogue.h"
 #include "sycldnn/conv2d/params.h"
 #include "sycldnn/internal/conv2d/winograd/tile_info.h"
 
@@ -63,13 +64,40 @@ launch_output_transform(BaseMemObject<T const>& intermediate,
                         BaseMemObject<T>& output, Conv2DParams const& params,
                         TileInfo const& tile_info, cl::sycl::queue& queue);
 
+/**
+ * Launch the Winograd output transform kernel, applying an epilogue to the
+ * output values as they are written.
+ *
+ * The epilogue is only applied for forward convolutions, and is ignored for
+ * the filter backprop.
+ *
+ * \param intermediate Intermediate tensor
+ * \param bias         Bias tensor, only read if the epilogue adds a bias
+ * \param output       Output temporary transform tensor
+ * \param params       Kernel parameters for the convolution
+ * \param epilogue     Bias and activation to apply to the output
+ * \param tile_info    Winograd tile information
+ * \param queue        SYCL queue to enqueue the kernels to
+ * \return An SNNStatus event containing an event corresponding to the last
+ * kernel launched.
+ */
+template <typename T, typename ConvType, int M, int N, int R, int S,
+          bool Accumulate = false>
+SNN_EXPORT SNNStatus launch_output_transform(
+    BaseMemObject<T const>& intermediate, BaseMemObject<T const>& bias,
+    BaseMemObject<T>& output, Conv2DParams const& params,
+    EpilogueParams const& epilogue, TileInfo const& tile_info,
+    cl::sycl::queue& queue);
+
 /**
  * Extract the buffers from the backend and launch the Winograd output transform
  * kernel.
  *
  * \param inter     Intermediate tensor
+ * \param bias      Bias tensor, only read if the epilogue adds a bias
  * \param output    Output temporary transform tensor
  * \param params    Kernel parameters for the convolution
+ * \param epilogue  Bias and activation to apply to the output
  * \param tile_info Winograd tile information
  * \param backend   Backend to provide SYCL buffers from the pointers
  * \return An SNNStatus event containing an event corresponding to the last
@@ -79,14 +107,17 @@ template <typename T, typename ConvType, int M, int N, int R, int S,
           typename Backend>
 SNNStatus launch_output_transform(
     typename Backend::template internal_pointer_type<T const> inter,
+    typename Backend::template internal_pointer_type<T const> bias,
     typename Backend::template internal_pointer_type<T> output,
-    Conv2DParams const& params, TileInfo const& tile_info, Backend& backend) {
+    Conv2DParams const& params, EpilogueParams const& epilogue,
+    TileInfo const& tile_info, Backend& backend) {
   constexpr int A = M + R - 1;
   constexpr int B = N + S - 1;
 
   size_t const inter_size =
       A * B * params.batch * tile_info.number * params.features;
   auto inter_acc = backend.get_mem_object_internal(inter, inter_size);
+  auto bias_acc = backend.get_mem_object_internal(bias, params.features);
 
   size_t const output_size =
       params.batch * params.out_rows * params.out_cols * params.features;
@@ -94,7 +125,7 @@ SNNStatus launch_output_transform(
 
   cl::sycl::queue queue = backend.get_queue();
   return launch_output_transform<T, ConvType, M, N, R, S>(
-      inter_acc, output_acc, params, tile_info, queue);
+      inter_acc, bias_acc, output_acc, params, epilogue, tile_info, queue);
 }
 
 /**
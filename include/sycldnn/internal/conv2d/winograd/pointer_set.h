@@ -25,11 +25,14 @@
 
 #include "sycldnn/internal/conv2d/winograd/tile_info.h"
 
+#include <algorithm>
+
 /**
  * \file
- * Contains the sycldnn::conv2d::internal::winograd::FullPointerSet and
- * sycldnn::conv2d::internal::winograd::AllocatedPointerSet helpers to wrap the
- * pointers required for a Winograd convolution.
+ * Contains the sycldnn::conv2d::internal::winograd::FullPointerSet,
+ * sycldnn::conv2d::internal::winograd::AllocatedPointerSet and
+ * sycldnn::conv2d::internal::winograd::AllocatedInputPointerSet helpers to wrap
+ * the pointers required for a Winograd convolution.
  */
 
 namespace sycldnn {
@@ -66,6 +69,45 @@ struct FullPointerSet {
   Pointer intermediate;
 };
 
+/** Number of bytes per image required in the input transform tensor. */
+template <typename T>
+size_t in_transform_bytes_per_image(Conv2DParams const& params,
+                                    TileInfo const& tile_info, int n_matrices) {
+  return sizeof(T) * n_matrices * tile_info.number * params.channels;
+}
+
+/** Number of bytes per image required in the intermediate tensor. */
+template <typename T>
+size_t intermediate_bytes_per_image(Conv2DParams const& params,
+                                    TileInfo const& tile_info, int n_matrices) {
+  return sizeof(T) * n_matrices * tile_info.number * params.features;
+}
+
+/** Number of bytes required in the filter transform tensor. */
+template <typename T>
+size_t filter_transform_bytes(Conv2DParams const& params, int n_matrices) {
+  return sizeof(T) * n_matrices * params.channels * params.features;
+}
+
+/**
+ * Get the number of images to use per minibatch, so that the temporary
+ * buffers can be allocated on the device.
+ */
+template <typename T, typename Backend>
+size_t get_minibatch_size(Conv2DParams const& params,
+                          TileInfo const& tile_info, int n_matrices,
+                          Backend& backend) {
+  auto max_bytes =
+      std::max(in_transform_bytes_per_image<T>(params, tile_info, n_matrices),
+               intermediate_bytes_per_image<T>(params, tile_info, n_matrices));
+  auto alloc_info = get_alloc_info(backend.get_queue().get_device(),
+                                   params.batch, max_bytes);
+  if (alloc_info.alloc_warning) {
+    // TODO: Handle error
+  }
+  return alloc_info.images_per_alloc;
+}
+
 /**
  * Container to allocate the temporary buffers required for a Winograd
  * convolution.
@@ -105,16 +147,17 @@ struct AllocatedPointerSet {
   AllocatedPointerSet(InternalPointerSet<T, Backend> const& set,
                       Conv2DParams const& params, int n_matrices,
                       TileInfo const& tile_info, Backend& backend)
-      : minibatch_size{get_minibatch_size(params, tile_info, n_matrices,
-                                          backend)},
+      : minibatch_size{get_minibatch_size<T>(params, tile_info, n_matrices,
+                                             backend)},
         input{set.input.get()},
         filter{set.filter.get()},
         output{set.output.get()},
-        input_transform{minibatch_size * in_transform_bytes_per_image(
+        input_transform{minibatch_size * in_transform_bytes_per_image<T>(
                                              params, tile_info, n_matrices),
                         backend},
-        filter_transform{filter_transform_bytes(params, n_matrices), backend},
-        intermediate{minibatch_size * intermediate_bytes_per_image(
+        filter_transform{filter_transform_bytes<T>(params, n_matrices),
+                         backend},
+        intermediate{minibatch_size * intermediate_bytes_per_image<T>(
                                           params, tile_info, n_matrices),
                      backend} {}
 
@@ -146,48 +189,86 @@ struct AllocatedPointerSet {
   AllocatedPointer filter_transform;
   /** The temporary output transform pointer. */
   AllocatedPointer intermediate;
+};
 
- private:
-  /** Number of bytes per image required in the input transform tensor. */
-  static size_t in_transform_bytes_per_image(Conv2DParams const& params,
-                                             TileInfo const& tile_info,
-                                             int n_matrices) {
-    return sizeof(T) * n_matrices * tile_info.number * params.channels;
-  }
-  /** Number of bytes per image required in the intermediate tensor. */
-  static size_t intermediate_bytes_per_image(Conv2DParams const& params,
-                                             TileInfo const& tile_info,
-                                             int n_matrices) {
-    return sizeof(T) * n_matrices * tile_info.number * params.features;
-  }
-  /** Number of bytes per image required in the filter transform tensor. */
-  static size_t filter_transform_bytes(Conv2DParams const& params,
-                                       int n_matrices) {
-    return sizeof(T) * n_matrices * params.channels * params.features;
-  }
-  /** Maximum number of bytes required for the temporary buffers per image. */
-  static size_t max_bytes_per_image(Conv2DParams const& params,
-                                    TileInfo const& tile_info, int n_matrices) {
-    size_t in_transform_bytes =
-        in_transform_bytes_per_image(params, tile_info, n_matrices);
-    size_t intermediate_bytes =
-        intermediate_bytes_per_image(params, tile_info, n_matrices);
-    size_t max_bytes_per_image =
-        std::max(in_transform_bytes, intermediate_bytes);
-    return max_bytes_per_image;
-  }
-  /** Get the number of images to use per minibatch. */
-  static size_t get_minibatch_size(Conv2DParams const& params,
-                                   TileInfo const& tile_info, int n_matrices,
-                                   Backend& backend) {
-    auto max_bytes = max_bytes_per_image(params, tile_info, n_matrices);
-    auto alloc_info = get_alloc_info(backend.get_queue().get_device(),
-                                     params.batch, max_bytes);
-    if (alloc_info.alloc_warning) {
-      // TODO: Handle error
-    }
-    return alloc_info.images_per_alloc;
+/**
+ * Container to allocate the temporary buffers required for a Winograd
+ * convolution when the filter has already been transformed.
+ *
+ * This behaves like AllocatedPointerSet, but only allocates the input transform
+ * and intermediate buffers, using the provided pre-transformed filter in place
+ * of a temporary filter transform buffer.
+ */
+template <typename T, typename Backend>
+struct AllocatedInputPointerSet {
+  /** User provided internal pointer type. */
+  using Pointer = typename Backend::template internal_pointer_type<T>;
+  /** User provided internal const pointer type. */
+  using ConstPointer =
+      typename Backend::template internal_pointer_type<T const>;
+  /** RAII allocating pointer which releases its buffer on destruction. */
+  using AllocatedPointer =
+      ::sycldnn::internal::helpers::AllocatedPointer<T, Backend>;
+
+  /**
+   * Construct an AllocatedInputPointerSet from the user provided pointers and
+   * the convolution parameters. Will allocate the temporary buffers required
+   * through the backend.
+   *
+   * \param input            The user provided input pointer.
+   * \param filter_transform The pre-transformed filter pointer.
+   * \param output           The user provided output pointer.
+   * \param params           The parameters for the convolution.
+   * \param n_matrices       The number of matrices in the intermediate
+   *                         Winograd tensor.
+   * \param tile_info        Information about the number of tiles in the
+   *                         convolution.
+   * \param backend          The user provided backend to use to allocate the
+   *                         temporary buffers.
+   */
+  AllocatedInputPointerSet(ConstPointer input, Pointer filter_transform,
+                           Pointer output, Conv2DParams const& params,
+                           int n_matrices, TileInfo const& tile_info,
+                           Backend& backend)
+      : minibatch_size{get_minibatch_size<T>(params, tile_info, n_matrices,
+                                             backend)},
+        input{input},
+        filter_transform{filter_transform},
+        output{output},
+        input_transform{minibatch_size * in_transform_bytes_per_image<T>(
+                                             params, tile_info, n_matrices),
+                        backend},
+        intermediate{minibatch_size * intermediate_bytes_per_image<T>(
+                                          params, tile_info, n_matrices),
+                     backend} {}
+
+  /**
+   * Convert an AllocatedInputPointerSet to a FullPointerSet instance.
+   * \return A FullPointerSet containing the pointers in this
+   * AllocatedInputPointerSet, with the filter pointing to the transformed
+   * filter.
+   */
+  FullPointerSet<T, Backend> to_full_pointer_set() const {
+    return {input,
+            ConstPointer{filter_transform},
+            output,
+            input_transform.get(),
+            filter_transform,
+            intermediate.get()};
   }
+
+  /** Minibatch size used to allocate the temporary buffers. */
+  size_t minibatch_size;
+  /** The user provided input pointer. */
+  ConstPointer input;
+  /** The pre-transformed filter pointer. */
+  Pointer filter_transform;
+  /** The user provided output pointer. */
+  Pointer output;
+  /** The temporary input transform pointer. */
+  AllocatedPointer input_transform;
+  /** The temporary output transform pointer. */
+  AllocatedPointer intermediate;
 };
 
 }  // namespace winograd
@@ -0,0 +1,134 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef SYCLDNN_INCLUDE_INTERNAL_DEPTHWISE_CONV2D_LAYOUT_H_
+#define SYCLDNN_INCLUDE_INTERNAL_DEPTHWISE_CONV2D_LAYOUT_H_
+
+#include "sycldnn/data_format.h"
+
+#include "sycldnn/conv2d/conv_type.h"
+
+#include "sycldnn/depthwise_conv2d/params.h"
+
+#include "sycldnn/internal/transpose/layout.h"
+
+#include <type_traits>
+
+namespace sycldnn {
+namespace depthwise_conv2d {
+namespace internal {
+
+/**
+ * Check whether a depthwise convolution has to be run on NHWC copies of its
+ * tensors.
+ *
+ * The basic forward kernel reads channel blocked tensors directly. The tiled
+ * forward kernels and the backprop kernels only support NHWC.
+ *
+ * \tparam ConvType The type of convolution.
+ * \param params    The depthwise convolution parameters.
+ * \return Returns true if the blocked tensors need to be converted to NHWC.
+ */
+template <typename ConvType>
+bool requires_nhwc(DepthwiseConv2DParams const& params) {
+  if (!is_channel_blocked(params.input_format)) {
+    return false;
+  }
+  return !std::is_same<ConvType, conv2d::conv_type::Forward>::value ||
+         params.algorithm == Algorithm::LocalTiled ||
+         params.algorithm == Algorithm::RegisterTiled;
+}
+
+/**
+ * The transposes which convert the tensors of a depthwise convolution to and
+ * from the NHWC layout used by the kernels.
+ */
+struct LayoutTransposes {
+  /** Converts the input tensor to NHWC. */
+  transpose::internal::LayoutTranspose input;
+  /** Converts the filter tensor to the kernel layout. */
+  transpose::internal::LayoutTranspose filter;
+  /** Converts the output tensor back from the kernel layout. */
+  transpose::internal::LayoutTranspose output;
+};
+
+/** Get the transpose converting the input or output image to NHWC. */
+inline transpose::internal::LayoutTranspose input_image_to_nhwc(
+    DepthwiseConv2DParams const& params) {
+  return transpose::internal::get_layout_transpose(
+      params.batch, params.in_rows, params.in_cols, params.channels,
+      params.input_format, DataFormat::NHWC);
+}
+
+/** Get the transpose converting an NHWC input image back to its format. */
+inline transpose::internal::LayoutTranspose input_image_from_nhwc(
+    DepthwiseConv2DParams const& params) {
+  return transpose::internal::get_layout_transpose(
+      params.batch, params.in_rows, params.in_cols, params.channels,
+      DataFormat::NHWC, params.input_format);
+}
+
+/** Get the transpose converting an output image to NHWC. */
+inline transpose::internal::LayoutTranspose output_image_to_nhwc(
+    DepthwiseConv2DParams const& params) {
+  return transpose::internal::get_layout_transpose(
+      params.batch, params.out_rows, params.out_cols,
+      params.channels * params.channel_multiplier, params.input_format,
+      DataFormat::NHWC);
+}
+
+/** Get the transpose converting an NHWC output image back to its format. */
+inline transpose::internal::LayoutTranspose output_image_from_nhwc(
+    DepthwiseConv2DParams const& params) {
+  return transpose::internal::get_layout_transpose(
+      params.batch, params.out_rows, params.out_cols,
+      params.channels * params.channel_multiplier, DataFormat::NHWC,
+      params.input_format);
+}
+
+/**
+ * Get the transposes which convert the tensors of a depthwise convolution
+ * between the user's data format and NHWC.
+ */
+template <typename ConvType>
+LayoutTransposes get_layout_transposes(DepthwiseConv2DParams const& params);
+
+/** \copydoc get_layout_transposes */
+template <>
+inline LayoutTransposes get_layout_transposes<conv2d::conv_type::Forward>(
+    DepthwiseConv2DParams const& params) {
+  return {input_image_to_nhwc(params), {}, output_image_from_nhwc(params)};
+}
+
+/** \copydoc get_layout_transposes */
+template <>
+inline LayoutTransposes get_layout_transposes<conv2d::conv_type::InputBackprop>(
+    DepthwiseConv2DParams const& params) {
+  return {output_image_to_nhwc(params), {}, input_image_from_nhwc(params)};
+}
+
+/** \copydoc get_layout_transposes */
+template <>
+inline LayoutTransposes
+get_layout_transposes<conv2d::conv_type::FilterBackprop>(
+    DepthwiseConv2DParams const& params) {
+  return {input_image_to_nhwc(params), output_image_to_nhwc(params), {}};
+}
+
+}  // namespace internal
+}  // namespace depthwise_conv2d
+}  // namespace sycldnn
+
+#endif  // SYCLDNN_INCLUDE_INTERNAL_DEPTHWISE_CONV2D_LAYOUT_H_
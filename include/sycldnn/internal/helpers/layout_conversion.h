@@ -0,0 +1,228 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef SYCLDNN_INCLUDE_INTERNAL_HELPERS_LAYOUT_CONVERSION_H_
+#define SYCLDNN_INCLUDE_INTERNAL_HELPERS_LAYOUT_CONVERSION_H_
+
+#include "sycldnn/status.h"
+
+#include "sycldnn/internal/helpers/allocated_pointer.h"
+#include "sycldnn/internal/transpose/launch.h"
+#include "sycldnn/internal/transpose/layout.h"
+
+#include <stddef.h>
+#include <memory>
+#include <type_traits>
+
+namespace sycldnn {
+namespace internal {
+namespace helpers {
+
+/**
+ * Whether the backend's internal pointers can be passed to the operation
+ * launchers in place of user pointers, which is required to run an operation
+ * on temporary tensors.
+ */
+template <typename T, typename Backend>
+struct CanUseTemporaries
+    : std::is_same<typename Backend::template pointer_type<T>,
+                   typename Backend::template internal_pointer_type<T>> {};
+
+/**
+ * Get the number of elements in the temporary tensor holding the result of a
+ * transpose, or 0 if the transpose is not required.
+ */
+inline size_t get_temporary_size(
+    transpose::internal::LayoutTranspose const& transpose) {
+  if (!transpose::internal::is_required(transpose)) {
+    return 0;
+  }
+  return transpose::internal::get_size(transpose.dimensions);
+}
+
+/**
+ * Get the number of workspace elements needed to hold the temporary tensors
+ * used when converting the layouts of an operation's tensors.
+ *
+ * \param input_tr  The transpose converting the input for the kernels.
+ * \param filter_tr The transpose converting the filter for the kernels.
+ * \param output_tr The transpose converting the kernels' output back to the
+ *                  user's layout.
+ * 
+eturn The total number of elements in the temporary tensors.
+ */
+inline size_t get_conversion_size(
+    transpose::internal::LayoutTranspose const& input_tr,
+    transpose::internal::LayoutTranspose const& filter_tr,
+    transpose::internal::LayoutTranspose const& output_tr) {
+  return get_temporary_size(input_tr) + get_temporary_size(filter_tr) +
+         get_temporary_size(output_tr);
+}
+
+/**
+ * Transpose a user tensor into a temporary tensor.
+ *
+ * \param input     The user tensor to transpose.
+ * \param temporary The temporary tensor to transpose into.
+ * \param transpose The dimensions of the user tensor and the permutation to
+ *                  apply to them.
+ * \param backend   The backend used to map the tensors to memory objects.
+ * 
+eturn An SNNStatus with event linked to the transpose or an error code.
+ */
+template <typename T, typename Backend>
+SNNStatus transpose_to_temporary(
+    typename Backend::template pointer_type<T const> input,
+    typename Backend::template pointer_type<T> temporary,
+    transpose::internal::LayoutTranspose const& transpose, Backend& backend) {
+  size_t const size = transpose::internal::get_size(transpose.dimensions);
+  auto input_mem = backend.get_mem_object(input, size);
+  auto temp_mem = backend.get_mem_object(temporary, size);
+  auto queue = backend.get_queue();
+  return transpose::internal::launch(input_mem, temp_mem, transpose.dimensions,
+                                     transpose.permutation, queue);
+}
+
+/**
+ * Run an operation on temporary copies of its tensors which have been
+ * transposed into the layouts supported by the operation's kernels.
+ *
+ * Any tensor whose transpose is not required is passed to the launcher
+ * directly, so a filter which the user has already converted to the kernel
+ * layout is not transposed again. Otherwise the input and filter are
+ * transposed into temporary tensors before the launcher is called, and the
+ * launcher's output is transposed from a temporary tensor into the user's
+ * output tensor.
+ *
+ * The temporary tensors are taken from the start of the workspace when it can
+ * hold them along with the launcher's own workspace, and the rest of the
+ * workspace is passed on to the launcher. Otherwise the temporary tensors are
+ * allocated through the backend and the whole workspace is passed on.
+ *
+ * \param input           A pointer to the user's input tensor.
+ * \param filter          A pointer to the user's filter tensor.
+ * \param output          A pointer to the user's output tensor.
+ * \param input_tr        The transpose converting the input for the kernels.
+ * \param filter_tr       The transpose converting the filter for the kernels.
+ * \param output_tr       The transpose converting the kernels' output back to
+ *                        the user's layout.
+ * \param workspace       Pointer to the user's workspace buffer.
+ * \param workspace_size  The number of elements available in the workspace.
+ * \param launcher_size   The number of workspace elements which the launcher
+ *                        requires for itself.
+ * \param backend         The backend used to allocate the temporary tensors.
+ * \param launcher        Functor taking the input, filter and output pointers
+ *                        to use in the kernels along with the workspace pointer
+ *                        and size left for it, which launches the operation.
+ * 
+eturn Returns an SNNStatus containing the SYCL event tied to the final
+ *         kernel launch and a StatusCode enum showing if the launch was OK or
+ *         whether it encountered some problem.
+ */
+template <typename T, typename Backend, typename Launcher,
+          typename std::enable_if<CanUseTemporaries<T, Backend>::value,
+                                  int>::type = 0>
+SNNStatus launch_with_converted_layouts(
+    typename Backend::template pointer_type<T const> input,
+    typename Backend::template pointer_type<T const> filter,
+    typename Backend::template pointer_type<T> output,
+    transpose::internal::LayoutTranspose const& input_tr,
+    transpose::internal::LayoutTranspose const& filter_tr,
+    transpose::internal::LayoutTranspose const& output_tr,
+    typename Backend::template pointer_type<T> workspace,
+    size_t workspace_size, size_t launcher_size, Backend& backend,
+    Launcher&& launcher) {
+  using Pointer = typename Backend::template pointer_type<T>;
+  size_t const input_size = get_temporary_size(input_tr);
+  size_t const filter_size = get_temporary_size(filter_tr);
+  size_t const output_size = get_temporary_size(output_tr);
+  size_t const conversion_size = input_size + filter_size + output_size;
+  if (conversion_size == 0) {
+    return launcher(input, filter, output, workspace, workspace_size);
+  }
+
+  std::unique_ptr<AllocatedPointer<T, Backend>> allocation;
+  Pointer temporaries = workspace;
+  if (workspace_size >= conversion_size + launcher_size) {
+    workspace_size -= conversion_size;
+    workspace = workspace_size > 0 ? workspace + conversion_size : Pointer{};
+  } else {
+    allocation.reset(
+        new AllocatedPointer<T, Backend>{sizeof(T) * conversion_size, backend});
+    temporaries = allocation->get();
+  }
+  Pointer temp_input = temporaries;
+  Pointer temp_filter = temp_input + input_size;
+  Pointer temp_output = temp_filter + filter_size;
+
+  if (input_size > 0) {
+    auto status =
+        transpose_to_temporary<T>(input, temp_input, input_tr, backend);
+    if (status.status != StatusCode::OK) {
+      return status;
+    }
+    input = temp_input;
+  }
+  if (filter_size > 0) {
+    auto status =
+        transpose_to_temporary<T>(filter, temp_filter, filter_tr, backend);
+    if (status.status != StatusCode::OK) {
+      return status;
+    }
+    filter = temp_filter;
+  }
+  if (output_size == 0) {
+    return launcher(input, filter, output, workspace, workspace_size);
+  }
+
+  auto status =
+      launcher(input, filter, temp_output, workspace, workspace_size);
+  if (status.status != StatusCode::OK) {
+    return status;
+  }
+  auto temp_mem = backend.get_mem_object(temp_output, output_size).as_const();
+  auto output_mem = backend.get_mem_object(output, output_size);
+  auto queue = backend.get_queue();
+  return transpose::internal::launch(temp_mem, output_mem,
+                                     output_tr.dimensions,
+                                     output_tr.permutation, queue);
+}
+
+/**
+ * Backends whose internal pointers cannot be used as user pointers are not
+ * able to run operations on temporary tensors, so layout conversions are not
+ * supported.
+ */
+template <typename T, typename Backend, typename Launcher,
+          typename std::enable_if<!CanUseTemporaries<T, Backend>::value,
+                                  int>::type = 0>
+SNNStatus launch_with_converted_layouts(
+    typename Backend::template pointer_type<T const> /*input*/,
+    typename Backend::template pointer_type<T const> /*filter*/,
+    typename Backend::template pointer_type<T> /*output*/,
+    transpose::internal::LayoutTranspose const& /*input_tr*/,
+    transpose::internal::LayoutTranspose const& /*filter_tr*/,
+    transpose::internal::LayoutTranspose const& /*output_tr*/,
+    typename Backend::template pointer_type<T> /*workspace*/,
+    size_t /*workspace_size*/, size_t /*launcher_size*/, Backend& /*backend*/,
+    Launcher&& /*launcher*/) {
+  return StatusCode::InvalidAlgorithm;
+}
+
+}  // namespace helpers
+}  // namespace internal
+}  // namespace sycldnn
+
+#endif  // SYCLDNN_INCLUDE_INTERNAL_HELPERS_LAYOUT_CONVERSION_H_
@@ -0,0 +1,59 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef SYCLDNN_INCLUDE_INTERNAL_HELPERS_STAT_TYPE_H_
+#define SYCLDNN_INCLUDE_INTERNAL_HELPERS_STAT_TYPE_H_
+
+#include "sycldnn/mem_object.h"
+
+#include <CL/sycl.hpp>
+
+namespace sycldnn {
+namespace internal {
+namespace helpers {
+
+/**
+ * The type used to accumulate the statistics of a tensor of type T, and so
+ * the type of any temporary statistics held in a workspace.
+ *
+ * Half precision statistics are accumulated in single precision, as both the
+ * element counts and the sums of squared differences can easily exceed the
+ * range of a half.
+ */
+template <typename T>
+struct StatType {
+  /** The accumulator type. */
+  using type = T;
+};
+
+/** \copydoc StatType */
+template <>
+struct StatType<cl::sycl::half> {
+  /** The accumulator type. */
+  using type = float;
+};
+
+/**
+ * A memory object holding values of the type used to accumulate the
+ * statistics of a tensor of type T.
+ */
+template <typename T>
+using StatMemObject = BaseMemObject<typename StatType<T>::type>;
+
+}  // namespace helpers
+}  // namespace internal
+}  // namespace sycldnn
+
+#endif  // SYCLDNN_INCLUDE_INTERNAL_HELPERS_STAT_TYPE_H_
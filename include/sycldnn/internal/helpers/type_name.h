@@ -0,0 +1,59 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef SYCLDNN_INCLUDE_INTERNAL_HELPERS_TYPE_NAME_H_
+#define SYCLDNN_INCLUDE_INTERNAL_HELPERS_TYPE_NAME_H_
+
+#include <CL/sycl.hpp>
+
+namespace sycldnn {
+namespace internal {
+namespace helpers {
+
+/**
+ * Get a short name for a data type, used in the keys of tables of tuned
+ * kernel choices which are stored on disk.
+ */
+template <typename T>
+struct TypeName;
+
+/** \copydoc TypeName */
+template <>
+struct TypeName<float> {
+  /** Name of the data type. */
+  static constexpr char const* value = "float";
+};
+
+/** \copydoc TypeName */
+template <>
+struct TypeName<double> {
+  /** Name of the data type. */
+  static constexpr char const* value = "double";
+};
+
+#ifdef SNN_USE_HALF
+/** \copydoc TypeName */
+template <>
+struct TypeName<cl::sycl::half> {
+  /** Name of the data type. */
+  static constexpr char const* value = "half";
+};
+#endif  // SNN_USE_HALF
+
+}  // namespace helpers
+}  // namespace internal
+}  // namespace sycldnn
+
+#endif  // SYCLDNN_INCLUDE_INTERNAL_HELPERS_TYPE_NAME_H_
@@ -21,6 +21,10 @@
 #include "sycldnn/mem_object.h"
 #include "sycldnn/status.h"
 
+#include "sycldnn/helpers/ratio.h"
+
+#include "sycldnn/matmul/tile_config.h"
+
 #include "sycldnn/export.h"
 
 namespace sycldnn {
@@ -28,7 +32,23 @@ namespace matmul {
 namespace internal {
 
 /**
- * The internal matrix multiply launcher.
+ * Get the tile configuration to use for a matrix multiply when no tuned
+ * configuration is provided, chosen from the shape of the multiply and the
+ * capabilities of the device.
+ *
+ * Implemented in the compiled SYCL DNN library.
+ */
+template <typename T>
+SNN_EXPORT TileConfig get_default_config(cl::sycl::queue& queue, int batches,
+                                         int m, int k, int n);
+
+/**
+ * The internal matrix multiply launcher, using the kernel for the given tile
+ * configuration. Returns StatusCode::InvalidAlgorithm if the configuration is
+ * not compiled into the library or is not supported by the device.
+ *
+ * Configurations which split the accumulation dimension need a workspace, so
+ * also return StatusCode::InvalidAlgorithm with this launcher.
  *
  * Implemented in the compiled SYCL DNN library.
  */
@@ -36,7 +56,65 @@ template <typename T, bool TransposeLHS, bool TransposeRHS>
 SNN_EXPORT SNNStatus launch(BaseMemObject<T const>& lhs,
                             BaseMemObject<T const>& rhs,
                             BaseMemObject<T>& output, int batches, int m, int k,
-                            int n, T beta, cl::sycl::queue& queue);
+                            int n, T beta, cl::sycl::queue& queue,
+                            TileConfig const& config);
+
+/**
+ * The internal matrix multiply launcher, using the kernel for the given tile
+ * configuration and the provided workspace for any partial products. The
+ * workspace must hold at least batches * k_splits * m * n elements when the
+ * configuration splits the accumulation dimension, and is otherwise unused.
+ *
+ * Implemented in the compiled SYCL DNN library.
+ */
+template <typename T, bool TransposeLHS, bool TransposeRHS>
+SNN_EXPORT SNNStatus launch(BaseMemObject<T const>& lhs,
+                            BaseMemObject<T const>& rhs,
+                            BaseMemObject<T>& output,
+                            BaseMemObject<T>& workspace, int batches, int m,
+                            int k, int n, T beta, cl::sycl::queue& queue,
+                            TileConfig const& config);
+
+/** The accumulator tile size of the packed right hand side layout. */
+constexpr int packed_rhs_acc_tile = 4;
+/** The column tile size of the packed right hand side layout. */
+constexpr int packed_rhs_col_tile = 4;
+
+/**
+ * Get the number of elements needed to hold a [k, n] right hand side matrix
+ * in the packed layout, where both dimensions are padded to whole tiles.
+ */
+inline size_t get_packed_rhs_size(int k, int n) {
+  return static_cast<size_t>(
+             helpers::round_up_to_nearest_multiple(k, packed_rhs_acc_tile)) *
+         helpers::round_up_to_nearest_multiple(n, packed_rhs_col_tile);
+}
+
+/**
+ * Pack a row-major [k, n] right hand side matrix into panels of
+ * packed_rhs_col_tile columns, each stored as contiguous tiles of
+ * packed_rhs_acc_tile rows, so that it can be reused in any number of calls
+ * to launch_packed_rhs(). The packed buffer must hold get_packed_rhs_size(k,
+ * n) elements.
+ *
+ * Implemented in the compiled SYCL DNN library.
+ */
+template <typename T>
+SNN_EXPORT SNNStatus launch_pack_rhs(BaseMemObject<T const>& rhs,
+                                     BaseMemObject<T>& packed, int k, int n,
+                                     cl::sycl::queue& queue);
+
+/**
+ * Compute a single [m, k] x [k, n] matrix multiply where the right hand side
+ * has been packed by launch_pack_rhs().
+ *
+ * Implemented in the compiled SYCL DNN library.
+ */
+template <typename T>
+SNN_EXPORT SNNStatus launch_packed_rhs(BaseMemObject<T const>& lhs,
+                                       BaseMemObject<T const>& packed_rhs,
+                                       BaseMemObject<T>& output, int m, int k,
+                                       int n, T beta, cl::sycl::queue& queue);
 
 }  // namespace internal
 }  // namespace matmul
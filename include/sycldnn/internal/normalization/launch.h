@@ -0,0 +1,110 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef SYCLDNN_INCLUDE_INTERNAL_NORMALIZATION_LAUNCH_H_
+#define SYCLDNN_INCLUDE_INTERNAL_NORMALIZATION_LAUNCH_H_
+
+#include "sycldnn/mem_object.h"
+#include "sycldnn/status.h"
+
+#include "sycldnn/normalization/params.h"
+
+#include "sycldnn/internal/helpers/stat_type.h"
+
+#include <CL/sycl.hpp>
+
+#include <stddef.h>
+
+#include "sycldnn/export.h"
+
+namespace sycldnn {
+namespace normalization {
+namespace internal {
+
+using ::sycldnn::internal::helpers::StatMemObject;
+
+/**
+ * Get the number of accumulator values needed in the workspace of the
+ * gradient kernels, which hold the mean and inverse standard deviation of
+ * every group in the batch.
+ */
+inline size_t get_gradient_workspace_size(NormalizationParams const& params) {
+  return 2 * static_cast<size_t>(params.batch) * get_groups(params);
+}
+
+/**
+ * Launch a single kernel to normalize each group of the input, then scale and
+ * shift the normalized values by the per-channel gamma and beta:
+ *   output = gamma * (input - mean) / sqrt(variance + epsilon) + beta
+ *
+ * Implemented in the compiled SYCL DNN library.
+ *
+ * \param input  Input tensor, in the layout given by params.input_format.
+ * \param beta   Per-channel shift applied after normalizing.
+ * \param gamma  Per-channel scale applied after normalizing.
+ * \param output Output tensor, in the same layout as the input.
+ * \param params Normalization parameters describing the tensor shape.
+ * \param queue  SYCL queue to enqueue the kernel to.
+ * \return An SNNStatus with event linked to the kernel launch or an error
+ *         code.
+ */
+template <typename T>
+SNN_EXPORT SNNStatus launch_forward(BaseMemObject<T const>& input,
+                                    BaseMemObject<T const>& beta,
+                                    BaseMemObject<T const>& gamma,
+                                    BaseMemObject<T>& output,
+                                    NormalizationParams const& params,
+                                    cl::sycl::queue& queue);
+
+/**
+ * Launch the kernels to compute the gradients of a normalization with respect
+ * to its input, beta and gamma.
+ *
+ * The first kernel recomputes the statistics of each group and writes the
+ * input gradient, along with the statistics for the second kernel which
+ * reduces the per-channel beta and gamma gradients.
+ *
+ * Implemented in the compiled SYCL DNN library.
+ *
+ * \param input      Input to the forward normalization.
+ * \param gradient   Gradient with respect to the normalization output.
+ * \param gamma      Per-channel scale used in the forward normalization.
+ * \param beta_grad  Output tensor for the gradient with respect to beta.
+ * \param gamma_grad Output tensor for the gradient with respect to gamma.
+ * \param output     Output tensor for the gradient with respect to the input.
+ * \param workspace  Temporary memory for the statistics of each group,
+ *                   holding at least get_gradient_workspace_size(params)
+ *                   values.
+ * \param params     Normalization parameters describing the tensor shape.
+ * \param queue      SYCL queue to enqueue the kernels to.
+ * \return An SNNStatus with event linked to the last kernel launch or an
+ *         error code.
+ */
+template <typename T>
+SNN_EXPORT SNNStatus launch_gradient(BaseMemObject<T const>& input,
+                                     BaseMemObject<T const>& gradient,
+                                     BaseMemObject<T const>& gamma,
+                                     BaseMemObject<T>& beta_grad,
+                                     BaseMemObject<T>& gamma_grad,
+                                     BaseMemObject<T>& output,
+                                     StatMemObject<T>& workspace,
+                                     NormalizationParams const& params,
+                                     cl::sycl::queue& queue);
+
+}  // namespace internal
+}  // namespace normalization
+}  // namespace sycldnn
+
+#endif  // SYCLDNN_INCLUDE_INTERNAL_NORMALIZATION_LAUNCH_H_
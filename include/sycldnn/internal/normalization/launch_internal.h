@@ -0,0 +1,115 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef SYCLDNN_INCLUDE_INTERNAL_NORMALIZATION_LAUNCH_INTERNAL_H_
+#define SYCLDNN_INCLUDE_INTERNAL_NORMALIZATION_LAUNCH_INTERNAL_H_
+
+#include "sycldnn/status.h"
+
+#include "sycldnn/internal/normalization/launch.h"
+
+#include "sycldnn/internal/helpers/allocated_pointer.h"
+#include "sycldnn/internal/helpers/stat_type.h"
+
+#include "sycldnn/normalization/direction.h"
+#include "sycldnn/normalization/params.h"
+#include "sycldnn/normalization/sizes.h"
+
+#include <type_traits>
+
+namespace sycldnn {
+namespace normalization {
+namespace internal {
+
+template <typename Direction>
+using EnableIfGradient = typename std::enable_if<
+    std::is_same<Direction, sycldnn::normalization::Gradient>::value,
+    int>::type;
+
+template <typename Direction>
+using DisableIfGradient = typename std::enable_if<
+    !std::is_same<Direction, sycldnn::normalization::Gradient>::value,
+    int>::type;
+
+/**
+ * The internal normalization launcher for the Forward direction.
+ *
+ * Launches a single kernel which computes the mean and variance of each group
+ * and writes the scaled and shifted normalized values.
+ */
+template <typename T, typename Direction, typename Backend,
+          typename = DisableIfGradient<Direction>>
+SNNStatus launch(typename Backend::template pointer_type<T const> input,
+                 typename Backend::template pointer_type<T const> beta,
+                 typename Backend::template pointer_type<T const> gamma,
+                 typename Backend::template pointer_type<T> output,
+                 NormalizationParams const& params, Backend& backend) {
+  auto sizes = get_sizes(params);
+  auto in_mem = backend.get_mem_object(input, sizes.input_size);
+  auto beta_mem = backend.get_mem_object(beta, sizes.scale_size);
+  auto gamma_mem = backend.get_mem_object(gamma, sizes.scale_size);
+  auto out_mem = backend.get_mem_object(output, sizes.output_size);
+  auto queue = backend.get_queue();
+  return launch_forward<T>(in_mem, beta_mem, gamma_mem, out_mem, params,
+                           queue);
+}
+
+/**
+ * The internal normalization launcher for the Gradient (Backward) direction.
+ *
+ * With x_hat the normalized input, g = gamma * dy and means taken over each
+ * group, computes:
+ *   dx         = (g - mean(g) - x_hat * mean(g * x_hat)) / sqrt(var + eps)
+ *   beta_grad  = sum(dy)
+ *   gamma_grad = sum(dy * x_hat)
+ * where the beta and gamma gradients are summed over every value in each
+ * channel.
+ */
+template <typename T, typename Direction, typename Backend,
+          typename = EnableIfGradient<Direction>>
+SNNStatus launch(typename Backend::template pointer_type<T const> input,
+                 typename Backend::template pointer_type<T const> gradient,
+                 typename Backend::template pointer_type<T const> gamma,
+                 typename Backend::template pointer_type<T> beta_grad,
+                 typename Backend::template pointer_type<T> gamma_grad,
+                 typename Backend::template pointer_type<T> output,
+                 NormalizationParams const& params, Backend& backend) {
+  auto sizes = get_sizes(params);
+  auto in_mem = backend.get_mem_object(input, sizes.input_size);
+  auto grad_mem = backend.get_mem_object(gradient, sizes.input_size);
+  auto gamma_mem = backend.get_mem_object(gamma, sizes.scale_size);
+  auto beta_grad_mem = backend.get_mem_object(beta_grad, sizes.scale_size);
+  auto gamma_grad_mem = backend.get_mem_object(gamma_grad, sizes.scale_size);
+  auto out_mem = backend.get_mem_object(output, sizes.output_size);
+
+  // The mean and inverse standard deviation of each group are only needed
+  // by the scale gradient kernel, so are held in memory from the backend.
+  using Stat = typename ::sycldnn::internal::helpers::StatType<T>::type;
+  size_t const workspace_size = get_gradient_workspace_size(params);
+  ::sycldnn::internal::helpers::AllocatedPointer<Stat, Backend> workspace{
+      sizeof(Stat) * workspace_size, backend};
+  auto workspace_mem =
+      backend.get_mem_object_internal(workspace.get(), workspace_size);
+  auto queue = backend.get_queue();
+  return launch_gradient<T>(in_mem, grad_mem, gamma_mem, beta_grad_mem,
+                            gamma_grad_mem, out_mem, workspace_mem, params,
+                            queue);
+}
+
+}  // namespace internal
+}  // namespace normalization
+}  // namespace sycldnn
+
+#endif  // SYCLDNN_INCLUDE_INTERNAL_NORMALIZATION_LAUNCH_INTERNAL_H_
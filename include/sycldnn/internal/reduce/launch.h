@@ -17,8 +17,11 @@
 #define SYCLDNN_INCLUDE_INTERNAL_REDUCE_LAUNCH_H_
 
 #include <CL/sycl.hpp>
+#include <cstddef>
+#include <cstdint>
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 #include "sycldnn/export.h"
 #include "sycldnn/internal/helpers/types.h"
@@ -48,6 +51,30 @@ SNN_EXPORT SNNStatus launch(BaseMemObject<T const>& input,
                             sycldnn::internal::types::KernelSubgroupSizesMap&
                                 max_kernel_sub_group_sizes);
 #endif
+/**
+ * The internal arg reduce launcher, computing the index of the largest value
+ * for ArgMax or the smallest value for ArgMin.
+ *
+ * Implemented in the compiled SYCL DNN library.
+ */
+template <typename T, typename Op>
+SNN_EXPORT SNNStatus launch_arg(BaseMemObject<T const>& input,
+                                BaseMemObject<int32_t>& output, int batches,
+                                int outer, int inner, cl::sycl::queue& queue);
+
+/**
+ * The internal top-k launcher, computing the k largest values and their
+ * indices.
+ *
+ * Implemented in the compiled SYCL DNN library.
+ */
+template <typename T>
+SNN_EXPORT SNNStatus launch_topk(BaseMemObject<T const>& input,
+                                 BaseMemObject<T>& values,
+                                 BaseMemObject<int32_t>& indices, int batches,
+                                 int outer, int inner, int k,
+                                 cl::sycl::queue& queue);
+
 /**
  * Helper for internal reduce launcher.
  */
@@ -72,6 +99,144 @@ inline SNNStatus launch(BaseMemObject<T const>& input, BaseMemObject<T>& output,
 }
 #endif
 
+/**
+ * The sizes of a single [batches, outer, inner] reduction pass, reducing the
+ * outer dimension.
+ */
+struct ReductionPass {
+  /** The number of batches. */
+  int batches;
+  /** The size of the dimension to reduce. */
+  int outer;
+  /** The number of contiguous elements following the reduced dimension. */
+  int inner;
+};
+
+/**
+ * Split a reduction of the given axes of an N-D tensor into a sequence of
+ * [batches, outer, inner] reductions.
+ *
+ * Dimensions of size one are dropped and adjacent dimensions which are either
+ * all reduced or all kept are coalesced, so that the tensor is viewed as
+ * alternating kept and reduced segments. Each pass then reduces one of the
+ * reduced segments in place, without transposing the data. The largest
+ * segment is reduced first as that shrinks the data read by the later passes
+ * the most.
+ *
+ * Applying Mean in each pass computes the mean over all reduced axes, as every
+ * element of a pass's output averages the same number of values.
+ *
+ * \param dims The size of each dimension of the input tensor.
+ * \param axes The distinct dimensions to reduce.
+ * \return The reduction passes to run, in order. There is always at least one
+ *         pass.
+ */
+inline std::vector<ReductionPass> get_reduction_passes(
+    std::vector<int> const& dims, std::vector<int> const& axes) {
+  std::vector<bool> is_reduced(dims.size(), false);
+  for (int axis : axes) {
+    is_reduced[axis] = true;
+  }
+
+  struct Segment {
+    int size;
+    bool reduced;
+  };
+  std::vector<Segment> segments;
+  for (size_t i = 0; i < dims.size(); ++i) {
+    if (dims[i] == 1) {
+      continue;
+    }
+    if (!segments.empty() && segments.back().reduced == is_reduced[i]) {
+      segments.back().size *= dims[i];
+    } else {
+      segments.push_back({dims[i], is_reduced[i]});
+    }
+  }
+
+  std::vector<ReductionPass> passes;
+  while (true) {
+    size_t reduce_idx = segments.size();
+    for (size_t i = 0; i < segments.size(); ++i) {
+      if (segments[i].reduced &&
+          (reduce_idx == segments.size() ||
+           segments[i].size >= segments[reduce_idx].size)) {
+        reduce_idx = i;
+      }
+    }
+    if (reduce_idx == segments.size()) {
+      break;
+    }
+
+    ReductionPass pass{1, segments[reduce_idx].size, 1};
+    for (size_t i = 0; i < reduce_idx; ++i) {
+      pass.batches *= segments[i].size;
+    }
+    for (size_t i = reduce_idx + 1; i < segments.size(); ++i) {
+      pass.inner *= segments[i].size;
+    }
+    passes.push_back(pass);
+
+    // The neighbours of a reduced segment are both kept, so merge them.
+    bool has_prev = reduce_idx > 0;
+    bool has_next = reduce_idx + 1 < segments.size();
+    if (has_prev && has_next) {
+      segments[reduce_idx - 1].size *= segments[reduce_idx + 1].size;
+      segments.erase(segments.begin() + reduce_idx,
+                     segments.begin() + reduce_idx + 2);
+    } else {
+      segments.erase(segments.begin() + reduce_idx);
+    }
+  }
+
+  if (passes.empty()) {
+    // Nothing to reduce, so the output is a copy of the input.
+    int size = segments.empty() ? 1 : segments.front().size;
+    passes.push_back({1, 1, size});
+  }
+  return passes;
+}
+
+/**
+ * Run a sequence of reduction passes, storing the intermediate results in
+ * temporary buffers and the result of the last pass in the output.
+ */
+template <typename Op, typename T, typename Backend>
+inline SNNStatus launch(BaseMemObject<T const>& input, BaseMemObject<T>& output,
+                        ReductionPass const* first, ReductionPass const* last,
+                        Backend& backend) {
+  ReductionPass const& pass = *first;
+  if (first + 1 == last) {
+    return launch<Op>(input, output, pass.batches, pass.outer, pass.inner,
+                      backend);
+  }
+
+  size_t pass_size = static_cast<size_t>(pass.batches) * pass.inner;
+  cl::sycl::buffer<T, 1> pass_output_buf((cl::sycl::range<1>(pass_size)));
+  auto pass_output = make_mem_object(pass_output_buf, pass_size);
+  SNNStatus status = launch<Op>(input, pass_output, pass.batches, pass.outer,
+                                pass.inner, backend);
+  if (sycldnn::StatusCode::OK != status.status) {
+    return status;
+  }
+
+  auto const_pass_output = pass_output.as_const();
+  return launch<Op>(const_pass_output, output, first + 1, last, backend);
+}
+
+/**
+ * Helper for internal reduce launcher reducing any set of axes of an N-D
+ * tensor.
+ */
+template <typename Op, typename T, typename Backend>
+inline SNNStatus launch(BaseMemObject<T const>& input, BaseMemObject<T>& output,
+                        std::vector<int> const& dims,
+                        std::vector<int> const& axes, Backend& backend) {
+  auto passes = get_reduction_passes(dims, axes);
+  return launch<Op>(input, output, passes.data(),
+                    passes.data() + passes.size(), backend);
+}
+
 }  // namespace internal
 }  // namespace reduce
 }  // namespace sycldnn
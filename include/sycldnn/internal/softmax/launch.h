@@ -0,0 +1,86 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef SYCLDNN_INCLUDE_INTERNAL_SOFTMAX_LAUNCH_H_
+#define SYCLDNN_INCLUDE_INTERNAL_SOFTMAX_LAUNCH_H_
+
+#include "sycldnn/mem_object.h"
+#include "sycldnn/status.h"
+
+#include "sycldnn/softmax/direction.h"
+#include "sycldnn/softmax/params.h"
+
+#include <CL/sycl.hpp>
+
+#include "sycldnn/export.h"
+
+namespace sycldnn {
+namespace softmax {
+namespace internal {
+
+/**
+ * Launch a single kernel to compute the softmax of the input along the channel
+ * dimension, or the log-softmax if Direction is LogForward.
+ *
+ * The maximum and sum of exponentials of each row are computed in a single
+ * pass using online rescaling, so no workspace is required.
+ *
+ * Implemented in the compiled SYCL DNN library.
+ *
+ * \param input  Input tensor, in the layout given by params.input_format.
+ * \param output Output tensor, in the same layout as the input.
+ * \param params Softmax parameters describing the tensor shape.
+ * \param queue  SYCL queue to enqueue the kernel to.
+ * \return An SNNStatus with event linked to the kernel launch or an error
+ *         code.
+ */
+template <typename T, typename Direction>
+SNN_EXPORT SNNStatus launch_forward(BaseMemObject<T const>& input,
+                                    BaseMemObject<T>& output,
+                                    SoftmaxParams const& params,
+                                    cl::sycl::queue& queue);
+
+/**
+ * Launch a single kernel to compute the gradient of the softmax along the
+ * channel dimension, given the output of the forward softmax y and the
+ * gradient dy:
+ *   dx = y * (dy - sum(dy * y))
+ * or if Direction is LogGradient, given the output of the forward log-softmax:
+ *   dx = dy - exp(y) * sum(dy)
+ *
+ * Implemented in the compiled SYCL DNN library.
+ *
+ * \param input    Output of the forward softmax, in the layout given by
+ *                 params.input_format.
+ * \param gradient Gradient with respect to the softmax output.
+ * \param output   Output tensor for the gradient with respect to the softmax
+ *                 input.
+ * \param params   Softmax parameters describing the tensor shape.
+ * \param queue    SYCL queue to enqueue the kernel to.
+ * \return An SNNStatus with event linked to the kernel launch or an error
+ *         code.
+ */
+template <typename T, typename Direction>
+SNN_EXPORT SNNStatus launch_gradient(BaseMemObject<T const>& input,
+                                     BaseMemObject<T const>& gradient,
+                                     BaseMemObject<T>& output,
+                                     SoftmaxParams const& params,
+                                     cl::sycl::queue& queue);
+
+}  // namespace internal
+}  // namespace softmax
+}  // namespace sycldnn
+
+#endif  // SYCLDNN_INCLUDE_INTERNAL_SOFTMAX_LAUNCH_H_
@@ -19,311 +19,85 @@
 
 #include "sycldnn/status.h"
 
-#include "sycldnn/internal/pointwise/launch_internal.h"
-#include "sycldnn/pointwise/direction.h"
-#include "sycldnn/pointwise/operators.h"
+#include "sycldnn/internal/softmax/launch.h"
 
-#include "sycldnn/binaryop/operators.h"
-#include "sycldnn/internal/binaryop/launch.h"
+#include "sycldnn/softmax/direction.h"
+#include "sycldnn/softmax/params.h"
+#include "sycldnn/softmax/sizes.h"
 
-#include "sycldnn/reduce/operators.h"
+#include <type_traits>
 
 namespace sycldnn {
 namespace softmax {
 namespace internal {
 
+/** Whether the direction computes a gradient, rather than a forward pass. */
 template <typename Direction>
-using EnableIfGradient = typename std::enable_if<
-    std::is_same<Direction, sycldnn::softmax::Gradient>::value, int>::type;
+struct IsGradient
+    : std::integral_constant<
+          bool, std::is_same<Direction, sycldnn::softmax::Gradient>::value ||
+                    std::is_same<Direction,
+                                 sycldnn::softmax::LogGradient>::value> {};
 
 template <typename Direction>
-using DisableIfGradient = typename std::enable_if<
-    !std::is_same<Direction, sycldnn::softmax::Gradient>::value, int>::type;
+using EnableIfGradient =
+    typename std::enable_if<IsGradient<Direction>::value, int>::type;
 
-/**
- * \copydoc launch<T, sycldnn::softmax::Forward, Backend>()
- * Special case for the Forward Direction and NHWC layout.
- */
-template <typename T, typename Backend>
-SNNStatus launch_forward_nhwc(
-    typename Backend::template pointer_type<T const> input,
-    typename Backend::template pointer_type<T> workspace,
-    typename Backend::template pointer_type<T> output,
-    SoftmaxParams const& params, Backend& backend) {
-  SNN_VALIDATE_PARAM(params.input_format == sycldnn::DataFormat::NHWC,
-                     "Unexpected layout");
-  auto n_items = params.batch * params.rows * params.cols * params.channels;
-  auto queue = backend.get_queue();
-  auto in_mem = backend.get_mem_object(input, n_items);
-  auto out_mem = backend.get_mem_object(output, n_items);
-  auto workspace_items = params.batch * params.rows * params.cols;
-
-  using ConstPointer = typename Backend::template pointer_type<T const>;
-  SNNStatus status;
-  status.event = backend.template reduce<reduce::Max>(
-      input, workspace, params.batch * params.rows * params.cols,
-      params.channels, 1);
-
-  if (sycldnn::StatusCode::OK != status.status) {
-    return status;
-  }
-
-  auto const_workspace = ConstPointer{workspace};
-  auto const_workspace_mem =
-      backend.get_mem_object(const_workspace, workspace_items);
-
-  status = binaryop::internal::launch_binaryop<binaryop::Sub>(
-      in_mem, const_workspace_mem, out_mem,
-      {params.batch, params.rows, params.cols, params.channels},
-      {params.batch, params.rows, params.cols, 1}, queue);
-
-  if (sycldnn::StatusCode::OK != status.status) {
-    return status;
-  }
-
-  auto const_output = ConstPointer{output};
-  auto const_output_mem = backend.get_mem_object(const_output, n_items);
-  status = pointwise::internal::launch_pointwise<pointwise::Exp>(
-      const_output_mem, out_mem, n_items, queue);
-
-  if (sycldnn::StatusCode::OK != status.status) {
-    return status;
-  }
-
-  status.event = backend.template reduce<reduce::Add>(
-      ConstPointer{output}, workspace, params.batch * params.rows * params.cols,
-      params.channels, 1);
-
-  status = binaryop::internal::launch_binaryop<binaryop::Div>(
-      const_output_mem, const_workspace_mem, out_mem,
-      {params.batch, params.rows, params.cols, params.channels},
-      {params.batch, params.rows, params.cols, 1}, queue);
-  return status;
-}
-
-/**
- * \copydoc launch<T, sycldnn::softmax::Forward, Backend>()
- * Special case for the Forward Direction and NCHW layout.
- */
-template <typename T, typename Backend>
-SNNStatus launch_forward_nchw(
-    typename Backend::template pointer_type<T const> input,
-    typename Backend::template pointer_type<T> workspace,
-    typename Backend::template pointer_type<T> output,
-    SoftmaxParams const& params, Backend& backend) {
-  SNN_VALIDATE_PARAM(params.input_format == sycldnn::DataFormat::NCHW,
-                     "Unexpected layout");
-  auto n_items = params.batch * params.channels * params.rows * params.cols;
-  auto queue = backend.get_queue();
-  auto in_mem = backend.get_mem_object(input, n_items);
-  auto out_mem = backend.get_mem_object(output, n_items);
-  auto workspace_items = params.batch * params.rows * params.cols;
-
-  using ConstPointer = typename Backend::template pointer_type<T const>;
-  SNNStatus status;
-  status.event = backend.template reduce<reduce::Max>(
-      input, workspace, params.batch, params.channels,
-      params.rows * params.cols);
-
-  if (sycldnn::StatusCode::OK != status.status) {
-    return status;
-  }
-
-  auto const_workspace = ConstPointer{workspace};
-  auto const_workspace_mem =
-      backend.get_mem_object(const_workspace, workspace_items);
-
-  status = binaryop::internal::launch_binaryop<binaryop::Sub>(
-      in_mem, const_workspace_mem, out_mem,
-      {params.batch, params.channels, params.rows, params.cols},
-      {params.batch, 1, params.rows, params.cols}, queue);
-
-  if (sycldnn::StatusCode::OK != status.status) {
-    return status;
-  }
-
-  auto const_output = ConstPointer{output};
-  auto const_output_mem = backend.get_mem_object(const_output, n_items);
-  status = pointwise::internal::launch_pointwise<pointwise::Exp>(
-      const_output_mem, out_mem, n_items, queue);
-
-  if (sycldnn::StatusCode::OK != status.status) {
-    return status;
-  }
-
-  status.event = backend.template reduce<reduce::Add>(
-      ConstPointer{output}, workspace, params.batch, params.channels,
-      params.rows * params.cols);
-
-  status = binaryop::internal::launch_binaryop<binaryop::Div>(
-      const_output_mem, const_workspace_mem, out_mem,
-      {params.batch, params.channels, params.rows, params.cols},
-      {params.batch, 1, params.rows, params.cols}, queue);
-  return status;
-}
+template <typename Direction>
+using DisableIfGradient =
+    typename std::enable_if<!IsGradient<Direction>::value, int>::type;
 
 /**
- * The internal softmax launcher for Forward direction.
+ * The internal softmax launcher for Forward and LogForward directions.
  *
- * Performs an element-wise exponentiation, followed by reduction
- * and then the pointwise division.
- * The input is subtracted from its maximum value (on the channel dimension)
- * to avoid values overflowing with the exponential. This has no effect on the
- * output.
+ * Launches a single kernel which computes the maximum and the sum of
+ * exponentials of each row in one pass, rescaling the running sum whenever the
+ * maximum changes, then writes the normalized exponentials. Subtracting the
+ * maximum avoids values overflowing with the exponential and has no effect on
+ * the output. The log-softmax is computed as x - max - log(sum) without
+ * taking the logarithm of the softmax, so small probabilities do not
+ * underflow.
+ *
+ * The workspace is not required by the forward pass.
  */
 template <typename T, typename Direction, typename Backend,
           typename = DisableIfGradient<Direction>>
 SNNStatus launch(typename Backend::template pointer_type<T const> input,
-                 typename Backend::template pointer_type<T> workspace,
+                 typename Backend::template pointer_type<T> /*workspace*/,
                  typename Backend::template pointer_type<T> output,
                  SoftmaxParams const& params, Backend& backend) {
-  if (params.input_format == sycldnn::DataFormat::NHWC) {
-    return launch_forward_nhwc<T, Backend>(input, workspace, output, params,
-                                           backend);
-  } else if (params.input_format == sycldnn::DataFormat::NCHW) {
-    return launch_forward_nchw<T, Backend>(input, workspace, output, params,
-                                           backend);
-  }
-  SNN_ASSERT(false, "Unsupported layout");
-  return SNNStatus(StatusCode::InvalidParameter);
-}
-
-/**
- * \copydoc launch<T, sycldnn::softmax::Gradient, Backend>()
- * Special case for the Gradient Direction and NHWC layout.
- */
-template <typename T, typename Backend>
-SNNStatus launch_gradient_nhwc(
-    typename Backend::template pointer_type<T const> input,
-    typename Backend::template pointer_type<T const> gradient,
-    typename Backend::template pointer_type<T> workspace,
-    typename Backend::template pointer_type<T> output,
-    SoftmaxParams const& params, Backend& backend) {
-  SNN_VALIDATE_PARAM(params.input_format == sycldnn::DataFormat::NHWC,
-                     "Unexpected layout");
-  auto n_items1 = params.batch * params.rows * params.cols * params.channels;
-  auto n_items2 = params.batch * params.rows * params.cols;
-
-  auto in_mem = backend.get_mem_object(input, n_items1);
-  auto grad_mem = backend.get_mem_object(gradient, n_items1);
-  auto workspace_mem = backend.get_mem_object(workspace, n_items1);
-  auto out_mem = backend.get_mem_object(output, n_items1);
-
-  auto queue = backend.get_queue();
-
-  SNNStatus status = binaryop::internal::launch_binaryop<binaryop::Mul>(
-      grad_mem, in_mem, workspace_mem, n_items1, queue);
-
-  if (sycldnn::StatusCode::OK != status.status) {
-    return status;
-  }
-
-  using ConstPointer = typename Backend::template pointer_type<T const>;
-
-  auto const_workspace = ConstPointer{workspace};
-  auto const_workspace_mem = backend.get_mem_object(const_workspace, n_items1);
-
-  status.event = backend.template reduce<reduce::Add>(
-      const_workspace, output, params.batch * params.rows * params.cols,
-      params.channels, 1);
-
-  auto const_output = ConstPointer{output};
-  auto const_output_mem = backend.get_mem_object(const_output, n_items2);
-
-  status = binaryop::internal::launch_binaryop<binaryop::Sub>(
-      grad_mem, const_output_mem, workspace_mem,
-      {params.batch, params.rows, params.cols, params.channels},
-      {params.batch, params.rows, params.cols, 1}, queue);
-
-  if (sycldnn::StatusCode::OK != status.status) {
-    return status;
-  }
-
-  status = binaryop::internal::launch_binaryop<binaryop::Mul>(
-      const_workspace_mem, in_mem, out_mem, n_items1, queue);
-
-  return status;
-}
-
-/**
- * \copydoc launch<T, sycldnn::softmax::Gradient, Backend>()
- * Special case for the Gradient Direction and NCHW layout.
- */
-template <typename T, typename Backend>
-SNNStatus launch_gradient_nchw(
-    typename Backend::template pointer_type<T const> input,
-    typename Backend::template pointer_type<T const> gradient,
-    typename Backend::template pointer_type<T> workspace,
-    typename Backend::template pointer_type<T> output,
-    SoftmaxParams const& params, Backend& backend) {
-  SNN_VALIDATE_PARAM(params.input_format == sycldnn::DataFormat::NCHW,
-                     "Unexpected layout");
-  auto n_items1 = params.batch * params.channels * params.rows * params.cols;
-  auto n_items2 = params.batch * params.rows * params.cols;
-
-  auto in_mem = backend.get_mem_object(input, n_items1);
-  auto grad_mem = backend.get_mem_object(gradient, n_items1);
-  auto workspace_mem = backend.get_mem_object(workspace, n_items1);
-  auto out_mem = backend.get_mem_object(output, n_items1);
-
+  auto n_items = get_sizes(params).input_size;
+  auto in_mem = backend.get_mem_object(input, n_items);
+  auto out_mem = backend.get_mem_object(output, n_items);
   auto queue = backend.get_queue();
-
-  SNNStatus status = binaryop::internal::launch_binaryop<binaryop::Mul>(
-      grad_mem, in_mem, workspace_mem, n_items1, queue);
-
-  if (sycldnn::StatusCode::OK != status.status) {
-    return status;
-  }
-
-  using ConstPointer = typename Backend::template pointer_type<T const>;
-
-  auto const_workspace = ConstPointer{workspace};
-  auto const_workspace_mem = backend.get_mem_object(const_workspace, n_items1);
-
-  status.event = backend.template reduce<reduce::Add>(
-      const_workspace, output, params.batch, params.channels,
-      params.rows * params.cols);
-
-  auto const_output = ConstPointer{output};
-  auto const_output_mem = backend.get_mem_object(const_output, n_items2);
-
-  status = binaryop::internal::launch_binaryop<binaryop::Sub>(
-      grad_mem, const_output_mem, workspace_mem,
-      {params.batch, params.channels, params.rows, params.cols},
-      {params.batch, 1, params.rows, params.cols}, queue);
-
-  if (sycldnn::StatusCode::OK != status.status) {
-    return status;
-  }
-
-  status = binaryop::internal::launch_binaryop<binaryop::Mul>(
-      const_workspace_mem, in_mem, out_mem, n_items1, queue);
-
-  return status;
+  return launch_forward<T, Direction>(in_mem, out_mem, params, queue);
 }
 
 /**
- * The internal softmax launcher for Gradient (Backward) direction.
+ * The internal softmax launcher for Gradient and LogGradient (Backward)
+ * directions.
  *
- * Performs an binary elementwise multiplication, followed by summation,
- * subtraction and then again multiplication.
+ * Launches a single kernel which computes dx = y * (dy - sum(dy * y)) for each
+ * row, where y is the output of the forward softmax and dy is the gradient.
+ * For the log-softmax, y is the forward log-softmax output and the kernel
+ * computes dx = dy - exp(y) * sum(dy).
+ *
+ * The workspace is not required by the gradient pass.
  */
 template <typename T, typename Direction, typename Backend,
           typename = EnableIfGradient<Direction>>
 SNNStatus launch(typename Backend::template pointer_type<T const> input,
                  typename Backend::template pointer_type<T const> gradient,
-                 typename Backend::template pointer_type<T> workspace,
+                 typename Backend::template pointer_type<T> /*workspace*/,
                  typename Backend::template pointer_type<T> output,
                  SoftmaxParams const& params, Backend& backend) {
-  if (params.input_format == sycldnn::DataFormat::NHWC) {
-    return launch_gradient_nhwc<T, Backend>(input, gradient, workspace, output,
-                                            params, backend);
-  } else if (params.input_format == sycldnn::DataFormat::NCHW) {
-    return launch_gradient_nchw<T, Backend>(input, gradient, workspace, output,
-                                            params, backend);
-  }
-  SNN_ASSERT(false, "Unsupported layout");
-  return SNNStatus(StatusCode::InvalidParameter);
+  auto n_items = get_sizes(params).input_size;
+  auto in_mem = backend.get_mem_object(input, n_items);
+  auto grad_mem = backend.get_mem_object(gradient, n_items);
+  auto out_mem = backend.get_mem_object(output, n_items);
+  auto queue = backend.get_queue();
+  return launch_gradient<T, Direction>(in_mem, grad_mem, out_mem, params,
+                                       queue);
 }
 
 }  // namespace internal
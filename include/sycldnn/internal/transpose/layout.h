@@ -0,0 +1,116 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef SYCLDNN_INCLUDE_INTERNAL_TRANSPOSE_LAYOUT_H_
+#define SYCLDNN_INCLUDE_INTERNAL_TRANSPOSE_LAYOUT_H_
+
+#include "sycldnn/data_format.h"
+
+#include <stddef.h>
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <numeric>
+#include <vector>
+
+namespace sycldnn {
+namespace transpose {
+namespace internal {
+
+/**
+ * The dimensions of a tensor along with the permutation which converts it to
+ * a different layout. An empty permutation means that the tensor is already in
+ * the required layout.
+ */
+struct LayoutTranspose {
+  /** The dimensions of the tensor before it is transposed. */
+  std::vector<int> dimensions;
+  /** The permutation applied to the dimensions. */
+  std::vector<int> permutation;
+};
+
+/** Check whether a layout transpose actually moves any data. */
+inline bool is_required(LayoutTranspose const& transpose) {
+  return !transpose.permutation.empty();
+}
+
+/** Get the number of elements in a tensor with the given dimensions. */
+inline size_t get_size(std::vector<int> const& dimensions) {
+  return std::accumulate(dimensions.begin(), dimensions.end(), size_t{1},
+                         std::multiplies<size_t>{});
+}
+
+/**
+ * Get the order of the dimensions of a data format, in terms of the dimensions
+ * [batch, channel blocks, rows, cols, channels in block].
+ */
+inline std::vector<int> get_dimension_order(DataFormat format) {
+  switch (format) {
+    case DataFormat::NHWC:
+      return {0, 2, 3, 1, 4};
+    case DataFormat::NCHW:
+      return {0, 1, 4, 2, 3};
+    case DataFormat::NCHW4:
+    case DataFormat::NCHW8:
+    case DataFormat::NCHW16:
+    default:
+      return {0, 1, 2, 3, 4};
+  }
+}
+
+/**
+ * Get the transpose which converts a 4D tensor between two data formats.
+ *
+ * The number of channels must be a multiple of the channel block size of any
+ * blocked format, and conversions between two different blocked formats are
+ * not supported.
+ *
+ * \param batch    The number of batches in the tensor.
+ * \param rows     The number of rows in the tensor.
+ * \param cols     The number of columns in the tensor.
+ * \param channels The number of channels in the tensor.
+ * \param from     The current data format of the tensor.
+ * \param to       The required data format of the tensor.
+ * \return Returns the dimensions of the tensor in its current format and the
+ *         permutation to apply to them.
+ */
+inline LayoutTranspose get_layout_transpose(int batch, int rows, int cols,
+                                            int channels, DataFormat from,
+                                            DataFormat to) {
+  if (from == to) {
+    return {};
+  }
+  int const block = std::max(get_channel_block(from), get_channel_block(to));
+  std::vector<int> const sizes{batch, channels / block, rows, cols, block};
+  auto const from_order = get_dimension_order(from);
+  auto const to_order = get_dimension_order(to);
+
+  LayoutTranspose transpose;
+  for (int dim : from_order) {
+    transpose.dimensions.push_back(sizes[dim]);
+  }
+  for (int dim : to_order) {
+    auto pos = std::find(from_order.begin(), from_order.end(), dim);
+    transpose.permutation.push_back(
+        static_cast<int>(std::distance(from_order.begin(), pos)));
+  }
+  return transpose;
+}
+
+}  // namespace internal
+}  // namespace transpose
+}  // namespace sycldnn
+
+#endif  // SYCLDNN_INCLUDE_INTERNAL_TRANSPOSE_LAYOUT_H_
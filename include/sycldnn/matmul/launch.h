@@ -25,10 +25,165 @@
 #include "sycldnn/status.h"
 
 #include "sycldnn/helpers/macros.h"
+#include "sycldnn/internal/helpers/allocated_pointer.h"
+#include "sycldnn/internal/helpers/type_name.h"
 #include "sycldnn/internal/matmul/launch.h"
 
+#include "sycldnn/matmul/tile_config.h"
+#include "sycldnn/matmul/tile_table.h"
+
 namespace sycldnn {
 namespace matmul {
+/**
+ * Get the number of elements needed in the workspace of a batched matrix
+ * multiplication using the given tile configuration.
+ *
+ * Only configurations which split the accumulation dimension need a
+ * workspace, which holds the partial products of every split.
+ *
+ * \param config The tile configuration used for the multiply.
+ * \param batches The number of matrices in each tensor.
+ * \param m The number of rows in the output matrices.
+ * \param n The number of columns in the output matrices.
+ * \return Returns the number of elements needed in the workspace, which is
+ *         zero if the configuration does not need a workspace.
+ */
+inline size_t query_workspace_size(TileConfig const& config, int batches,
+                                   int m, int n) {
+  if (config.k_splits <= 1) {
+    return 0;
+  }
+  return static_cast<size_t>(batches) * config.k_splits * m * n;
+}
+
+/**
+ * Get the number of elements needed in the workspace of a batched matrix
+ * multiplication using the default tile configuration for the backend's
+ * device, as used by the launchers without a configuration.
+ *
+ * \param batches The number of matrices in each tensor.
+ * \param m The number of rows in the output matrices.
+ * \param k The accumulation dimension.
+ * \param n The number of columns in the output matrices.
+ * \param backend The backend implementation, used to get the SYCL device.
+ * \return Returns the number of elements needed in the workspace, which is
+ *         zero if the multiply does not need a workspace.
+ */
+template <typename T, typename Backend>
+size_t query_workspace_size(int batches, int m, int k, int n,
+                            Backend& backend) {
+  auto sycl_queue = backend.get_queue();
+  auto config = internal::get_default_config<T>(sycl_queue, batches, m, k, n);
+  return query_workspace_size(config, batches, m, n);
+}
+
+/**
+ * Launch a batched matrix multiplication using the given tile configuration
+ * and a user provided workspace.
+ *
+ * The parameters are the same as for the launcher without a configuration.
+ *
+ * \param workspace A pointer to the memory used to hold the partial products
+ *                  when the configuration splits the accumulation dimension.
+ * \param workspace_size The number of elements available in the workspace.
+ *                       Must be at least the size given by
+ *                       \ref sycldnn::matmul::query_workspace_size.
+ * \param config The tile and work-group sizes to use. The tile shape must be
+ *               one compiled into the library.
+ * \return Returns an SNNStatus containing the SYCL event tied to the kernel
+ *         launches and a StatusCode enum showing if the launch was OK or
+ *         whether it encountered some problem. If the workspace is too small
+ *         then StatusCode::InsufficientWorkspace is returned.
+ */
+template <typename T, bool TransposeLHS, bool TransposeRHS, typename Backend>
+SNNStatus launch(typename Backend::template pointer_type<T const> lhs,
+                 typename Backend::template pointer_type<T const> rhs,
+                 typename Backend::template pointer_type<T> output,
+                 typename Backend::template pointer_type<T> workspace,
+                 int batches, int m, int k, int n, T beta,
+                 size_t workspace_size, Backend& backend,
+                 TileConfig const& config) {
+  SNN_VALIDATE_PARAM(batches > 0, "The number of batches must be positive.");
+  SNN_VALIDATE_PARAM(m > 0, "The value of m must be positive.");
+  SNN_VALIDATE_PARAM(k > 0, "The value of k must be positive.");
+  SNN_VALIDATE_PARAM(n > 0, "The value of n must be positive.");
+
+  size_t const required_size = query_workspace_size(config, batches, m, n);
+  if (workspace_size < required_size) {
+    return StatusCode::InsufficientWorkspace;
+  }
+
+  size_t lhs_size = batches * m * k;
+  size_t rhs_size = batches * k * n;
+  size_t out_size = batches * m * n;
+
+  auto lhs_acc = backend.get_mem_object(lhs, lhs_size);
+  auto rhs_acc = backend.get_mem_object(rhs, rhs_size);
+  auto out_acc = backend.get_mem_object(output, out_size);
+
+  auto sycl_queue = backend.get_queue();
+
+  if (required_size == 0) {
+    return internal::launch<T, TransposeLHS, TransposeRHS>(
+        lhs_acc, rhs_acc, out_acc, batches, m, k, n, beta, sycl_queue, config);
+  }
+  auto workspace_acc = backend.get_mem_object(workspace, required_size);
+  return internal::launch<T, TransposeLHS, TransposeRHS>(
+      lhs_acc, rhs_acc, out_acc, workspace_acc, batches, m, k, n, beta,
+      sycl_queue, config);
+}
+
+/**
+ * Launch a batched matrix multiplication using the given tile configuration.
+ *
+ * The parameters are the same as for the launcher without a configuration.
+ * If the configuration splits the accumulation dimension then the partial
+ * products are held in a temporary buffer allocated through the backend. Use
+ * the launcher taking a workspace to avoid this allocation.
+ *
+ * \param config The tile and work-group sizes to use. The tile shape must be
+ *               one compiled into the library.
+ * \return Returns an SNNStatus containing the SYCL event tied to the kernel
+ *         launches and a StatusCode enum showing if the launch was OK or
+ *         whether it encountered some problem. If the configuration is not
+ *         available on the device then StatusCode::InvalidAlgorithm is
+ *         returned.
+ */
+template <typename T, bool TransposeLHS, bool TransposeRHS, typename Backend>
+SNNStatus launch(typename Backend::template pointer_type<T const> lhs,
+                 typename Backend::template pointer_type<T const> rhs,
+                 typename Backend::template pointer_type<T> output, int batches,
+                 int m, int k, int n, T beta, Backend& backend,
+                 TileConfig const& config) {
+  SNN_VALIDATE_PARAM(batches > 0, "The number of batches must be positive.");
+  SNN_VALIDATE_PARAM(m > 0, "The value of m must be positive.");
+  SNN_VALIDATE_PARAM(k > 0, "The value of k must be positive.");
+  SNN_VALIDATE_PARAM(n > 0, "The value of n must be positive.");
+
+  size_t lhs_size = batches * m * k;
+  size_t rhs_size = batches * k * n;
+  size_t out_size = batches * m * n;
+
+  auto lhs_acc = backend.get_mem_object(lhs, lhs_size);
+  auto rhs_acc = backend.get_mem_object(rhs, rhs_size);
+  auto out_acc = backend.get_mem_object(output, out_size);
+
+  auto sycl_queue = backend.get_queue();
+
+  size_t const workspace_size = query_workspace_size(config, batches, m, n);
+  if (workspace_size == 0) {
+    return internal::launch<T, TransposeLHS, TransposeRHS>(
+        lhs_acc, rhs_acc, out_acc, batches, m, k, n, beta, sycl_queue, config);
+  }
+  ::sycldnn::internal::helpers::AllocatedPointer<T, Backend> workspace{
+      sizeof(T) * workspace_size, backend};
+  auto workspace_acc =
+      backend.get_mem_object_internal(workspace.get(), workspace_size);
+  return internal::launch<T, TransposeLHS, TransposeRHS>(
+      lhs_acc, rhs_acc, out_acc, workspace_acc, batches, m, k, n, beta,
+      sycl_queue, config);
+}
+
 /**
  * Launch a batched matrix multiplication.
  *
@@ -36,6 +191,11 @@ namespace matmul {
  * where i ranges over the number of batches and op(X) is either X or X^T if
  * TransposeX is true.
  *
+ * Multiplies with a small output and a long accumulation dimension split the
+ * accumulation dimension, and hold the partial products in a temporary buffer
+ * allocated through the backend. Use the launcher taking a workspace to avoid
+ * this allocation.
+ *
  * \param lhs A pointer to the memory representing the left hand matrix.
  * \param rhs A pointer to the memory representing the right hand matrix.
  * \param output A pointer to the memory representing the output tensor.
@@ -60,23 +220,71 @@ SNNStatus launch(typename Backend::template pointer_type<T const> lhs,
                  typename Backend::template pointer_type<T const> rhs,
                  typename Backend::template pointer_type<T> output, int batches,
                  int m, int k, int n, T beta, Backend& backend) {
-  SNN_VALIDATE_PARAM(batches > 0, "The number of batches must be positive.");
-  SNN_VALIDATE_PARAM(m > 0, "The value of m must be positive.");
-  SNN_VALIDATE_PARAM(k > 0, "The value of k must be positive.");
-  SNN_VALIDATE_PARAM(n > 0, "The value of n must be positive.");
-
-  size_t lhs_size = batches * m * k;
-  size_t rhs_size = batches * k * n;
-  size_t out_size = batches * m * n;
-
-  auto lhs_acc = backend.get_mem_object(lhs, lhs_size);
-  auto rhs_acc = backend.get_mem_object(rhs, rhs_size);
-  auto out_acc = backend.get_mem_object(output, out_size);
+  auto sycl_queue = backend.get_queue();
+  auto config = internal::get_default_config<T>(sycl_queue, batches, m, k, n);
+  return launch<T, TransposeLHS, TransposeRHS>(lhs, rhs, output, batches, m, k,
+                                               n, beta, backend, config);
+}
 
+/**
+ * Launch a batched matrix multiplication using a user provided workspace.
+ *
+ * The parameters are the same as for the launcher without a workspace.
+ *
+ * \param workspace A pointer to the memory used to hold the partial products
+ *                  when the accumulation dimension is split.
+ * \param workspace_size The number of elements available in the workspace.
+ *                       Must be at least the size given by
+ *                       \ref sycldnn::matmul::query_workspace_size.
+ * \return Returns an SNNStatus containing the SYCL event tied to the kernel
+ *         launches and a StatusCode enum showing if the launch was OK or
+ *         whether it encountered some problem. If the workspace is too small
+ *         then StatusCode::InsufficientWorkspace is returned.
+ */
+template <typename T, bool TransposeLHS, bool TransposeRHS, typename Backend>
+SNNStatus launch(typename Backend::template pointer_type<T const> lhs,
+                 typename Backend::template pointer_type<T const> rhs,
+                 typename Backend::template pointer_type<T> output,
+                 typename Backend::template pointer_type<T> workspace,
+                 int batches, int m, int k, int n, T beta,
+                 size_t workspace_size, Backend& backend) {
   auto sycl_queue = backend.get_queue();
+  auto config = internal::get_default_config<T>(sycl_queue, batches, m, k, n);
+  return launch<T, TransposeLHS, TransposeRHS>(lhs, rhs, output, workspace,
+                                               batches, m, k, n, beta,
+                                               workspace_size, backend, config);
+}
 
-  return internal::launch<T, TransposeLHS, TransposeRHS>(
-      lhs_acc, rhs_acc, out_acc, batches, m, k, n, beta, sycl_queue);
+/**
+ * Launch a batched matrix multiplication, using the tile configuration stored
+ * in a lookup table for this shape of multiply on the backend's device.
+ *
+ * If the table has no entry for the multiply then the default configuration
+ * is used, as in the launcher without a table.
+ *
+ * \param table A table of tuned tile configurations, as created by
+ *              \ref sycldnn::matmul::tune.
+ * \return Returns an SNNStatus containing the SYCL event tied to the kernel
+ *         launches and a StatusCode enum showing if the launch was OK or
+ *         whether it encountered some problem.
+ */
+template <typename T, bool TransposeLHS, bool TransposeRHS, typename Backend>
+SNNStatus launch(typename Backend::template pointer_type<T const> lhs,
+                 typename Backend::template pointer_type<T const> rhs,
+                 typename Backend::template pointer_type<T> output, int batches,
+                 int m, int k, int n, T beta, Backend& backend,
+                 TileTable const& table) {
+  auto device_id = get_device_id(backend.get_queue().get_device());
+  auto key = make_tile_table_key(
+      device_id, ::sycldnn::internal::helpers::TypeName<T>::value,
+      TransposeLHS, TransposeRHS, batches, m, k, n);
+  TileConfig config;
+  if (table.lookup(key, config)) {
+    return launch<T, TransposeLHS, TransposeRHS>(
+        lhs, rhs, output, batches, m, k, n, beta, backend, config);
+  }
+  return launch<T, TransposeLHS, TransposeRHS>(lhs, rhs, output, batches, m, k,
+                                               n, beta, backend);
 }
 }  // namespace matmul
 }  // namespace sycldnn
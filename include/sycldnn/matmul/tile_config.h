@@ -0,0 +1,127 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef SYCLDNN_INCLUDE_MATMUL_TILE_CONFIG_H_
+#define SYCLDNN_INCLUDE_MATMUL_TILE_CONFIG_H_
+
+/**
+ * \file
+ * Contains the \ref sycldnn::matmul::TileConfig struct, which describes the
+ * tile sizes and work-group sizes used by a matrix multiply kernel, along with
+ * helpers to list the configurations compiled into the library.
+ */
+#include <string>
+#include <vector>
+
+#include "sycldnn/export.h"
+
+namespace sycldnn {
+namespace matmul {
+
+/**
+ * The tiling used to compute a matrix multiply.
+ *
+ * Each work-item computes a row_tile x col_tile block of the output, loading
+ * acc_tile values along the accumulation dimension at a time. Only the tile
+ * shapes listed by \ref sycldnn::matmul::get_compiled_tile_shapes are
+ * available, while the work-group sizes can be any values supported by the
+ * device.
+ *
+ * If local_memory is true then the work-group shares panels of the input
+ * matrices in local memory. This kernel is only compiled with 4x4x4 tiles and
+ * 8x8 work-groups, so the work-group sizes must match that.
+ *
+ * If k_splits is greater than one then the accumulation dimension is split
+ * into that many chunks, each computed by separate work-items into a temporary
+ * buffer, and the partial results are summed in a second kernel. This
+ * increases the parallelism available for multiplies with a small output and
+ * a long accumulation dimension. The split kernels are only compiled with
+ * 4x4x4 tiles, and do not split the batch dimension across work-groups.
+ */
+struct TileConfig {
+  /** The number of output rows computed by each work-item. */
+  int row_tile = 4;
+  /** The number of accumulator values loaded at a time by each work-item. */
+  int acc_tile = 4;
+  /** The number of output columns computed by each work-item. */
+  int col_tile = 4;
+  /** The number of work-items along the output rows in a work-group. */
+  int wg_rows = 8;
+  /** The number of work-items along the output columns in a work-group. */
+  int wg_cols = 4;
+  /** The number of work-items along the batch dimension in a work-group. */
+  int wg_batch = 1;
+  /** Whether to use the local memory kernel. */
+  bool local_memory = false;
+  /** The number of chunks to split the accumulation dimension into. */
+  int k_splits = 1;
+};
+
+/**
+ * Compare two tile configurations.
+ * \return Returns true if all fields of the two configurations match.
+ */
+inline bool operator==(TileConfig const& lhs, TileConfig const& rhs) {
+  return lhs.row_tile == rhs.row_tile && lhs.acc_tile == rhs.acc_tile &&
+         lhs.col_tile == rhs.col_tile && lhs.wg_rows == rhs.wg_rows &&
+         lhs.wg_cols == rhs.wg_cols && lhs.wg_batch == rhs.wg_batch &&
+         lhs.local_memory == rhs.local_memory && lhs.k_splits == rhs.k_splits;
+}
+
+/** \copydoc operator==(TileConfig const&, TileConfig const&) */
+inline bool operator!=(TileConfig const& lhs, TileConfig const& rhs) {
+  return !(lhs == rhs);
+}
+
+/**
+ * Get a string representation of a tile configuration, in the form
+ * "row_tile,acc_tile,col_tile,wg_rows,wg_cols,wg_batch,local_memory,k_splits".
+ * \param config The tile configuration.
+ * \return Returns the string representation of the configuration.
+ */
+SNN_EXPORT std::string to_string(TileConfig const& config);
+
+/**
+ * Parse a tile configuration from its string representation, as given by
+ * \ref sycldnn::matmul::to_string(TileConfig const&).
+ * \param [in]  str    The string to parse.
+ * \param [out] config The parsed configuration.
+ * \return Returns true if the string was successfully parsed.
+ */
+SNN_EXPORT bool tile_config_from_string(std::string const& str,
+                                        TileConfig& config);
+
+/**
+ * Get whether the kernel for a tile configuration is compiled into the
+ * library. This does not check whether the device supports the work-group
+ * size or local memory required by the configuration.
+ * \param config The tile configuration.
+ * \return Returns true if the configuration can be launched.
+ */
+SNN_EXPORT bool is_compiled(TileConfig const& config);
+
+/**
+ * Get a list of tile configurations to compare when tuning a matrix multiply.
+ *
+ * This contains every compiled tile shape combined with a range of work-group
+ * shapes, including long thin work-groups for matrix-vector products, along
+ * with the local memory kernel and a range of accumulation splits.
+ * \return Returns the list of candidate configurations.
+ */
+SNN_EXPORT std::vector<TileConfig> get_tile_candidates();
+
+}  // namespace matmul
+}  // namespace sycldnn
+#endif  // SYCLDNN_INCLUDE_MATMUL_TILE_CONFIG_H_
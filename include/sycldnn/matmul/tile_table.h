@@ -0,0 +1,122 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef SYCLDNN_INCLUDE_MATMUL_TILE_TABLE_H_
+#define SYCLDNN_INCLUDE_MATMUL_TILE_TABLE_H_
+
+/**
+ * \file
+ * Contains the declaration of the \ref sycldnn::matmul::TileTable class,
+ * which stores the tile configurations chosen for matrix multiplies of
+ * different shapes and persists them to a file on disk.
+ */
+#include "sycldnn/matmul/tile_config.h"
+
+#include <string>
+#include <unordered_map>
+
+#include <CL/sycl.hpp>
+
+#include "sycldnn/export.h"
+
+namespace sycldnn {
+namespace matmul {
+
+/**
+ * Get a string identifying a device and its driver version, used in tile
+ * table keys.
+ * \param device The SYCL device.
+ * \return Returns a string containing the device name and driver version.
+ */
+SNN_EXPORT std::string get_device_id(cl::sycl::device const& device);
+
+/**
+ * Construct a key identifying the bucket of matrix multiply shapes which a
+ * multiply belongs to on a given device.
+ *
+ * Each of batches, m, k and n is rounded up to the next power of two, so that
+ * a single tuned configuration is used for all multiplies of a similar shape.
+ *
+ * \param device_id     A string identifying the device and driver.
+ * \param data_type     A string identifying the data type of the matrices.
+ * \param transpose_lhs Whether the LHS matrix is transposed.
+ * \param transpose_rhs Whether the RHS matrix is transposed.
+ * \param batches       The number of matrices in each tensor.
+ * \param m             The number of rows in the output.
+ * \param k             The accumulation dimension.
+ * \param n             The number of columns in the output.
+ * \return Returns a string which can be used as a key in a TileTable.
+ */
+SNN_EXPORT std::string make_tile_table_key(std::string const& device_id,
+                                           std::string const& data_type,
+                                           bool transpose_lhs,
+                                           bool transpose_rhs, int batches,
+                                           int m, int k, int n);
+
+/**
+ * Lookup table of matrix multiply tile configurations, backed by a file on
+ * disk.
+ *
+ * Each line of the file contains a key, as given by
+ * \ref sycldnn::matmul::make_tile_table_key, followed by a tab and the tile
+ * configuration to use. New entries are appended to the file as they are
+ * added, with later entries taking precedence when the file is loaded.
+ */
+class SNN_EXPORT TileTable {
+ public:
+  /**
+   * Construct a table backed by the given file. Any existing entries in the
+   * file are loaded. If the filename is empty then the table is only held in
+   * memory.
+   * \param filename The path to the table file.
+   */
+  explicit TileTable(std::string filename = "");
+
+  /**
+   * Look up the configuration stored for a key.
+   * \param [in]  key    The key to search for.
+   * \param [out] config Set to the stored configuration if one is found.
+   * \return Returns true if there is an entry for the key.
+   */
+  bool lookup(std::string const& key, TileConfig& config) const;
+
+  /**
+   * Add an entry to the table, and write it to the table file.
+   * \param key    The key to store the configuration under.
+   * \param config The configuration to store.
+   * \return Returns true if the entry was successfully written to the file.
+   */
+  bool insert(std::string const& key, TileConfig const& config);
+
+  /**
+   * Get the number of entries in the table.
+   * \return The number of entries in the table.
+   */
+  size_t size() const { return entries_.size(); }
+
+ private:
+  /** Load all entries in the table file into memory. */
+  void load();
+
+  /** Path to the table file. */
+  std::string filename_;
+
+  /** In-memory copy of the table entries. */
+  std::unordered_map<std::string, TileConfig> entries_;
+};
+
+}  // namespace matmul
+}  // namespace sycldnn
+#endif  // SYCLDNN_INCLUDE_MATMUL_TILE_TABLE_H_
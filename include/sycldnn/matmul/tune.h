@@ -0,0 +1,178 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef SYCLDNN_INCLUDE_MATMUL_TUNE_H_
+#define SYCLDNN_INCLUDE_MATMUL_TUNE_H_
+
+/**
+ * \file
+ * Contains the \ref sycldnn::matmul::tune() function, which times a set of
+ * matrix multiply tile configurations on the target device and stores the
+ * fastest in a \ref sycldnn::matmul::TileTable.
+ */
+#include "sycldnn/status.h"
+
+#include "sycldnn/backend/internal_backend.h"
+
+#include "sycldnn/internal/helpers/allocated_pointer.h"
+#include "sycldnn/internal/helpers/type_name.h"
+
+#include "sycldnn/matmul/launch.h"
+#include "sycldnn/matmul/tile_config.h"
+#include "sycldnn/matmul/tile_table.h"
+
+#include <algorithm>
+#include <chrono>
+#include <limits>
+#include <utility>
+#include <vector>
+
+#include <CL/sycl.hpp>
+
+namespace sycldnn {
+namespace matmul {
+
+/**
+ * Find the fastest tile configuration for a matrix multiply on the backend's
+ * device, and store it in a tile table.
+ *
+ * Each candidate configuration is launched once to exclude any kernel
+ * compilation from the timings, then timed over a number of runs, with the
+ * fastest run used to compare the configurations. Any configuration which is
+ * not compiled, is not supported by the device or fails to launch is skipped.
+ *
+ * The table entry covers all multiplies in the same bucket of shapes as the
+ * given sizes, as described in \ref sycldnn::matmul::make_tile_table_key, so
+ * subsequent calls to \ref sycldnn::matmul::launch with the table will use the
+ * tuned configuration for any similar multiply.
+ *
+ * \param [in]     batches    The number of matrices in each tensor.
+ * \param [in]     m          The number of rows in the output.
+ * \param [in]     k          The accumulation dimension.
+ * \param [in]     n          The number of columns in the output.
+ * \param [in]     backend    The backend to use to run the timed multiplies.
+ * \param [in,out] table      The table to store the fastest configuration in.
+ * \param [out]    best       Set to the fastest configuration, if any
+ *                            configuration could be timed.
+ * \param [in]     candidates The configurations to compare.
+ * \param [in]     n_reps     The number of timed runs of each configuration.
+ * \return Returns true if any configuration could be timed, in which case the
+ *         fastest has been added to the table.
+ */
+template <typename T, bool TransposeLHS, bool TransposeRHS, typename Backend>
+bool tune(int batches, int m, int k, int n, Backend& backend, TileTable& table,
+          TileConfig& best,
+          std::vector<TileConfig> const& candidates = get_tile_candidates(),
+          int n_reps = 3) {
+  using InternalBackend = backend::internal::InternalBackend<Backend>;
+  using Pointer = typename InternalBackend::template pointer_type<T>;
+  using ConstPointer = typename InternalBackend::template pointer_type<T const>;
+  using Allocation = sycldnn::internal::helpers::AllocatedPointer<T, Backend>;
+
+  if (batches <= 0 || m <= 0 || k <= 0 || n <= 0) {
+    return false;
+  }
+  n_reps = std::max(n_reps, 1);
+  size_t const lhs_size = batches * m * k;
+  size_t const rhs_size = batches * k * n;
+  size_t const out_size = batches * m * n;
+  Allocation lhs{sizeof(T) * lhs_size, backend};
+  Allocation rhs{sizeof(T) * rhs_size, backend};
+  Allocation output{sizeof(T) * out_size, backend};
+  auto queue = backend.get_queue();
+  for (auto const& alloc : {std::make_pair(lhs.get(), lhs_size),
+                            std::make_pair(rhs.get(), rhs_size),
+                            std::make_pair(output.get(), out_size)}) {
+    auto mem = backend.get_mem_object_internal(alloc.first, alloc.second);
+    queue
+        .submit([&](cl::sycl::handler& cgh) {
+          auto acc = mem.write_accessor(cgh);
+          cgh.fill(acc.get_accessor(), T{0});
+        })
+        .wait_and_throw();
+  }
+
+  // A single workspace large enough for every candidate is allocated up
+  // front, so that split-K configurations are not timed with an allocation
+  // in each run. It holds at least one element, as a SYCL buffer cannot be
+  // empty.
+  size_t workspace_size = 1;
+  for (auto const& config : candidates) {
+    if (is_compiled(config)) {
+      workspace_size = std::max(workspace_size,
+                                query_workspace_size(config, batches, m, n));
+    }
+  }
+  Allocation workspace{sizeof(T) * workspace_size, backend};
+
+  InternalBackend internal_backend{backend};
+  auto time_config = [&](TileConfig const& config) {
+    auto const failed = std::numeric_limits<double>::max();
+    auto run = [&]() {
+      return launch<T, TransposeLHS, TransposeRHS>(
+          ConstPointer{lhs.get()}, ConstPointer{rhs.get()},
+          Pointer{output.get()}, Pointer{workspace.get()}, batches, m, k, n,
+          T{0}, workspace_size, internal_backend, config);
+    };
+    try {
+      auto status = run();
+      if (status.status != StatusCode::OK) {
+        return failed;
+      }
+      status.event.wait_and_throw();
+
+      double fastest = failed;
+      for (int i = 0; i < n_reps; ++i) {
+        auto start = std::chrono::high_resolution_clock::now();
+        status = run();
+        status.event.wait_and_throw();
+        auto end = std::chrono::high_resolution_clock::now();
+        fastest = std::min(
+            fastest, std::chrono::duration<double>(end - start).count());
+      }
+      return fastest;
+    } catch (cl::sycl::exception const&) {
+      return failed;
+    } catch (std::exception const&) {
+      return failed;
+    }
+  };
+
+  bool found = false;
+  double fastest_time = std::numeric_limits<double>::max();
+  for (auto const& config : candidates) {
+    if (!is_compiled(config)) {
+      continue;
+    }
+    double time = time_config(config);
+    if (time < fastest_time) {
+      fastest_time = time;
+      best = config;
+      found = true;
+    }
+  }
+  if (found) {
+    auto device_id = get_device_id(queue.get_device());
+    auto key = make_tile_table_key(
+        device_id, ::sycldnn::internal::helpers::TypeName<T>::value,
+        TransposeLHS, TransposeRHS, batches, m, k, n);
+    table.insert(key, best);
+  }
+  return found;
+}
+
+}  // namespace matmul
+}  // namespace sycldnn
+#endif  // SYCLDNN_INCLUDE_MATMUL_TUNE_H_
@@ -0,0 +1,159 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef SYCLDNN_INCLUDE_NORMALIZATION_LAUNCH_H_
+#define SYCLDNN_INCLUDE_NORMALIZATION_LAUNCH_H_
+
+/**
+ * \file
+ * Implements the \ref sycldnn::normalization::launch() function, which
+ * asynchronously dispatches the SYCL kernels to compute a layer, group or
+ * instance normalization, or its gradient.
+ */
+#include "sycldnn/status.h"
+
+#include "sycldnn/normalization/direction.h"
+#include "sycldnn/normalization/params.h"
+
+#include "sycldnn/internal/normalization/launch_internal.h"
+
+#include "sycldnn/helpers/macros.h"
+
+namespace sycldnn {
+/** Namespace containing the layer, group and instance normalization operators.
+ */
+namespace normalization {
+/** Namespace containing internal implementation details for normalization. */
+namespace internal {
+
+/**
+ * Validate that the user-provided normalization parameters are consistent
+ * with what is expected by SYCL-DNN.
+ *
+ * If compiled with asserts, any invalid parameter will fail with an assert.
+ * Otherwise a status code \ref StatusCode::InvalidParameter will be returned.
+ *
+ * \param params  Normalization parameters to validate.
+ * \return        A SNNStatus object containing either \ref StatusCode::OK if
+ * all parameters are valid, or \ref StatusCode::InvalidParameter otherwise.
+ */
+SNNStatus inline validate_params(NormalizationParams const& params) {
+  SNN_VALIDATE_PARAM(params.batch > 0, "The batch size must be positive.");
+  SNN_VALIDATE_PARAM(params.rows > 0,
+                     "The number of input/output rows must be positive.");
+  SNN_VALIDATE_PARAM(params.cols > 0,
+                     "The number of input/output columns must be positive.");
+  SNN_VALIDATE_PARAM(params.channels > 0,
+                     "The number of channels must be positive.");
+  if (params.type == NormType::Group) {
+    SNN_VALIDATE_PARAM(params.groups > 0,
+                       "The number of groups must be positive.");
+    SNN_VALIDATE_PARAM(params.channels % params.groups == 0,
+                       "The number of channels must be divisible by the "
+                       "number of groups.");
+  }
+  SNN_VALIDATE_PARAM(params.epsilon > 0.f, "The epsilon must be positive.");
+  SNN_VALIDATE_PARAM(params.input_format == sycldnn::DataFormat::NHWC ||
+                         params.input_format == sycldnn::DataFormat::NCHW,
+                     "Unsupported layout");
+  return StatusCode::OK;
+}
+
+}  // namespace internal
+
+/**
+ * Launch a layer, group or instance normalization in the Forward direction.
+ *
+ * Each group of values given by params.type is normalized to zero mean and
+ * unit variance, then scaled by gamma and shifted by beta, which both hold a
+ * value for each channel.
+ *
+ * \tparam T           The data type of the input tensor.
+ * \tparam Direction   The direction of processing, Forward.
+ * \tparam Backend     The type of backend.
+ * \param input        A pointer to the memory representing the input tensor.
+ * \param beta         A pointer to the memory representing the beta tensor.
+ * \param gamma        A pointer to the memory representing the gamma tensor.
+ * \param output       A pointer to the memory representing the output tensor.
+ * \param params       The normalization parameters, which describe the tensor
+ *                     shape and layout.
+ * \param backend      The backend implementation, used to map between pointer
+ *                     representations.
+ * \return Returns a SNNStatus containing the SYCL event tied to the kernel
+ *         launches and a StatusCode enum showing if the launch was OK or
+ *         whether it encountered some problem.
+ */
+template <typename T, typename Direction, typename Backend,
+          typename = internal::DisableIfGradient<Direction>>
+SNNStatus launch(typename Backend::template pointer_type<T const> input,
+                 typename Backend::template pointer_type<T const> beta,
+                 typename Backend::template pointer_type<T const> gamma,
+                 typename Backend::template pointer_type<T> output,
+                 NormalizationParams const& params, Backend& backend) {
+  auto validation_status = internal::validate_params(params);
+  if (validation_status.status != StatusCode::OK) {
+    return validation_status;
+  }
+
+  return internal::launch<T, Direction>(input, beta, gamma, output, params,
+                                        backend);
+}
+
+/**
+ * Launch a layer, group or instance normalization in the Gradient (Backward)
+ * direction, computing the gradients with respect to the input, beta and
+ * gamma.
+ *
+ * \tparam T           The data type of the input tensor.
+ * \tparam Direction   The direction of processing, Gradient.
+ * \tparam Backend     The type of backend.
+ * \param input        A pointer to the memory representing the input to the
+ *                     forward normalization.
+ * \param gradient     A pointer to the memory representing the gradient with
+ *                     respect to the normalization output.
+ * \param gamma        A pointer to the memory representing the gamma tensor.
+ * \param beta_grad    A pointer to the memory for the beta gradient.
+ * \param gamma_grad   A pointer to the memory for the gamma gradient.
+ * \param output       A pointer to the memory for the input gradient.
+ * \param params       The normalization parameters, which describe the tensor
+ *                     shape and layout.
+ * \param backend      The backend implementation, used to map between pointer
+ *                     representations.
+ * \return Returns a SNNStatus containing the SYCL event tied to the kernel
+ *         launches and a StatusCode enum showing if the launch was OK or
+ *         whether it encountered some problem.
+ */
+template <typename T, typename Direction, typename Backend,
+          typename = internal::EnableIfGradient<Direction>>
+SNNStatus launch(typename Backend::template pointer_type<T const> input,
+                 typename Backend::template pointer_type<T const> gradient,
+                 typename Backend::template pointer_type<T const> gamma,
+                 typename Backend::template pointer_type<T> beta_grad,
+                 typename Backend::template pointer_type<T> gamma_grad,
+                 typename Backend::template pointer_type<T> output,
+                 NormalizationParams const& params, Backend& backend) {
+  auto validation_status = internal::validate_params(params);
+  if (validation_status.status != StatusCode::OK) {
+    return validation_status;
+  }
+
+  return internal::launch<T, Direction>(input, gradient, gamma, beta_grad,
+                                        gamma_grad, output, params, backend);
+}
+
+}  // namespace normalization
+}  // namespace sycldnn
+
+#endif  // SYCLDNN_INCLUDE_NORMALIZATION_LAUNCH_H_
@@ -0,0 +1,109 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef SYCLDNN_INCLUDE_NORMALIZATION_PARAMS_H_
+#define SYCLDNN_INCLUDE_NORMALIZATION_PARAMS_H_
+
+#include "sycldnn/data_format.h"
+
+/**
+ * \file
+ * Contains the declaration of the
+ * \ref sycldnn::normalization::NormalizationParams structure, which represents
+ * the tensor shapes for a layer, group or instance normalization operation.
+ */
+namespace sycldnn {
+namespace normalization {
+
+/** The set of values each normalization computes its statistics over. */
+enum class NormType {
+  /** Normalize over all the rows, columns and channels of each tensor. */
+  Layer,
+  /**
+   * Normalize over the rows and columns of each of NormalizationParams::groups
+   * contiguous sets of channels in each tensor.
+   */
+  Group,
+  /** Normalize over the rows and columns of each channel of each tensor. */
+  Instance,
+};
+
+/**
+ * Parameter struct containing the parameters required for a layer, group or
+ * instance normalization operation.
+ *
+ * A transformer layer normalization over the hidden dimension of a
+ * [batch, sequence, hidden] tensor is a layer normalization with the batch set
+ * to batch * sequence, the rows and columns set to 1 and the channels set to
+ * the hidden size.
+ */
+struct NormalizationParams {
+  /** The underlying data type of all index parameters. */
+  using Index = int;
+
+  /** The number of input/output tensors per batch. */
+  Index batch;
+
+  /** The number of rows in each input/output tensor. */
+  Index rows;
+
+  /** The number of columns in each input/output tensor. */
+  Index cols;
+
+  /** The number of channels (or feature maps) in each input/output tensor. */
+  Index channels;
+
+  /** The set of values to compute the statistics over. */
+  NormType type = NormType::Layer;
+
+  /**
+   * The number of channel groups for group normalization, which must divide
+   * the number of channels. Ignored for layer and instance normalization.
+   */
+  Index groups = 1;
+
+  /**
+   * The epsilon parameter added to the variance to ensure divisibility by a
+   * non-zero value.
+   */
+  float epsilon = 1e-5f;
+
+  /** The data format used in the input and output tensors. */
+  sycldnn::DataFormat input_format = sycldnn::DataFormat::NHWC;
+};
+
+/**
+ * Get the number of channel groups each tensor is split into, each of which
+ * is normalized separately.
+ * \param params The normalization parameters.
+ * \return The number of groups of channels in each tensor.
+ */
+inline NormalizationParams::Index get_groups(
+    NormalizationParams const& params) {
+  switch (params.type) {
+    case NormType::Group:
+      return params.groups;
+    case NormType::Instance:
+      return params.channels;
+    case NormType::Layer:
+    default:
+      return 1;
+  }
+}
+
+}  // namespace normalization
+}  // namespace sycldnn
+
+#endif  // SYCLDNN_INCLUDE_NORMALIZATION_PARAMS_H_
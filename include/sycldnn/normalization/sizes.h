@@ -0,0 +1,57 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef SYCLDNN_INCLUDE_NORMALIZATION_SIZES_H_
+#define SYCLDNN_INCLUDE_NORMALIZATION_SIZES_H_
+
+/**
+ * \file
+ * Contains functionality for calculating the size of tensors from the
+ * normalization parameters, including the declaration of the
+ * \ref sycldnn::normalization::NormalizationSizes structure.
+ */
+#include "sycldnn/normalization/params.h"
+
+namespace sycldnn {
+namespace normalization {
+
+/** Tensor sizes for a given normalization operation. */
+struct NormalizationSizes {
+  /** The size of the input tensor in elements. */
+  int input_size;
+  /** The size of the beta and gamma tensors, and their gradients. */
+  int scale_size;
+  /** The size of the output tensor in elements. */
+  int output_size;
+};
+
+/**
+ * Compute the total sizes of the tensors used in a normalization operator for
+ * the specified parameters.
+ * \param params The normalization parameters containing the tensor sizes.
+ * \return Returns a \ref sycldnn::normalization::NormalizationSizes instance,
+ *         containing the sizes of the tensors in elements.
+ */
+inline NormalizationSizes get_sizes(NormalizationParams const& params) {
+  int input = params.batch * params.rows * params.cols * params.channels;
+
+  NormalizationSizes sizes{input, params.channels, input};
+  return sizes;
+}
+
+}  // namespace normalization
+}  // namespace sycldnn
+
+#endif  // SYCLDNN_INCLUDE_NORMALIZATION_SIZES_H_
@@ -80,12 +80,41 @@ SNNStatus inline validate_params(PoolingParams const& params) {
       "The padding in the column direction must be non-negative.");
   SNN_VALIDATE_PARAM(
       params.input_format == sycldnn::DataFormat::NHWC ||
+          is_channel_blocked(params.input_format) ||
           (params.input_format == sycldnn::DataFormat::NCHW &&
            std::is_same<Direction, Forward>::value),
-      "Currently SYCL-DNN pooling supports the NHWC and NCHW data formats.");
+      "Currently SYCL-DNN pooling supports the NHWC, NCHW and NCHWc data "
+      "formats.");
+  int const channel_block = get_channel_block(params.input_format);
+  SNN_VALIDATE_PARAM(params.channels % channel_block == 0,
+                     "The number of channels must be divisible by the channel "
+                     "block size.");
   return StatusCode::OK;
 }
 
+/**
+ * Get the parameters to pass to the pooling kernels.
+ *
+ * Pooling treats every channel independently, so a channel blocked NCHWc
+ * tensor can be pooled as an NHWC tensor where each channel block is a
+ * separate batch. This allows the NHWC kernels to be used, vectorized across
+ * the channels in each block.
+ *
+ * \param [in] params User provided parameters.
+ * \return The parameters describing the tensor layout used by the kernels.
+ */
+inline PoolingParams get_kernel_params(PoolingParams const& params) {
+  int const channel_block = get_channel_block(params.input_format);
+  if (channel_block == 1) {
+    return params;
+  }
+  PoolingParams kernel_params = params;
+  kernel_params.batch = params.batch * (params.channels / channel_block);
+  kernel_params.channels = channel_block;
+  kernel_params.input_format = sycldnn::DataFormat::NHWC;
+  return kernel_params;
+}
+
 }  // namespace internal
 
 /**
@@ -124,8 +153,8 @@ SNNStatus launch(typename Backend::template pointer_type<T const> input,
   auto outp_mem = backend.get_mem_object(output, sizes.output_size);
 
   auto queue = backend.get_queue();
-  return internal::launch_pooling<T, PoolType, Direction>(inp_mem, outp_mem, pp,
-                                                          queue);
+  return internal::launch_pooling<T, PoolType, Direction>(
+      inp_mem, outp_mem, internal::get_kernel_params(pp), queue);
 }
 
 /**
@@ -179,7 +208,7 @@ SNNStatus launch(
   auto queue = backend.get_queue();
   return internal::launch_pooling<T, PoolType, Direction>(
       inp_data_access, outp_data_access, inp_backprop_access,
-      outp_backprop_access, pp, queue);
+      outp_backprop_access, internal::get_kernel_params(pp), queue);
 }
 
 }  // namespace pooling
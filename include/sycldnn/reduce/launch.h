@@ -21,7 +21,12 @@
  * Implements the \ref sycldnn::reduce::launch() function, which asynchronously
  * dispatches the SYCL kernels required to perform reductions.
  */
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <numeric>
 #include <type_traits>
+#include <vector>
 
 #include "sycldnn/mem_object.h"
 #include "sycldnn/status.h"
@@ -70,6 +75,167 @@ SNNStatus launch(typename Backend::template pointer_type<T const> input,
 
   return internal::launch<Op>(in_acc, out_acc, batches, outer, inner, backend);
 }
+
+/**
+ * Launch a reduction applying Op over any set of axes of an N-D tensor. The
+ * output has the shape of the input with the reduced axes removed.
+ *
+ * Adjacent axes are coalesced and each contiguous group of reduced axes is
+ * reduced in place, so no transposes are needed. For example reducing axes
+ * {0, 2, 3} of an NCHW tensor gives the per-channel result directly.
+ *
+ * \tparam Op Operation to apply on the reduced axes
+ * \param input A pointer to the memory representing the input tensor.
+ * \param output A pointer to the memory representing the output tensor.
+ * \param dims The size of each dimension of the input tensor. Each size must
+ *             be positive.
+ * \param axes The zero indexed dimensions to reduce. Each axis must be
+ *             distinct. If empty the input is copied to the output.
+ * \param backend The backend implementation, used to map between pointer
+ *                representations.
+ * \return Returns an SNNStatus containing the SYCL event tied to the kernel
+ *         launches and a StatusCode enum showing if the launch was OK or
+ *         whether it encountered some problem.
+ * \retval StatusCode::InvalidParameter: An invalid parameter was passed in to
+ *         the launch function:
+ *         * There were no dimensions.
+ *         * The size of a dimension was not positive.
+ *         * An axis did not index a dimension or was repeated.
+ * \retval StatusCode::IndexExceeded: The tensor was too large to index.
+ * \retval StatusCode::OK: The kernel was launched successfully.
+ */
+template <typename T, typename Op, typename Backend>
+SNNStatus launch(typename Backend::template pointer_type<T const> input,
+                 typename Backend::template pointer_type<T> output,
+                 std::vector<int> const& dims, std::vector<int> const& axes,
+                 Backend& backend) {
+  static_assert(std::is_same<Op, reduce::Add>::value ||
+                    std::is_same<Op, reduce::Mean>::value ||
+                    std::is_same<Op, reduce::Max>::value ||
+                    std::is_same<Op, reduce::Min>::value,
+                "Invalid Reduction Type");
+  auto n_dims = dims.size();
+  SNN_VALIDATE_PARAM(n_dims > 0u, "The number of dimensions must be positive.");
+  for (int dim : dims) {
+    SNN_VALIDATE_PARAM(dim > 0, "Each dimension must be positive.");
+  }
+  std::vector<bool> not_seen(n_dims, true);
+  for (int axis : axes) {
+    SNN_VALIDATE_PARAM(axis >= 0 && static_cast<size_t>(axis) < n_dims,
+                       "Each axis must index a dimension.");
+    SNN_VALIDATE_PARAM(not_seen[axis], "Each axis must be distinct.");
+    not_seen[axis] = false;
+  }
+
+  size_t in_size = std::accumulate(begin(dims), end(dims),
+                                   static_cast<size_t>(1),
+                                   [](size_t a, int b) { return a * b; });
+  if (in_size > static_cast<size_t>(std::numeric_limits<int>::max())) {
+    return StatusCode::IndexExceeded;
+  }
+  size_t out_size = in_size;
+  for (int axis : axes) {
+    out_size /= dims[axis];
+  }
+
+  auto in_acc = backend.get_mem_object(input, in_size);
+  auto out_acc = backend.get_mem_object(output, out_size);
+
+  return internal::launch<Op>(in_acc, out_acc, dims, axes, backend);
+}
+
+/** The largest number of values which can be selected by a top-k launch. */
+constexpr int max_topk = 32;
+
+/**
+ * Launch a reduction of [batch, outer, inner] computing the index of the
+ * largest (ArgMax) or smallest (ArgMin) value in the outer dimension. The
+ * output shape is [batch, inner]. If the value occurs more than once the first
+ * index is used.
+ *
+ * \tparam Op Either ArgMax or ArgMin
+ * \param input A pointer to the memory representing the input tensor.
+ * \param output A pointer to the memory representing the output indices.
+ * \param batches The number of batches. Must be a positive value.
+ * \param outer Outer size. This is the dimension that is always reduced. Must
+ * be a positive value.
+ * \param inner Inner size. Must be a positive value.
+ * \param backend The backend implementation, used to map between pointer
+ *                representations.
+ * \return Returns an SNNStatus containing the SYCL event tied to the kernel
+ *         launches and a StatusCode enum showing if the launch was OK or
+ *         whether it encountered some problem.
+ */
+template <typename T, typename Op, typename Backend>
+SNNStatus launch_arg(typename Backend::template pointer_type<T const> input,
+                     typename Backend::template pointer_type<int32_t> output,
+                     int batches, int outer, int inner, Backend& backend) {
+  static_assert(std::is_same<Op, reduce::ArgMax>::value ||
+                    std::is_same<Op, reduce::ArgMin>::value,
+                "Invalid Arg Reduction Type");
+  SNN_VALIDATE_PARAM(batches > 0, "The number of batches must be positive.");
+  SNN_VALIDATE_PARAM(outer > 0, "The value of outer must be positive.");
+  SNN_VALIDATE_PARAM(inner > 0, "The value of inner must be positive.");
+
+  size_t in_size = batches * outer * inner;
+  size_t out_size = batches * inner;
+
+  auto in_acc = backend.get_mem_object(input, in_size);
+  auto out_acc = backend.get_mem_object(output, out_size);
+
+  auto queue = backend.get_queue();
+  return internal::launch_arg<T, Op>(in_acc, out_acc, batches, outer, inner,
+                                     queue);
+}
+
+/**
+ * Launch a top-k selection of [batch, outer, inner], computing the k largest
+ * values in the outer dimension along with their indices. The values and
+ * indices have shape [batch, k, inner] and are sorted from largest to
+ * smallest. Equal values are ordered by index.
+ *
+ * \param input A pointer to the memory representing the input tensor.
+ * \param values A pointer to the memory representing the output values.
+ * \param indices A pointer to the memory representing the output indices.
+ * \param batches The number of batches. Must be a positive value.
+ * \param outer Outer size. This is the dimension that values are selected
+ * from. Must be a positive value.
+ * \param inner Inner size. Must be a positive value.
+ * \param k The number of values to select. Must be positive, at most outer
+ * and at most \ref max_topk.
+ * \param backend The backend implementation, used to map between pointer
+ *                representations.
+ * \return Returns an SNNStatus containing the SYCL event tied to the kernel
+ *         launches and a StatusCode enum showing if the launch was OK or
+ *         whether it encountered some problem.
+ * \retval StatusCode::InvalidAlgorithm: The device does not have enough local
+ *         memory to compute the selection.
+ */
+template <typename T, typename Backend>
+SNNStatus launch_topk(typename Backend::template pointer_type<T const> input,
+                      typename Backend::template pointer_type<T> values,
+                      typename Backend::template pointer_type<int32_t> indices,
+                      int batches, int outer, int inner, int k,
+                      Backend& backend) {
+  SNN_VALIDATE_PARAM(batches > 0, "The number of batches must be positive.");
+  SNN_VALIDATE_PARAM(outer > 0, "The value of outer must be positive.");
+  SNN_VALIDATE_PARAM(inner > 0, "The value of inner must be positive.");
+  SNN_VALIDATE_PARAM(k > 0, "The value of k must be positive.");
+  SNN_VALIDATE_PARAM(k <= outer, "The value of k must be at most outer.");
+  SNN_VALIDATE_PARAM(k <= max_topk, "The value of k must be at most 32.");
+
+  size_t in_size = batches * outer * inner;
+  size_t out_size = batches * k * inner;
+
+  auto in_acc = backend.get_mem_object(input, in_size);
+  auto values_acc = backend.get_mem_object(values, out_size);
+  auto indices_acc = backend.get_mem_object(indices, out_size);
+
+  auto queue = backend.get_queue();
+  return internal::launch_topk<T>(in_acc, values_acc, indices_acc, batches,
+                                  outer, inner, k, queue);
+}
+
 }  // namespace reduce
 }  // namespace sycldnn
 #endif  // SYCLDNN_INCLUDE_REDUCE_LAUNCH_H_
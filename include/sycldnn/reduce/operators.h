@@ -19,7 +19,8 @@
 
 /**
  * \file
- * Contains the declarations of the Add, Mean tag types.
+ * Contains the declarations of the Add, Mean, Max, Min, ArgMax and ArgMin tag
+ * types.
  */
 
 namespace sycldnn {
@@ -33,6 +34,12 @@ struct Max;
 
 struct Min;
 
+/** Compute the index of the largest value in the reduced dimension. */
+struct ArgMax;
+
+/** Compute the index of the smallest value in the reduced dimension. */
+struct ArgMin;
+
 }  // namespace reduce
 }  // namespace sycldnn
 
@@ -19,7 +19,8 @@
 
 /**
  * \file
- * Contains the declarations of the Forward and Gradient tag types.
+ * Contains the declarations of the Forward, Gradient, LogForward and
+ * LogGradient tag types.
  */
 
 namespace sycldnn {
@@ -29,6 +30,10 @@ struct Forward;
 
 struct Gradient;
 
+struct LogForward;
+
+struct LogGradient;
+
 }  // namespace softmax
 }  // namespace sycldnn
 
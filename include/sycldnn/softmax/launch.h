@@ -49,6 +49,15 @@ namespace internal {
  * all parameters are valid, or \ref StatusCode::InvalidParameter otherwise.
  */
 SNNStatus inline validate_params(SoftmaxParams const& params) {
+  if (!params.dims.empty()) {
+    int const n_dims = static_cast<int>(params.dims.size());
+    SNN_VALIDATE_PARAM(params.axis >= -n_dims && params.axis < n_dims,
+                       "The softmax axis must be a valid dimension index.");
+    for (int dim : params.dims) {
+      SNN_VALIDATE_PARAM(dim > 0, "All tensor dimensions must be positive.");
+    }
+    return StatusCode::OK;
+  }
   SNN_VALIDATE_PARAM(params.batch > 0, "The batch size must be positive.");
   SNN_VALIDATE_PARAM(params.channels > 0,
                      "The number of channels/classes must be positive.");
@@ -56,14 +65,17 @@ SNNStatus inline validate_params(SoftmaxParams const& params) {
                      "The number of input/output rows must be positive.");
   SNN_VALIDATE_PARAM(params.cols > 0,
                      "The number of input/output columns must be positive.");
+  SNN_VALIDATE_PARAM(params.input_format == sycldnn::DataFormat::NHWC ||
+                         params.input_format == sycldnn::DataFormat::NCHW,
+                     "Unsupported layout");
   return StatusCode::OK;
 }
 
 }  // namespace internal
 
 /**
- * Launch the softmax operation kernel in either Forward or Gradient (Backward)
- * direction.
+ * Launch the softmax operation kernel in the Forward direction, or the
+ * log-softmax operation kernel in the LogForward direction.
  * Softmax is applied along the channel dimension of a 4D tensor - for 2D
  * matrices with shape (batch x channels), the height and width dimensions can
  * be set to 1.
@@ -73,11 +85,16 @@ SNNStatus inline validate_params(SoftmaxParams const& params) {
  * performing softmax on (i.e. batch' = batch x height x width), yielding a 2D
  * matrix as above with dimensions (batch' x channels).
  *
+ * If params.dims is set then the softmax is instead applied along the given
+ * axis of an N-D tensor, which need not be the innermost axis.
+ *
  * \tparam T           The data type of the input tensor.
- * \tparam Direction   The direction of processing, either Forward or Gradient.
+ * \tparam Direction   The direction of processing, either Forward or
+ *                     LogForward.
  * \tparam Backend     The type of backend.
  * \param input        A pointer to the memory representing the input tensor.
  * \param workspace    A pointer to the memory representing the workspace.
+ *                     The forward pass does not use the workspace.
  * \param output       A pointer to the memory representing the output tensor.
  * \param params       The softmax parameters, which describe the tensor shape
  *                     and layout.
@@ -103,14 +120,16 @@ SNNStatus launch(typename Backend::template pointer_type<T const> input,
 }
 
 /**
- * Launch the softmax operation kernel in either Gradient (Backward)
- * direction.
+ * Launch the softmax operation kernel in the Gradient (Backward) direction, or
+ * the log-softmax operation kernel in the LogGradient direction.
  * \tparam T           The data type of the input tensor.
- * \tparam Direction   The direction of processing, either Forward or Gradient.
+ * \tparam Direction   The direction of processing, either Gradient or
+ *                     LogGradient.
  * \tparam Backend     The type of backend.
  * \param input        A pointer to the memory representing the input tensor.
  * \param gradient     A pointer to the memory representing the gradient tensor.
  * \param workspace    A pointer to the memory representing the workspace.
+ *                     The gradient pass does not use the workspace.
  * \param output       A pointer to the memory representing the output tensor.
  * \param params       The softmax parameters, which describe the tensor shape
  *                     and layout.
@@ -18,6 +18,8 @@
 
 #include "sycldnn/data_format.h"
 
+#include <vector>
+
 /**
  * \file
  * Contains the declaration of the \ref sycldnn::softmax::SoftmaxParams
@@ -49,6 +51,20 @@ struct SoftmaxParams {
 
   /** The data format used in the input and output tensors. */
   sycldnn::DataFormat input_format = sycldnn::DataFormat::NHWC;
+
+  /**
+   * The dimensions of an N-D input/output tensor, with the last dimension
+   * contiguous in memory. If this is non-empty then the softmax is computed
+   * along dims[axis], and the channels, batch, rows, cols and input_format
+   * parameters are ignored.
+   */
+  std::vector<Index> dims;
+
+  /**
+   * The axis of dims to compute the softmax along. Negative values count back
+   * from the last axis, so the default of -1 is the innermost axis.
+   */
+  Index axis = -1;
 };
 
 }  // namespace softmax
@@ -45,6 +45,19 @@ struct SoftmaxSizes {
  *         the sizes of the tensors in elements.
  */
 inline SoftmaxSizes get_sizes(SoftmaxParams const& params) {
+  if (!params.dims.empty()) {
+    int input = 1;
+    for (int dim : params.dims) {
+      input *= dim;
+    }
+    int const n_dims = static_cast<int>(params.dims.size());
+    int const axis = params.axis < 0 ? params.axis + n_dims : params.axis;
+    int workspace = input / params.dims[axis];
+
+    SoftmaxSizes sizes{input, workspace, input};
+    return sizes;
+  }
+
   int input = params.batch * params.rows * params.cols * params.channels;
 
   int workspace = params.batch * params.rows * params.cols;
@@ -22,12 +22,14 @@
  * asynchronously dispatches a SYCL kernel to transpose an N-Dimensional
  * tensor.
  */
+#include "sycldnn/data_format.h"
 #include "sycldnn/mem_object.h"
 #include "sycldnn/status.h"
 
 #include "sycldnn/helpers/macros.h"
 
 #include "sycldnn/internal/transpose/launch.h"
+#include "sycldnn/internal/transpose/layout.h"
 
 #include <numeric>
 #include <vector>
@@ -157,6 +159,57 @@ SNNStatus convert_nchw_to_nhwc(
   return launch<T>(input, output, dimensions, NCHW_TO_NHWC, backend);
 }
 
+/**
+ * Convert a 4D tensor between two data formats, including the channel blocked
+ * NCHWc formats.
+ *
+ * \param input       A pointer to the memory representing the input tensor.
+ * \param output      A pointer to the memory representing the output tensor.
+ * \param dimensions  The number of batches, rows, columns and channels in the
+ *                    tensor, in that order regardless of the data formats.
+ * \param from        The data format of the input tensor.
+ * \param to          The data format of the output tensor.
+ * \param backend     The backend implementation, used to map between pointer
+ *                    representations.
+ * \return Returns an SNNStatus containing the SYCL event tied to the kernel
+ *         launches and a StatusCode enum showing if the launch was OK or
+ *         whether it encountered some problem.
+ * \retval StatusCode::InvalidParameter: An invalid parameter was passed in to
+ *         the launch function:
+ *         * The number of dimensions was not 4.
+ *         * The tensor size was zero.
+ *         * The number of channels is not a multiple of the channel block
+ *           size of a blocked format.
+ *         * Both formats are blocked, with different channel block sizes.
+ * \retval StatusCode::OK: The kernel was launched successfully.
+ */
+template <typename T, typename Backend>
+SNNStatus convert_layout(typename Backend::template pointer_type<T const> input,
+                         typename Backend::template pointer_type<T> output,
+                         std::vector<int> const& dimensions, DataFormat from,
+                         DataFormat to, Backend& backend) {
+  SNN_VALIDATE_PARAM(dimensions.size() == 4,
+                     "Layout conversions are only valid on 4D tensors.");
+  SNN_VALIDATE_PARAM(dimensions[3] % get_channel_block(from) == 0 &&
+                         dimensions[3] % get_channel_block(to) == 0,
+                     "The number of channels must be divisible by the channel "
+                     "block size.");
+  SNN_VALIDATE_PARAM(!is_channel_blocked(from) || !is_channel_blocked(to) ||
+                         from == to,
+                     "Conversions between different channel block sizes are "
+                     "not supported.");
+  if (from == to) {
+    // A one dimensional transpose copies the tensor.
+    int const size =
+        dimensions[0] * dimensions[1] * dimensions[2] * dimensions[3];
+    return launch<T>(input, output, {size}, {0}, backend);
+  }
+  auto transpose = internal::get_layout_transpose(
+      dimensions[0], dimensions[1], dimensions[2], dimensions[3], from, to);
+  return launch<T>(input, output, transpose.dimensions, transpose.permutation,
+                   backend);
+}
+
 }  // namespace transpose
 }  // namespace sycldnn
 
@@ -0,0 +1,670 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef SYCLDNN_SRC_BATCHNORM_KERNELS_H_
+#define SYCLDNN_SRC_BATCHNORM_KERNELS_H_
+
+#include "sycldnn/accessor_types.h"
+
+#include "sycldnn/helpers/macros.h"
+#include "sycldnn/internal/helpers/stat_type.h"
+
+#include "src/helpers/vector_io.h"
+#include "src/helpers/vector_type.h"
+
+#include <CL/sycl.hpp>
+
+namespace sycldnn {
+namespace batchnorm {
+namespace internal {
+
+using ::sycldnn::internal::helpers::StatType;
+
+/**
+ * Compute the mean and the sum of squared differences from the mean of a
+ * subset of the values in each channel, using Welford's algorithm.
+ *
+ * The batch and spatial dimensions are flattened into a single reduction
+ * dimension of size n_reduce. Chunk j of n_chunks reduces the values j,
+ * j + n_chunks, j + 2 * n_chunks, ... along this dimension, so that adjacent
+ * work-items read adjacent values in memory. For NHWC the channel is the
+ * fastest moving dimension of the kernel range, while for NCHW the chunk is.
+ *
+ * The partial results are written to two planes of [n_chunks, channels]
+ * values, the first holding the means and the second the sums of squared
+ * differences.
+ */
+template <typename T, typename Index, bool IsNCHW>
+struct WelfordPartialKernel {
+  using Stat = typename StatType<T>::type;
+
+  WelfordPartialKernel(ReadAccessor<T const> const& input,
+                       WriteAccessor<Stat> const& partials, Index n_reduce,
+                       Index channels, Index spatial, Index n_chunks)
+      : input_{input},
+        partials_{partials},
+        n_reduce_{n_reduce},
+        channels_{channels},
+        spatial_{spatial},
+        n_chunks_{n_chunks} {}
+
+  void SNN_ALWAYS_INLINE operator()(cl::sycl::item<2> item) const {
+    Index const channel = IsNCHW ? item.get_id(0) : item.get_id(1);
+    Index const chunk = IsNCHW ? item.get_id(1) : item.get_id(0);
+
+    using Load = helpers::io::Load<T>;
+    using Store = helpers::io::Store<Stat>;
+    auto in_ptr = input_.get_pointer();
+
+    Stat mean{0};
+    Stat m2{0};
+    Index count = 0;
+    for (Index r = chunk; r < n_reduce_; r += n_chunks_) {
+      Index const idx =
+          IsNCHW ? ((r / spatial_) * channels_ + channel) * spatial_ +
+                       r % spatial_
+                 : r * channels_ + channel;
+      Stat const value = static_cast<Stat>(Load()(in_ptr, idx));
+      ++count;
+      Stat const delta = value - mean;
+      mean += delta / static_cast<Stat>(count);
+      m2 += delta * (value - mean);
+    }
+
+    auto out_ptr = partials_.get_pointer();
+    Index const out_idx = chunk * channels_ + channel;
+    Store()(out_ptr, out_idx, mean);
+    Store()(out_ptr, n_chunks_ * channels_ + out_idx, m2);
+  }
+
+ private:
+  ReadAccessor<T const> input_;
+  WriteAccessor<Stat> partials_;
+  Index const n_reduce_;
+  Index const channels_;
+  Index const spatial_;
+  Index const n_chunks_;
+};
+
+/**
+ * Merge the partial statistics computed by the
+ * \ref sycldnn::batchnorm::internal::WelfordPartialKernel into the mean and
+ * variance of each channel.
+ *
+ * The partial results are combined with the parallel variance algorithm of
+ * Chan et al., so no cancellation occurs when the mean is large compared to the
+ * variance.
+ *
+ * If UpdateRunning is true then the batch statistics are blended with the
+ * previous statistics as:
+ *   running = batch * (1 - momentum) + previous * momentum
+ * otherwise the batch statistics are written directly and the previous
+ * statistics are not read.
+ */
+template <typename T, typename Index, bool UpdateRunning>
+struct WelfordMergeKernel {
+  using Stat = typename StatType<T>::type;
+
+  WelfordMergeKernel(ReadAccessor<Stat const> const& partials,
+                     ReadAccessor<T const> const& prev_mean,
+                     ReadAccessor<T const> const& prev_variance,
+                     WriteAccessor<T> const& mean,
+                     WriteAccessor<T> const& variance, Index n_reduce,
+                     Index channels, Index n_chunks, T momentum)
+      : partials_{partials},
+        prev_mean_{prev_mean},
+        prev_variance_{prev_variance},
+        mean_{mean},
+        variance_{variance},
+        n_reduce_{n_reduce},
+        channels_{channels},
+        n_chunks_{n_chunks},
+        momentum_{momentum} {}
+
+  void SNN_ALWAYS_INLINE operator()(cl::sycl::item<1> item) const {
+    Index const channel = item.get_id(0);
+
+    using LoadStat = helpers::io::Load<Stat>;
+    using Load = helpers::io::Load<T>;
+    using Store = helpers::io::Store<T>;
+    auto partial_ptr = partials_.get_pointer();
+
+    Stat mean{0};
+    Stat m2{0};
+    Index count = 0;
+    for (Index chunk = 0; chunk < n_chunks_; ++chunk) {
+      Index const chunk_count = (n_reduce_ - chunk + n_chunks_ - 1) / n_chunks_;
+      Index const idx = chunk * channels_ + channel;
+      Stat const chunk_mean = LoadStat()(partial_ptr, idx);
+      Stat const chunk_m2 =
+          LoadStat()(partial_ptr, n_chunks_ * channels_ + idx);
+
+      Index const new_count = count + chunk_count;
+      Stat const delta = chunk_mean - mean;
+      Stat const chunk_weight =
+          static_cast<Stat>(chunk_count) / static_cast<Stat>(new_count);
+      mean += delta * chunk_weight;
+      m2 += chunk_m2 + delta * delta * static_cast<Stat>(count) * chunk_weight;
+      count = new_count;
+    }
+    T batch_mean = static_cast<T>(mean);
+    T batch_variance = static_cast<T>(m2 / static_cast<Stat>(count));
+
+    if (UpdateRunning) {
+      T const one_minus_momentum = T{1} - momentum_;
+      batch_mean = batch_mean * one_minus_momentum +
+                   Load()(prev_mean_.get_pointer(), channel) * momentum_;
+      batch_variance =
+          batch_variance * one_minus_momentum +
+          Load()(prev_variance_.get_pointer(), channel) * momentum_;
+    }
+    Store()(mean_.get_pointer(), channel, batch_mean);
+    Store()(variance_.get_pointer(), channel, batch_variance);
+  }
+
+ private:
+  ReadAccessor<Stat const> partials_;
+  ReadAccessor<T const> prev_mean_;
+  ReadAccessor<T const> prev_variance_;
+  WriteAccessor<T> mean_;
+  WriteAccessor<T> variance_;
+  Index const n_reduce_;
+  Index const channels_;
+  Index const n_chunks_;
+  T const momentum_;
+};
+
+/**
+ * Normalize, scale and shift each value in a tensor in a single pass:
+ *   output = (input - mean) / sqrt(variance + epsilon) * gamma + beta
+ * where mean, variance, gamma and beta are indexed by the value's channel.
+ *
+ * Each work-item handles VectorWidth consecutive values. For NHWC these are
+ * consecutive channels, so the number of channels must be a multiple of
+ * VectorWidth. For NCHW these all share a channel, so the spatial size must be
+ * a multiple of VectorWidth.
+ */
+template <typename T, typename Index, int VectorWidth, bool IsNCHW>
+struct NormalizeKernel {
+  using DataType = typename helpers::VectorType<T, VectorWidth>::type;
+
+  NormalizeKernel(ReadAccessor<T const> const& input,
+                  ReadAccessor<T const> const& beta,
+                  ReadAccessor<T const> const& gamma,
+                  ReadAccessor<T const> const& mean,
+                  ReadAccessor<T const> const& variance,
+                  WriteAccessor<T> const& output, Index n_vecs, Index channels,
+                  Index spatial, T epsilon)
+      : input_{input},
+        beta_{beta},
+        gamma_{gamma},
+        mean_{mean},
+        variance_{variance},
+        output_{output},
+        n_vecs_{n_vecs},
+        channels_{channels},
+        spatial_{spatial},
+        epsilon_{epsilon} {}
+
+  void SNN_ALWAYS_INLINE operator()(cl::sycl::item<1> item) const {
+    Index const idx = item.get_id(0);
+
+    if (idx < n_vecs_) {
+      Index const vec_idx = idx * VectorWidth;
+      Index const channel =
+          IsNCHW ? (vec_idx / spatial_) % channels_ : vec_idx % channels_;
+
+      using Load = helpers::io::Load<DataType>;
+      using Store = helpers::io::Store<DataType>;
+      DataType const value = Load()(input_.get_pointer(), vec_idx);
+      DataType const mean = load_channel(mean_, channel);
+      DataType const variance = load_channel(variance_, channel);
+      DataType const gamma = load_channel(gamma_, channel);
+      DataType const beta = load_channel(beta_, channel);
+
+      DataType const stddev = cl::sycl::sqrt(variance + DataType{epsilon_});
+      DataType const output = (value - mean) / stddev * gamma + beta;
+      Store()(output_.get_pointer(), vec_idx, output);
+    }
+  }
+
+ private:
+  /**
+   * Load the per-channel values for this work-item. For NHWC these are a
+   * vector of consecutive channels, while for NCHW a single value is
+   * broadcast.
+   */
+  DataType SNN_ALWAYS_INLINE load_channel(ReadAccessor<T const> const& values,
+                                          Index channel) const {
+    if (IsNCHW) {
+      return DataType{helpers::io::Load<T>()(values.get_pointer(), channel)};
+    }
+    return helpers::io::Load<DataType>()(values.get_pointer(), channel);
+  }
+
+  ReadAccessor<T const> input_;
+  ReadAccessor<T const> beta_;
+  ReadAccessor<T const> gamma_;
+  ReadAccessor<T const> mean_;
+  ReadAccessor<T const> variance_;
+  WriteAccessor<T> output_;
+  Index const n_vecs_;
+  Index const channels_;
+  Index const spatial_;
+  T const epsilon_;
+};
+
+/**
+ * Compute the statistics needed for the batchnorm gradient over a subset of
+ * the values in each channel, in a single pass over the input and the
+ * gradient.
+ *
+ * For each channel the mean and the sum of squared differences from the mean
+ * of the input are computed using Welford's algorithm, alongside the mean of
+ * the gradient and the co-moment:
+ *   sum((input - mean(input)) * (gradient - mean(gradient)))
+ * which is updated in the same way as the sum of squared differences. As the
+ * centered input sums to zero, the co-moment is equal to
+ * sum(gradient * (input - mean(input))), without any of the cancellation
+ * that comes from computing it as a difference of sums.
+ *
+ * The chunking and layout handling matches the
+ * \ref sycldnn::batchnorm::internal::WelfordPartialKernel. The partial results
+ * are written to four planes of [n_chunks, channels] values, holding the input
+ * means, the input sums of squared differences, the gradient means and the
+ * co-moments.
+ */
+template <typename T, typename Index, bool IsNCHW>
+struct GradientPartialKernel {
+  using Stat = typename StatType<T>::type;
+
+  GradientPartialKernel(ReadAccessor<T const> const& input,
+                        ReadAccessor<T const> const& gradient,
+                        WriteAccessor<Stat> const& partials, Index n_reduce,
+                        Index channels, Index spatial, Index n_chunks)
+      : input_{input},
+        gradient_{gradient},
+        partials_{partials},
+        n_reduce_{n_reduce},
+        channels_{channels},
+        spatial_{spatial},
+        n_chunks_{n_chunks} {}
+
+  void SNN_ALWAYS_INLINE operator()(cl::sycl::item<2> item) const {
+    Index const channel = IsNCHW ? item.get_id(0) : item.get_id(1);
+    Index const chunk = IsNCHW ? item.get_id(1) : item.get_id(0);
+
+    using Load = helpers::io::Load<T>;
+    using Store = helpers::io::Store<Stat>;
+    auto in_ptr = input_.get_pointer();
+    auto grad_ptr = gradient_.get_pointer();
+
+    Stat mean{0};
+    Stat m2{0};
+    Stat grad_mean{0};
+    Stat co_moment{0};
+    Index count = 0;
+    for (Index r = chunk; r < n_reduce_; r += n_chunks_) {
+      Index const idx =
+          IsNCHW ? ((r / spatial_) * channels_ + channel) * spatial_ +
+                       r % spatial_
+                 : r * channels_ + channel;
+      Stat const value = static_cast<Stat>(Load()(in_ptr, idx));
+      Stat const grad = static_cast<Stat>(Load()(grad_ptr, idx));
+      ++count;
+      Stat const delta = value - mean;
+      mean += delta / static_cast<Stat>(count);
+      m2 += delta * (value - mean);
+      grad_mean += (grad - grad_mean) / static_cast<Stat>(count);
+      co_moment += delta * (grad - grad_mean);
+    }
+
+    auto out_ptr = partials_.get_pointer();
+    Index const plane = n_chunks_ * channels_;
+    Index const out_idx = chunk * channels_ + channel;
+    Store()(out_ptr, out_idx, mean);
+    Store()(out_ptr, plane + out_idx, m2);
+    Store()(out_ptr, 2 * plane + out_idx, grad_mean);
+    Store()(out_ptr, 3 * plane + out_idx, co_moment);
+  }
+
+ private:
+  ReadAccessor<T const> input_;
+  ReadAccessor<T const> gradient_;
+  WriteAccessor<Stat> partials_;
+  Index const n_reduce_;
+  Index const channels_;
+  Index const spatial_;
+  Index const n_chunks_;
+};
+
+/**
+ * Merge the partial statistics computed by the
+ * \ref sycldnn::batchnorm::internal::GradientPartialKernel and compute the
+ * gradients of beta and gamma for each channel, along with the coefficients
+ * used to compute the input gradient.
+ *
+ * With x_hat = (input - mean) / sqrt(variance + epsilon):
+ *   beta_grad  = sum(gradient)
+ *   gamma_grad = sum(gradient * x_hat)
+ *
+ * If IsTraining is true the mean and variance are the batch statistics, and
+ * the input gradient is:
+ *   gamma / sqrt(variance + epsilon) *
+ *       (gradient - mean(gradient) - x_hat * gamma_grad / n_reduce)
+ * otherwise the mean and variance are the provided population statistics, and
+ * the input gradient is:
+ *   gamma / sqrt(variance + epsilon) * gradient
+ *
+ * Both are written as:
+ *   scale * (gradient - gradient_center) + x_scale * (input - input_center)
+ * with the four coefficients stored as planes of [channels] values in that
+ * order.
+ */
+template <typename T, typename Index, bool IsTraining>
+struct GradientMergeKernel {
+  using Stat = typename StatType<T>::type;
+
+  GradientMergeKernel(ReadAccessor<Stat const> const& partials,
+                      ReadAccessor<T const> const& gamma,
+                      ReadAccessor<T const> const& pop_mean,
+                      ReadAccessor<T const> const& pop_variance,
+                      WriteAccessor<T> const& beta_grad,
+                      WriteAccessor<T> const& gamma_grad,
+                      WriteAccessor<T> const& coefficients, Index n_reduce,
+                      Index channels, Index n_chunks, T epsilon)
+      : partials_{partials},
+        gamma_{gamma},
+        pop_mean_{pop_mean},
+        pop_variance_{pop_variance},
+        beta_grad_{beta_grad},
+        gamma_grad_{gamma_grad},
+        coefficients_{coefficients},
+        n_reduce_{n_reduce},
+        channels_{channels},
+        n_chunks_{n_chunks},
+        epsilon_{epsilon} {}
+
+  void SNN_ALWAYS_INLINE operator()(cl::sycl::item<1> item) const {
+    Index const channel = item.get_id(0);
+
+    using LoadStat = helpers::io::Load<Stat>;
+    using Load = helpers::io::Load<T>;
+    using Store = helpers::io::Store<T>;
+    auto partial_ptr = partials_.get_pointer();
+    Index const plane = n_chunks_ * channels_;
+
+    Stat mean{0};
+    Stat m2{0};
+    Stat grad_mean{0};
+    Stat co_moment{0};
+    Index count = 0;
+    for (Index chunk = 0; chunk < n_chunks_; ++chunk) {
+      Index const chunk_count = (n_reduce_ - chunk + n_chunks_ - 1) / n_chunks_;
+      Index const idx = chunk * channels_ + channel;
+      Stat const chunk_mean = LoadStat()(partial_ptr, idx);
+      Stat const chunk_m2 = LoadStat()(partial_ptr, plane + idx);
+      Stat const chunk_grad_mean = LoadStat()(partial_ptr, 2 * plane + idx);
+      Stat const chunk_co_moment = LoadStat()(partial_ptr, 3 * plane + idx);
+
+      Index const new_count = count + chunk_count;
+      Stat const delta = chunk_mean - mean;
+      Stat const grad_delta = chunk_grad_mean - grad_mean;
+      Stat const chunk_weight =
+          static_cast<Stat>(chunk_count) / static_cast<Stat>(new_count);
+      Stat const cross_weight = static_cast<Stat>(count) * chunk_weight;
+      mean += delta * chunk_weight;
+      grad_mean += grad_delta * chunk_weight;
+      m2 += chunk_m2 + delta * delta * cross_weight;
+      co_moment += chunk_co_moment + delta * grad_delta * cross_weight;
+      count = new_count;
+    }
+    Stat const n_values = static_cast<Stat>(count);
+    Stat const gamma = static_cast<Stat>(Load()(gamma_.get_pointer(), channel));
+
+    Stat variance = m2 / n_values;
+    Stat grad_dot_centered = co_moment;
+    if (!IsTraining) {
+      // The co-moment is centered on the batch mean, so shift it to the
+      // population mean.
+      Stat const pop_mean =
+          static_cast<Stat>(Load()(pop_mean_.get_pointer(), channel));
+      variance =
+          static_cast<Stat>(Load()(pop_variance_.get_pointer(), channel));
+      grad_dot_centered += n_values * grad_mean * (mean - pop_mean);
+    }
+    Stat const inv_stddev =
+        Stat{1} / cl::sycl::sqrt(variance + static_cast<Stat>(epsilon_));
+    Stat const beta_grad = n_values * grad_mean;
+    Stat const gamma_grad = grad_dot_centered * inv_stddev;
+    Stat const scale = gamma * inv_stddev;
+
+    Store()(beta_grad_.get_pointer(), channel, static_cast<T>(beta_grad));
+    Store()(gamma_grad_.get_pointer(), channel, static_cast<T>(gamma_grad));
+
+    auto coeff_ptr = coefficients_.get_pointer();
+    if (IsTraining) {
+      Stat const x_scale =
+          -scale * inv_stddev * inv_stddev * co_moment / n_values;
+      Store()(coeff_ptr, channel, static_cast<T>(scale));
+      Store()(coeff_ptr, channels_ + channel, static_cast<T>(grad_mean));
+      Store()(coeff_ptr, 2 * channels_ + channel, static_cast<T>(x_scale));
+      Store()(coeff_ptr, 3 * channels_ + channel, static_cast<T>(mean));
+    } else {
+      Store()(coeff_ptr, channel, static_cast<T>(scale));
+      Store()(coeff_ptr, channels_ + channel, T{0});
+      Store()(coeff_ptr, 2 * channels_ + channel, T{0});
+      Store()(coeff_ptr, 3 * channels_ + channel, T{0});
+    }
+  }
+
+ private:
+  ReadAccessor<Stat const> partials_;
+  ReadAccessor<T const> gamma_;
+  ReadAccessor<T const> pop_mean_;
+  ReadAccessor<T const> pop_variance_;
+  WriteAccessor<T> beta_grad_;
+  WriteAccessor<T> gamma_grad_;
+  WriteAccessor<T> coefficients_;
+  Index const n_reduce_;
+  Index const channels_;
+  Index const n_chunks_;
+  T const epsilon_;
+};
+
+/**
+ * Compute the batchnorm input gradient in a single pass, using the per-channel
+ * coefficients computed by the
+ * \ref sycldnn::batchnorm::internal::GradientMergeKernel:
+ *   output = scale * (gradient - gradient_center) +
+ *            x_scale * (input - input_center)
+ *
+ * If UseInput is false then x_scale is zero, so the input is not read.
+ *
+ * The vectorization matches the
+ * \ref sycldnn::batchnorm::internal::NormalizeKernel.
+ */
+template <typename T, typename Index, int VectorWidth, bool IsNCHW,
+          bool UseInput>
+struct InputGradientKernel {
+  using DataType = typename helpers::VectorType<T, VectorWidth>::type;
+
+  InputGradientKernel(ReadAccessor<T const> const& input,
+                      ReadAccessor<T const> const& gradient,
+                      ReadAccessor<T const> const& coefficients,
+                      WriteAccessor<T> const& output, Index n_vecs,
+                      Index channels, Index spatial)
+      : input_{input},
+        gradient_{gradient},
+        coefficients_{coefficients},
+        output_{output},
+        n_vecs_{n_vecs},
+        channels_{channels},
+        spatial_{spatial} {}
+
+  void SNN_ALWAYS_INLINE operator()(cl::sycl::item<1> item) const {
+    Index const idx = item.get_id(0);
+
+    if (idx < n_vecs_) {
+      Index const vec_idx = idx * VectorWidth;
+      Index const channel =
+          IsNCHW ? (vec_idx / spatial_) % channels_ : vec_idx % channels_;
+
+      using Load = helpers::io::Load<DataType>;
+      using Store = helpers::io::Store<DataType>;
+      DataType const gradient = Load()(gradient_.get_pointer(), vec_idx);
+      DataType const scale = load_channel(0, channel);
+      DataType const grad_center = load_channel(1, channel);
+      DataType output = scale * (gradient - grad_center);
+      if (UseInput) {
+        DataType const input = Load()(input_.get_pointer(), vec_idx);
+        DataType const x_scale = load_channel(2, channel);
+        DataType const input_center = load_channel(3, channel);
+        output += x_scale * (input - input_center);
+      }
+      Store()(output_.get_pointer(), vec_idx, output);
+    }
+  }
+
+ private:
+  /**
+   * Load the per-channel coefficients for this work-item from the given
+   * plane. For NHWC these are a vector of consecutive channels, while for
+   * NCHW a single value is broadcast.
+   */
+  DataType SNN_ALWAYS_INLINE load_channel(Index plane, Index channel) const {
+    Index const idx = plane * channels_ + channel;
+    if (IsNCHW) {
+      return DataType{
+          helpers::io::Load<T>()(coefficients_.get_pointer(), idx)};
+    }
+    return helpers::io::Load<DataType>()(coefficients_.get_pointer(), idx);
+  }
+
+  ReadAccessor<T const> input_;
+  ReadAccessor<T const> gradient_;
+  ReadAccessor<T const> coefficients_;
+  WriteAccessor<T> output_;
+  Index const n_vecs_;
+  Index const channels_;
+  Index const spatial_;
+};
+
+/**
+ * Scale each value in a convolution filter by the frozen batchnorm scale of its
+ * output feature:
+ *   filter = filter * gamma / sqrt(variance + epsilon)
+ *
+ * The filter is updated in place. For HWCF filters the feature is the fastest
+ * moving dimension, while for FCHW filters each feature holds a contiguous
+ * block of filter_per_feature values.
+ */
+template <typename T, typename Index, bool IsFCHW>
+struct FoldFilterKernel {
+  FoldFilterKernel(ReadWriteAccessor<T> const& filter,
+                   ReadAccessor<T const> const& gamma,
+                   ReadAccessor<T const> const& variance, Index filter_size,
+                   Index features, Index filter_per_feature, T epsilon)
+      : filter_{filter},
+        gamma_{gamma},
+        variance_{variance},
+        filter_size_{filter_size},
+        features_{features},
+        filter_per_feature_{filter_per_feature},
+        epsilon_{epsilon} {}
+
+  void SNN_ALWAYS_INLINE operator()(cl::sycl::item<1> item) const {
+    Index const idx = item.get_id(0);
+
+    if (idx < filter_size_) {
+      Index const feature =
+          IsFCHW ? idx / filter_per_feature_ : idx % features_;
+
+      using Load = helpers::io::Load<T>;
+      using Store = helpers::io::Store<T>;
+      T const gamma = Load()(gamma_.get_pointer(), feature);
+      T const variance = Load()(variance_.get_pointer(), feature);
+      T const scale = gamma / cl::sycl::sqrt(variance + epsilon_);
+
+      auto filter_ptr = filter_.get_pointer();
+      Store()(filter_ptr, idx, Load()(filter_ptr, idx) * scale);
+    }
+  }
+
+ private:
+  ReadWriteAccessor<T> filter_;
+  ReadAccessor<T const> gamma_;
+  ReadAccessor<T const> variance_;
+  Index const filter_size_;
+  Index const features_;
+  Index const filter_per_feature_;
+  T const epsilon_;
+};
+
+/**
+ * Shift the bias of each output feature of a convolution so that it also
+ * applies a frozen batchnorm:
+ *   bias = (bias - mean) * gamma / sqrt(variance + epsilon) + beta
+ *
+ * The bias is updated in place.
+ */
+template <typename T, typename Index>
+struct FoldBiasKernel {
+  FoldBiasKernel(ReadWriteAccessor<T> const& bias,
+                 ReadAccessor<T const> const& beta,
+                 ReadAccessor<T const> const& gamma,
+                 ReadAccessor<T const> const& mean,
+                 ReadAccessor<T const> const& variance, Index features,
+                 T epsilon)
+      : bias_{bias},
+        beta_{beta},
+        gamma_{gamma},
+        mean_{mean},
+        variance_{variance},
+        features_{features},
+        epsilon_{epsilon} {}
+
+  void SNN_ALWAYS_INLINE operator()(cl::sycl::item<1> item) const {
+    Index const feature = item.get_id(0);
+
+    if (feature < features_) {
+      using Load = helpers::io::Load<T>;
+      using Store = helpers::io::Store<T>;
+      T const beta = Load()(beta_.get_pointer(), feature);
+      T const gamma = Load()(gamma_.get_pointer(), feature);
+      T const mean = Load()(mean_.get_pointer(), feature);
+      T const variance = Load()(variance_.get_pointer(), feature);
+      T const scale = gamma / cl::sycl::sqrt(variance + epsilon_);
+
+      auto bias_ptr = bias_.get_pointer();
+      T const bias = Load()(bias_ptr, feature);
+      Store()(bias_ptr, feature, (bias - mean) * scale + beta);
+    }
+  }
+
+ private:
+  ReadWriteAccessor<T> bias_;
+  ReadAccessor<T const> beta_;
+  ReadAccessor<T const> gamma_;
+  ReadAccessor<T const> mean_;
+  ReadAccessor<T const> variance_;
+  Index const features_;
+  T const epsilon_;
+};
+
+}  // namespace internal
+}  // namespace batchnorm
+}  // namespace sycldnn
+#endif  // SYCLDNN_SRC_BATCHNORM_KERNELS_H_
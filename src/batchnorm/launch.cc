@@ -0,0 +1,547 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "sycldnn/internal/batchnorm/launch.h"
+
+#include "sycldnn/mem_object.h"
+#include "sycldnn/status.h"
+
+#include "sycldnn/batchnorm/params.h"
+#include "sycldnn/conv2d/params.h"
+
+#include "sycldnn/helpers/ratio.h"
+
+#include "src/batchnorm/kernels.h"
+
+#include <CL/sycl.hpp>
+
+#include <stddef.h>
+#include <cstdint>
+#include <limits>
+
+#include "sycldnn/export.h"
+
+namespace sycldnn {
+namespace batchnorm {
+namespace internal {
+namespace {
+
+template <typename T, typename Index, bool IsNCHW, bool UpdateRunning>
+SNNStatus queue_statistics(BaseMemObject<T const>& input_mem,
+                           BaseMemObject<T const>& prev_mean_mem,
+                           BaseMemObject<T const>& prev_variance_mem,
+                           BaseMemObject<T>& mean_mem,
+                           BaseMemObject<T>& variance_mem,
+                           StatMemObject<T>& partials_mem,
+                           BatchNormParams const& params,
+                           cl::sycl::queue& queue) {
+  Index const channels = params.channels;
+  Index const spatial = static_cast<Index>(params.rows) * params.cols;
+  Index const n_reduce = spatial * params.batch;
+  // Each chunk writes its partial mean and sum of squared differences to the
+  // workspace, which the merge kernel then reads back for every channel.
+  Index const n_chunks = get_n_chunks(n_reduce, channels);
+
+  queue.submit([&](cl::sycl::handler& cgh) {
+    auto input = input_mem.read_accessor(cgh);
+    auto partials = partials_mem.write_accessor(cgh);
+    WelfordPartialKernel<T, Index, IsNCHW> functor{
+        input, partials, n_reduce, channels, spatial, n_chunks};
+    size_t const n_channels = channels;
+    size_t const n_chunk_threads = n_chunks;
+    cl::sycl::range<2> range =
+        IsNCHW ? cl::sycl::range<2>{n_channels, n_chunk_threads}
+               : cl::sycl::range<2>{n_chunk_threads, n_channels};
+    cgh.parallel_for(range, functor);
+  });
+
+  auto event = queue.submit([&](cl::sycl::handler& cgh) {
+    auto partials = partials_mem.as_const().read_accessor(cgh);
+    auto prev_mean = prev_mean_mem.read_accessor(cgh);
+    auto prev_variance = prev_variance_mem.read_accessor(cgh);
+    auto mean = mean_mem.write_accessor(cgh);
+    auto variance = variance_mem.write_accessor(cgh);
+    WelfordMergeKernel<T, Index, UpdateRunning> functor{
+        partials, prev_mean, prev_variance,
+        mean,     variance,  n_reduce,
+        channels, n_chunks,  static_cast<T>(params.momentum)};
+    cgh.parallel_for(cl::sycl::range<1>{static_cast<size_t>(channels)},
+                     functor);
+  });
+  return {event, StatusCode::OK};
+}
+
+template <typename T, typename Index, bool UpdateRunning>
+SNNStatus launch_statistics_with_index(BaseMemObject<T const>& input,
+                                       BaseMemObject<T const>& prev_mean,
+                                       BaseMemObject<T const>& prev_variance,
+                                       BaseMemObject<T>& mean,
+                                       BaseMemObject<T>& variance,
+                                       StatMemObject<T>& workspace,
+                                       BatchNormParams const& params,
+                                       cl::sycl::queue& queue) {
+  if (params.input_format == DataFormat::NCHW) {
+    return queue_statistics<T, Index, true, UpdateRunning>(
+        input, prev_mean, prev_variance, mean, variance, workspace, params,
+        queue);
+  }
+  return queue_statistics<T, Index, false, UpdateRunning>(
+      input, prev_mean, prev_variance, mean, variance, workspace, params,
+      queue);
+}
+
+template <typename T, bool UpdateRunning>
+SNNStatus launch_statistics(BaseMemObject<T const>& input,
+                            BaseMemObject<T const>& prev_mean,
+                            BaseMemObject<T const>& prev_variance,
+                            BaseMemObject<T>& mean, BaseMemObject<T>& variance,
+                            StatMemObject<T>& workspace,
+                            BatchNormParams const& params,
+                            cl::sycl::queue& queue) {
+  size_t const n_items = static_cast<size_t>(params.batch) * params.rows *
+                         params.cols * params.channels;
+  if (n_items > static_cast<size_t>(std::numeric_limits<int32_t>::max())) {
+#ifdef SNN_USE_INT64
+    return launch_statistics_with_index<T, int64_t, UpdateRunning>(
+        input, prev_mean, prev_variance, mean, variance, workspace, params,
+        queue);
+#else
+    return StatusCode::IndexExceeded;
+#endif  // SNN_USE_INT64
+  } else {
+    return launch_statistics_with_index<T, int32_t, UpdateRunning>(
+        input, prev_mean, prev_variance, mean, variance, workspace, params,
+        queue);
+  }
+}
+
+template <typename T, typename Index, int VectorWidth, bool IsNCHW>
+SNNStatus queue_normalize(BaseMemObject<T const>& input_mem,
+                          BaseMemObject<T const>& beta_mem,
+                          BaseMemObject<T const>& gamma_mem,
+                          BaseMemObject<T const>& mean_mem,
+                          BaseMemObject<T const>& variance_mem,
+                          BaseMemObject<T>& output_mem, Index n_items,
+                          BatchNormParams const& params,
+                          cl::sycl::queue& queue) {
+  auto event = queue.submit([&](cl::sycl::handler& cgh) {
+    auto input = input_mem.read_accessor(cgh);
+    auto beta = beta_mem.read_accessor(cgh);
+    auto gamma = gamma_mem.read_accessor(cgh);
+    auto mean = mean_mem.read_accessor(cgh);
+    auto variance = variance_mem.read_accessor(cgh);
+    auto output = output_mem.write_accessor(cgh);
+    Index const n_vecs = n_items / VectorWidth;
+    Index const spatial = static_cast<Index>(params.rows) * params.cols;
+    size_t const n_threads = helpers::round_up_to_nearest_multiple(n_vecs, 64);
+    T const epsilon = static_cast<T>(params.epsilon);
+    NormalizeKernel<T, Index, VectorWidth, IsNCHW> functor{
+        input,  beta,   gamma,           mean,    variance,
+        output, n_vecs, params.channels, spatial, epsilon};
+    cgh.parallel_for(cl::sycl::range<1>{n_threads}, functor);
+  });
+  return {event, StatusCode::OK};
+}
+
+template <typename T, typename Index, bool IsNCHW>
+SNNStatus launch_normalize_with_layout(
+    BaseMemObject<T const>& input, BaseMemObject<T const>& beta,
+    BaseMemObject<T const>& gamma, BaseMemObject<T const>& mean,
+    BaseMemObject<T const>& variance, BaseMemObject<T>& output, Index n_items,
+    BatchNormParams const& params, cl::sycl::queue& queue) {
+  // NHWC vectorizes over consecutive channels, while NCHW vectorizes over
+  // consecutive spatial values within a single channel.
+  Index const vector_dim =
+      IsNCHW ? static_cast<Index>(params.rows) * params.cols : params.channels;
+  if (vector_dim % 4 == 0) {
+    return queue_normalize<T, Index, 4, IsNCHW>(
+        input, beta, gamma, mean, variance, output, n_items, params, queue);
+  } else if (vector_dim % 2 == 0) {
+    return queue_normalize<T, Index, 2, IsNCHW>(
+        input, beta, gamma, mean, variance, output, n_items, params, queue);
+  } else {
+    return queue_normalize<T, Index, 1, IsNCHW>(
+        input, beta, gamma, mean, variance, output, n_items, params, queue);
+  }
+}
+
+template <typename T, typename Index>
+SNNStatus launch_normalize_with_index(
+    BaseMemObject<T const>& input, BaseMemObject<T const>& beta,
+    BaseMemObject<T const>& gamma, BaseMemObject<T const>& mean,
+    BaseMemObject<T const>& variance, BaseMemObject<T>& output, Index n_items,
+    BatchNormParams const& params, cl::sycl::queue& queue) {
+  if (params.input_format == DataFormat::NCHW) {
+    return launch_normalize_with_layout<T, Index, true>(
+        input, beta, gamma, mean, variance, output, n_items, params, queue);
+  }
+  return launch_normalize_with_layout<T, Index, false>(
+      input, beta, gamma, mean, variance, output, n_items, params, queue);
+}
+
+template <typename T, typename Index, bool IsNCHW, bool IsTraining>
+SNNStatus queue_gradient_statistics(
+    BaseMemObject<T const>& input_mem, BaseMemObject<T const>& gradient_mem,
+    BaseMemObject<T const>& gamma_mem, BaseMemObject<T const>& pop_mean_mem,
+    BaseMemObject<T const>& pop_variance_mem, BaseMemObject<T>& beta_grad_mem,
+    BaseMemObject<T>& gamma_grad_mem, StatMemObject<T>& partials_mem,
+    BaseMemObject<T>& coefficients_mem, BatchNormParams const& params,
+    cl::sycl::queue& queue) {
+  Index const channels = params.channels;
+  Index const spatial = static_cast<Index>(params.rows) * params.cols;
+  Index const n_reduce = spatial * params.batch;
+  // Each chunk writes its partial statistics and gradient sums to the
+  // workspace, which the merge kernel reduces into the coefficients.
+  Index const n_chunks = get_n_chunks(n_reduce, channels);
+
+  queue.submit([&](cl::sycl::handler& cgh) {
+    auto input = input_mem.read_accessor(cgh);
+    auto gradient = gradient_mem.read_accessor(cgh);
+    auto partials = partials_mem.write_accessor(cgh);
+    GradientPartialKernel<T, Index, IsNCHW> functor{
+        input, gradient, partials, n_reduce, channels, spatial, n_chunks};
+    size_t const n_channels = channels;
+    size_t const n_chunk_threads = n_chunks;
+    cl::sycl::range<2> range =
+        IsNCHW ? cl::sycl::range<2>{n_channels, n_chunk_threads}
+               : cl::sycl::range<2>{n_chunk_threads, n_channels};
+    cgh.parallel_for(range, functor);
+  });
+
+  auto event = queue.submit([&](cl::sycl::handler& cgh) {
+    auto partials = partials_mem.as_const().read_accessor(cgh);
+    auto gamma = gamma_mem.read_accessor(cgh);
+    auto pop_mean = pop_mean_mem.read_accessor(cgh);
+    auto pop_variance = pop_variance_mem.read_accessor(cgh);
+    auto beta_grad = beta_grad_mem.write_accessor(cgh);
+    auto gamma_grad = gamma_grad_mem.write_accessor(cgh);
+    auto coefficients = coefficients_mem.write_accessor(cgh);
+    T const epsilon = static_cast<T>(params.epsilon);
+    GradientMergeKernel<T, Index, IsTraining> functor{
+        partials,     gamma,    pop_mean, pop_variance, beta_grad, gamma_grad,
+        coefficients, n_reduce, channels, n_chunks,     epsilon};
+    cgh.parallel_for(cl::sycl::range<1>{static_cast<size_t>(channels)},
+                     functor);
+  });
+  return {event, StatusCode::OK};
+}
+
+template <typename T, typename Index, int VectorWidth, bool IsNCHW,
+          bool UseInput>
+SNNStatus queue_input_gradient(BaseMemObject<T const>& input_mem,
+                               BaseMemObject<T const>& gradient_mem,
+                               BaseMemObject<T const>& coefficients_mem,
+                               BaseMemObject<T>& output_mem, Index n_items,
+                               BatchNormParams const& params,
+                               cl::sycl::queue& queue) {
+  auto event = queue.submit([&](cl::sycl::handler& cgh) {
+    auto input = input_mem.read_accessor(cgh);
+    auto gradient = gradient_mem.read_accessor(cgh);
+    auto coefficients = coefficients_mem.read_accessor(cgh);
+    auto output = output_mem.write_accessor(cgh);
+    Index const n_vecs = n_items / VectorWidth;
+    Index const spatial = static_cast<Index>(params.rows) * params.cols;
+    size_t const n_threads = helpers::round_up_to_nearest_multiple(n_vecs, 64);
+    InputGradientKernel<T, Index, VectorWidth, IsNCHW, UseInput> functor{
+        input, gradient, coefficients, output, n_vecs, params.channels,
+        spatial};
+    cgh.parallel_for(cl::sycl::range<1>{n_threads}, functor);
+  });
+  return {event, StatusCode::OK};
+}
+
+template <typename T, typename Index, bool IsNCHW, bool IsTraining>
+SNNStatus launch_gradient_with_layout(
+    BaseMemObject<T const>& input, BaseMemObject<T const>& gradient,
+    BaseMemObject<T const>& gamma, BaseMemObject<T const>& pop_mean,
+    BaseMemObject<T const>& pop_variance, BaseMemObject<T>& beta_grad,
+    BaseMemObject<T>& gamma_grad, BaseMemObject<T>& output,
+    StatMemObject<T>& workspace, BaseMemObject<T>& coefficients, Index n_items,
+    BatchNormParams const& params, cl::sycl::queue& queue) {
+  // The merge kernel writes the per-channel coefficients, which the
+  // elementwise kernel then reads to compute the input gradient.
+  auto status = queue_gradient_statistics<T, Index, IsNCHW, IsTraining>(
+      input, gradient, gamma, pop_mean, pop_variance, beta_grad, gamma_grad,
+      workspace, coefficients, params, queue);
+  if (status.status != StatusCode::OK) {
+    return status;
+  }
+
+  auto const_coefficients = coefficients.as_const();
+  Index const vector_dim =
+      IsNCHW ? static_cast<Index>(params.rows) * params.cols : params.channels;
+  if (vector_dim % 4 == 0) {
+    return queue_input_gradient<T, Index, 4, IsNCHW, IsTraining>(
+        input, gradient, const_coefficients, output, n_items, params, queue);
+  } else if (vector_dim % 2 == 0) {
+    return queue_input_gradient<T, Index, 2, IsNCHW, IsTraining>(
+        input, gradient, const_coefficients, output, n_items, params, queue);
+  } else {
+    return queue_input_gradient<T, Index, 1, IsNCHW, IsTraining>(
+        input, gradient, const_coefficients, output, n_items, params, queue);
+  }
+}
+
+template <typename T, typename Index, bool IsTraining>
+SNNStatus launch_gradient_with_index(
+    BaseMemObject<T const>& input, BaseMemObject<T const>& gradient,
+    BaseMemObject<T const>& gamma, BaseMemObject<T const>& pop_mean,
+    BaseMemObject<T const>& pop_variance, BaseMemObject<T>& beta_grad,
+    BaseMemObject<T>& gamma_grad, BaseMemObject<T>& output,
+    StatMemObject<T>& workspace, BaseMemObject<T>& coefficients, Index n_items,
+    BatchNormParams const& params, cl::sycl::queue& queue) {
+  if (params.input_format == DataFormat::NCHW) {
+    return launch_gradient_with_layout<T, Index, true, IsTraining>(
+        input, gradient, gamma, pop_mean, pop_variance, beta_grad, gamma_grad,
+        output, workspace, coefficients, n_items, params, queue);
+  }
+  return launch_gradient_with_layout<T, Index, false, IsTraining>(
+      input, gradient, gamma, pop_mean, pop_variance, beta_grad, gamma_grad,
+      output, workspace, coefficients, n_items, params, queue);
+}
+
+template <typename T, bool IsTraining>
+SNNStatus launch_gradient_kernels(
+    BaseMemObject<T const>& input, BaseMemObject<T const>& gradient,
+    BaseMemObject<T const>& gamma, BaseMemObject<T const>& pop_mean,
+    BaseMemObject<T const>& pop_variance, BaseMemObject<T>& beta_grad,
+    BaseMemObject<T>& gamma_grad, BaseMemObject<T>& output,
+    StatMemObject<T>& workspace, BaseMemObject<T>& coefficients,
+    BatchNormParams const& params, cl::sycl::queue& queue) {
+  size_t const n_items = static_cast<size_t>(params.batch) * params.rows *
+                         params.cols * params.channels;
+  if (n_items > static_cast<size_t>(std::numeric_limits<int32_t>::max())) {
+#ifdef SNN_USE_INT64
+    return launch_gradient_with_index<T, int64_t, IsTraining>(
+        input, gradient, gamma, pop_mean, pop_variance, beta_grad, gamma_grad,
+        output, workspace, coefficients, static_cast<int64_t>(n_items), params,
+        queue);
+#else
+    return StatusCode::IndexExceeded;
+#endif  // SNN_USE_INT64
+  } else {
+    return launch_gradient_with_index<T, int32_t, IsTraining>(
+        input, gradient, gamma, pop_mean, pop_variance, beta_grad, gamma_grad,
+        output, workspace, coefficients, static_cast<int32_t>(n_items), params,
+        queue);
+  }
+}
+
+template <typename T, typename Index, bool IsFCHW>
+SNNStatus queue_fold_conv2d(BaseMemObject<T>& filter_mem,
+                            BaseMemObject<T>& bias_mem,
+                            BaseMemObject<T const>& beta_mem,
+                            BaseMemObject<T const>& gamma_mem,
+                            BaseMemObject<T const>& mean_mem,
+                            BaseMemObject<T const>& variance_mem,
+                            Index filter_size, Index features, T epsilon,
+                            cl::sycl::queue& queue) {
+  queue.submit([&](cl::sycl::handler& cgh) {
+    auto filter = filter_mem.read_write_accessor(cgh);
+    auto gamma = gamma_mem.read_accessor(cgh);
+    auto variance = variance_mem.read_accessor(cgh);
+    Index const filter_per_feature = filter_size / features;
+    size_t const n_threads =
+        helpers::round_up_to_nearest_multiple(filter_size, 64);
+    FoldFilterKernel<T, Index, IsFCHW> functor{
+        filter, gamma, variance, filter_size, features, filter_per_feature,
+        epsilon};
+    cgh.parallel_for(cl::sycl::range<1>{n_threads}, functor);
+  });
+
+  auto event = queue.submit([&](cl::sycl::handler& cgh) {
+    auto bias = bias_mem.read_write_accessor(cgh);
+    auto beta = beta_mem.read_accessor(cgh);
+    auto gamma = gamma_mem.read_accessor(cgh);
+    auto mean = mean_mem.read_accessor(cgh);
+    auto variance = variance_mem.read_accessor(cgh);
+    size_t const n_threads =
+        helpers::round_up_to_nearest_multiple(features, 64);
+    FoldBiasKernel<T, Index> functor{bias,     beta,     gamma,  mean,
+                                     variance, features, epsilon};
+    cgh.parallel_for(cl::sycl::range<1>{n_threads}, functor);
+  });
+  return {event, StatusCode::OK};
+}
+
+}  // namespace
+
+template <typename T>
+SNNStatus launch_batch_statistics(BaseMemObject<T const>& input,
+                                  BaseMemObject<T>& mean,
+                                  BaseMemObject<T>& variance,
+                                  StatMemObject<T>& workspace,
+                                  BatchNormParams const& params,
+                                  cl::sycl::queue& queue) {
+  // The previous statistics are not read, so the input is used as a
+  // placeholder.
+  return launch_statistics<T, false>(input, input, input, mean, variance,
+                                     workspace, params, queue);
+}
+
+template <typename T>
+SNNStatus launch_running_statistics(
+    BaseMemObject<T const>& input, BaseMemObject<T const>& prev_mean,
+    BaseMemObject<T const>& prev_variance, BaseMemObject<T>& running_mean,
+    BaseMemObject<T>& running_variance, StatMemObject<T>& workspace,
+    BatchNormParams const& params, cl::sycl::queue& queue) {
+  return launch_statistics<T, true>(input, prev_mean, prev_variance,
+                                    running_mean, running_variance, workspace,
+                                    params, queue);
+}
+
+template <typename T>
+SNNStatus launch_normalize(BaseMemObject<T const>& input,
+                           BaseMemObject<T const>& beta,
+                           BaseMemObject<T const>& gamma,
+                           BaseMemObject<T const>& mean,
+                           BaseMemObject<T const>& variance,
+                           BaseMemObject<T>& output,
+                           BatchNormParams const& params,
+                           cl::sycl::queue& queue) {
+  size_t const n_items = static_cast<size_t>(params.batch) * params.rows *
+                         params.cols * params.channels;
+  if (n_items > static_cast<size_t>(std::numeric_limits<int32_t>::max())) {
+#ifdef SNN_USE_INT64
+    return launch_normalize_with_index<T, int64_t>(
+        input, beta, gamma, mean, variance, output,
+        static_cast<int64_t>(n_items), params, queue);
+#else
+    return StatusCode::IndexExceeded;
+#endif  // SNN_USE_INT64
+  } else {
+    return launch_normalize_with_index<T, int32_t>(
+        input, beta, gamma, mean, variance, output,
+        static_cast<int32_t>(n_items), params, queue);
+  }
+}
+
+template <typename T>
+SNNStatus launch_batch_gradient(BaseMemObject<T const>& input,
+                                BaseMemObject<T const>& gradient,
+                                BaseMemObject<T const>& gamma,
+                                BaseMemObject<T>& beta_grad,
+                                BaseMemObject<T>& gamma_grad,
+                                BaseMemObject<T>& output,
+                                StatMemObject<T>& workspace,
+                                BaseMemObject<T>& coefficients,
+                                BatchNormParams const& params,
+                                cl::sycl::queue& queue) {
+  // The population statistics are not read, so gamma is used as a
+  // placeholder.
+  return launch_gradient_kernels<T, true>(input, gradient, gamma, gamma, gamma,
+                                          beta_grad, gamma_grad, output,
+                                          workspace, coefficients, params,
+                                          queue);
+}
+
+template <typename T>
+SNNStatus launch_frozen_gradient(
+    BaseMemObject<T const>& input, BaseMemObject<T const>& gradient,
+    BaseMemObject<T const>& gamma, BaseMemObject<T const>& pop_mean,
+    BaseMemObject<T const>& pop_variance, BaseMemObject<T>& beta_grad,
+    BaseMemObject<T>& gamma_grad, BaseMemObject<T>& output,
+    StatMemObject<T>& workspace, BaseMemObject<T>& coefficients,
+    BatchNormParams const& params, cl::sycl::queue& queue) {
+  return launch_gradient_kernels<T, false>(
+      input, gradient, gamma, pop_mean, pop_variance, beta_grad, gamma_grad,
+      output, workspace, coefficients, params, queue);
+}
+
+template <typename T>
+SNNStatus launch_fold_conv2d(BaseMemObject<T>& filter, BaseMemObject<T>& bias,
+                             BaseMemObject<T const>& beta,
+                             BaseMemObject<T const>& gamma,
+                             BaseMemObject<T const>& mean,
+                             BaseMemObject<T const>& variance,
+                             conv2d::Conv2DParams const& conv_params,
+                             BatchNormParams const& params,
+                             cl::sycl::queue& queue) {
+  // The filter is small compared to the tensors of a network, so a 32 bit
+  // index is always sufficient.
+  int32_t const features = conv_params.features;
+  int32_t const filter_size = conv_params.window_rows *
+                              conv_params.window_cols *
+                              (conv_params.channels / conv_params.groups) *
+                              features;
+  T const epsilon = static_cast<T>(params.epsilon);
+  if (conv_params.filter_format == FilterFormat::FCHW) {
+    return queue_fold_conv2d<T, int32_t, true>(filter, bias, beta, gamma,
+                                               mean, variance, filter_size,
+                                               features, epsilon, queue);
+  }
+  return queue_fold_conv2d<T, int32_t, false>(filter, bias, beta, gamma, mean,
+                                              variance, filter_size, features,
+                                              epsilon, queue);
+}
+
+#define INSTANTIATE_LAUNCHERS(DTYPE)                                          \
+  template SNN_EXPORT SNNStatus launch_batch_statistics<DTYPE>(               \
+      BaseMemObject<DTYPE const> & input, BaseMemObject<DTYPE> & mean,        \
+      BaseMemObject<DTYPE> & variance, StatMemObject<DTYPE> & workspace,      \
+      BatchNormParams const& params, cl::sycl::queue& queue);                 \
+  template SNN_EXPORT SNNStatus launch_running_statistics<DTYPE>(             \
+      BaseMemObject<DTYPE const> & input,                                     \
+      BaseMemObject<DTYPE const> & prev_mean,                                 \
+      BaseMemObject<DTYPE const> & prev_variance,                             \
+      BaseMemObject<DTYPE> & running_mean,                                    \
+      BaseMemObject<DTYPE> & running_variance,                                \
+      StatMemObject<DTYPE> & workspace, BatchNormParams const& params,        \
+      cl::sycl::queue& queue);                                                \
+  template SNN_EXPORT SNNStatus launch_normalize<DTYPE>(                      \
+      BaseMemObject<DTYPE const> & input, BaseMemObject<DTYPE const> & beta,  \
+      BaseMemObject<DTYPE const> & gamma, BaseMemObject<DTYPE const> & mean,  \
+      BaseMemObject<DTYPE const> & variance, BaseMemObject<DTYPE> & output,   \
+      BatchNormParams const& params, cl::sycl::queue& queue);                 \
+  template SNN_EXPORT SNNStatus launch_batch_gradient<DTYPE>(                 \
+      BaseMemObject<DTYPE const> & input,                                     \
+      BaseMemObject<DTYPE const> & gradient,                                  \
+      BaseMemObject<DTYPE const> & gamma, BaseMemObject<DTYPE> & beta_grad,   \
+      BaseMemObject<DTYPE> & gamma_grad, BaseMemObject<DTYPE> & output,       \
+      StatMemObject<DTYPE> & workspace, BaseMemObject<DTYPE> & coefficients,  \
+      BatchNormParams const& params, cl::sycl::queue& queue);                 \
+  template SNN_EXPORT SNNStatus launch_frozen_gradient<DTYPE>(                \
+      BaseMemObject<DTYPE const> & input,                                     \
+      BaseMemObject<DTYPE const> & gradient,                                  \
+      BaseMemObject<DTYPE const> & gamma,                                     \
+      BaseMemObject<DTYPE const> & pop_mean,                                  \
+      BaseMemObject<DTYPE const> & pop_variance,                              \
+      BaseMemObject<DTYPE> & beta_grad, BaseMemObject<DTYPE> & gamma_grad,    \
+      BaseMemObject<DTYPE> & output, StatMemObject<DTYPE> & workspace,        \
+      BaseMemObject<DTYPE> & coefficients, BatchNormParams const& params,     \
+      cl::sycl::queue& queue);                                                \
+  template SNN_EXPORT SNNStatus launch_fold_conv2d<DTYPE>(                    \
+      BaseMemObject<DTYPE> & filter, BaseMemObject<DTYPE> & bias,             \
+      BaseMemObject<DTYPE const> & beta, BaseMemObject<DTYPE const> & gamma,  \
+      BaseMemObject<DTYPE const> & mean,                                      \
+      BaseMemObject<DTYPE const> & variance,                                  \
+      conv2d::Conv2DParams const& conv_params, BatchNormParams const& params, \
+      cl::sycl::queue& queue)
+
+INSTANTIATE_LAUNCHERS(float);
+
+#ifdef SNN_USE_DOUBLE
+INSTANTIATE_LAUNCHERS(double);
+#endif  // SNN_USE_DOUBLE
+
+#ifdef SNN_USE_HALF
+INSTANTIATE_LAUNCHERS(cl::sycl::half);
+#endif  // SNN_USE_HALF
+
+#undef INSTANTIATE_LAUNCHERS
+
+}  // namespace internal
+}  // namespace batchnorm
+}  // namespace sycldnn
@@ -30,7 +30,8 @@ struct DirectConv2D<T, Index, conv_type::Forward, UseFastDiv, StaticWindow,
   using IndexDivType = typename fast_div::IndexDiv<Index, UseFastDiv>::type;
 
   DirectConv2D(const Conv2DParams& params, const ReadAccessor<const T> input,
-               const ReadAccessor<const T> filter, WriteAccessor<T> output)
+               const ReadAccessor<const T> filter, WriteAccessor<T> output,
+               Epilogue<T> const& epilogue)
       : n_elems_{params.batch * params.out_rows * params.out_cols *
                  params.features},
         div_features_{params.features},
@@ -38,6 +39,9 @@ struct DirectConv2D<T, Index, conv_type::Forward, UseFastDiv, StaticWindow,
         div_out_rows_{params.out_rows},
         channels_{params.channels},
         features_{params.features},
+        groups_{params.groups},
+        group_channels_{params.channels / params.groups},
+        group_features_{params.features / params.groups},
         batch_{params.batch},
         in_rows_{params.in_rows},
         in_cols_{params.in_cols},
@@ -45,13 +49,16 @@ struct DirectConv2D<T, Index, conv_type::Forward, UseFastDiv, StaticWindow,
         window_cols_{params.window_cols},
         stride_rows_{params.stride_rows},
         stride_cols_{params.stride_cols},
+        dilation_rows_{params.dilation_rows},
+        dilation_cols_{params.dilation_cols},
         out_rows_{params.out_rows},
         out_cols_{params.out_cols},
         pad_rows_{params.pad_rows},
         pad_cols_{params.pad_cols},
         input_accessor_{input},
         filter_accessor_{filter},
-        output_accessor_{output} {}
+        output_accessor_{output},
+        epilogue_{epilogue} {}
 
   inline SNN_ALWAYS_INLINE void operator()(cl::sycl::item<1> item) const {
     Index index = item.get_id(0);
@@ -87,24 +94,30 @@ struct DirectConv2D<T, Index, conv_type::Forward, UseFastDiv, StaticWindow,
 
       const Index row_window = static_window_param(window_rows_);
       const Index col_window = static_window_param(window_cols_);
+      // Each output feature only uses the input channels in its group.
+      const Index group = groups_ == 1 ? 0 : feature / group_features_;
       const auto input_data_n =
-          input_data + batch * channels_ * in_rows_ * in_cols_;
+          input_data +
+          (batch * channels_ + group * group_channels_) * in_rows_ * in_cols_;
       const auto filter_data_n =
-          filter_data + feature * channels_ * row_window * col_window;
+          filter_data + feature * group_channels_ * row_window * col_window;
 
       for (Index channel = 0, in_chan_idx = 0, fil_chan_idx = 0;
-           channel < channels_; ++channel, in_chan_idx += in_rows_ * in_cols_,
+           channel < group_channels_;
+           ++channel, in_chan_idx += in_rows_ * in_cols_,
                  fil_chan_idx += row_window * col_window) {
         Index in_row_idx = in_chan_idx + rstart * in_cols_;
         Index fil_row_idx = fil_chan_idx + firstr * col_window;
         for (Index r = rstart, i = firstr; i < row_window;
-             ++r, ++i, in_row_idx += in_cols_, fil_row_idx += col_window) {
+             r += dilation_rows_, ++i, in_row_idx += dilation_rows_ * in_cols_,
+                   fil_row_idx += col_window) {
           if (r >= 0 && r < in_rows_) {
             Index in_col_idx = in_row_idx + cstart;
             Index fil_col_idx = fil_row_idx + firstc;
 
             for (Index c = cstart, j = firstc; j < col_window;
-                 ++c, ++j, ++in_col_idx, ++fil_col_idx) {
+                 c += dilation_cols_, ++j, in_col_idx += dilation_cols_,
+                       ++fil_col_idx) {
               if (c >= 0 && c < in_cols_) {
                 T in_val = input_data_n[in_col_idx];
                 T fil_val = filter_data_n[fil_col_idx];
@@ -115,7 +128,7 @@ struct DirectConv2D<T, Index, conv_type::Forward, UseFastDiv, StaticWindow,
         }  // row loop
       }    // channel loop
 
-      output_data[index] = out_val;
+      output_data[index] = epilogue_.apply(out_val, feature);
     }
   }
 
@@ -137,6 +150,9 @@ struct DirectConv2D<T, Index, conv_type::Forward, UseFastDiv, StaticWindow,
   const IndexDivType div_out_rows_;
   const Index channels_;
   const Index features_;
+  const Index groups_;
+  const Index group_channels_;
+  const Index group_features_;
   const Index batch_;
   const Index in_rows_;
   const Index in_cols_;
@@ -144,6 +160,8 @@ struct DirectConv2D<T, Index, conv_type::Forward, UseFastDiv, StaticWindow,
   const Index window_cols_;
   const Index stride_rows_;
   const Index stride_cols_;
+  const Index dilation_rows_;
+  const Index dilation_cols_;
   const Index out_rows_;
   const Index out_cols_;
   const Index pad_rows_;
@@ -151,6 +169,7 @@ struct DirectConv2D<T, Index, conv_type::Forward, UseFastDiv, StaticWindow,
   const ReadAccessor<const T> input_accessor_;
   const ReadAccessor<const T> filter_accessor_;
   WriteAccessor<T> output_accessor_;
+  Epilogue<T> const epilogue_;
 };
 template <typename T, typename Index, bool UseFastDiv, int StaticWindow,
           int StaticStride>
@@ -168,6 +187,9 @@ struct DirectConv2D<T, Index, conv_type::InputBackprop, UseFastDiv,
         div_in_rows_{params.in_rows},
         channels_{params.channels},
         features_{params.features},
+        groups_{params.groups},
+        group_channels_{params.channels / params.groups},
+        group_features_{params.features / params.groups},
         batch_{params.batch},
         in_rows_{params.in_rows},
         in_cols_{params.in_cols},
@@ -175,12 +197,16 @@ struct DirectConv2D<T, Index, conv_type::InputBackprop, UseFastDiv,
         window_cols_{params.window_cols},
         stride_rows_{params.stride_rows},
         stride_cols_{params.stride_cols},
+        dilation_rows_{params.dilation_rows},
+        dilation_cols_{params.dilation_cols},
         out_rows_{params.out_rows},
         out_cols_{params.out_cols},
-        pad_rows_{static_window_param(params.window_rows) - params.pad_rows -
-                  1},
-        pad_cols_{static_window_param(params.window_cols) - params.pad_cols -
-                  1},
+        pad_rows_{(static_window_param(params.window_rows) - 1) *
+                      params.dilation_rows -
+                  params.pad_rows},
+        pad_cols_{(static_window_param(params.window_cols) - 1) *
+                      params.dilation_cols -
+                  params.pad_cols},
         input_accessor_{input},
         filter_accessor_{filter},
         output_accessor_{output} {}
@@ -219,16 +245,29 @@ struct DirectConv2D<T, Index, conv_type::InputBackprop, UseFastDiv,
 
       const Index row_window = static_window_param(window_rows_);
       const Index col_window = static_window_param(window_cols_);
+      // The kernel parameters swap the channels and features, so each output
+      // value only uses the channels in the group of its feature.
+      const Index group = groups_ == 1 ? 0 : feature / group_features_;
+      const Index group_feature = feature - group * group_features_;
       const auto input_data_n =
-          input_data + batch * channels_ * out_cols_ * out_rows_;
+          input_data + (batch * channels_ + group * group_channels_) *
+                           out_cols_ * out_rows_;
       const auto filter_data_n =
-          filter_data + feature * row_window * col_window;
+          filter_data +
+          (group * group_channels_ * group_features_ + group_feature) *
+              row_window * col_window;
+
+      if (dilation_rows_ != 1 || dilation_cols_ != 1) {
+        output_data[index] = dilated_input_backprop(
+            input_data_n, filter_data_n, row_idx, col_idx);
+        continue;
+      }
 
       Index in_chan_idx = 0;
       Index fil_chan_idx = 0;
-      for (Index channel = 0; channel < channels_; ++channel,
+      for (Index channel = 0; channel < group_channels_; ++channel,
                  in_chan_idx += out_cols_ * out_rows_,
-                 fil_chan_idx += features_ * row_window * col_window) {
+                 fil_chan_idx += group_features_ * row_window * col_window) {
         Index in_row_idx = in_chan_idx + rstart * out_cols_;
         Index fil_row_idx =
             fil_chan_idx + (row_window - firstr - 1) * col_window;
@@ -257,6 +296,58 @@ struct DirectConv2D<T, Index, conv_type::InputBackprop, UseFastDiv,
   }
 
  private:
+  /**
+   * Compute a single input backprop value for a dilated convolution.
+   *
+   * With dilation the filter values which contribute to an input are not
+   * evenly spaced by the stride, so each filter value is checked in turn.
+   */
+  template <typename InputPointer, typename FilterPointer>
+  inline SNN_ALWAYS_INLINE T dilated_input_backprop(
+      InputPointer input_data_n, FilterPointer filter_data_n,
+      Index const row_idx, Index const col_idx) const {
+    const Index row_stride = static_stride_param(stride_rows_);
+    const Index col_stride = static_stride_param(stride_cols_);
+    const Index row_window = static_window_param(window_rows_);
+    const Index col_window = static_window_param(window_cols_);
+    const Index padded_row = row_idx - pad_rows_;
+    const Index padded_col = col_idx - pad_cols_;
+
+    T out_val{0};
+    for (Index channel = 0, in_chan_idx = 0, fil_chan_idx = 0;
+         channel < group_channels_;
+         ++channel, in_chan_idx += out_cols_ * out_rows_,
+               fil_chan_idx += group_features_ * row_window * col_window) {
+      for (Index i = 0; i < row_window; ++i) {
+        const Index shifted_row = padded_row + i * dilation_rows_;
+        if (shifted_row < 0 || shifted_row % row_stride != 0) {
+          continue;
+        }
+        const Index r = shifted_row / row_stride;
+        if (r >= out_rows_) {
+          break;
+        }
+        const Index in_row_idx = in_chan_idx + r * out_cols_;
+        const Index fil_row_idx =
+            fil_chan_idx + (row_window - i - 1) * col_window;
+        for (Index j = 0; j < col_window; ++j) {
+          const Index shifted_col = padded_col + j * dilation_cols_;
+          if (shifted_col < 0 || shifted_col % col_stride != 0) {
+            continue;
+          }
+          const Index c = shifted_col / col_stride;
+          if (c >= out_cols_) {
+            break;
+          }
+          T in_val = input_data_n[in_row_idx + c];
+          T fil_val = filter_data_n[fil_row_idx + (col_window - j - 1)];
+          out_val = helpers::math::mad(in_val, fil_val, out_val);
+        }  // col loop
+      }    // row loop
+    }      // channel loop
+    return out_val;
+  }
+
   constexpr Index static_window_param(Index window) const {
     return (StaticWindow > 0 ? StaticWindow : window);
   }
@@ -270,6 +361,9 @@ struct DirectConv2D<T, Index, conv_type::InputBackprop, UseFastDiv,
   const IndexDivType div_in_rows_;
   const Index channels_;
   const Index features_;
+  const Index groups_;
+  const Index group_channels_;
+  const Index group_features_;
   const Index batch_;
   const Index in_rows_;
   const Index in_cols_;
@@ -277,6 +371,8 @@ struct DirectConv2D<T, Index, conv_type::InputBackprop, UseFastDiv,
   const Index window_cols_;
   const Index stride_rows_;
   const Index stride_cols_;
+  const Index dilation_rows_;
+  const Index dilation_cols_;
   const Index out_rows_;
   const Index out_cols_;
   const Index pad_rows_;
@@ -303,13 +399,16 @@ struct DirectConv2D<T, Index, conv_type::FilterBackprop, UseFastDiv, StaticOut,
 
   DirectConv2D(const Conv2DParams& params, const ReadAccessor<const T> input,
                const ReadAccessor<const T> filter, WriteAccessor<T> output)
-      : n_elems_{params.out_rows * params.out_cols * params.channels *
-                 params.features},
-        div_channels_{params.channels},
+      : n_elems_{params.out_rows * params.out_cols *
+                 (params.channels / params.groups) * params.features},
+        div_channels_{params.channels / params.groups},
         div_out_cols_{params.out_cols},
         div_out_rows_{params.out_rows},
         channels_{params.channels},
         features_{params.features},
+        groups_{params.groups},
+        group_channels_{params.channels / params.groups},
+        group_features_{params.features / params.groups},
         batch_{params.batch},
         in_rows_{params.in_rows},
         in_cols_{params.in_cols},
@@ -317,6 +416,8 @@ struct DirectConv2D<T, Index, conv_type::FilterBackprop, UseFastDiv, StaticOut,
         window_cols_{params.window_cols},
         stride_rows_{params.stride_rows},
         stride_cols_{params.stride_cols},
+        dilation_rows_{params.dilation_rows},
+        dilation_cols_{params.dilation_cols},
         out_rows_{params.out_rows},
         out_cols_{params.out_cols},
         pad_rows_{params.pad_rows},
@@ -338,16 +439,16 @@ struct DirectConv2D<T, Index, conv_type::FilterBackprop, UseFastDiv, StaticOut,
       const Index col_out = static_out_param(out_cols_);
       const auto tensor_idx =
           helpers::TensorIndexHelper<Index, UseFastDiv>::unflatten4d(
-              index, div_channels_, channels_, div_out_rows_, row_out,
+              index, div_channels_, group_channels_, div_out_rows_, row_out,
               div_out_cols_, col_out);
       const Index col_idx = tensor_idx.s3;
       const Index row_idx = tensor_idx.s2;
       const Index channel = tensor_idx.s1;
       const Index feature = tensor_idx.s0;
 
-      const Index cstart = col_idx - pad_cols_;
+      const Index cstart = col_idx * dilation_cols_ - pad_cols_;
       const Index cend = cstart + window_cols_;
-      const Index rstart = row_idx - pad_rows_;
+      const Index rstart = row_idx * dilation_rows_ - pad_rows_;
       const Index rend = rstart + window_rows_;
 
       const Index row_stride = static_stride_param(stride_rows_);
@@ -360,7 +461,11 @@ struct DirectConv2D<T, Index, conv_type::FilterBackprop, UseFastDiv, StaticOut,
 
       T out_val{0};
 
-      auto input_data_n = input_data + channel * in_rows_ * in_cols_;
+      // The filter only holds the channels in the group of each feature.
+      const Index group = groups_ == 1 ? 0 : feature / group_features_;
+      auto input_data_n =
+          input_data + (group * group_channels_ + channel) * in_rows_ *
+                           in_cols_;
       auto filter_data_n = filter_data + feature * filter_rows * filter_cols;
 
       for (Index b = 0; b < batch_; b++) {
@@ -406,6 +511,9 @@ struct DirectConv2D<T, Index, conv_type::FilterBackprop, UseFastDiv, StaticOut,
   const IndexDivType div_out_rows_;
   const Index channels_;
   const Index features_;
+  const Index groups_;
+  const Index group_channels_;
+  const Index group_features_;
   const Index batch_;
   const Index in_rows_;
   const Index in_cols_;
@@ -413,6 +521,8 @@ struct DirectConv2D<T, Index, conv_type::FilterBackprop, UseFastDiv, StaticOut,
   const Index window_cols_;
   const Index stride_rows_;
   const Index stride_cols_;
+  const Index dilation_rows_;
+  const Index dilation_cols_;
   const Index out_rows_;
   const Index out_cols_;
   const Index pad_rows_;
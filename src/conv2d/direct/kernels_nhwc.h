@@ -36,7 +36,8 @@ struct DirectConv2D<T, Index, conv_type::Forward, UseFastDiv, StaticWindow,
   using StoreData = helpers::io::Store<DataType>;
 
   DirectConv2D(const Conv2DParams& params, const ReadAccessor<const T> input,
-               const ReadAccessor<const T> filter, WriteAccessor<T> output)
+               const ReadAccessor<const T> filter, WriteAccessor<T> output,
+               Epilogue<T> const& epilogue)
       : n_elems_{params.batch * params.out_rows * params.out_cols *
                  params.features / VectorWidth},
         div_features_{params.features / VectorWidth},
@@ -44,6 +45,9 @@ struct DirectConv2D<T, Index, conv_type::Forward, UseFastDiv, StaticWindow,
         div_out_rows_{params.out_rows},
         channels_{params.channels},
         features_{params.features},
+        groups_{params.groups},
+        group_channels_{params.channels / params.groups},
+        group_features_{params.features / params.groups},
         batch_{params.batch},
         in_rows_{params.in_rows},
         in_cols_{params.in_cols},
@@ -51,17 +55,28 @@ struct DirectConv2D<T, Index, conv_type::Forward, UseFastDiv, StaticWindow,
         window_cols_{params.window_cols},
         stride_rows_{params.stride_rows},
         stride_cols_{params.stride_cols},
+        dilation_rows_{params.dilation_rows},
+        dilation_cols_{params.dilation_cols},
         out_rows_{params.out_rows},
         out_cols_{params.out_cols},
         pad_rows_{params.pad_rows},
         pad_cols_{params.pad_cols},
+        in_block_{get_pixel_channels(params.input_format, params.channels)},
+        out_block_{get_pixel_channels(params.input_format, params.features)},
         input_accessor_{input},
         filter_accessor_{filter},
-        output_accessor_{output} {}
-
+        output_accessor_{output},
+        epilogue_{epilogue} {}
+
+  /**
+   * The input and output can either be NHWC or channel blocked NCHWc, where
+   * NHWC is treated as a single block containing every channel. Channel ch of
+   * pixel (r, c) is then at (ch / B) * H * W * B + (r * W + c) * B + ch % B.
+   */
   inline SNN_ALWAYS_INLINE void operator()(cl::sycl::item<1> item) const {
     Index index = item.get_id(0);
     const Index range = item.get_range().get(0);
+    const Index in_block_stride = in_rows_ * in_cols_ * in_block_;
 
     for (; index < n_elems_; index += range) {
       const auto input_data = input_accessor_.get_pointer();
@@ -91,30 +106,45 @@ struct DirectConv2D<T, Index, conv_type::Forward, UseFastDiv, StaticWindow,
 
       DataType out_val{0};
 
+      // Each output feature only uses the input channels in its group.
+      const Index group = groups_ == 1 ? 0 : feature / group_features_;
+      const Index first_channel = group * group_channels_;
+      const Index first_block_channel = first_channel % in_block_;
       const auto input_data_n =
-          input_data + batch * in_cols_ * in_rows_ * channels_;
+          input_data + batch * in_cols_ * in_rows_ * channels_ +
+          (first_channel / in_block_) * in_block_stride + first_block_channel;
       const auto filter_data_n = filter_data + feature;
       const Index row_window = static_window_param(window_rows_);
       const Index col_window = static_window_param(window_cols_);
 
-      Index in_row_idx = rstart * in_cols_ * channels_;
-      Index fil_row_idx = firstr * col_window * channels_ * features_;
-      for (Index r = rstart, i = firstr; i < row_window; ++r, ++i,
-                 in_row_idx += in_cols_ * channels_,
-                 fil_row_idx += col_window * channels_ * features_) {
+      Index in_row_idx = rstart * in_cols_ * in_block_;
+      Index fil_row_idx = firstr * col_window * group_channels_ * features_;
+      for (Index r = rstart, i = firstr; i < row_window;
+           r += dilation_rows_, ++i,
+                 in_row_idx += dilation_rows_ * in_cols_ * in_block_,
+                 fil_row_idx += col_window * group_channels_ * features_) {
         if (r >= 0 && r < in_rows_) {
-          Index in_col_idx = in_row_idx + cstart * channels_;
-          Index fil_col_idx = fil_row_idx + firstc * channels_ * features_;
+          Index in_col_idx = in_row_idx + cstart * in_block_;
+          Index fil_col_idx =
+              fil_row_idx + firstc * group_channels_ * features_;
 
-          for (Index c = cstart, j = firstc; j < col_window; ++c, ++j,
-                     in_col_idx += channels_,
-                     fil_col_idx += channels_ * features_) {
+          for (Index c = cstart, j = firstc; j < col_window;
+               c += dilation_cols_, ++j,
+                     in_col_idx += dilation_cols_ * in_block_,
+                     fil_col_idx += group_channels_ * features_) {
             if (c >= 0 && c < in_cols_) {
               Index idx = in_col_idx;
               Index k_idx = fil_col_idx;
+              Index block_channel = first_block_channel;
 
-              for (Index channel = 0; channel < channels_;
+              for (Index channel = 0; channel < group_channels_;
                    ++channel, ++idx, k_idx += features_) {
+                if (block_channel == in_block_) {
+                  // Step over to the same pixel in the next channel block.
+                  block_channel = 0;
+                  idx += in_block_stride - in_block_;
+                }
+                ++block_channel;
                 DataType in_val = DataType{LoadScalar()(input_data_n, idx)};
                 DataType fil_vals = LoadData()(filter_data_n, k_idx);
 
@@ -125,7 +155,13 @@ struct DirectConv2D<T, Index, conv_type::Forward, UseFastDiv, StaticWindow,
         }
       }  // row loop
 
-      StoreData()(output_data, index * VectorWidth, out_val);
+      // The vector of features never crosses a block, as the vector width
+      // divides the block size.
+      const Index out_idx =
+          batch * out_rows_ * out_cols_ * features_ +
+          (feature / out_block_) * out_rows_ * out_cols_ * out_block_ +
+          (row_idx * out_cols_ + col_idx) * out_block_ + feature % out_block_;
+      StoreData()(output_data, out_idx, epilogue_.apply(out_val, feature));
     }
   }
 
@@ -147,6 +183,9 @@ struct DirectConv2D<T, Index, conv_type::Forward, UseFastDiv, StaticWindow,
   const IndexDivType div_out_rows_;
   const Index channels_;
   const Index features_;
+  const Index groups_;
+  const Index group_channels_;
+  const Index group_features_;
   const Index batch_;
   const Index in_rows_;
   const Index in_cols_;
@@ -154,13 +193,18 @@ struct DirectConv2D<T, Index, conv_type::Forward, UseFastDiv, StaticWindow,
   const Index window_cols_;
   const Index stride_rows_;
   const Index stride_cols_;
+  const Index dilation_rows_;
+  const Index dilation_cols_;
   const Index out_rows_;
   const Index out_cols_;
   const Index pad_rows_;
   const Index pad_cols_;
+  const Index in_block_;
+  const Index out_block_;
   const ReadAccessor<const T> input_accessor_;
   const ReadAccessor<const T> filter_accessor_;
   WriteAccessor<T> output_accessor_;
+  Epilogue<T> const epilogue_;
 };
 template <typename T, typename Index, bool UseFastDiv, int StaticWindow,
           int StaticStride, int VectorWidth>
@@ -185,6 +229,9 @@ struct DirectConv2D<T, Index, conv_type::InputBackprop, UseFastDiv,
         div_in_rows_{params.in_rows},
         channels_{params.channels},
         features_{params.features},
+        groups_{params.groups},
+        group_channels_{params.channels / params.groups},
+        group_features_{params.features / params.groups},
         batch_{params.batch},
         in_rows_{params.in_rows},
         in_cols_{params.in_cols},
@@ -192,12 +239,16 @@ struct DirectConv2D<T, Index, conv_type::InputBackprop, UseFastDiv,
         window_cols_{params.window_cols},
         stride_rows_{params.stride_rows},
         stride_cols_{params.stride_cols},
+        dilation_rows_{params.dilation_rows},
+        dilation_cols_{params.dilation_cols},
         out_rows_{params.out_rows},
         out_cols_{params.out_cols},
-        pad_rows_{static_window_param(params.window_rows) - params.pad_rows -
-                  1},
-        pad_cols_{static_window_param(params.window_cols) - params.pad_cols -
-                  1},
+        pad_rows_{(static_window_param(params.window_rows) - 1) *
+                      params.dilation_rows -
+                  params.pad_rows},
+        pad_cols_{(static_window_param(params.window_cols) - 1) *
+                      params.dilation_cols -
+                  params.pad_cols},
         input_accessor_{input},
         filter_accessor_{filter},
         output_accessor_{output} {}
@@ -234,32 +285,44 @@ struct DirectConv2D<T, Index, conv_type::InputBackprop, UseFastDiv,
 
       ScalarType out_val{0};
 
-      const auto input_data_n =
-          input_data + batch * out_cols_ * out_rows_ * channels_;
-      const auto filter_data_n = filter_data + feature * channels_;
+      // The kernel parameters swap the channels and features, so each output
+      // value only uses the channels in the group of its feature.
+      const Index group = groups_ == 1 ? 0 : feature / group_features_;
+      const Index group_feature = feature - group * group_features_;
+      const auto input_data_n = input_data +
+                                batch * out_cols_ * out_rows_ * channels_ +
+                                group * group_channels_;
+      const auto filter_data_n = filter_data + group_feature * channels_ +
+                                 group * group_channels_;
       const Index row_window = static_window_param(window_rows_);
       const Index col_window = static_window_param(window_cols_);
 
+      if (dilation_rows_ != 1 || dilation_cols_ != 1) {
+        out_val = dilated_input_backprop(input_data_n, filter_data_n, row_idx,
+                                         col_idx);
+        StoreScalar()(output_data, index, out_val);
+        continue;
+      }
+
       Index in_row_idx = rstart * out_cols_ * channels_;
-      Index fil_row_idx =
-          (row_window - firstr - 1) * col_window * features_ * channels_;
+      Index const fil_tap_size = group_features_ * channels_;
+      Index fil_row_idx = (row_window - firstr - 1) * col_window * fil_tap_size;
       for (Index r = rstart, i = firstr; i < row_window; ++r, i += row_stride,
                  in_row_idx += out_cols_ * channels_,
-                 fil_row_idx -= row_stride * col_window * features_ *
-                                                         channels_) {
+                 fil_row_idx -= row_stride * col_window * fil_tap_size) {
         if (r >= 0 && r < out_rows_) {
           Index in_col_idx = in_row_idx + cstart * channels_;
           Index fil_col_idx =
-              fil_row_idx + (col_window - firstc - 1) * features_ * channels_;
+              fil_row_idx + (col_window - firstc - 1) * fil_tap_size;
 
           for (Index c = cstart, j = firstc; j < col_window; ++c,
                      j += col_stride, in_col_idx += channels_,
-                     fil_col_idx -= col_stride * features_ * channels_) {
+                     fil_col_idx -= col_stride * fil_tap_size) {
             if (c >= 0 && c < out_cols_) {
               Index idx = in_col_idx;
               Index k_idx = fil_col_idx;
 
-              for (Index channel = 0; channel < channels_;
+              for (Index channel = 0; channel < group_channels_;
                    channel += VectorWidth, idx += VectorWidth,
                          k_idx += VectorWidth) {
                 DataType in_val = LoadData()(input_data_n, idx);
@@ -277,6 +340,62 @@ struct DirectConv2D<T, Index, conv_type::InputBackprop, UseFastDiv,
   }
 
  private:
+  /**
+   * Compute a single input backprop value for a dilated convolution.
+   *
+   * With dilation the filter values which contribute to an input are not
+   * evenly spaced by the stride, so each filter value is checked in turn.
+   */
+  template <typename InputPointer, typename FilterPointer>
+  inline SNN_ALWAYS_INLINE ScalarType dilated_input_backprop(
+      InputPointer input_data_n, FilterPointer filter_data_n,
+      Index const row_idx, Index const col_idx) const {
+    const Index row_stride = static_stride_param(stride_rows_);
+    const Index col_stride = static_stride_param(stride_cols_);
+    const Index row_window = static_window_param(window_rows_);
+    const Index col_window = static_window_param(window_cols_);
+    const Index padded_row = row_idx - pad_rows_;
+    const Index padded_col = col_idx - pad_cols_;
+
+    ScalarType out_val{0};
+    for (Index i = 0; i < row_window; ++i) {
+      const Index shifted_row = padded_row + i * dilation_rows_;
+      if (shifted_row < 0 || shifted_row % row_stride != 0) {
+        continue;
+      }
+      const Index r = shifted_row / row_stride;
+      if (r >= out_rows_) {
+        break;
+      }
+      const Index in_row_idx = r * out_cols_ * channels_;
+      const Index fil_row_idx =
+          (row_window - i - 1) * col_window * group_features_ * channels_;
+      for (Index j = 0; j < col_window; ++j) {
+        const Index shifted_col = padded_col + j * dilation_cols_;
+        if (shifted_col < 0 || shifted_col % col_stride != 0) {
+          continue;
+        }
+        const Index c = shifted_col / col_stride;
+        if (c >= out_cols_) {
+          break;
+        }
+        Index idx = in_row_idx + c * channels_;
+        Index k_idx =
+            fil_row_idx + (col_window - j - 1) * group_features_ * channels_;
+
+        for (Index channel = 0; channel < group_channels_;
+             channel += VectorWidth, idx += VectorWidth,
+                   k_idx += VectorWidth) {
+          DataType in_val = LoadData()(input_data_n, idx);
+          DataType fil_val = LoadData()(filter_data_n, k_idx);
+
+          out_val += helpers::math::dot(in_val, fil_val);
+        }  // channel loop
+      }    // col loop
+    }      // row loop
+    return out_val;
+  }
+
   constexpr Index static_window_param(Index window) const {
     return (StaticWindow > 0 ? StaticWindow : window);
   }
@@ -290,6 +409,9 @@ struct DirectConv2D<T, Index, conv_type::InputBackprop, UseFastDiv,
   const IndexDivType div_in_rows_;
   const Index channels_;
   const Index features_;
+  const Index groups_;
+  const Index group_channels_;
+  const Index group_features_;
   const Index batch_;
   const Index in_rows_;
   const Index in_cols_;
@@ -297,6 +419,8 @@ struct DirectConv2D<T, Index, conv_type::InputBackprop, UseFastDiv,
   const Index window_cols_;
   const Index stride_rows_;
   const Index stride_cols_;
+  const Index dilation_rows_;
+  const Index dilation_cols_;
   const Index out_rows_;
   const Index out_cols_;
   const Index pad_rows_;
@@ -330,13 +454,17 @@ struct DirectConv2D<T, Index, conv_type::FilterBackprop, UseFastDiv, StaticOut,
 
   DirectConv2D(const Conv2DParams& params, const ReadAccessor<const T> input,
                const ReadAccessor<const T> filter, WriteAccessor<T> output)
-      : n_elems_{params.out_rows * params.out_cols * params.channels *
-                 params.features / VectorWidth},
+      : n_elems_{params.out_rows * params.out_cols *
+                 (params.channels / params.groups) * params.features /
+                 VectorWidth},
         div_features_{params.features / VectorWidth},
-        div_channels_{params.channels},
+        div_channels_{params.channels / params.groups},
         div_out_cols_{params.out_cols},
         channels_{params.channels},
         features_{params.features},
+        groups_{params.groups},
+        group_channels_{params.channels / params.groups},
+        group_features_{params.features / params.groups},
         batch_{params.batch},
         in_rows_{params.in_rows},
         in_cols_{params.in_cols},
@@ -344,6 +472,8 @@ struct DirectConv2D<T, Index, conv_type::FilterBackprop, UseFastDiv, StaticOut,
         window_cols_{params.window_cols},
         stride_rows_{params.stride_rows},
         stride_cols_{params.stride_cols},
+        dilation_rows_{params.dilation_rows},
+        dilation_cols_{params.dilation_cols},
         out_rows_{params.out_rows},
         out_cols_{params.out_cols},
         pad_rows_{params.pad_rows},
@@ -364,16 +494,16 @@ struct DirectConv2D<T, Index, conv_type::FilterBackprop, UseFastDiv, StaticOut,
       const Index col_out = static_out_param(out_cols_);
       const auto tensor_idx =
           helpers::TensorIndexHelper<Index, UseFastDiv>::unflatten4d(
-              index, div_out_cols_, col_out, div_channels_, channels_,
+              index, div_out_cols_, col_out, div_channels_, group_channels_,
               div_features_, features_ / VectorWidth);
       const Index feature = tensor_idx.s3 * VectorWidth;
       const Index channel = tensor_idx.s2;
       const Index col_idx = tensor_idx.s1;
       const Index row_idx = tensor_idx.s0;
 
-      const Index cstart = col_idx - pad_cols_;
+      const Index cstart = col_idx * dilation_cols_ - pad_cols_;
       const Index cend = cstart + window_cols_;
-      const Index rstart = row_idx - pad_rows_;
+      const Index rstart = row_idx * dilation_rows_ - pad_rows_;
       const Index rend = rstart + window_rows_;
 
       const Index row_stride = static_stride_param(stride_rows_);
@@ -386,7 +516,9 @@ struct DirectConv2D<T, Index, conv_type::FilterBackprop, UseFastDiv, StaticOut,
 
       DataType out_val{0};
 
-      auto input_data_n = input_data + channel;
+      // The filter only holds the channels in the group of each feature.
+      const Index group = groups_ == 1 ? 0 : feature / group_features_;
+      auto input_data_n = input_data + group * group_channels_ + channel;
       auto filter_data_n = filter_data + feature;
 
       for (Index b = 0; b < batch_; b++) {
@@ -432,6 +564,9 @@ struct DirectConv2D<T, Index, conv_type::FilterBackprop, UseFastDiv, StaticOut,
   const IndexDivType div_out_cols_;
   const Index channels_;
   const Index features_;
+  const Index groups_;
+  const Index group_channels_;
+  const Index group_features_;
   const Index batch_;
   const Index in_rows_;
   const Index in_cols_;
@@ -439,6 +574,8 @@ struct DirectConv2D<T, Index, conv_type::FilterBackprop, UseFastDiv, StaticOut,
   const Index window_cols_;
   const Index stride_rows_;
   const Index stride_cols_;
+  const Index dilation_rows_;
+  const Index dilation_cols_;
   const Index out_rows_;
   const Index out_cols_;
   const Index pad_rows_;
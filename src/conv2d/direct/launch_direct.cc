@@ -20,6 +20,7 @@
 #include "sycldnn/status.h"
 
 #include "sycldnn/conv2d/conv_type.h"
+#include "sycldnn/conv2d/epilogue.h"
 
 #include "sycldnn/conv2d/params.h"
 #include "sycldnn/conv2d/sizes.h"
@@ -32,6 +33,7 @@
 #include <stddef.h>
 #include <cstdint>
 #include <limits>
+#include <type_traits>
 
 #include "sycldnn/export.h"
 
@@ -57,8 +59,8 @@ inline bool can_use_fast_div<conv_type::InputBackprop>(
 template <>
 inline bool can_use_fast_div<conv_type::FilterBackprop>(
     Conv2DParams const& params, int vec_width) {
-  return (params.features / vec_width) != 1 && params.channels != 1 &&
-         params.out_cols != 1;
+  return (params.features / vec_width) != 1 &&
+         (params.channels / params.groups) != 1 && params.out_cols != 1;
 }
 /**
  * Check whether the provided window and stride can be used with the given
@@ -74,14 +76,36 @@ inline bool can_use_static_conv(Conv2DParams const& params, int const window,
 /**
  * Check whether a given vector width can be used for the given convolution.
  *
+ * The vectors are loaded along the feature dimension, so must not cross the
+ * boundary between two groups of features, or between two blocks of features
+ * in a channel blocked output.
+ *
  * Expects the convolution parameters to be the original parameters, not the
  * kernel parameters.
  * */
 template <typename ConvType>
 inline bool can_use_vector_width(Conv2DParams const& params, int const width) {
-  return params.input_format == DataFormat::NHWC &&
+  int const feature_block =
+      get_pixel_channels(params.input_format, params.features);
+  return (params.input_format == DataFormat::NHWC ||
+          is_channel_blocked(params.input_format)) &&
          params.filter_format == FilterFormat::HWCF &&
-         params.features % width == 0;
+         (params.features / params.groups) % width == 0 &&
+         feature_block % width == 0;
+}
+
+/**
+ * Check whether the NHWC kernels can be used for the convolution. The forward
+ * kernel also indexes the channel blocked formats natively.
+ */
+template <typename ConvType>
+inline bool can_use_nhwc_kernel(Conv2DParams const& params) {
+  if (params.filter_format != FilterFormat::HWCF) {
+    return false;
+  }
+  return params.input_format == DataFormat::NHWC ||
+         (std::is_same<ConvType, conv_type::Forward>::value &&
+          is_channel_blocked(params.input_format));
 }
 
 /**
@@ -91,7 +115,8 @@ template <typename T, typename Index, typename ConvType, bool UseFastDiv,
           int Window, int Stride, int VectorWidth, typename Layout>
 struct queue_kernel_helper {
   SNNStatus operator()(BaseMemObject<T const>&, BaseMemObject<T const>&,
-                       BaseMemObject<T>&, Conv2DParams const&, Index,
+                       BaseMemObject<T const>&, BaseMemObject<T>&,
+                       Conv2DParams const&, EpilogueParams const&, Index,
                        cl::sycl::queue&) {
     return StatusCode::InvalidAlgorithm;
   }
@@ -102,12 +127,14 @@ template <typename T, typename Index, typename ConvType, bool UseFastDiv,
 struct queue_kernel_helper<T, Index, ConvType, UseFastDiv, Window, Stride,
                            VectorWidth, layout::NHWC> {
   SNNStatus operator()(BaseMemObject<T const>& input,
-                       BaseMemObject<T const>& filter, BaseMemObject<T>& output,
-                       Conv2DParams const& params, Index output_size,
+                       BaseMemObject<T const>& filter,
+                       BaseMemObject<T const>& bias, BaseMemObject<T>& output,
+                       Conv2DParams const& params,
+                       EpilogueParams const& epilogue, Index output_size,
                        cl::sycl::queue& queue) {
     return queue_direct_kernel<T, Index, ConvType, UseFastDiv, Window, Stride,
                                VectorWidth, layout::NHWC>(
-        input, filter, output, params, output_size, queue);
+        input, filter, bias, output, params, epilogue, output_size, queue);
   }
 };
 
@@ -117,12 +144,14 @@ template <typename T, typename Index, typename ConvType, bool UseFastDiv,
 struct queue_kernel_helper<T, Index, ConvType, UseFastDiv, Window, Stride, 1,
                            layout::NCHW> {
   SNNStatus operator()(BaseMemObject<T const>& input,
-                       BaseMemObject<T const>& filter, BaseMemObject<T>& output,
-                       Conv2DParams const& params, Index output_size,
+                       BaseMemObject<T const>& filter,
+                       BaseMemObject<T const>& bias, BaseMemObject<T>& output,
+                       Conv2DParams const& params,
+                       EpilogueParams const& epilogue, Index output_size,
                        cl::sycl::queue& queue) {
     return queue_direct_kernel<T, Index, ConvType, UseFastDiv, Window, Stride,
                                /*VectorWidth=*/1, layout::NCHW>(
-        input, filter, output, params, output_size, queue);
+        input, filter, bias, output, params, epilogue, output_size, queue);
   }
 };
 #endif
@@ -131,19 +160,20 @@ template <typename T, typename Index, typename ConvType, bool UseFastDiv,
           int Window, int Stride, int VectorWidth>
 SNNStatus launch_with_fast_div(BaseMemObject<T const>& input,
                                BaseMemObject<T const>& filter,
+                               BaseMemObject<T const>& bias,
                                BaseMemObject<T>& output,
-                               Conv2DParams const& params, Index output_size,
-                               cl::sycl::queue& queue) {
+                               Conv2DParams const& params,
+                               EpilogueParams const& epilogue,
+                               Index output_size, cl::sycl::queue& queue) {
   if (params.input_format == DataFormat::NCHW &&
       params.filter_format == FilterFormat::FCHW) {
     return queue_kernel_helper<T, Index, ConvType, UseFastDiv, Window, Stride,
                                VectorWidth, layout::NCHW>()(
-        input, filter, output, params, output_size, queue);
-  } else if (params.input_format == DataFormat::NHWC &&
-             params.filter_format == FilterFormat::HWCF) {
+        input, filter, bias, output, params, epilogue, output_size, queue);
+  } else if (can_use_nhwc_kernel<ConvType>(params)) {
     return queue_kernel_helper<T, Index, ConvType, UseFastDiv, Window, Stride,
                                VectorWidth, layout::NHWC>()(
-        input, filter, output, params, output_size, queue);
+        input, filter, bias, output, params, epilogue, output_size, queue);
   }
   return StatusCode::InvalidAlgorithm;
 }
@@ -156,18 +186,22 @@ template <typename T, typename Index, typename ConvType, int Window, int Stride,
           int VectorWidth>
 SNNStatus launch_with_vector(BaseMemObject<T const>& input,
                              BaseMemObject<T const>& filter,
+                             BaseMemObject<T const>& bias,
                              BaseMemObject<T>& output,
-                             Conv2DParams const& params, Index output_size,
+                             Conv2DParams const& params,
+                             EpilogueParams const& epilogue, Index output_size,
                              cl::sycl::queue& queue) {
   auto kernel_params = direct::get_kernel_params<ConvType>(params);
   if (can_use_fast_div<ConvType>(kernel_params, VectorWidth)) {
     return launch_with_fast_div<T, Index, ConvType, true, Window, Stride,
-                                VectorWidth>(input, filter, output,
-                                             kernel_params, output_size, queue);
+                                VectorWidth>(input, filter, bias, output,
+                                             kernel_params, epilogue,
+                                             output_size, queue);
   } else {
     return launch_with_fast_div<T, Index, ConvType, false, Window, Stride,
-                                VectorWidth>(input, filter, output,
-                                             kernel_params, output_size, queue);
+                                VectorWidth>(input, filter, bias, output,
+                                             kernel_params, epilogue,
+                                             output_size, queue);
   }
 }
 
@@ -178,18 +212,20 @@ SNNStatus launch_with_vector(BaseMemObject<T const>& input,
 template <typename T, typename Index, typename ConvType, int Window, int Stride>
 SNNStatus launch_with_index(BaseMemObject<T const>& input,
                             BaseMemObject<T const>& filter,
+                            BaseMemObject<T const>& bias,
                             BaseMemObject<T>& output,
-                            Conv2DParams const& params, Index output_size,
+                            Conv2DParams const& params,
+                            EpilogueParams const& epilogue, Index output_size,
                             cl::sycl::queue& queue) {
   if (can_use_vector_width<ConvType>(params, 4)) {
     return launch_with_vector<T, Index, ConvType, Window, Stride, 4>(
-        input, filter, output, params, output_size, queue);
+        input, filter, bias, output, params, epilogue, output_size, queue);
   } else if (can_use_vector_width<ConvType>(params, 2)) {
     return launch_with_vector<T, Index, ConvType, Window, Stride, 2>(
-        input, filter, output, params, output_size, queue);
+        input, filter, bias, output, params, epilogue, output_size, queue);
   } else {
     return launch_with_vector<T, Index, ConvType, Window, Stride, 1>(
-        input, filter, output, params, output_size, queue);
+        input, filter, bias, output, params, epilogue, output_size, queue);
   }
 }
 
@@ -200,23 +236,25 @@ SNNStatus launch_with_index(BaseMemObject<T const>& input,
 template <typename T, typename ConvType, int Window, int Stride>
 SNNStatus launch_with_static_sizes(BaseMemObject<T const>& input,
                                    BaseMemObject<T const>& filter,
+                                   BaseMemObject<T const>& bias,
                                    BaseMemObject<T>& output,
                                    Conv2DParams const& params,
+                                   EpilogueParams const& epilogue,
                                    cl::sycl::queue& queue) {
   auto conv_sizes = get_sizes<ConvType>(params);
   size_t output_size = conv_sizes.output_size;
   if (output_size > static_cast<size_t>(std::numeric_limits<int32_t>::max())) {
 #ifdef SNN_USE_INT64
     return launch_with_index<T, int64_t, ConvType, Window, Stride>(
-        input, filter, output, params, static_cast<int64_t>(output_size),
-        queue);
+        input, filter, bias, output, params, epilogue,
+        static_cast<int64_t>(output_size), queue);
 #else
     return StatusCode::IndexExceeded;
 #endif  // SNN_USE_INT64
   } else {
     return launch_with_index<T, int32_t, ConvType, Window, Stride>(
-        input, filter, output, params, static_cast<int32_t>(output_size),
-        queue);
+        input, filter, bias, output, params, epilogue,
+        static_cast<int32_t>(output_size), queue);
   }
 }
 }  // namespace
@@ -228,36 +266,56 @@ SNNStatus launch_with_static_sizes(BaseMemObject<T const>& input,
 template <typename T, typename ConvType>
 SNNStatus launch_direct(BaseMemObject<T const>& input,
                         BaseMemObject<T const>& filter,
+                        BaseMemObject<T const>& bias,
                         BaseMemObject<T>& output, Conv2DParams const& params,
+                        EpilogueParams const& epilogue,
                         cl::sycl::queue& queue) {
 #ifdef SNN_CONV2D_STATIC_DIRECT
   if (can_use_static_conv<ConvType>(params, 1, 1)) {
-    return launch_with_static_sizes<T, ConvType, 1, 1>(input, filter, output,
-                                                       params, queue);
+    return launch_with_static_sizes<T, ConvType, 1, 1>(
+        input, filter, bias, output, params, epilogue, queue);
   } else if (can_use_static_conv<ConvType>(params, 3, 1)) {
-    return launch_with_static_sizes<T, ConvType, 3, 1>(input, filter, output,
-                                                       params, queue);
+    return launch_with_static_sizes<T, ConvType, 3, 1>(
+        input, filter, bias, output, params, epilogue, queue);
   } else if (can_use_static_conv<ConvType>(params, 3, 2)) {
-    return launch_with_static_sizes<T, ConvType, 3, 2>(input, filter, output,
-                                                       params, queue);
+    return launch_with_static_sizes<T, ConvType, 3, 2>(
+        input, filter, bias, output, params, epilogue, queue);
   } else if (can_use_static_conv<ConvType>(params, 5, 1)) {
-    return launch_with_static_sizes<T, ConvType, 5, 1>(input, filter, output,
-                                                       params, queue);
+    return launch_with_static_sizes<T, ConvType, 5, 1>(
+        input, filter, bias, output, params, epilogue, queue);
   } else if (can_use_static_conv<ConvType>(params, 5, 2)) {
-    return launch_with_static_sizes<T, ConvType, 5, 2>(input, filter, output,
-                                                       params, queue);
+    return launch_with_static_sizes<T, ConvType, 5, 2>(
+        input, filter, bias, output, params, epilogue, queue);
   } else
 #endif  // SNN_CONV2D_STATIC_DIRECT
   {
-    return launch_with_static_sizes<T, ConvType, 0, 0>(input, filter, output,
-                                                       params, queue);
+    return launch_with_static_sizes<T, ConvType, 0, 0>(
+        input, filter, bias, output, params, epilogue, queue);
   }
 }
 
+/**
+ * Launch a direct convolution without an epilogue. The filter is passed in
+ * place of the bias tensor, but is never read as a bias.
+ */
+template <typename T, typename ConvType>
+SNNStatus launch_direct(BaseMemObject<T const>& input,
+                        BaseMemObject<T const>& filter,
+                        BaseMemObject<T>& output, Conv2DParams const& params,
+                        cl::sycl::queue& queue) {
+  return launch_direct<T, ConvType>(input, filter, filter, output, params,
+                                    EpilogueParams{}, queue);
+}
+
 #define INSTANTIATE_LAUNCHER(DTYPE, DIR)                                       \
   template SNN_EXPORT SNNStatus launch_direct<DTYPE, DIR>(                     \
       BaseMemObject<DTYPE const> & input, BaseMemObject<DTYPE const> & filter, \
       BaseMemObject<DTYPE> & output, Conv2DParams const& params,               \
+      cl::sycl::queue& queue);                                                 \
+  template SNN_EXPORT SNNStatus launch_direct<DTYPE, DIR>(                     \
+      BaseMemObject<DTYPE const> & input, BaseMemObject<DTYPE const> & filter, \
+      BaseMemObject<DTYPE const> & bias, BaseMemObject<DTYPE> & output,        \
+      Conv2DParams const& params, EpilogueParams const& epilogue,              \
       cl::sycl::queue& queue)
 
 #define INSTANTIATE_FOR_TYPE(DTYPE)                      \
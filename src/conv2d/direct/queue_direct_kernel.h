@@ -19,6 +19,7 @@
 #include "sycldnn/mem_object.h"
 #include "sycldnn/status.h"
 
+#include "sycldnn/conv2d/epilogue.h"
 #include "sycldnn/conv2d/params.h"
 
 namespace sycldnn {
@@ -26,13 +27,17 @@ namespace conv2d {
 namespace internal {
 /**
  * Queue a direct convolution kernel to the provided SYCL queue.
+ *
+ * The epilogue is only applied by forward convolutions.
  */
 template <typename T, typename Index, typename ConvType, bool UseFastDiv,
           int Window, int Stride, int VectorWidth, typename Layout>
 SNNStatus queue_direct_kernel(BaseMemObject<T const>& input,
                               BaseMemObject<T const>& filter,
+                              BaseMemObject<T const>& bias,
                               BaseMemObject<T>& output,
                               Conv2DParams const& kernel_params,
+                              EpilogueParams const& epilogue,
                               Index output_size, cl::sycl::queue& queue);
 }  // namespace internal
 }  // namespace conv2d
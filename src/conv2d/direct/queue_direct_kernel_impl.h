@@ -21,6 +21,8 @@
 #include "sycldnn/helpers/minmax.h"
 #include "sycldnn/helpers/ratio.h"
 
+#include "src/conv2d/epilogue/epilogue.h"
+
 #include "src/conv2d/direct/kernels_nchw.h"
 #include "src/conv2d/direct/kernels_nhwc.h"
 #include "src/conv2d/direct/queue_direct_kernel.h"
@@ -38,12 +40,34 @@ Index calculate_required_threads(Index output_size) {
   }
 }
 
+/** Construct a forward convolution functor, which applies the epilogue. */
+template <typename Functor, typename T>
+Functor make_direct_functor(conv_type::Forward, Conv2DParams const& params,
+                            ReadAccessor<T const> input,
+                            ReadAccessor<T const> filter,
+                            WriteAccessor<T> output,
+                            Epilogue<T> const& epilogue) {
+  return Functor{params, input, filter, output, epilogue};
+}
+
+/** Construct a backprop convolution functor, which has no epilogue. */
+template <typename Functor, typename ConvType, typename T>
+Functor make_direct_functor(ConvType, Conv2DParams const& params,
+                            ReadAccessor<T const> input,
+                            ReadAccessor<T const> filter,
+                            WriteAccessor<T> output,
+                            Epilogue<T> const& /*epilogue*/) {
+  return Functor{params, input, filter, output};
+}
+
 template <typename T, typename Index, typename ConvType, bool UseFastDiv,
           int Window, int Stride, int VectorWidth, typename Layout>
 SNNStatus queue_direct_kernel(BaseMemObject<T const>& in_mem,
                               BaseMemObject<T const>& fil_mem,
+                              BaseMemObject<T const>& bias_mem,
                               BaseMemObject<T>& out_mem,
                               Conv2DParams const& kernel_params,
+                              EpilogueParams const& epilogue,
                               Index output_size, cl::sycl::queue& queue) {
   using Functor = direct::DirectConv2D<T, Index, ConvType, UseFastDiv, Window,
                                        Stride, VectorWidth, Layout>;
@@ -58,9 +82,12 @@ SNNStatus queue_direct_kernel(BaseMemObject<T const>& in_mem,
   auto event = queue.submit([&](cl::sycl::handler& cgh) {
     auto input = in_mem.read_accessor(cgh);
     auto filter = fil_mem.read_accessor(cgh);
+    auto bias = bias_mem.read_accessor(cgh);
     auto output = out_mem.write_accessor(cgh);
 
-    Functor conv{kernel_params, input, filter, output};
+    auto conv = make_direct_functor<Functor>(ConvType{}, kernel_params, input,
+                                             filter, output,
+                                             Epilogue<T>{epilogue, bias});
 
     cgh.parallel_for(cl::sycl::range<1>{n_threads}, conv);
   });
@@ -0,0 +1,102 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef SYCLDNN_SRC_CONV2D_EPILOGUE_EPILOGUE_H_
+#define SYCLDNN_SRC_CONV2D_EPILOGUE_EPILOGUE_H_
+
+#include "sycldnn/accessor_types.h"
+
+#include "sycldnn/conv2d/epilogue.h"
+
+#include "sycldnn/helpers/macros.h"
+
+#include "src/helpers/vector_io.h"
+
+#include <CL/sycl.hpp>
+
+namespace sycldnn {
+namespace conv2d {
+namespace internal {
+
+/**
+ * Device side helper to apply a bias add and activation to convolution output
+ * values before they are stored.
+ *
+ * When no bias is required the accessor is still bound, usually to one of the
+ * convolution's other buffers, but is never read.
+ */
+template <typename T>
+struct Epilogue {
+  /**
+   * Construct the epilogue from the user provided parameters and an accessor
+   * to the bias tensor.
+   */
+  Epilogue(EpilogueParams const& params, ReadAccessor<T const> bias)
+      : add_bias_{params.bias},
+        activation_{params.activation},
+        clamp_min_{static_cast<T>(params.clamp_min)},
+        clamp_max_{static_cast<T>(params.clamp_max)},
+        bias_accessor_{std::move(bias)} {}
+
+  /**
+   * Load the bias for a value, which may be a vector of consecutive features
+   * starting at the given feature index. If the epilogue does not add a bias
+   * then this returns zero.
+   */
+  template <typename DataType, typename Index>
+  DataType SNN_ALWAYS_INLINE load_bias(Index feature) const {
+    if (add_bias_) {
+      auto bias_data = bias_accessor_.get_pointer();
+      return helpers::io::Load<DataType>()(bias_data, feature);
+    }
+    return DataType{0};
+  }
+
+  /** Apply the activation to a value which already includes the bias. */
+  template <typename DataType>
+  DataType SNN_ALWAYS_INLINE activate(DataType value) const {
+    switch (activation_) {
+      case Activation::Relu:
+        return cl::sycl::max(value, DataType{0});
+      case Activation::Clamp:
+        return cl::sycl::clamp(value, DataType{clamp_min_},
+                               DataType{clamp_max_});
+      case Activation::None:
+      default:
+        return value;
+    }
+  }
+
+  /**
+   * Apply the bias and activation to a value, which may be a vector of
+   * consecutive features starting at the given feature index.
+   */
+  template <typename DataType, typename Index>
+  DataType SNN_ALWAYS_INLINE apply(DataType value, Index feature) const {
+    return activate(value + load_bias<DataType>(feature));
+  }
+
+ private:
+  bool const add_bias_;
+  Activation const activation_;
+  T const clamp_min_;
+  T const clamp_max_;
+  ReadAccessor<T const> bias_accessor_;
+};
+
+}  // namespace internal
+}  // namespace conv2d
+}  // namespace sycldnn
+#endif  // SYCLDNN_SRC_CONV2D_EPILOGUE_EPILOGUE_H_
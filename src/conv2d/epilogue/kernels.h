@@ -0,0 +1,79 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef SYCLDNN_SRC_CONV2D_EPILOGUE_KERNELS_H_
+#define SYCLDNN_SRC_CONV2D_EPILOGUE_KERNELS_H_
+
+#include "sycldnn/accessor_types.h"
+
+#include "sycldnn/helpers/macros.h"
+
+#include "src/conv2d/epilogue/epilogue.h"
+
+#include "src/helpers/vector_io.h"
+#include "src/helpers/vector_type.h"
+
+#include <CL/sycl.hpp>
+
+namespace sycldnn {
+namespace conv2d {
+namespace internal {
+
+/**
+ * Apply an epilogue in place to an NHWC convolution output.
+ *
+ * Used for the convolution algorithms which compute the output with a matrix
+ * multiply provided by the backend, so cannot apply the epilogue as the output
+ * is stored. Each thread handles VectorWidth consecutive features, so the
+ * number of features must be a multiple of VectorWidth.
+ */
+template <typename T, typename Index, int VectorWidth>
+class EpilogueOp {
+  using DataType = typename helpers::VectorType<T, VectorWidth>::type;
+  using LoadData = helpers::io::Load<DataType>;
+  using StoreData = helpers::io::Store<DataType>;
+
+  ReadWriteAccessor<T> output_;
+  Epilogue<T> epilogue_;
+  Index const n_vecs_;
+  Index const n_features_;
+
+ public:
+  EpilogueOp(ReadWriteAccessor<T> const& output, Epilogue<T> const& epilogue,
+             Index const n_vecs, Index const n_features)
+      : output_{output},
+        epilogue_{epilogue},
+        n_vecs_{n_vecs},
+        n_features_{n_features} {}
+
+  void SNN_ALWAYS_INLINE operator()(cl::sycl::item<1> item) const {
+    Index const idx = item.get_id(0);
+
+    if (idx < n_vecs_) {
+      Index const vec_idx = idx * VectorWidth;
+      Index const feature = vec_idx % n_features_;
+
+      auto out_ptr = output_.get_pointer();
+      auto value =
+          LoadData()(helpers::internal::as_const_ptr(out_ptr), vec_idx);
+      StoreData()(out_ptr, vec_idx, epilogue_.apply(value, feature));
+    }
+  }
+};
+
+}  // namespace internal
+}  // namespace conv2d
+}  // namespace sycldnn
+#endif  // SYCLDNN_SRC_CONV2D_EPILOGUE_KERNELS_H_
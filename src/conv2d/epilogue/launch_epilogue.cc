@@ -0,0 +1,117 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "sycldnn/internal/conv2d/epilogue.h"
+
+#include "sycldnn/mem_object.h"
+#include "sycldnn/status.h"
+
+#include "sycldnn/helpers/ratio.h"
+
+#include "src/conv2d/epilogue/epilogue.h"
+#include "src/conv2d/epilogue/kernels.h"
+
+#include <CL/sycl.hpp>
+
+#include <stddef.h>
+#include <cstdint>
+#include <limits>
+
+#include "sycldnn/export.h"
+
+namespace sycldnn {
+namespace conv2d {
+namespace internal {
+namespace {
+
+template <typename T, typename Index, int VectorWidth>
+SNNStatus queue_epilogue(BaseMemObject<T const>& bias_mem,
+                         BaseMemObject<T>& out_mem,
+                         EpilogueParams const& epilogue, Index const n_items,
+                         Index const n_features, cl::sycl::queue& queue) {
+  auto event = queue.submit([&](cl::sycl::handler& cgh) {
+    auto bias = bias_mem.read_accessor(cgh);
+    auto output = out_mem.read_write_accessor(cgh);
+    Index const n_vecs = n_items / VectorWidth;
+    size_t const n_threads = helpers::round_up_to_nearest_multiple(n_vecs, 64);
+    EpilogueOp<T, Index, VectorWidth> op{output, Epilogue<T>{epilogue, bias},
+                                         n_vecs, n_features};
+    cgh.parallel_for(cl::sycl::range<1>{n_threads}, op);
+  });
+  return {event, StatusCode::OK};
+}
+
+template <typename T, typename Index>
+SNNStatus launch_with_index(BaseMemObject<T const>& bias,
+                            BaseMemObject<T>& output,
+                            EpilogueParams const& epilogue,
+                            Index const n_items, Index const n_features,
+                            cl::sycl::queue& queue) {
+  if (n_features % 4 == 0) {
+    return queue_epilogue<T, Index, 4>(bias, output, epilogue, n_items,
+                                       n_features, queue);
+  } else if (n_features % 2 == 0) {
+    return queue_epilogue<T, Index, 2>(bias, output, epilogue, n_items,
+                                       n_features, queue);
+  } else {
+    return queue_epilogue<T, Index, 1>(bias, output, epilogue, n_items,
+                                       n_features, queue);
+  }
+}
+
+}  // namespace
+
+template <typename T>
+SNNStatus launch_epilogue(BaseMemObject<T const>& bias,
+                          BaseMemObject<T>& output,
+                          EpilogueParams const& epilogue,
+                          Conv2DParams const& params, cl::sycl::queue& queue) {
+  size_t const n_items = static_cast<size_t>(params.batch) * params.out_rows *
+                         params.out_cols * params.features;
+  if (n_items > static_cast<size_t>(std::numeric_limits<int32_t>::max())) {
+#ifdef SNN_USE_INT64
+    return launch_with_index<T, int64_t>(bias, output, epilogue, n_items,
+                                         params.features, queue);
+#else
+    return StatusCode::IndexExceeded;
+#endif  // SNN_USE_INT64
+  } else {
+    return launch_with_index<T, int32_t>(bias, output, epilogue,
+                                         static_cast<int32_t>(n_items),
+                                         params.features, queue);
+  }
+}
+
+#define INSTANTIATE_LAUNCHER(DTYPE)                                     \
+  template SNN_EXPORT SNNStatus launch_epilogue<DTYPE>(                 \
+      BaseMemObject<DTYPE const> & bias, BaseMemObject<DTYPE> & output, \
+      EpilogueParams const& epilogue, Conv2DParams const& params,       \
+      cl::sycl::queue& queue)
+
+INSTANTIATE_LAUNCHER(float);
+
+#ifdef SNN_USE_DOUBLE
+INSTANTIATE_LAUNCHER(double);
+#endif  // SNN_USE_DOUBLE
+
+#ifdef SNN_USE_HALF
+INSTANTIATE_LAUNCHER(cl::sycl::half);
+#endif  // SNN_USE_HALF
+
+#undef INSTANTIATE_LAUNCHER
+
+}  // namespace internal
+}  // namespace conv2d
+}  // namespace sycldnn
@@ -39,12 +39,14 @@ struct ExtractFilterTiles {
   ExtractFilterTiles(Conv2DParams const& params,
                      ReadAccessor<T const> const& input,
                      WriteAccessor<T> const& output)
-      : n_items_{params.window_rows * params.window_cols * params.channels *
-                 params.features},
+      : n_items_{params.window_rows * params.window_cols *
+                 (params.channels / params.groups) * params.features},
         n_window_rows_{params.window_rows},
         n_window_cols_{params.window_cols},
-        n_channels_{params.channels},
+        n_channels_{params.channels / params.groups},
         n_features_{params.features},
+        n_groups_{params.groups},
+        n_group_features_{params.features / params.groups},
         input_accessor_{input},
         output_accessor_{output} {}
 
@@ -66,10 +68,19 @@ struct ExtractFilterTiles {
       Index const col = tensor_idx.s1;
       Index const row = tensor_idx.s0;
 
+      // In a grouped convolution the filter for each group is stored
+      // contiguously, so that the groups can be computed in a batched matmul.
+      Index const group = n_groups_ == 1 ? 0 : feature / n_group_features_;
+      Index const group_feature = feature - group * n_group_features_;
+      Index const group_offset = group * n_window_rows_ * n_window_cols_ *
+                                 n_group_features_ * n_channels_;
+
       Index const out_row = n_window_rows_ - 1 - row;
       Index const out_col = n_window_cols_ - 1 - col;
       Index const out_idx =
-          ((out_row * n_window_cols_ + out_col) * n_features_ + feature) *
+          group_offset +
+          ((out_row * n_window_cols_ + out_col) * n_group_features_ +
+           group_feature) *
               n_channels_ +
           channel;
       Store()(output_data, out_idx, in_val);
@@ -82,6 +93,8 @@ struct ExtractFilterTiles {
   Index const n_window_cols_;
   Index const n_channels_;
   Index const n_features_;
+  Index const n_groups_;
+  Index const n_group_features_;
   ReadAccessor<T const> input_accessor_;
   WriteAccessor<T> output_accessor_;
 };
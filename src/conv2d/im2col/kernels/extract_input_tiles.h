@@ -50,9 +50,13 @@ struct ExtractInputTiles<T, Index, VectorWidth, conv_type::Forward> {
   ExtractInputTiles(Index tile_size, Conv2DParams const& params,
                     ReadAccessor<T const> const& input,
                     WriteAccessor<T> const& output)
-      : tile_size_{tile_size},
+      : tile_size_{tile_size / params.groups},
+        group_size_{params.batch * params.out_rows * params.out_cols *
+                    (tile_size / params.groups)},
         channels_{params.channels},
         features_{params.features},
+        groups_{params.groups},
+        group_channels_{params.channels / params.groups},
         batch_{params.batch},
         in_rows_{params.in_rows},
         in_cols_{params.in_cols},
@@ -60,10 +64,14 @@ struct ExtractInputTiles<T, Index, VectorWidth, conv_type::Forward> {
         window_cols_{params.window_cols},
         stride_rows_{params.stride_rows},
         stride_cols_{params.stride_cols},
+        dilation_rows_{params.dilation_rows},
+        dilation_cols_{params.dilation_cols},
         out_rows_{params.out_rows},
         out_cols_{params.out_cols},
-        pad_rows_{params.window_rows - params.pad_rows - 1},
-        pad_cols_{params.window_cols - params.pad_cols - 1},
+        pad_rows_{(params.window_rows - 1) * params.dilation_rows -
+                  params.pad_rows},
+        pad_cols_{(params.window_cols - 1) * params.dilation_cols -
+                  params.pad_cols},
         input_accessor_{input},
         output_accessor_{output} {}
 
@@ -93,6 +101,18 @@ struct ExtractInputTiles<T, Index, VectorWidth, conv_type::Forward> {
           channel;
       VecType in_val = Load()(input_data, in_idx);
 
+      // In a grouped convolution the tiles for each group are stored
+      // contiguously, so that the groups can be computed in a batched matmul.
+      Index const group = groups_ == 1 ? 0 : channel / group_channels_;
+      Index const group_channel = channel - group * group_channels_;
+      auto group_output = output_data + group * group_size_;
+
+      if (dilation_rows_ != 1 || dilation_cols_ != 1) {
+        write_dilated_tiles(group_output, in_val, batch, row_idx, col_idx,
+                            group_channel);
+        return;
+      }
+
       auto const col_window_struct =
           helpers::out_window_from_input(col_idx, stride_cols_, pad_cols_);
       Index const cstart = col_window_struct.window_start;
@@ -110,10 +130,10 @@ struct ExtractInputTiles<T, Index, VectorWidth, conv_type::Forward> {
                ++c, in_c -= stride_cols_) {
             if (c >= 0 && c < out_cols_) {
               auto tile_start =
-                  output_data +
+                  group_output +
                   ((batch * out_rows_ + r) * out_cols_ + c) * tile_size_;
-              Index tile_idx =
-                  (in_r * window_cols_ + in_c) * channels_ + channel;
+              Index tile_idx = (in_r * window_cols_ + in_c) * group_channels_ +
+                               group_channel;
               Store()(tile_start, tile_idx, in_val);
             }
           }
@@ -123,9 +143,56 @@ struct ExtractInputTiles<T, Index, VectorWidth, conv_type::Forward> {
   }
 
  private:
+  /**
+   * Write the input value to each tile which uses it in a dilated
+   * convolution.
+   *
+   * With dilation the filter values which use an input are not evenly spaced
+   * by the stride, so each filter value is checked in turn. The output pointer
+   * and channel are given relative to the channel's group.
+   */
+  template <typename OutputPointer>
+  void SNN_ALWAYS_INLINE write_dilated_tiles(OutputPointer output_data,
+                                             VecType in_val, Index batch,
+                                             Index row_idx, Index col_idx,
+                                             Index channel) const {
+    Index const padded_row = row_idx - pad_rows_;
+    Index const padded_col = col_idx - pad_cols_;
+    for (Index i = 0; i < window_rows_; ++i) {
+      Index const shifted_row = padded_row + i * dilation_rows_;
+      if (shifted_row < 0 || shifted_row % stride_rows_ != 0) {
+        continue;
+      }
+      Index const r = shifted_row / stride_rows_;
+      if (r >= out_rows_) {
+        break;
+      }
+      Index const in_r = window_rows_ - 1 - i;
+      for (Index j = 0; j < window_cols_; ++j) {
+        Index const shifted_col = padded_col + j * dilation_cols_;
+        if (shifted_col < 0 || shifted_col % stride_cols_ != 0) {
+          continue;
+        }
+        Index const c = shifted_col / stride_cols_;
+        if (c >= out_cols_) {
+          break;
+        }
+        Index const in_c = window_cols_ - 1 - j;
+        Index const tile_offset =
+            ((batch * out_rows_ + r) * out_cols_ + c) * tile_size_;
+        Index const tile_idx =
+            (in_r * window_cols_ + in_c) * group_channels_ + channel;
+        Store()(output_data + tile_offset, tile_idx, in_val);
+      }
+    }
+  }
+
   Index const tile_size_;
+  Index const group_size_;
   Index const channels_;
   Index const features_;
+  Index const groups_;
+  Index const group_channels_;
   Index const batch_;
   Index const in_rows_;
   Index const in_cols_;
@@ -133,6 +200,8 @@ struct ExtractInputTiles<T, Index, VectorWidth, conv_type::Forward> {
   Index const window_cols_;
   Index const stride_rows_;
   Index const stride_cols_;
+  Index const dilation_rows_;
+  Index const dilation_cols_;
   Index const out_rows_;
   Index const out_cols_;
   Index const pad_rows_;
@@ -150,9 +219,13 @@ struct ExtractInputTiles<T, Index, VectorWidth, conv_type::InputBackprop> {
   ExtractInputTiles(Index tile_size, Conv2DParams const& params,
                     ReadAccessor<T const> const& input,
                     WriteAccessor<T> const& output)
-      : tile_size_{tile_size},
+      : tile_size_{tile_size / params.groups},
+        group_size_{params.batch * params.in_rows * params.in_cols *
+                    (tile_size / params.groups)},
         channels_{params.channels},
         features_{params.features},
+        groups_{params.groups},
+        group_features_{params.features / params.groups},
         batch_{params.batch},
         in_rows_{params.in_rows},
         in_cols_{params.in_cols},
@@ -160,6 +233,8 @@ struct ExtractInputTiles<T, Index, VectorWidth, conv_type::InputBackprop> {
         window_cols_{params.window_cols},
         stride_rows_{params.stride_rows},
         stride_cols_{params.stride_cols},
+        dilation_rows_{params.dilation_rows},
+        dilation_cols_{params.dilation_cols},
         out_rows_{params.out_rows},
         out_cols_{params.out_cols},
         pad_rows_{params.pad_rows},
@@ -192,19 +267,26 @@ struct ExtractInputTiles<T, Index, VectorWidth, conv_type::InputBackprop> {
           feature;
       VecType in_val = Load()(input_data, in_idx);
 
+      // In a grouped convolution the tiles for each group are stored
+      // contiguously, so that the groups can be computed in a batched matmul.
+      Index const group = groups_ == 1 ? 0 : feature / group_features_;
+      Index const group_feature = feature - group * group_features_;
+      auto group_output = output_data + group * group_size_;
+
       Index const cstart = col_idx * stride_cols_ - pad_cols_;
       Index const rstart = row_idx * stride_rows_ - pad_rows_;
 
-      for (Index r = rstart, in_r = window_rows_ - 1; in_r >= 0; ++r, --in_r) {
+      for (Index r = rstart, in_r = window_rows_ - 1; in_r >= 0;
+           r += dilation_rows_, --in_r) {
         if (r >= 0 && r < in_rows_) {
           for (Index c = cstart, in_c = window_cols_ - 1; in_c >= 0;
-               ++c, --in_c) {
+               c += dilation_cols_, --in_c) {
             if (c >= 0 && c < in_cols_) {
               auto tile_start =
-                  output_data +
+                  group_output +
                   ((batch * in_rows_ + r) * in_cols_ + c) * tile_size_;
-              Index tile_idx =
-                  (in_r * window_cols_ + in_c) * features_ + feature;
+              Index tile_idx = (in_r * window_cols_ + in_c) * group_features_ +
+                               group_feature;
               Store()(tile_start, tile_idx, in_val);
             }
           }
@@ -215,8 +297,11 @@ struct ExtractInputTiles<T, Index, VectorWidth, conv_type::InputBackprop> {
 
  private:
   Index const tile_size_;
+  Index const group_size_;
   Index const channels_;
   Index const features_;
+  Index const groups_;
+  Index const group_features_;
   Index const batch_;
   Index const in_rows_;
   Index const in_cols_;
@@ -224,6 +309,8 @@ struct ExtractInputTiles<T, Index, VectorWidth, conv_type::InputBackprop> {
   Index const window_cols_;
   Index const stride_rows_;
   Index const stride_cols_;
+  Index const dilation_rows_;
+  Index const dilation_cols_;
   Index const out_rows_;
   Index const out_cols_;
   Index const pad_rows_;
@@ -52,15 +52,20 @@ size_t get_thread_size<conv_type::InputBackprop>(Conv2DParams const& params,
          vector_width;
 }
 
-/** Check whether a certain vector size can be used for the given parameters. */
+/**
+ * Check whether a certain vector size can be used for the given parameters.
+ *
+ * The vectors must not cross the boundary between two groups, as each group is
+ * written to a separate set of tiles.
+ */
 template <typename ConvType>
 bool can_use_vector(Conv2DParams const& params, int vector_width) {
-  return params.channels % vector_width == 0;
+  return (params.channels / params.groups) % vector_width == 0;
 }
 template <>
 bool can_use_vector<conv_type::InputBackprop>(Conv2DParams const& params,
                                               int vector_width) {
-  return params.features % vector_width == 0;
+  return (params.features / params.groups) % vector_width == 0;
 }
 template <>
 bool can_use_vector<conv_type::FilterBackprop>(Conv2DParams const& /*params*/,
@@ -0,0 +1,128 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "sycldnn/conv2d/selector/algorithm_cache.h"
+
+#include "sycldnn/conv2d/algorithm.h"
+#include "sycldnn/conv2d/params.h"
+
+#include <fstream>
+#include <sstream>
+#include <string>
+
+#include "sycldnn/export.h"
+
+namespace sycldnn {
+namespace conv2d {
+
+SNN_EXPORT char const* to_string(Algorithm algo) {
+  switch (algo) {
+    case Algorithm::Direct:
+      return "Direct";
+    case Algorithm::Tiled:
+      return "Tiled";
+    case Algorithm::Im2col:
+      return "Im2col";
+    case Algorithm::Winograd:
+      return "Winograd";
+    case Algorithm::WinogradLarge:
+      return "WinogradLarge";
+    case Algorithm::Matmul:
+      return "Matmul";
+    case Algorithm::NotSupported:
+    default:
+      return "NotSupported";
+  }
+}
+
+SNN_EXPORT Algorithm algorithm_from_string(std::string const& name) {
+  for (auto algo : {Algorithm::Direct, Algorithm::Tiled, Algorithm::Im2col,
+                    Algorithm::Winograd, Algorithm::WinogradLarge,
+                    Algorithm::Matmul}) {
+    if (name == to_string(algo)) {
+      return algo;
+    }
+  }
+  return Algorithm::NotSupported;
+}
+
+SNN_EXPORT std::string make_algorithm_cache_key(std::string const& device_id,
+                                                std::string const& data_type,
+                                                std::string const& conv_type,
+                                                Conv2DParams const& params) {
+  std::ostringstream key;
+  // The key must not contain the tab separator used in the cache file.
+  for (char c : device_id) {
+    key << (c == '\t' || c == '\n' ? ' ' : c);
+  }
+  key << ";" << data_type << ";" << conv_type << ";" << params.batch << ","
+      << params.in_rows << "," << params.in_cols << "," << params.channels
+      << "," << params.features << "," << params.window_rows << ","
+      << params.window_cols << "," << params.stride_rows << ","
+      << params.stride_cols << "," << params.out_rows << "," << params.out_cols
+      << "," << params.pad_rows << "," << params.pad_cols << ","
+      << params.dilation_rows << "," << params.dilation_cols << ","
+      << params.groups << "," << static_cast<int>(params.input_format) << ","
+      << static_cast<int>(params.filter_format);
+  return key.str();
+}
+
+AlgorithmCache::AlgorithmCache(std::string filename)
+    : filename_{std::move(filename)}, entries_{} {
+  load();
+}
+
+Algorithm AlgorithmCache::lookup(std::string const& key) const {
+  auto entry = entries_.find(key);
+  if (entry == entries_.end()) {
+    return Algorithm::NotSupported;
+  }
+  return entry->second;
+}
+
+bool AlgorithmCache::insert(std::string const& key, Algorithm algo) {
+  entries_[key] = algo;
+  if (filename_.empty()) {
+    return false;
+  }
+  std::ofstream file{filename_, std::ios::app};
+  if (!file) {
+    return false;
+  }
+  file << key << '\t' << to_string(algo) << '\n';
+  return static_cast<bool>(file);
+}
+
+void AlgorithmCache::load() {
+  if (filename_.empty()) {
+    return;
+  }
+  std::ifstream file{filename_};
+  std::string line;
+  while (std::getline(file, line)) {
+    auto separator = line.rfind('\t');
+    if (separator == std::string::npos) {
+      continue;
+    }
+    auto algo = algorithm_from_string(line.substr(separator + 1));
+    if (algo != Algorithm::NotSupported) {
+      // Later entries take precedence, so re-tuned results override old ones.
+      entries_[line.substr(0, separator)] = algo;
+    }
+  }
+}
+
+}  // namespace conv2d
+}  // namespace sycldnn
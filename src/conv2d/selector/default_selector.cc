@@ -48,13 +48,19 @@ class DefaultSelector : public sycldnn::conv2d::Selector {
    */
   sycldnn::conv2d::Algorithm select_forward(
       sycldnn::conv2d::Conv2DParams const& params) override {
-    // For 1x1s1 the convolution is equivalent to a matrix multiply.
+    // For 1x1s1 the convolution is equivalent to a matrix multiply, or a
+    // batched matrix multiply over the groups of a grouped convolution.
     if (params.stride_rows == 1 && params.stride_cols == 1 &&
         params.window_rows == 1 && params.window_cols == 1) {
       return sycldnn::conv2d::Algorithm::Matmul;
     }
-    // Winograd is supported for 1x3s1, 3x1s1, 3x3s1.
-    if (params.stride_rows == 1 && params.stride_cols == 1) {
+    // Other grouped convolutions are only supported by Direct and Im2col.
+    if (params.groups != 1) {
+      return sycldnn::conv2d::Algorithm::Im2col;
+    }
+    // Winograd is supported for 1x3s1, 3x1s1, 3x3s1 without dilation.
+    if (params.stride_rows == 1 && params.stride_cols == 1 &&
+        params.dilation_rows == 1 && params.dilation_cols == 1) {
       if (params.window_rows == 3 && params.window_cols == 3) {
         return sycldnn::conv2d::Algorithm::WinogradLarge;
       } else if ((params.window_rows == 1 && params.window_cols == 3) ||
@@ -62,6 +68,15 @@ class DefaultSelector : public sycldnn::conv2d::Selector {
         return sycldnn::conv2d::Algorithm::Winograd;
       }
     }
+    // Tiled is supported for 3x3s1 with dilation 2.
+    if (params.dilation_rows != 1 || params.dilation_cols != 1) {
+      if (params.window_rows == 3 && params.window_cols == 3 &&
+          params.stride_rows == 1 && params.stride_cols == 1 &&
+          params.dilation_rows == 2 && params.dilation_cols == 2) {
+        return sycldnn::conv2d::Algorithm::Tiled;
+      }
+      return sycldnn::conv2d::Algorithm::Im2col;
+    }
     // Tiled is supported for 1x1s1, 1x1s2, 3x3s1, 3x3s2, 5x5s1.
     if (params.stride_rows == params.stride_cols &&
         params.window_rows == params.window_cols) {
@@ -81,13 +96,19 @@ class DefaultSelector : public sycldnn::conv2d::Selector {
    */
   sycldnn::conv2d::Algorithm select_input_backprop(
       sycldnn::conv2d::Conv2DParams const& params) override {
-    // For 1x1s1 the convolution is equivalent to a matrix multiply.
+    // For 1x1s1 the convolution is equivalent to a matrix multiply, or a
+    // batched matrix multiply over the groups of a grouped convolution.
     if (params.stride_rows == 1 && params.stride_cols == 1 &&
         params.window_rows == 1 && params.window_cols == 1) {
       return sycldnn::conv2d::Algorithm::Matmul;
     }
-    // Winograd is supported for 1x3s1, 3x1s1, 3x3s1.
-    if (params.stride_rows == 1 && params.stride_cols == 1) {
+    // Other grouped convolutions are only supported by Direct and Im2col.
+    if (params.groups != 1) {
+      return sycldnn::conv2d::Algorithm::Im2col;
+    }
+    // Winograd is supported for 1x3s1, 3x1s1, 3x3s1 without dilation.
+    if (params.stride_rows == 1 && params.stride_cols == 1 &&
+        params.dilation_rows == 1 && params.dilation_cols == 1) {
       if (params.window_rows == 3 && params.window_cols == 3) {
         return sycldnn::conv2d::Algorithm::WinogradLarge;
       } else if ((params.window_rows == 1 && params.window_cols == 3) ||
@@ -105,13 +126,19 @@ class DefaultSelector : public sycldnn::conv2d::Selector {
    */
   sycldnn::conv2d::Algorithm select_filter_backprop(
       sycldnn::conv2d::Conv2DParams const& params) override {
-    // For 1x1s1 the convolution is equivalent to a matrix multiply.
+    // For 1x1s1 the convolution is equivalent to a matrix multiply, or a
+    // batched matrix multiply over the groups of a grouped convolution.
     if (params.stride_rows == 1 && params.stride_cols == 1 &&
         params.window_rows == 1 && params.window_cols == 1) {
       return sycldnn::conv2d::Algorithm::Matmul;
     }
-    // Winograd is supported for 1x3s1, 3x1s1, 3x3s1.
-    if (params.stride_rows == 1 && params.stride_cols == 1) {
+    // Other grouped filter backprops are only supported by Direct.
+    if (params.groups != 1) {
+      return sycldnn::conv2d::Algorithm::Direct;
+    }
+    // Winograd is supported for 1x3s1, 3x1s1, 3x3s1 without dilation.
+    if (params.stride_rows == 1 && params.stride_cols == 1 &&
+        params.dilation_rows == 1 && params.dilation_cols == 1) {
       if (params.window_rows == 3 && params.window_cols == 3) {
         return sycldnn::conv2d::Algorithm::WinogradLarge;
       } else if ((params.window_rows == 1 && params.window_cols == 3) ||
@@ -215,6 +242,12 @@ class PowerVRSelector final : public DefaultSelector {
  public:
   sycldnn::conv2d::Algorithm select_forward(
       sycldnn::conv2d::Conv2DParams const& params) override {
+    if (params.groups != 1) {
+      return this->DefaultSelector::select_forward(params);
+    }
+    if (params.dilation_rows != 1 || params.dilation_cols != 1) {
+      return this->DefaultSelector::select_forward(params);
+    }
     if (params.stride_cols > 1 && params.stride_cols > 1) {
       return sycldnn::conv2d::Algorithm::Im2col;
     }
@@ -30,6 +30,8 @@
 #include "src/helpers/vector_type.h"
 #include "src/helpers/window_index.h"
 
+#include "src/conv2d/epilogue/epilogue.h"
+
 #include "src/conv2d/tiled/tile_info.h"
 #include "src/conv2d/tiled/tiles.h"
 
@@ -40,7 +42,8 @@ namespace tiled {
 
 template <typename T, typename Index, typename ConvType, int TileRows,
           int TileCols, int ChannelVectorWidth, int FeatureVectorWidth,
-          bool UseFastDiv, int WindowRows, int WindowCols, int Stride = 0>
+          bool UseFastDiv, int WindowRows, int WindowCols, int Stride = 0,
+          int Dilation = 1>
 struct TiledConv2D;
 
 /**
@@ -52,17 +55,27 @@ struct TiledConv2D;
  * be controlled using the FeatureVectorWidth template. The channel
  * vectorisation needs the kernel to be modified so that the loop over the
  * channels is split into a vectorised part and a scalar part.
+ *
+ * The filter dilation is a compile time constant, so that the size of the
+ * input tile loaded into registers is known at compile time.
+ *
+ * The input and output tensors can also be in a channel blocked NCHWc format,
+ * as long as the vector widths divide the block size. The input rows are then
+ * read from one channel block at a time, moving to the next block once all of
+ * its channels have been accumulated.
  */
 template <typename T, typename Index, int OutTileRows, int OutTileCols,
           int ChannelVectorWidth, int FeatureVectorWidth, bool UseFastDiv,
-          int WindowRows, int WindowCols, int Stride>
+          int WindowRows, int WindowCols, int Stride, int Dilation>
 struct TiledConv2D<T, Index, conv_type::Forward, OutTileRows, OutTileCols,
                    ChannelVectorWidth, FeatureVectorWidth, UseFastDiv,
-                   WindowRows, WindowCols, Stride> {
+                   WindowRows, WindowCols, Stride, Dilation> {
  private:
   using IndexDivType = typename fast_div::IndexDiv<Index, UseFastDiv>::type;
-  static constexpr auto InputTileCols = (OutTileCols - 1) * Stride + WindowCols;
-  static constexpr auto InputTileRows = (OutTileRows - 1) * Stride + WindowRows;
+  static constexpr auto InputTileCols =
+      (OutTileCols - 1) * Stride + (WindowCols - 1) * Dilation + 1;
+  static constexpr auto InputTileRows =
+      (OutTileRows - 1) * Stride + (WindowRows - 1) * Dilation + 1;
   using Input = InputRow<T, ChannelVectorWidth, InputTileCols>;
   using Filter = FilterTile<T, ChannelVectorWidth, FeatureVectorWidth,
                             WindowRows, WindowCols>;
@@ -73,7 +86,7 @@ struct TiledConv2D<T, Index, conv_type::Forward, OutTileRows, OutTileCols,
  public:
   TiledConv2D(ReadAccessor<T const> input, ReadAccessor<T const> filter,
               WriteAccessor<T> output, Conv2DParams const& params,
-              TileInfo const& tile_info)
+              TileInfo const& tile_info, Epilogue<T> const& epilogue)
       : n_tile_cols_{tile_info.n_cols},
         n_tile_rows_{tile_info.n_rows},
         n_feature_vectors_{tile_info.output_vectors},
@@ -91,9 +104,12 @@ struct TiledConv2D<T, Index, conv_type::Forward, OutTileRows, OutTileCols,
         out_cols_{params.out_cols},
         pad_rows_{params.pad_rows},
         pad_cols_{params.pad_cols},
+        in_block_{get_pixel_channels(params.input_format, params.channels)},
+        out_block_{get_pixel_channels(params.input_format, params.features)},
         input_accessor_{std::move(input)},
         filter_accessor_{std::move(filter)},
-        output_accessor_{std::move(output)} {}
+        output_accessor_{std::move(output)},
+        epilogue_{epilogue} {}
 
   void SNN_ALWAYS_INLINE operator()(cl::sycl::item<1> item) const {
     Index const index = item.get_id(0);
@@ -122,37 +138,65 @@ struct TiledConv2D<T, Index, conv_type::Forward, OutTileRows, OutTileCols,
       Output out_tile{};
       Index filter_offset = feature;
       Index input_channel_offset = batch * in_cols_ * in_rows_ * channels_;
+      Index block_channel = 0;
       for (Index channel = 0; channel < channels_;
            channel += ChannelVectorWidth) {
         Filter filter_tile{filter_data, filter_offset, channels_, features_};
 
         Index input_offset =
-            input_channel_offset + rstart * in_cols_ * channels_;
+            input_channel_offset + rstart * in_cols_ * in_block_;
         for (Index i = 0; i < InputTileRows; ++i) {
           if (rstart + i >= 0 && rstart + i < in_rows_) {
             auto input_tile = Input::load_input_row(
-                input_data, input_offset, cstart, in_cols_, channels_);
+                input_data, input_offset, cstart, in_cols_, in_block_);
             convolve_tile(input_tile, filter_tile, out_tile, i);
           }
-          input_offset += in_cols_ * channels_;
+          input_offset += in_cols_ * in_block_;
         }
         input_channel_offset += ChannelVectorWidth;
+        block_channel += ChannelVectorWidth;
+        if (block_channel == in_block_) {
+          // Move on to the start of the next channel block.
+          block_channel = 0;
+          input_channel_offset += (in_rows_ * in_cols_ - 1) * in_block_;
+        }
         filter_offset += ChannelVectorWidth * features_;
       }
+      apply_epilogue(out_tile, feature);
       out_tile.write_out(output_data, batch, row_idx, out_rows_, col_idx,
-                         out_cols_, feature, features_);
+                         out_cols_, feature, features_, out_block_);
     }
   }
 
  private:
+  /**
+   * Apply the epilogue to each value in the output tile. All values in the
+   * tile share the same features, so the bias is only loaded once.
+   */
+  void SNN_ALWAYS_INLINE apply_epilogue(Output& output,
+                                        Index const feature) const {
+    auto const bias = epilogue_.template load_bias<OutVecType>(feature);
+    SNN_PRAGMA_UNROLL
+    for (int out_row = 0; out_row < OutTileRows; ++out_row) {
+      SNN_PRAGMA_UNROLL
+      for (int out_col = 0; out_col < OutTileCols; ++out_col) {
+        output.data(out_row, out_col) =
+            epilogue_.activate(output.data(out_row, out_col) + bias);
+      }
+    }
+  }
+
   void SNN_ALWAYS_INLINE convolve_tile(Input const& input, Filter const& filter,
                                        Output& output,
                                        int const row_idx) const {
     SNN_PRAGMA_UNROLL
     for (int out_row = 0; out_row < OutTileRows; ++out_row) {
-      int const filter_row = row_idx - out_row * Stride;
-      if (filter_row >= 0 && filter_row < WindowRows) {
-        convolve_one_row(input, filter, output, out_row, filter_row);
+      int const dilated_row = row_idx - out_row * Stride;
+      if (dilated_row >= 0 && dilated_row % Dilation == 0) {
+        int const filter_row = dilated_row / Dilation;
+        if (filter_row < WindowRows) {
+          convolve_one_row(input, filter, output, out_row, filter_row);
+        }
       }
     }
   }
@@ -167,8 +211,8 @@ struct TiledConv2D<T, Index, conv_type::Forward, OutTileRows, OutTileCols,
       SNN_PRAGMA_UNROLL
       for (int filter_col = 0; filter_col < WindowCols; ++filter_col) {
         output.data(out_row, out_col) = forward_accumulate(
-            input.data(in_offset + filter_col), filter, filter_row, filter_col,
-            output.data(out_row, out_col));
+            input.data(in_offset + filter_col * Dilation), filter, filter_row,
+            filter_col, output.data(out_row, out_col));
       }
       in_offset += Stride;
     }
@@ -204,16 +248,25 @@ struct TiledConv2D<T, Index, conv_type::Forward, OutTileRows, OutTileCols,
   const Index out_cols_;
   const Index pad_rows_;
   const Index pad_cols_;
+  const Index in_block_;
+  const Index out_block_;
   const ReadAccessor<const T> input_accessor_;
   const ReadAccessor<const T> filter_accessor_;
   WriteAccessor<T> output_accessor_;
+  Epilogue<T> const epilogue_;
 };
+
+/**
+ * Input backprop convolution using a tiled direct computation technique.
+ *
+ * Dilated convolutions are not supported by this kernel.
+ */
 template <typename T, typename Index, int OutTileRows, int OutTileCols,
           int ChannelVectorWidth, int FeatureVectorWidth, bool UseFastDiv,
           int WindowRows, int WindowCols, int Stride>
 struct TiledConv2D<T, Index, conv_type::InputBackprop, OutTileRows, OutTileCols,
                    ChannelVectorWidth, FeatureVectorWidth, UseFastDiv,
-                   WindowRows, WindowCols, Stride> {
+                   WindowRows, WindowCols, Stride, /*Dilation=*/1> {
  private:
   using IndexDivType = typename fast_div::IndexDiv<Index, UseFastDiv>::type;
   static constexpr auto InputTileCols = (OutTileCols + WindowCols - 1) / Stride;
@@ -299,7 +352,7 @@ struct TiledConv2D<T, Index, conv_type::InputBackprop, OutTileRows, OutTileCols,
         filter_offset += FeatureVectorWidth;
       }
       out_tile.write_out(output_data, batch, row_idx, in_rows_, col_idx,
-                         in_cols_, channel, channels_);
+                         in_cols_, channel, channels_, channels_);
     }
   }
 
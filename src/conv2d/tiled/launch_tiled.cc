@@ -19,6 +19,7 @@
 #include "sycldnn/status.h"
 
 #include "sycldnn/conv2d/conv_type.h"
+#include "sycldnn/conv2d/epilogue.h"
 #include "sycldnn/conv2d/params.h"
 
 #include "sycldnn/helpers/ratio.h"
@@ -64,26 +65,38 @@ inline bool can_use_fast_div<conv_type::InputBackprop>(
 }
 template <typename ConvType>
 inline bool can_use_sizes(Conv2DParams const& params, int channel_vector,
-                          int feature_vector, int window, int stride);
+                          int feature_vector, int window, int stride,
+                          int dilation);
 template <>
 inline bool can_use_sizes<conv_type::Forward>(Conv2DParams const& params,
                                               int const channel_vector,
                                               int const feature_vector,
                                               int const window,
-                                              int const stride) {
+                                              int const stride,
+                                              int const dilation) {
+  // The vectors cannot cross the blocks of a channel blocked tensor.
+  int const channel_block =
+      get_pixel_channels(params.input_format, params.channels);
+  int const feature_block =
+      get_pixel_channels(params.input_format, params.features);
   return (params.window_rows == window && params.window_cols == window &&
           params.stride_rows == stride && params.stride_cols == stride &&
-          params.features % feature_vector == 0 &&
-          params.channels % channel_vector == 0);
+          params.dilation_rows == dilation &&
+          params.dilation_cols == dilation &&
+          feature_block % feature_vector == 0 &&
+          channel_block % channel_vector == 0);
 }
 template <>
 inline bool can_use_sizes<conv_type::InputBackprop>(Conv2DParams const& params,
                                                     int const channel_vector,
                                                     int const feature_vector,
                                                     int const window,
-                                                    int const stride) {
+                                                    int const stride,
+                                                    int const dilation) {
   return (params.window_rows == window && params.window_cols == window &&
           params.stride_rows == stride && params.stride_cols == stride &&
+          params.dilation_rows == dilation &&
+          params.dilation_cols == dilation &&
           params.features % feature_vector == 0 &&
           params.channels % channel_vector == 0);
 }
@@ -94,11 +107,13 @@ inline bool can_use_sizes<conv_type::InputBackprop>(Conv2DParams const& params,
  */
 template <typename T, typename Index, typename ConvType, int TileRows,
           int TileCols, int ChannelVectorWidth, int FeatureVectorWidth,
-          int Window, int Stride>
+          int Window, int Stride, int Dilation>
 SNNStatus launch_with_index_type(BaseMemObject<T const>& input,
                                  BaseMemObject<T const>& filter,
+                                 BaseMemObject<T const>& bias,
                                  BaseMemObject<T>& output,
                                  Conv2DParams const& params,
+                                 EpilogueParams const& epilogue,
                                  tiled::TileInfo const& tile_info,
                                  cl::sycl::queue& queue) {
   auto kernel_params = get_kernel_params<ConvType>(params);
@@ -106,13 +121,15 @@ SNNStatus launch_with_index_type(BaseMemObject<T const>& input,
                                  FeatureVectorWidth, TileRows, TileCols)) {
     return queue_tiled_kernel<T, Index, ConvType, TileRows, TileCols,
                               ChannelVectorWidth, FeatureVectorWidth, true,
-                              Window, Window, Stride>(
-        input, filter, output, kernel_params, tile_info, queue);
+                              Window, Window, Stride, Dilation>(
+        input, filter, bias, output, kernel_params, epilogue, tile_info,
+        queue);
   } else {
     return queue_tiled_kernel<T, Index, ConvType, TileRows, TileCols,
                               ChannelVectorWidth, FeatureVectorWidth, false,
-                              Window, Window, Stride>(
-        input, filter, output, kernel_params, tile_info, queue);
+                              Window, Window, Stride, Dilation>(
+        input, filter, bias, output, kernel_params, epilogue, tile_info,
+        queue);
   }
 }
 /**
@@ -121,11 +138,13 @@ SNNStatus launch_with_index_type(BaseMemObject<T const>& input,
  */
 template <typename T, typename ConvType, int TileRows, int TileCols,
           int ChannelVectorWidth, int FeatureVectorWidth, int Window,
-          int Stride>
+          int Stride, int Dilation>
 SNNStatus launch_with_sizes(BaseMemObject<T const>& input,
                             BaseMemObject<T const>& filter,
+                            BaseMemObject<T const>& bias,
                             BaseMemObject<T>& output,
                             Conv2DParams const& params,
+                            EpilogueParams const& epilogue,
                             cl::sycl::queue& queue) {
   auto const tile_info = tiled::get_tile_info<ConvType>(
       params, TileRows, TileCols, ChannelVectorWidth, FeatureVectorWidth);
@@ -135,16 +154,16 @@ SNNStatus launch_with_sizes(BaseMemObject<T const>& input,
 #ifdef SNN_USE_INT64
     return launch_with_index_type<T, int64_t, ConvType, TileRows, TileCols,
                                   ChannelVectorWidth, FeatureVectorWidth,
-                                  Window, Stride>(input, filter, output, params,
-                                                  tile_info, queue);
+                                  Window, Stride, Dilation>(
+        input, filter, bias, output, params, epilogue, tile_info, queue);
 #else
     return StatusCode::IndexExceeded;
 #endif  // SNN_USE_INT64
   } else {
     return launch_with_index_type<T, int32_t, ConvType, TileRows, TileCols,
                                   ChannelVectorWidth, FeatureVectorWidth,
-                                  Window, Stride>(input, filter, output, params,
-                                                  tile_info, queue);
+                                  Window, Stride, Dilation>(
+        input, filter, bias, output, params, epilogue, tile_info, queue);
   }
 }
 
@@ -154,17 +173,23 @@ template <typename T, typename ConvType,
               std::is_same<ConvType, conv_type::Forward>::value, int>::type = 0>
 inline SNNStatus launch_tiled_impl(BaseMemObject<T const>& input,
                                    BaseMemObject<T const>& filter,
+                                   BaseMemObject<T const>& bias,
                                    BaseMemObject<T>& output,
                                    Conv2DParams const& params,
+                                   EpilogueParams const& epilogue,
                                    cl::sycl::queue& queue) {
-#define LAUNCH_IF_MATCH(params, window, stride, tile_row, tile_col,           \
-                        channel_vector, feature_vector)                       \
+#define LAUNCH_DILATED_IF_MATCH(params, window, stride, dilation, tile_row,   \
+                                tile_col, channel_vector, feature_vector)     \
   if (can_use_sizes<ConvType>(params, channel_vector, feature_vector, window, \
-                              stride)) {                                      \
+                              stride, dilation)) {                            \
     return launch_with_sizes<T, ConvType, tile_row, tile_col, channel_vector, \
-                             feature_vector, window, stride>(                 \
-        input, filter, output, params, queue);                                \
+                             feature_vector, window, stride, dilation>(       \
+        input, filter, bias, output, params, epilogue, queue);                \
   }
+#define LAUNCH_IF_MATCH(params, window, stride, tile_row, tile_col,           \
+                        channel_vector, feature_vector)                       \
+  LAUNCH_DILATED_IF_MATCH(params, window, stride, 1, tile_row, tile_col,      \
+                          channel_vector, feature_vector)
 
 // clang-format off
 #ifdef POWER_VR
@@ -225,6 +250,8 @@ inline SNNStatus launch_tiled_impl(BaseMemObject<T const>& input,
   LAUNCH_IF_MATCH(params, 1, 1, 2, 2, 1, 4)
   LAUNCH_IF_MATCH(params, 1, 1, 2, 2, 1, 1)
   LAUNCH_IF_MATCH(params, 1, 2, 2, 2, 1, 1)
+  LAUNCH_DILATED_IF_MATCH(params, 3, 1, 2, 2, 2, 1, 4)
+  LAUNCH_DILATED_IF_MATCH(params, 3, 1, 2, 2, 2, 1, 1)
   // clang-format on
 
   return StatusCode::InvalidAlgorithm;
@@ -237,8 +264,10 @@ template <
         std::is_same<ConvType, conv_type::InputBackprop>::value, int>::type = 0>
 inline SNNStatus launch_tiled_impl(BaseMemObject<T const>& input,
                                    BaseMemObject<T const>& filter,
+                                   BaseMemObject<T const>& bias,
                                    BaseMemObject<T>& output,
                                    Conv2DParams const& params,
+                                   EpilogueParams const& epilogue,
                                    cl::sycl::queue& queue) {
   // clang-format off
   LAUNCH_IF_MATCH(params, 1, 2, 2, 2, 1, 4)
@@ -259,6 +288,7 @@ inline SNNStatus launch_tiled_impl(BaseMemObject<T const>& input,
 }
 
 #undef LAUNCH_IF_MATCH
+#undef LAUNCH_DILATED_IF_MATCH
 
 /** Internal tile size launcher for FilterBackprop.  */
 template <typename T, typename ConvType,
@@ -267,8 +297,10 @@ template <typename T, typename ConvType,
               int>::type = 0>
 inline SNNStatus launch_tiled_impl(BaseMemObject<T const>& /*input*/,
                                    BaseMemObject<T const>& /*filter*/,
+                                   BaseMemObject<T const>& /*bias*/,
                                    BaseMemObject<T>& /*output*/,
                                    Conv2DParams const& /*params*/,
+                                   EpilogueParams const& /*epilogue*/,
                                    cl::sycl::queue& /*queue*/) {
   // Tiled algorithm is not supported for filter backprop.
   return StatusCode::InvalidAlgorithm;
@@ -276,18 +308,38 @@ inline SNNStatus launch_tiled_impl(BaseMemObject<T const>& /*input*/,
 }  // namespace
 
 template <typename T, typename ConvType>
-inline SNNStatus launch_tiled(BaseMemObject<T const>& input,
-                              BaseMemObject<T const>& filter,
-                              BaseMemObject<T>& output,
-                              Conv2DParams const& params,
-                              cl::sycl::queue& queue) {
-  return launch_tiled_impl<T, ConvType>(input, filter, output, params, queue);
+SNNStatus launch_tiled(BaseMemObject<T const>& input,
+                       BaseMemObject<T const>& filter,
+                       BaseMemObject<T const>& bias, BaseMemObject<T>& output,
+                       Conv2DParams const& params,
+                       EpilogueParams const& epilogue,
+                       cl::sycl::queue& queue) {
+  return launch_tiled_impl<T, ConvType>(input, filter, bias, output, params,
+                                        epilogue, queue);
+}
+
+/**
+ * Launch a tiled convolution without an epilogue. The filter is passed in
+ * place of the bias tensor, but is never read as a bias.
+ */
+template <typename T, typename ConvType>
+SNNStatus launch_tiled(BaseMemObject<T const>& input,
+                       BaseMemObject<T const>& filter,
+                       BaseMemObject<T>& output, Conv2DParams const& params,
+                       cl::sycl::queue& queue) {
+  return launch_tiled_impl<T, ConvType>(input, filter, filter, output, params,
+                                        EpilogueParams{}, queue);
 }
 
 #define INSTANTIATE_LAUNCHER(DTYPE, DIR)                                       \
   template SNN_EXPORT SNNStatus launch_tiled<DTYPE, DIR>(                      \
       BaseMemObject<DTYPE const> & input, BaseMemObject<DTYPE const> & filter, \
       BaseMemObject<DTYPE> & output, Conv2DParams const& params,               \
+      cl::sycl::queue& queue);                                                 \
+  template SNN_EXPORT SNNStatus launch_tiled<DTYPE, DIR>(                      \
+      BaseMemObject<DTYPE const> & input, BaseMemObject<DTYPE const> & filter, \
+      BaseMemObject<DTYPE const> & bias, BaseMemObject<DTYPE> & output,        \
+      Conv2DParams const& params, EpilogueParams const& epilogue,              \
       cl::sycl::queue& queue)
 
 #define INSTANTIATE_FOR_TYPE(DTYPE)                      \
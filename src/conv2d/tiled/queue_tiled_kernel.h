@@ -19,6 +19,7 @@
 #include "sycldnn/mem_object.h"
 #include "sycldnn/status.h"
 
+#include "sycldnn/conv2d/epilogue.h"
 #include "sycldnn/conv2d/params.h"
 
 #include "src/conv2d/tiled/tile_info.h"
@@ -31,11 +32,14 @@ namespace internal {
 
 template <typename T, typename Index, typename ConvType, int TileRows,
           int TileCols, int ChannelVectorWidth, int FeatureVectorWidth,
-          bool UseFastDiv, int WindowRows, int WindowCols, int Stride>
+          bool UseFastDiv, int WindowRows, int WindowCols, int Stride,
+          int Dilation>
 SNNStatus queue_tiled_kernel(BaseMemObject<T const>& input,
                              BaseMemObject<T const>& filter,
+                             BaseMemObject<T const>& bias,
                              BaseMemObject<T>& output,
                              Conv2DParams const& kernel_params,
+                             EpilogueParams const& epilogue,
                              tiled::TileInfo const& tile_info,
                              cl::sycl::queue& queue);
 
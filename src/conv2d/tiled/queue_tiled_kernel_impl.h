@@ -23,6 +23,8 @@
 
 #include "sycldnn/conv2d/params.h"
 
+#include "src/conv2d/epilogue/epilogue.h"
+
 #include "src/conv2d/tiled/kernels.h"
 #include "src/conv2d/tiled/tile_info.h"
 
@@ -52,28 +54,54 @@ cl::sycl::range<1> get_thread_range(Conv2DParams const& params,
   return {size};
 }
 
+/** Construct a forward convolution functor, which applies the epilogue. */
+template <typename Functor, typename T>
+Functor make_tiled_functor(conv_type::Forward, ReadAccessor<T const> input,
+                           ReadAccessor<T const> filter,
+                           WriteAccessor<T> output, Conv2DParams const& params,
+                           tiled::TileInfo const& tile_info,
+                           Epilogue<T> const& epilogue) {
+  return Functor{input, filter, output, params, tile_info, epilogue};
+}
+
+/** Construct a backprop convolution functor, which has no epilogue. */
+template <typename Functor, typename ConvType, typename T>
+Functor make_tiled_functor(ConvType, ReadAccessor<T const> input,
+                           ReadAccessor<T const> filter,
+                           WriteAccessor<T> output, Conv2DParams const& params,
+                           tiled::TileInfo const& tile_info,
+                           Epilogue<T> const& /*epilogue*/) {
+  return Functor{input, filter, output, params, tile_info};
+}
+
 }  // namespace
 
 template <typename T, typename Index, typename ConvType, int TileRows,
           int TileCols, int ChannelVectorWidth, int FeatureVectorWidth,
-          bool UseFastDiv, int WindowRows, int WindowCols, int Stride>
+          bool UseFastDiv, int WindowRows, int WindowCols, int Stride,
+          int Dilation>
 SNNStatus queue_tiled_kernel(BaseMemObject<T const>& in_mem,
                              BaseMemObject<T const>& fil_mem,
+                             BaseMemObject<T const>& bias_mem,
                              BaseMemObject<T>& out_mem,
                              Conv2DParams const& kernel_params,
+                             EpilogueParams const& epilogue,
                              tiled::TileInfo const& tile_info,
                              cl::sycl::queue& queue) {
   using Functor =
       tiled::TiledConv2D<T, Index, ConvType, TileRows, TileCols,
                          ChannelVectorWidth, FeatureVectorWidth, UseFastDiv,
-                         WindowRows, WindowCols, Stride>;
+                         WindowRows, WindowCols, Stride, Dilation>;
 
   auto event = queue.submit([&](cl::sycl::handler& cgh) {
     auto input = in_mem.read_accessor(cgh);
     auto filter = fil_mem.read_accessor(cgh);
+    auto bias = bias_mem.read_accessor(cgh);
     auto output = out_mem.write_accessor(cgh);
 
-    Functor conv{input, filter, output, kernel_params, tile_info};
+    auto conv = make_tiled_functor<Functor>(ConvType{}, input, filter, output,
+                                            kernel_params, tile_info,
+                                            Epilogue<T>{epilogue, bias});
     auto threads = get_thread_range(kernel_params, tile_info, queue);
 
     cgh.parallel_for(threads, conv);
@@ -149,7 +149,12 @@ struct FilterTile : public helpers::RegisterTile3D<
   }
 };
 
-/* An OutTileRows x OutTileCols tile to collect output results. */
+/*
+ * An OutTileRows x OutTileCols tile to collect output results.
+ *
+ * The output is either NHWC or channel blocked NCHWc, where an NHWC tensor is
+ * written as a single block holding all of the features.
+ */
 template <typename T, int VectorWidth, int OutTileRows, int OutTileCols>
 struct OutputTile final
     : helpers::RegisterTile2D<
@@ -163,25 +168,26 @@ struct OutputTile final
                                    Index const batch, Index const out_row,
                                    Index const n_rows, Index const out_col,
                                    Index const n_cols, Index const feature,
-                                   Index const n_features) {
+                                   Index const n_features,
+                                   Index const feature_block) {
+    Index const offset =
+        batch * n_rows * n_cols * n_features +
+        (feature / feature_block) * n_rows * n_cols * feature_block +
+        (out_row * n_cols + out_col) * feature_block + feature % feature_block;
     if (out_row + OutTileRows < n_rows && out_col + OutTileCols < n_cols) {
-      write_out_no_check(output, batch, out_row, n_rows, out_col, n_cols,
-                         feature, n_features);
+      write_out_no_check(output, offset, n_cols, feature_block);
     } else {
-      write_out_checked(output, batch, out_row, n_rows, out_col, n_cols,
-                        feature, n_features);
+      write_out_checked(output, offset, out_row, n_rows, out_col, n_cols,
+                        feature_block);
     }
   }
 
  private:
   template <typename Index, cl::sycl::access::address_space Space>
   void SNN_ALWAYS_INLINE write_out_checked(
-      cl::sycl::multi_ptr<T, Space> output, Index const batch,
+      cl::sycl::multi_ptr<T, Space> output, Index const offset,
       Index const out_row, Index const n_rows, Index const out_col,
-      Index const n_cols, Index const feature, Index const n_features) {
-    Index const offset =
-        ((batch * n_rows + out_row) * n_cols + out_col) * n_features + feature;
-
+      Index const n_cols, Index const feature_block) {
     Index row_idx = offset;
     SNN_PRAGMA_UNROLL
     for (int tile_row = 0; tile_row < OutTileRows; ++tile_row) {
@@ -192,22 +198,18 @@ struct OutputTile final
           if (tile_col < n_cols - out_col) {
             helpers::io::Store<VecType>()(output, idx,
                                           data(tile_row, tile_col));
-            idx += n_features;
+            idx += feature_block;
           }
         }
-        row_idx += n_cols * n_features;
+        row_idx += n_cols * feature_block;
       }
     }
   }
 
   template <typename Index, cl::sycl::access::address_space Space>
   void SNN_ALWAYS_INLINE write_out_no_check(
-      cl::sycl::multi_ptr<T, Space> output, Index const batch,
-      Index const out_row, Index const n_rows, Index const out_col,
-      Index const n_cols, Index const feature, Index const n_features) {
-    Index const offset =
-        ((batch * n_rows + out_row) * n_cols + out_col) * n_features + feature;
-
+      cl::sycl::multi_ptr<T, Space> output, Index const offset,
+      Index const n_cols, Index const feature_block) {
     Index row_idx = offset;
     SNN_PRAGMA_UNROLL
     for (int tile_row = 0; tile_row < OutTileRows; ++tile_row) {
@@ -215,9 +217,9 @@ struct OutputTile final
       SNN_PRAGMA_UNROLL
       for (int tile_col = 0; tile_col < OutTileCols; ++tile_col) {
         helpers::io::Store<VecType>()(output, idx, data(tile_row, tile_col));
-        idx += n_features;
+        idx += feature_block;
       }
-      row_idx += n_cols * n_features;
+      row_idx += n_cols * feature_block;
     }
   }
 };
@@ -24,6 +24,8 @@
 
 #include "src/helpers/tensor_index.h"
 
+#include "src/conv2d/epilogue/epilogue.h"
+
 #include "src/conv2d/winograd/kernels/tiles.h"
 
 namespace sycldnn {
@@ -31,12 +33,20 @@ namespace conv2d {
 namespace internal {
 namespace winograd {
 
+/**
+ * Extract the output tiles for a forward or input backprop convolution.
+ *
+ * The epilogue is applied to each output tile before it is written. Input
+ * backprop convolutions are launched with an epilogue which leaves the output
+ * unchanged.
+ */
 template <typename T, typename Index, int M, int N, int R, int S,
           typename ConvType, bool Accumulate = false>
 struct ExtractOutputTiles {
   ExtractOutputTiles(Conv2DParams const& params, TileInfo const& tile_info,
                      ReadAccessor<T const> const& input,
-                     WriteAccessor<T> const& output)
+                     WriteAccessor<T> const& output,
+                     Epilogue<T> const& epilogue)
       : n_threads_{params.batch * tile_info.rows * tile_info.cols *
                    params.features},
         n_tiles_{tile_info.number * params.batch},
@@ -46,7 +56,8 @@ struct ExtractOutputTiles {
         n_out_cols_{params.out_cols},
         n_features_{params.features},
         input_accessor_{input},
-        output_accessor_{output} {}
+        output_accessor_{output},
+        epilogue_{epilogue} {}
 
   void SNN_ALWAYS_INLINE operator()(cl::sycl::item<1> item) const {
     Index const index = item.get_id(0);
@@ -82,13 +93,28 @@ struct ExtractOutputTiles {
 
       SYCLOutputWindow<Index> out_w{rend - row, cend - col, offset};
 
+      OutputTile<T, M, N, R, S> out_tile{tmp};
+      apply_epilogue(out_tile, feature);
       OutputData<T, M, N, R, S>::write_output(output_data, out_w, n_out_cols_,
-                                              n_features_,
-                                              OutputTile<T, M, N, R, S>{tmp});
+                                              n_features_, out_tile);
     }
   }
 
  private:
+  /**
+   * Apply the epilogue to each value in the output tile. All values in the
+   * tile belong to the same feature, so the bias is only loaded once.
+   */
+  void SNN_ALWAYS_INLINE apply_epilogue(OutputTile<T, M, N, R, S>& tile,
+                                        Index const feature) const {
+    T const bias = epilogue_.template load_bias<T>(feature);
+    for (int r = 0; r < M; ++r) {
+      for (int c = 0; c < N; ++c) {
+        tile.data(r, c) = epilogue_.activate(tile.data(r, c) + bias);
+      }
+    }
+  }
+
   Index const n_threads_;
   Index const n_tiles_;
   Index const n_tile_rows_;
@@ -98,6 +124,7 @@ struct ExtractOutputTiles {
   Index const n_features_;
   ReadAccessor<T const> input_accessor_;
   WriteAccessor<T> output_accessor_;
+  Epilogue<T> const epilogue_;
 };
 
 template <typename T, typename Index, int M, int N, int R, int S,
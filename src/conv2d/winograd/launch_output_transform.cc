@@ -16,6 +16,7 @@
 #include "sycldnn/internal/conv2d/winograd/launch_output_transform.h"
 
 #include "sycldnn/conv2d/conv_type.h"
+#include "sycldnn/conv2d/epilogue.h"
 
 #include "src/conv2d/winograd/queue_output_transform.h"
 
@@ -34,15 +35,36 @@ SNNStatus launch_output_transform(BaseMemObject<T const>& intermediate,
                                   TileInfo const& tile_info,
                                   cl::sycl::queue& queue) {
   return queue_output_transform<T, int, ConvType, M, N, R, S, Accumulate>(
-      intermediate, output, params, tile_info, queue);
+      intermediate, intermediate, output, params, EpilogueParams{}, tile_info,
+      queue);
 }
 
-#define INSTANTIATE_LAUNCHER(DTYPE, CTYPE, M, N, R, S, ACC)      \
-  template SNN_EXPORT SNNStatus                                  \
-  launch_output_transform<DTYPE, CTYPE, M, N, R, S, ACC>(        \
-      BaseMemObject<DTYPE const> & intermediate,                 \
-      BaseMemObject<DTYPE> & output, Conv2DParams const& params, \
-      TileInfo const& tile_info, cl::sycl::queue& queue);
+template <typename T, typename ConvType, int M, int N, int R, int S,
+          bool Accumulate>
+SNNStatus launch_output_transform(BaseMemObject<T const>& intermediate,
+                                  BaseMemObject<T const>& bias,
+                                  BaseMemObject<T>& output,
+                                  Conv2DParams const& params,
+                                  EpilogueParams const& epilogue,
+                                  TileInfo const& tile_info,
+                                  cl::sycl::queue& queue) {
+  return queue_output_transform<T, int, ConvType, M, N, R, S, Accumulate>(
+      intermediate, bias, output, params, epilogue, tile_info, queue);
+}
+
+#define INSTANTIATE_LAUNCHER(DTYPE, CTYPE, M, N, R, S, ACC)        \
+  template SNN_EXPORT SNNStatus                                    \
+  launch_output_transform<DTYPE, CTYPE, M, N, R, S, ACC>(          \
+      BaseMemObject<DTYPE const> & intermediate,                   \
+      BaseMemObject<DTYPE> & output, Conv2DParams const& params,   \
+      TileInfo const& tile_info, cl::sycl::queue& queue);          \
+  template SNN_EXPORT SNNStatus                                    \
+  launch_output_transform<DTYPE, CTYPE, M, N, R, S, ACC>(          \
+      BaseMemObject<DTYPE const> & intermediate,                   \
+      BaseMemObject<DTYPE const> & bias,                           \
+      BaseMemObject<DTYPE> & output, Conv2DParams const& params,   \
+      EpilogueParams const& epilogue, TileInfo const& tile_info,   \
+      cl::sycl::queue& queue);
 
 #define INSTANTIATE_FOR_TYPE(DTYPE)                                         \
   INSTANTIATE_LAUNCHER(DTYPE, conv_type::Forward, 4, 4, 3, 3, false)        \
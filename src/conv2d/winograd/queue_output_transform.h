@@ -19,6 +19,7 @@
 #include "sycldnn/mem_object.h"
 #include "sycldnn/status.h"
 
+#include "sycldnn/conv2d/epilogue.h"
 #include "sycldnn/conv2d/params.h"
 #include "sycldnn/internal/conv2d/winograd/tile_info.h"
 
@@ -32,8 +33,10 @@ namespace winograd {
 template <typename T, typename Index, typename ConvType, int M, int N, int R,
           int S, bool Accumulate>
 SNNStatus queue_output_transform(BaseMemObject<T const>& intermediate,
+                                 BaseMemObject<T const>& bias,
                                  BaseMemObject<T>& output,
                                  Conv2DParams const& kernel_params,
+                                 EpilogueParams const& epilogue,
                                  TileInfo const& tile_info,
                                  cl::sycl::queue& queue);
 
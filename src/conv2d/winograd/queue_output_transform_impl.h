@@ -20,6 +20,8 @@
 
 #include "src/conv2d/winograd/queue_output_transform.h"
 
+#include "src/conv2d/epilogue/epilogue.h"
+
 #include "src/conv2d/winograd/kernels/extract_output_transform.h"
 
 namespace sycldnn {
@@ -56,13 +58,42 @@ inline cl::sycl::range<1> get_thread_range<conv_type::FilterBackprop>(
   return cl::sycl::range<1>{n_threads};
 }
 
+/**
+ * Construct a forward or input backprop output transform functor, which
+ * applies the epilogue.
+ */
+template <typename Functor, typename ConvType, typename T>
+Functor make_output_functor(ConvType, Conv2DParams const& params,
+                            TileInfo const& tile_info,
+                            ReadAccessor<T const> input,
+                            WriteAccessor<T> output,
+                            Epilogue<T> const& epilogue) {
+  return Functor{params, tile_info, input, output, epilogue};
+}
+
+/**
+ * Construct a filter backprop output transform functor, which has no
+ * epilogue.
+ */
+template <typename Functor, typename T>
+Functor make_output_functor(conv_type::FilterBackprop,
+                            Conv2DParams const& params,
+                            TileInfo const& tile_info,
+                            ReadAccessor<T const> input,
+                            WriteAccessor<T> output,
+                            Epilogue<T> const& /*epilogue*/) {
+  return Functor{params, tile_info, input, output};
+}
+
 }  // namespace
 
 template <typename T, typename Index, typename ConvType, int M, int N, int R,
           int S, bool Accumulate>
 SNNStatus queue_output_transform(BaseMemObject<T const>& intermediate_mem,
+                                 BaseMemObject<T const>& bias_mem,
                                  BaseMemObject<T>& output_mem,
                                  Conv2DParams const& params,
+                                 EpilogueParams const& epilogue,
                                  TileInfo const& tile_info,
                                  cl::sycl::queue& queue) {
   using Functor =
@@ -70,9 +101,12 @@ SNNStatus queue_output_transform(BaseMemObject<T const>& intermediate_mem,
 
   auto event = queue.submit([&](cl::sycl::handler& cgh) {
     auto intermediate = intermediate_mem.read_accessor(cgh);
+    auto bias = bias_mem.read_accessor(cgh);
     auto output = output_mem.write_accessor(cgh);
     auto range = get_thread_range<ConvType>(params, tile_info);
-    Functor conv{params, tile_info, intermediate, output};
+    auto conv = make_output_functor<Functor>(ConvType{}, params, tile_info,
+                                             intermediate, output,
+                                             Epilogue<T>{epilogue, bias});
 
     cgh.parallel_for(range, conv);
   });
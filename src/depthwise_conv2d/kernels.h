@@ -48,11 +48,18 @@ struct DepthwiseConv2D<T, Index, conv2d::conv_type::Forward, VectorWidth> {
                   WriteAccessor<T> const& output)
       : n_elems_{n_elems / VectorWidth},
         features_{params.channels * params.channel_multiplier},
+        in_block_{get_pixel_channels(params.input_format, params.channels)},
+        out_block_{get_pixel_channels(params.input_format, features_)},
         p_{params},
         input_accessor_{input},
         filter_accessor_{filter},
         output_accessor_{output} {}
 
+  /**
+   * The input and output are either NHWC or channel blocked NCHWc. A channel
+   * is read from the same block at every pixel in the window, so only the
+   * initial offsets depend on the format.
+   */
   void SNN_ALWAYS_INLINE operator()(cl::sycl::item<1> item) const {
     const Index index = item.get_id(0);
 
@@ -87,17 +94,19 @@ struct DepthwiseConv2D<T, Index, conv2d::conv_type::Forward, VectorWidth> {
 
       DataType out_val{0};
       Index const input_initial_offset =
-          batch_idx * p_.in_cols * p_.in_rows * p_.channels + channel;
+          batch_idx * p_.in_cols * p_.in_rows * p_.channels +
+          (channel / in_block_) * p_.in_rows * p_.in_cols * in_block_ +
+          channel % in_block_;
       Index const filter_initial_offset =
           channel * p_.channel_multiplier + multiple;
 
       Index input_row_offset =
-          input_initial_offset + rstart * p_.in_cols * p_.channels;
+          input_initial_offset + rstart * p_.in_cols * in_block_;
       Index filter_row_offset =
           filter_initial_offset + firstr * p_.window_rows * features_;
       for (Index row = rstart, i = firstr; i < p_.window_rows; ++row, ++i) {
         if (row >= 0 && row < p_.in_rows) {
-          Index input_offset = input_row_offset + cstart * p_.channels;
+          Index input_offset = input_row_offset + cstart * in_block_;
           Index filter_offset = filter_row_offset + firstc * features_;
 
           for (Index col = cstart, j = firstc; j < p_.window_cols; ++col, ++j) {
@@ -108,23 +117,30 @@ struct DepthwiseConv2D<T, Index, conv2d::conv_type::Forward, VectorWidth> {
               out_val = helpers::math::mad(in_val, fil_val, out_val);
             }
 
-            input_offset += p_.channels;
+            input_offset += in_block_;
             filter_offset += features_;
           }  // col loop
         }
 
-        input_row_offset += p_.in_cols * p_.channels;
+        input_row_offset += p_.in_cols * in_block_;
         filter_row_offset += p_.window_cols * features_;
       }  // row loop
 
+      Index const output_offset =
+          batch_idx * p_.out_rows * p_.out_cols * features_ +
+          (feature / out_block_) * p_.out_rows * p_.out_cols * out_block_ +
+          (row_idx * p_.out_cols + col_idx) * out_block_ +
+          feature % out_block_;
       auto output_data = output_accessor_.get_pointer();
-      Store()(output_data, index * VectorWidth, out_val);
+      Store()(output_data, output_offset, out_val);
     }
   }
 
  private:
   Index const n_elems_;
   Index const features_;
+  Index const in_block_;
+  Index const out_block_;
   DepthwiseConv2DParams const p_;
   ReadAccessor<T const> const input_accessor_;
   ReadAccessor<T const> const filter_accessor_;
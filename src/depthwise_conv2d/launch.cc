@@ -13,20 +13,25 @@
  * See the License for the specific language governing permissions and
  * limitations under the License.
  */
+#include "sycldnn/data_format.h"
 #include "sycldnn/mem_object.h"
 #include "sycldnn/status.h"
 
 #include "sycldnn/conv2d/conv_type.h"
 
+#include "sycldnn/depthwise_conv2d/algorithm.h"
 #include "sycldnn/depthwise_conv2d/params.h"
 
 #include "src/depthwise_conv2d/kernel_params.h"
 #include "src/depthwise_conv2d/output_size.h"
 #include "src/depthwise_conv2d/queue_depthwise_conv2d.h"
+#include "src/depthwise_conv2d/register_tiled_kernel.h"
+#include "src/depthwise_conv2d/tiled_kernel.h"
 
 #include <stddef.h>
 #include <cstdint>
 #include <limits>
+#include <type_traits>
 
 #include <CL/sycl.hpp>
 
@@ -45,7 +50,9 @@ bool can_vectorize(DepthwiseConv2DParams const& p, int vector_width) {
   if (p.channel_multiplier != 1) {
     return false;
   }
-  return (p.channels * p.channel_multiplier) % vector_width == 0;
+  // The vectors of a channel blocked tensor cannot cross a block.
+  int const features = p.channels * p.channel_multiplier;
+  return get_pixel_channels(p.input_format, features) % vector_width == 0;
 }
 
 template <typename ConvType, typename T, typename Index, int VectorWidth>
@@ -90,6 +97,168 @@ SNNStatus launch_vectorised(BaseMemObject<T const>& input,
   }
 }
 
+/**
+ * The smallest number of channels to use the tiled kernel. With fewer
+ * channels most of the work-items in each work-group would be idle.
+ */
+constexpr int min_tiled_channels = TiledKernelSizes::ChannelBlock / 2;
+
+/**
+ * Whether the forward convolution can use the tiled kernels, which are only
+ * available for common 3x3 and 5x5 windows on NHWC tensors.
+ */
+bool is_tiled_window(DepthwiseConv2DParams const& params) {
+  if (params.input_format != DataFormat::NHWC) {
+    return false;
+  }
+  bool const supported_window =
+      params.window_rows == params.window_cols &&
+      (params.window_rows == 3 || params.window_rows == 5);
+  bool const supported_stride =
+      params.stride_rows == params.stride_cols &&
+      (params.stride_rows == 1 || params.stride_rows == 2);
+  return supported_window && supported_stride &&
+         params.channel_multiplier == 1;
+}
+
+/**
+ * Whether the forward convolution can use the local memory tiled kernel on
+ * the given device.
+ */
+template <typename T>
+bool can_use_tiled_kernel(DepthwiseConv2DParams const& params,
+                          cl::sycl::device const& device) {
+  if (!is_tiled_window(params) || params.channels < min_tiled_channels) {
+    return false;
+  }
+  if (device.get_info<cl::sycl::info::device::local_mem_type>() ==
+      cl::sycl::info::local_mem_type::none) {
+    return false;
+  }
+  size_t const local_bytes =
+      TiledKernelSizes::local_size(params.window_rows, params.stride_rows) *
+      sizeof(T);
+  return device.get_info<cl::sycl::info::device::max_work_group_size>() >=
+             static_cast<size_t>(TiledKernelSizes::WorkGroupSize) &&
+         device.get_info<cl::sycl::info::device::local_mem_size>() >=
+             local_bytes;
+}
+
+template <typename T, typename IndexType>
+SNNStatus launch_tiled(BaseMemObject<T const>& input,
+                       BaseMemObject<T const>& filter, BaseMemObject<T>& output,
+                       DepthwiseConv2DParams const& params,
+                       cl::sycl::queue& queue) {
+  if (params.window_rows == 3) {
+    if (params.stride_rows == 1) {
+      return queue_tiled_kernel<3, 1, T, IndexType>(input, filter, output,
+                                                    params, queue);
+    } else {
+      return queue_tiled_kernel<3, 2, T, IndexType>(input, filter, output,
+                                                    params, queue);
+    }
+  } else {
+    if (params.stride_rows == 1) {
+      return queue_tiled_kernel<5, 1, T, IndexType>(input, filter, output,
+                                                    params, queue);
+    } else {
+      return queue_tiled_kernel<5, 2, T, IndexType>(input, filter, output,
+                                                    params, queue);
+    }
+  }
+}
+
+template <typename T, typename IndexType, int VectorWidth>
+SNNStatus launch_register_tiled_vectorised(BaseMemObject<T const>& input,
+                                           BaseMemObject<T const>& filter,
+                                           BaseMemObject<T>& output,
+                                           DepthwiseConv2DParams const& params,
+                                           cl::sycl::queue& queue) {
+  constexpr int TileRows = RegisterTiledKernelSizes::TileRows;
+  constexpr int TileCols = RegisterTiledKernelSizes::TileCols;
+  if (params.window_rows == 3) {
+    if (params.stride_rows == 1) {
+      return queue_register_tiled_kernel<VectorWidth, 3, 1, TileRows, TileCols,
+                                         T, IndexType>(input, filter, output,
+                                                       params, queue);
+    } else {
+      return queue_register_tiled_kernel<VectorWidth, 3, 2, TileRows, TileCols,
+                                         T, IndexType>(input, filter, output,
+                                                       params, queue);
+    }
+  } else {
+    if (params.stride_rows == 1) {
+      return queue_register_tiled_kernel<VectorWidth, 5, 1, TileRows, TileCols,
+                                         T, IndexType>(input, filter, output,
+                                                       params, queue);
+    } else {
+      return queue_register_tiled_kernel<VectorWidth, 5, 2, TileRows, TileCols,
+                                         T, IndexType>(input, filter, output,
+                                                       params, queue);
+    }
+  }
+}
+
+template <typename T, typename IndexType>
+SNNStatus launch_register_tiled(BaseMemObject<T const>& input,
+                                BaseMemObject<T const>& filter,
+                                BaseMemObject<T>& output,
+                                DepthwiseConv2DParams const& params,
+                                cl::sycl::queue& queue) {
+  using Forward = conv2d::conv_type::Forward;
+  if (can_vectorize<Forward>(params, 4)) {
+    return launch_register_tiled_vectorised<T, IndexType, 4>(
+        input, filter, output, params, queue);
+  } else if (can_vectorize<Forward>(params, 2)) {
+    return launch_register_tiled_vectorised<T, IndexType, 2>(
+        input, filter, output, params, queue);
+  } else {
+    return launch_register_tiled_vectorised<T, IndexType, 1>(
+        input, filter, output, params, queue);
+  }
+}
+
+template <typename ConvType, typename T, typename IndexType>
+SNNStatus launch_with_index(BaseMemObject<T const>& input,
+                            BaseMemObject<T const>& filter,
+                            BaseMemObject<T>& output,
+                            DepthwiseConv2DParams const& params,
+                            IndexType output_size, cl::sycl::queue& queue) {
+  bool const use_tiled =
+      std::is_same<ConvType, conv2d::conv_type::Forward>::value &&
+      is_tiled_window(params);
+  cl::sycl::device const device = queue.get_device();
+  switch (params.algorithm) {
+    case Algorithm::Direct:
+      return launch_vectorised<ConvType, T, IndexType>(
+          input, filter, output, params, output_size, queue);
+    case Algorithm::LocalTiled:
+      if (use_tiled && can_use_tiled_kernel<T>(params, device)) {
+        return launch_tiled<T, IndexType>(input, filter, output, params, queue);
+      }
+      return StatusCode::InvalidAlgorithm;
+    case Algorithm::RegisterTiled:
+      if (use_tiled) {
+        return launch_register_tiled<T, IndexType>(input, filter, output,
+                                                   params, queue);
+      }
+      return StatusCode::InvalidAlgorithm;
+    case Algorithm::Automatic:
+      break;
+  }
+  if (use_tiled) {
+    // Local memory on CPU devices is just global memory, so the registers
+    // give better reuse there and allow the channels to be vectorised.
+    if (!device.is_cpu() && can_use_tiled_kernel<T>(params, device)) {
+      return launch_tiled<T, IndexType>(input, filter, output, params, queue);
+    }
+    return launch_register_tiled<T, IndexType>(input, filter, output, params,
+                                               queue);
+  }
+  return launch_vectorised<ConvType, T, IndexType>(input, filter, output,
+                                                   params, output_size, queue);
+}
+
 }  // namespace
 
 template <typename ConvType, typename T>
@@ -100,14 +269,14 @@ SNNStatus launch(BaseMemObject<T const>& input, BaseMemObject<T const>& filter,
   auto kernel_params = get_kernel_params<ConvType>(params);
   if (output_size > static_cast<size_t>(std::numeric_limits<int32_t>::max())) {
 #ifdef SNN_USE_INT64
-    return launch_vectorised<ConvType, T, int64_t>(
+    return launch_with_index<ConvType, T, int64_t>(
         input, filter, output, kernel_params, static_cast<int64_t>(output_size),
         queue);
 #else
     return StatusCode::IndexExceeded;
 #endif  // SNN_USE_INT64
   } else {
-    return launch_vectorised<ConvType, T, int32_t>(
+    return launch_with_index<ConvType, T, int32_t>(
         input, filter, output, kernel_params, static_cast<int32_t>(output_size),
         queue);
   }
@@ -40,6 +40,31 @@ SNNStatus queue_kernel_fil_bk(BaseMemObject<T const>& input,
                               DepthwiseConv2DParams const& kernel_params,
                               Index output_size, cl::sycl::queue& queue);
 
+/**
+ * Queue a forward depthwise convolution which shares input values between
+ * the outputs of a work-group through local memory. Only supports a channel
+ * multiplier of 1, with square Window x Window filters and equal strides.
+ */
+template <int Window, int Stride, typename T, typename Index>
+SNNStatus queue_tiled_kernel(BaseMemObject<T const>& input,
+                             BaseMemObject<T const>& filter,
+                             BaseMemObject<T>& output,
+                             DepthwiseConv2DParams const& kernel_params,
+                             cl::sycl::queue& queue);
+
+/**
+ * Queue a forward depthwise convolution where each work-item computes a
+ * TileRows x TileCols tile of outputs for VectorWidth channels, reusing input
+ * values held in registers. Only supports a channel multiplier of 1, with
+ * square Window x Window filters and equal strides.
+ */
+template <int VectorWidth, int Window, int Stride, int TileRows, int TileCols,
+          typename T, typename Index>
+SNNStatus queue_register_tiled_kernel(
+    BaseMemObject<T const>& input, BaseMemObject<T const>& filter,
+    BaseMemObject<T>& output, DepthwiseConv2DParams const& kernel_params,
+    cl::sycl::queue& queue);
+
 }  // namespace internal
 }  // namespace depthwise_conv2d
 }  // namespace sycldnn
@@ -0,0 +1,74 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef SYCLDNN_SRC_DEPTHWISE_CONV2D_QUEUE_REGISTER_TILED_KERNEL_IMPL_H_
+#define SYCLDNN_SRC_DEPTHWISE_CONV2D_QUEUE_REGISTER_TILED_KERNEL_IMPL_H_
+
+#include "sycldnn/accessor_types.h"
+#include "sycldnn/mem_object.h"
+#include "sycldnn/status.h"
+
+#include "sycldnn/depthwise_conv2d/params.h"
+
+#include "sycldnn/helpers/ratio.h"
+
+#include "src/depthwise_conv2d/queue_depthwise_conv2d.h"
+#include "src/depthwise_conv2d/register_tiled_kernel.h"
+
+#include <CL/sycl.hpp>
+
+namespace sycldnn {
+namespace depthwise_conv2d {
+namespace internal {
+
+template <int VectorWidth, int Window, int Stride, int TileRows, int TileCols,
+          typename T, typename Index>
+SNNStatus queue_register_tiled_kernel(
+    BaseMemObject<T const>& input_mem, BaseMemObject<T const>& filter_mem,
+    BaseMemObject<T>& output_mem, DepthwiseConv2DParams const& kernel_params,
+    cl::sycl::queue& queue) {
+  using Functor = RegisterTiledDepthwiseConv2D<T, Index, VectorWidth, Window,
+                                               Stride, TileRows, TileCols>;
+
+  Index const n_row_tiles = helpers::round_ratio_up_above_zero(
+      kernel_params.out_rows, TileRows);
+  Index const n_col_tiles = helpers::round_ratio_up_above_zero(
+      kernel_params.out_cols, TileCols);
+  Index const n_items = kernel_params.batch * n_row_tiles * n_col_tiles *
+                        (kernel_params.channels / VectorWidth);
+
+  cl::sycl::device device = queue.get_device();
+  size_t const workgroup_size =
+      device.get_info<cl::sycl::info::device::max_work_group_size>();
+  size_t const n_threads = helpers::round_up_to_nearest_multiple(
+      static_cast<size_t>(n_items), workgroup_size);
+
+  auto event = queue.submit([&](cl::sycl::handler& cgh) {
+    auto input = input_mem.read_accessor(cgh);
+    auto filter = filter_mem.read_accessor(cgh);
+    auto output = output_mem.write_accessor(cgh);
+    Functor conv(n_items, n_row_tiles, n_col_tiles, kernel_params, input,
+                 filter, output);
+
+    cgh.parallel_for(cl::sycl::range<1>{n_threads}, conv);
+  });
+  return {event, StatusCode::OK};
+}
+
+}  // namespace internal
+}  // namespace depthwise_conv2d
+}  // namespace sycldnn
+
+#endif  // SYCLDNN_SRC_DEPTHWISE_CONV2D_QUEUE_REGISTER_TILED_KERNEL_IMPL_H_
@@ -0,0 +1,197 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef SYCLDNN_SRC_DEPTHWISE_CONV2D_REGISTER_TILED_KERNEL_H_
+#define SYCLDNN_SRC_DEPTHWISE_CONV2D_REGISTER_TILED_KERNEL_H_
+
+#include "sycldnn/accessor_types.h"
+#include "sycldnn/helpers/macros.h"
+
+#include "sycldnn/depthwise_conv2d/params.h"
+
+#include "src/helpers/math.h"
+#include "src/helpers/register_tile.h"
+#include "src/helpers/vector_io.h"
+#include "src/helpers/vector_type.h"
+
+#include <CL/sycl.hpp>
+
+namespace sycldnn {
+namespace depthwise_conv2d {
+namespace internal {
+
+/** The default output tile computed by each register tiled work-item. */
+struct RegisterTiledKernelSizes {
+  /** The number of output rows computed by each work-item. */
+  static constexpr int TileRows = 2;
+  /** The number of output columns computed by each work-item. */
+  static constexpr int TileCols = 4;
+};
+
+/**
+ * Forward depthwise convolution computing a TileRows x TileCols tile of
+ * outputs in each work-item, reusing input values held in registers.
+ *
+ * Each work-item computes its output tile for a vector of VectorWidth
+ * channels. The filter window is loaded into registers once, then each row of
+ * the input patch covered by the tile is loaded in turn into a sliding row
+ * window of registers and accumulated into every output row whose window
+ * covers it. Each input value is therefore loaded once per work-item, rather
+ * than once for every output in the tile that uses it, and all arithmetic is
+ * carried out on channel vectors.
+ *
+ * Only supports NHWC tensors, HWCF filters and a channel multiplier of 1, with
+ * square windows and strides.
+ */
+template <typename T, typename Index, int VectorWidth, int Window, int Stride,
+          int TileRows, int TileCols>
+struct RegisterTiledDepthwiseConv2D {
+  using DataType = typename helpers::VectorType<T, VectorWidth>::type;
+  using Load = typename helpers::io::Load<DataType>;
+  using Store = typename helpers::io::Store<DataType>;
+
+  /** The number of input rows covered by the output tile. */
+  static constexpr int InputTileRows = (TileRows - 1) * Stride + Window;
+  /** The number of input columns covered by the output tile. */
+  static constexpr int InputTileCols = (TileCols - 1) * Stride + Window;
+
+  RegisterTiledDepthwiseConv2D(Index n_items, Index n_row_tiles,
+                               Index n_col_tiles,
+                               DepthwiseConv2DParams const& params,
+                               ReadAccessor<T const> const& input,
+                               ReadAccessor<T const> const& filter,
+                               WriteAccessor<T> const& output)
+      : n_items_{n_items},
+        n_row_tiles_{n_row_tiles},
+        n_col_tiles_{n_col_tiles},
+        n_channel_vecs_{params.channels / VectorWidth},
+        p_{params},
+        input_accessor_{input},
+        filter_accessor_{filter},
+        output_accessor_{output} {}
+
+  void SNN_ALWAYS_INLINE operator()(cl::sycl::item<1> item) const {
+    Index index = item.get_id(0);
+
+    if (index < n_items_) {
+      Index const channel = (index % n_channel_vecs_) * VectorWidth;
+      index /= n_channel_vecs_;
+      Index const col_tile = index % n_col_tiles_;
+      index /= n_col_tiles_;
+      Index const row_tile = index % n_row_tiles_;
+      Index const batch_idx = index / n_row_tiles_;
+
+      Index const first_out_row = row_tile * TileRows;
+      Index const first_out_col = col_tile * TileCols;
+      Index const first_in_row = first_out_row * Stride - p_.pad_rows;
+      Index const first_in_col = first_out_col * Stride - p_.pad_cols;
+
+      auto const filter_data = filter_accessor_.get_pointer();
+      helpers::RegisterTile2D<DataType, Window, Window> filter;
+      SNN_PRAGMA_UNROLL
+      for (int i = 0; i < Window; ++i) {
+        SNN_PRAGMA_UNROLL
+        for (int j = 0; j < Window; ++j) {
+          filter.data(i, j) =
+              Load()(filter_data, (i * Window + j) * p_.channels + channel);
+        }
+      }
+
+      helpers::RegisterTile2D<DataType, TileRows, TileCols> output;
+      SNN_PRAGMA_UNROLL
+      for (int tile_row = 0; tile_row < TileRows; ++tile_row) {
+        SNN_PRAGMA_UNROLL
+        for (int tile_col = 0; tile_col < TileCols; ++tile_col) {
+          output.data(tile_row, tile_col) = DataType{0};
+        }
+      }
+
+      auto const input_data = input_accessor_.get_pointer();
+      Index const input_initial_offset =
+          batch_idx * p_.in_rows * p_.in_cols * p_.channels + channel;
+      SNN_PRAGMA_UNROLL
+      for (int in_row = 0; in_row < InputTileRows; ++in_row) {
+        // Load the next input row of the patch, with zero padding outside
+        // the image.
+        Index const row = first_in_row + in_row;
+        bool const valid_row = row >= 0 && row < p_.in_rows;
+        Index const input_row_offset =
+            input_initial_offset + row * p_.in_cols * p_.channels;
+        helpers::RegisterTile1D<DataType, InputTileCols> input;
+        SNN_PRAGMA_UNROLL
+        for (int in_col = 0; in_col < InputTileCols; ++in_col) {
+          Index const col = first_in_col + in_col;
+          bool const valid = valid_row && col >= 0 && col < p_.in_cols;
+          input.data(in_col) =
+              valid ? Load()(input_data, input_row_offset + col * p_.channels)
+                    : DataType{0};
+        }
+
+        // Accumulate the row into every output row whose window covers it.
+        // The loop bounds are compile time constants, so once unrolled the
+        // window check is resolved statically.
+        SNN_PRAGMA_UNROLL
+        for (int tile_row = 0; tile_row < TileRows; ++tile_row) {
+          int const i = in_row - tile_row * Stride;
+          if (i >= 0 && i < Window) {
+            SNN_PRAGMA_UNROLL
+            for (int tile_col = 0; tile_col < TileCols; ++tile_col) {
+              SNN_PRAGMA_UNROLL
+              for (int j = 0; j < Window; ++j) {
+                output.data(tile_row, tile_col) = helpers::math::mad(
+                    input.data(tile_col * Stride + j), filter.data(i, j),
+                    output.data(tile_row, tile_col));
+              }
+            }
+          }
+        }
+      }
+
+      auto output_data = output_accessor_.get_pointer();
+      SNN_PRAGMA_UNROLL
+      for (int tile_row = 0; tile_row < TileRows; ++tile_row) {
+        Index const row = first_out_row + tile_row;
+        SNN_PRAGMA_UNROLL
+        for (int tile_col = 0; tile_col < TileCols; ++tile_col) {
+          Index const col = first_out_col + tile_col;
+          if (row < p_.out_rows && col < p_.out_cols) {
+            Index const output_offset =
+                ((batch_idx * p_.out_rows + row) * p_.out_cols + col) *
+                    p_.channels +
+                channel;
+            Store()(output_data, output_offset,
+                    output.data(tile_row, tile_col));
+          }
+        }
+      }
+    }
+  }
+
+ private:
+  Index const n_items_;
+  Index const n_row_tiles_;
+  Index const n_col_tiles_;
+  Index const n_channel_vecs_;
+  DepthwiseConv2DParams const p_;
+  ReadAccessor<T const> const input_accessor_;
+  ReadAccessor<T const> const filter_accessor_;
+  WriteAccessor<T> output_accessor_;
+};
+
+}  // namespace internal
+}  // namespace depthwise_conv2d
+}  // namespace sycldnn
+
+#endif  // SYCLDNN_SRC_DEPTHWISE_CONV2D_REGISTER_TILED_KERNEL_H_
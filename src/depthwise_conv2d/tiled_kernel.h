@@ -0,0 +1,190 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef SYCLDNN_SRC_DEPTHWISE_CONV2D_TILED_KERNEL_H_
+#define SYCLDNN_SRC_DEPTHWISE_CONV2D_TILED_KERNEL_H_
+
+#include "sycldnn/accessor_types.h"
+#include "sycldnn/helpers/macros.h"
+#include "sycldnn/helpers/minmax.h"
+
+#include "sycldnn/depthwise_conv2d/params.h"
+
+#include "src/helpers/math.h"
+
+#include <CL/sycl.hpp>
+
+namespace sycldnn {
+namespace depthwise_conv2d {
+namespace internal {
+
+/** The output tile and channel block computed by each tiled work-group. */
+struct TiledKernelSizes {
+  /** The number of output rows computed by each work-group. */
+  static constexpr int TileRows = 8;
+  /** The number of output columns computed by each work-group. */
+  static constexpr int TileCols = 8;
+  /** The number of channels computed by each work-group. */
+  static constexpr int ChannelBlock = 16;
+  /** The number of work-items in each work-group. */
+  static constexpr int WorkGroupSize = TileCols * ChannelBlock;
+
+  /**
+   * The number of values in the input patch required for a tile of outputs,
+   * including the halo of the window around the tile.
+   */
+  static constexpr int local_size(int window, int stride) {
+    return ((TileRows - 1) * stride + window) *
+           ((TileCols - 1) * stride + window) * ChannelBlock;
+  }
+};
+
+/**
+ * Forward depthwise convolution using local memory to share input values
+ * between neighbouring outputs.
+ *
+ * Each work-group computes a TileRows x TileCols tile of outputs for a block
+ * of ChannelBlock channels. The input patch needed by the tile, including its
+ * halo, is first loaded into local memory with adjacent work-items loading
+ * adjacent channels, so each input value is read from global memory roughly
+ * once rather than once for every output whose window covers it. Each
+ * work-item then computes a column of the output tile for a single channel,
+ * keeping the filter window for that channel in registers.
+ *
+ * Only supports NHWC tensors, HWCF filters and a channel multiplier of 1, with
+ * square windows and strides.
+ */
+template <typename T, typename Index, int Window, int Stride>
+struct TiledDepthwiseConv2D {
+  static constexpr int TileRows = TiledKernelSizes::TileRows;
+  static constexpr int TileCols = TiledKernelSizes::TileCols;
+  static constexpr int ChannelBlock = TiledKernelSizes::ChannelBlock;
+  static constexpr int WorkGroupSize = TiledKernelSizes::WorkGroupSize;
+  static constexpr int InputTileCols = (TileCols - 1) * Stride + Window;
+  /** The number of values required in local memory. */
+  static constexpr int LocalSize =
+      TiledKernelSizes::local_size(Window, Stride);
+
+  TiledDepthwiseConv2D(DepthwiseConv2DParams const& params,
+                       Index n_row_tiles, Index n_col_tiles,
+                       Index n_channel_blocks,
+                       ReadAccessor<T const> const& input,
+                       ReadAccessor<T const> const& filter,
+                       LocalAccessor<T> const& tile,
+                       WriteAccessor<T> const& output)
+      : n_row_tiles_{n_row_tiles},
+        n_col_tiles_{n_col_tiles},
+        n_channel_blocks_{n_channel_blocks},
+        p_{params},
+        input_accessor_{input},
+        filter_accessor_{filter},
+        tile_accessor_{tile},
+        output_accessor_{output} {}
+
+  void SNN_ALWAYS_INLINE operator()(cl::sycl::nd_item<1> item) const {
+    Index const local_idx = item.get_local_id(0);
+    Index group_idx = item.get_group(0);
+    Index const channel_block = group_idx % n_channel_blocks_;
+    group_idx /= n_channel_blocks_;
+    Index const col_tile = group_idx % n_col_tiles_;
+    group_idx /= n_col_tiles_;
+    Index const row_tile = group_idx % n_row_tiles_;
+    Index const batch_idx = group_idx / n_row_tiles_;
+
+    Index const first_channel = channel_block * ChannelBlock;
+    Index const first_out_row = row_tile * TileRows;
+    Index const first_out_col = col_tile * TileCols;
+    Index const first_in_row = first_out_row * Stride - p_.pad_rows;
+    Index const first_in_col = first_out_col * Stride - p_.pad_cols;
+
+    auto const input_data = input_accessor_.get_pointer();
+    auto tile = tile_accessor_.get_pointer();
+
+    // Values outside the image or past the last channel are zero padding.
+    Index const input_initial_offset =
+        batch_idx * p_.in_rows * p_.in_cols * p_.channels;
+    for (Index idx = local_idx; idx < LocalSize; idx += WorkGroupSize) {
+      Index const channel = first_channel + idx % ChannelBlock;
+      Index const pixel = idx / ChannelBlock;
+      Index const row = first_in_row + pixel / InputTileCols;
+      Index const col = first_in_col + pixel % InputTileCols;
+      bool const in_bounds = row >= 0 && row < p_.in_rows && col >= 0 &&
+                             col < p_.in_cols && channel < p_.channels;
+      tile[idx] = in_bounds
+                      ? input_data[input_initial_offset +
+                                   (row * p_.in_cols + col) * p_.channels +
+                                   channel]
+                      : T{0};
+    }
+    item.barrier(cl::sycl::access::fence_space::local_space);
+
+    Index const block_channel = local_idx % ChannelBlock;
+    Index const tile_col = local_idx / ChannelBlock;
+    Index const channel = first_channel + block_channel;
+    Index const out_col = first_out_col + tile_col;
+    if (channel < p_.channels && out_col < p_.out_cols) {
+      auto const filter_data = filter_accessor_.get_pointer();
+      T filter[Window][Window];
+      SNN_PRAGMA_UNROLL
+      for (int i = 0; i < Window; ++i) {
+        SNN_PRAGMA_UNROLL
+        for (int j = 0; j < Window; ++j) {
+          filter[i][j] = filter_data[(i * Window + j) * p_.channels + channel];
+        }
+      }
+
+      auto output_data = output_accessor_.get_pointer();
+      Index const n_rows = helpers::min(static_cast<Index>(TileRows),
+                                        p_.out_rows - first_out_row);
+      Index output_offset =
+          ((batch_idx * p_.out_rows + first_out_row) * p_.out_cols + out_col) *
+              p_.channels +
+          channel;
+      for (Index row = 0; row < n_rows; ++row) {
+        T out_val{0};
+        SNN_PRAGMA_UNROLL
+        for (int i = 0; i < Window; ++i) {
+          Index const tile_row_offset =
+              ((row * Stride + i) * InputTileCols + tile_col * Stride) *
+                  ChannelBlock +
+              block_channel;
+          SNN_PRAGMA_UNROLL
+          for (int j = 0; j < Window; ++j) {
+            T const in_val = tile[tile_row_offset + j * ChannelBlock];
+            out_val = helpers::math::mad(in_val, filter[i][j], out_val);
+          }
+        }
+        output_data[output_offset] = out_val;
+        output_offset += p_.out_cols * p_.channels;
+      }
+    }
+  }
+
+ private:
+  Index const n_row_tiles_;
+  Index const n_col_tiles_;
+  Index const n_channel_blocks_;
+  DepthwiseConv2DParams const p_;
+  ReadAccessor<T const> const input_accessor_;
+  ReadAccessor<T const> const filter_accessor_;
+  LocalAccessor<T> tile_accessor_;
+  WriteAccessor<T> output_accessor_;
+};
+
+}  // namespace internal
+}  // namespace depthwise_conv2d
+}  // namespace sycldnn
+
+#endif  // SYCLDNN_SRC_DEPTHWISE_CONV2D_TILED_KERNEL_H_
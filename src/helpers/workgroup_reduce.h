@@ -73,7 +73,9 @@ struct Sum {
  *
  * Assumes that the workgroup range is a power of two.
  * Assumes that the workspace pointer has sufficient storage to hold
- * (workgroup_size / 2) DataType elements.
+ * workgroup_size DataType elements. Only the upper half of each step's work
+ * items store their value, but they do so at their own local id, so the
+ * indices written go up to (workgroup_size - 1).
  */
 template <typename Op, typename Index, typename DataType, typename PtrType,
           int Dimensions, cl::sycl::access::address_space Space>
@@ -17,8 +17,14 @@
 
 #include "sycldnn/mem_object.h"
 
+#include "sycldnn/matmul/tile_config.h"
+
+#include "sycldnn/helpers/ratio.h"
+
 #include "src/matmul/queue_kernel.h"
 
+#include <algorithm>
+
 namespace sycldnn {
 namespace matmul {
 namespace internal {
@@ -41,27 +47,218 @@ SNNStatus launch_with_tiles(BaseMemObject<T const>& lhs,
                 wg_cols, wg_batch);
 }
 
+// The local memory kernel uses 4x4x4 register tiles in each work-item, with
+// 8x8 work-items in each work-group sharing panels of 16 accumulator values.
+constexpr int local_wg_rows = 8;
+constexpr int local_wg_cols = 8;
+constexpr int local_panel_depth = 16;
+constexpr int local_block_rows = 4 * local_wg_rows;
+constexpr int local_block_cols = 4 * local_wg_cols;
+
+// Check whether the device has enough local memory and a large enough
+// work-group size to run the local memory kernel.
+template <typename T>
+bool supports_local_kernel(cl::sycl::device const& device) {
+  if (device.get_info<cl::sycl::info::device::local_mem_type>() ==
+      cl::sycl::info::local_mem_type::none) {
+    return false;
+  }
+  // Two buffers each holding an LHS and an RHS panel.
+  size_t const local_bytes = 2 * (local_block_rows + local_block_cols) *
+                             local_panel_depth * sizeof(T);
+  return device.get_info<cl::sycl::info::device::local_mem_size>() >=
+             local_bytes &&
+         device.get_info<cl::sycl::info::device::max_work_group_size>() >=
+             static_cast<size_t>(local_wg_rows * local_wg_cols);
+}
+
+// Split the accumulation dimension when there are fewer than this many output
+// tiles, as the output alone is not enough work to fill the device.
+constexpr int split_k_max_output_tiles = 1024;
+// The minimum number of accumulator values computed in each split.
+constexpr int split_k_min_chunk = 256;
+// The number of work-items to aim for when splitting the accumulation.
+constexpr int split_k_target_tiles = 4096;
+// The maximum number of splits, which bounds the size of the workspace.
+constexpr int split_k_max_splits = 64;
+
+// Launch the matrix multiply kernel for the passed tile configuration. The
+// workspace is only needed when the configuration splits the accumulation
+// dimension, and may be null otherwise.
+template <typename T, bool TransposeLHS, bool TransposeRHS>
+SNNStatus launch_with_config(BaseMemObject<T const>& lhs,
+                             BaseMemObject<T const>& rhs,
+                             BaseMemObject<T>& output,
+                             BaseMemObject<T>* workspace, int batches, int m,
+                             int k, int n, T beta, cl::sycl::queue& queue,
+                             TileConfig const& config) {
+  if (!is_compiled(config)) {
+    return StatusCode::InvalidAlgorithm;
+  }
+  auto device = queue.get_device();
+  if (config.local_memory) {
+    if (!supports_local_kernel<T>(device)) {
+      return StatusCode::InvalidAlgorithm;
+    }
+    return queue_local_kernel<T, int, TransposeLHS, TransposeRHS, 4, 4, 4,
+                              local_wg_rows, local_wg_cols, local_panel_depth>(
+        lhs, rhs, output, batches, m, k, n, beta, queue);
+  }
+  size_t const wg_rows = config.wg_rows;
+  size_t const wg_cols = config.wg_cols;
+  size_t const wg_batch = config.wg_batch;
+  if (wg_rows * wg_cols * wg_batch >
+      device.get_info<cl::sycl::info::device::max_work_group_size>()) {
+    return StatusCode::InvalidAlgorithm;
+  }
+  if (config.k_splits > 1) {
+    if (workspace == nullptr) {
+      return StatusCode::InvalidAlgorithm;
+    }
+    return queue_split_k_kernel<T, int, TransposeLHS, TransposeRHS, 4, 4, 4>(
+        lhs, rhs, output, *workspace, batches, m, k, n, beta, config.k_splits,
+        queue, wg_rows, wg_cols);
+  }
+  // The tile shapes here must match those generated in CMakeLists.txt and
+  // accepted by is_compiled.
+  if (config.row_tile == 1) {
+    return launch_with_tiles<T, TransposeLHS, TransposeRHS, 1, 4, 4>(
+        lhs, rhs, output, batches, m, k, n, beta, queue, wg_rows, wg_cols,
+        wg_batch);
+  }
+  if (config.col_tile == 1) {
+    return launch_with_tiles<T, TransposeLHS, TransposeRHS, 4, 4, 1>(
+        lhs, rhs, output, batches, m, k, n, beta, queue, wg_rows, wg_cols,
+        wg_batch);
+  }
+  if (config.row_tile == 8) {
+    return launch_with_tiles<T, TransposeLHS, TransposeRHS, 8, 4, 4>(
+        lhs, rhs, output, batches, m, k, n, beta, queue, wg_rows, wg_cols,
+        wg_batch);
+  }
+  return launch_with_tiles<T, TransposeLHS, TransposeRHS, 4, 4, 4>(
+      lhs, rhs, output, batches, m, k, n, beta, queue, wg_rows, wg_cols,
+      wg_batch);
+}
+
 }  // namespace
 
-// Launch the matrix multiply kernel for the passed parameters.
+// Choose a tile configuration when no tuned configuration is provided.
+//
+// Multiplies with a small output but a long accumulation dimension, such as
+// those in convolution filter backprop, split the accumulation dimension
+// across work-items. Matrix-vector products use tiles which are one value wide
+// in the skinny dimension, so no work-items are wasted on padding. Otherwise
+// the local memory kernel is used when the device supports it and the
+// matrices are large enough to fill at least one of its work-group blocks.
+template <typename T>
+TileConfig get_default_config(cl::sycl::queue& queue, int batches, int m,
+                              int k, int n) {
+  TileConfig config;
+  int const output_tiles = batches * helpers::round_ratio_up(m, 4) *
+                           helpers::round_ratio_up(n, 4);
+  if (output_tiles < split_k_max_output_tiles &&
+      k >= 2 * split_k_min_chunk) {
+    int const max_splits = std::min(k / split_k_min_chunk, split_k_max_splits);
+    config.k_splits = std::max(
+        2, std::min(max_splits,
+                    helpers::round_ratio_up(split_k_target_tiles,
+                                            output_tiles)));
+  } else if (m < config.row_tile) {
+    config.row_tile = 1;
+    config.wg_rows = 1;
+    config.wg_cols = 32;
+  } else if (n < config.col_tile) {
+    config.col_tile = 1;
+    config.wg_rows = 32;
+    config.wg_cols = 1;
+  } else if (m >= local_block_rows && n >= local_block_cols &&
+             supports_local_kernel<T>(queue.get_device())) {
+    config.wg_rows = local_wg_rows;
+    config.wg_cols = local_wg_cols;
+    config.local_memory = true;
+  }
+  return config;
+}
+
+// Launch the matrix multiply kernel for the passed tile configuration.
 template <typename T, bool TransposeLHS, bool TransposeRHS>
 SNNStatus launch(BaseMemObject<T const>& lhs, BaseMemObject<T const>& rhs,
                  BaseMemObject<T>& output, int batches, int m, int k, int n,
-                 T beta, cl::sycl::queue& queue) {
-  return launch_with_tiles<T, TransposeLHS, TransposeRHS, 4, 4, 4>(
-      lhs, rhs, output, batches, m, k, n, beta, queue, 8, 4, 1);
+                 T beta, cl::sycl::queue& queue, TileConfig const& config) {
+  return launch_with_config<T, TransposeLHS, TransposeRHS>(
+      lhs, rhs, output, nullptr, batches, m, k, n, beta, queue, config);
+}
+
+// Launch the matrix multiply kernel for the passed tile configuration, using
+// the workspace to hold any partial products.
+template <typename T, bool TransposeLHS, bool TransposeRHS>
+SNNStatus launch(BaseMemObject<T const>& lhs, BaseMemObject<T const>& rhs,
+                 BaseMemObject<T>& output, BaseMemObject<T>& workspace,
+                 int batches, int m, int k, int n, T beta,
+                 cl::sycl::queue& queue, TileConfig const& config) {
+  return launch_with_config<T, TransposeLHS, TransposeRHS>(
+      lhs, rhs, output, &workspace, batches, m, k, n, beta, queue, config);
+}
+
+// The packed right hand side kernel uses a work-group of 8x4 work-items, which
+// each compute a 4x4 block of the output.
+constexpr size_t packed_rhs_wg_rows = 8;
+constexpr size_t packed_rhs_wg_cols = 4;
+
+// Pack the right hand side into the tile-blocked layout.
+template <typename T>
+SNNStatus launch_pack_rhs(BaseMemObject<T const>& rhs,
+                          BaseMemObject<T>& packed, int k, int n,
+                          cl::sycl::queue& queue) {
+  return queue_pack_rhs_kernel<T, int, packed_rhs_acc_tile,
+                               packed_rhs_col_tile>(rhs, packed, k, n, queue);
+}
+
+// Launch the matrix multiply kernel which reads a packed right hand side. The
+// packed panels are padded, so only the shape of the left hand side decides
+// whether the kernel needs to check bounds.
+template <typename T>
+SNNStatus launch_packed_rhs(BaseMemObject<T const>& lhs,
+                            BaseMemObject<T const>& packed_rhs,
+                            BaseMemObject<T>& output, int m, int k, int n,
+                            T beta, cl::sycl::queue& queue) {
+  constexpr int row_tile = 4;
+  auto kernel =
+      ((m % row_tile == 0) && (k % packed_rhs_acc_tile == 0) &&
+       (n % packed_rhs_col_tile == 0))
+          ? queue_packed_rhs_kernel<T, int, row_tile, packed_rhs_acc_tile,
+                                    packed_rhs_col_tile, false>
+          : queue_packed_rhs_kernel<T, int, row_tile, packed_rhs_acc_tile,
+                                    packed_rhs_col_tile, true>;
+  return kernel(lhs, packed_rhs, output, m, k, n, beta, queue,
+                packed_rhs_wg_rows, packed_rhs_wg_cols);
 }
 
 #define INSTANTIATE_LAUNCHER(DTYPE, TLHS, TRHS)                                \
   template SNN_EXPORT SNNStatus launch<DTYPE, TLHS, TRHS>(                     \
       BaseMemObject<DTYPE const> & input, BaseMemObject<DTYPE const> & filter, \
       BaseMemObject<DTYPE> & output, int batches, int m, int k, int n,         \
-      DTYPE beta, cl::sycl::queue& queue);
+      DTYPE beta, cl::sycl::queue& queue, TileConfig const& config);           \
+  template SNN_EXPORT SNNStatus launch<DTYPE, TLHS, TRHS>(                     \
+      BaseMemObject<DTYPE const> & input, BaseMemObject<DTYPE const> & filter, \
+      BaseMemObject<DTYPE> & output, BaseMemObject<DTYPE> & workspace,         \
+      int batches, int m, int k, int n, DTYPE beta, cl::sycl::queue& queue,    \
+      TileConfig const& config);
 
-#define INSTANTIATE_FOR_TYPE(DTYPE)        \
-  INSTANTIATE_LAUNCHER(DTYPE, true, true)  \
-  INSTANTIATE_LAUNCHER(DTYPE, false, true) \
-  INSTANTIATE_LAUNCHER(DTYPE, true, false) \
+#define INSTANTIATE_FOR_TYPE(DTYPE)                                            \
+  template SNN_EXPORT TileConfig get_default_config<DTYPE>(                    \
+      cl::sycl::queue & queue, int batches, int m, int k, int n);              \
+  template SNN_EXPORT SNNStatus launch_pack_rhs<DTYPE>(                        \
+      BaseMemObject<DTYPE const> & rhs, BaseMemObject<DTYPE> & packed,         \
+      int k, int n, cl::sycl::queue& queue);                                   \
+  template SNN_EXPORT SNNStatus launch_packed_rhs<DTYPE>(                      \
+      BaseMemObject<DTYPE const> & lhs, BaseMemObject<DTYPE const> & rhs,      \
+      BaseMemObject<DTYPE> & output, int m, int k, int n, DTYPE beta,          \
+      cl::sycl::queue& queue);                                                 \
+  INSTANTIATE_LAUNCHER(DTYPE, true, true)                                      \
+  INSTANTIATE_LAUNCHER(DTYPE, false, true)                                     \
+  INSTANTIATE_LAUNCHER(DTYPE, true, false)                                     \
   INSTANTIATE_LAUNCHER(DTYPE, false, false)
 
 INSTANTIATE_FOR_TYPE(float);
@@ -0,0 +1,252 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef SYCLDNN_SRC_MATMUL_LOCAL_KERNEL_H_
+#define SYCLDNN_SRC_MATMUL_LOCAL_KERNEL_H_
+
+#include "sycldnn/accessor_types.h"
+#include "sycldnn/status.h"
+
+#include "sycldnn/helpers/macros.h"
+
+#include "src/helpers/vector_io.h"
+#include "src/matmul/blocks.h"
+
+#include <array>
+
+namespace sycldnn {
+namespace matmul {
+
+/**
+ * Matrix multiply kernel which uses local memory to share the LHS and RHS
+ * matrices between the work-items in a work-group.
+ *
+ * Each work-group computes a block of (RowTile * WgRows) x (ColTile * WgCols)
+ * output values, with each work-item computing a RowTile x ColTile tile of
+ * that block in registers. The accumulation dimension is split into panels of
+ * PanelDepth values. The work-group cooperatively copies the LHS and RHS
+ * panels into local memory, then each work-item computes its tile from the
+ * values in local memory.
+ *
+ * The local memory is double buffered, so that the next panels are loaded
+ * while the current panels are used in the computation. This means only a
+ * single barrier is needed for each panel.
+ *
+ * The panels are always stored in local memory in a non-transposed layout, so
+ * any transposes are handled when copying data from global memory, which is
+ * also where all bounds checks are made. Any values outside the matrices are
+ * set to zero in local memory, so the computation itself needs no checks.
+ */
+template <typename T, typename Index, bool TransposeLHS, bool TransposeRHS,
+          int RowTile, int AccTile, int ColTile, int WgRows, int WgCols,
+          int PanelDepth>
+struct LocalMatmulKernel {
+  /** The number of output rows computed by a work-group. */
+  static constexpr int BlockRows = RowTile * WgRows;
+  /** The number of output columns computed by a work-group. */
+  static constexpr int BlockCols = ColTile * WgCols;
+  /** The number of work-items in each work-group. */
+  static constexpr int WorkGroupSize = WgRows * WgCols;
+  /** The number of LHS values in a single panel. */
+  static constexpr int LHSPanelSize = BlockRows * PanelDepth;
+  /** The number of RHS values in a single panel. */
+  static constexpr int RHSPanelSize = PanelDepth * BlockCols;
+  /** The number of values in one of the two local memory buffers. */
+  static constexpr int StageSize = LHSPanelSize + RHSPanelSize;
+  /** The total number of values required in local memory. */
+  static constexpr int LocalSize = 2 * StageSize;
+
+  static_assert(PanelDepth % AccTile == 0,
+                "The panel depth must be a multiple of the accumulator tile.");
+  static_assert(LHSPanelSize % WorkGroupSize == 0,
+                "The LHS panel must be evenly split across the work-group.");
+  static_assert(RHSPanelSize % WorkGroupSize == 0,
+                "The RHS panel must be evenly split across the work-group.");
+
+  LocalMatmulKernel(ReadAccessor<T const> const& lhs,
+                    ReadAccessor<T const> const& rhs,
+                    ReadWriteAccessor<T> const& output,
+                    LocalAccessor<T> const& local, Index batches, Index m,
+                    Index k, Index n, T beta)
+      : lhs_{lhs},
+        rhs_{rhs},
+        output_{output},
+        local_{local},
+        batches_{batches},
+        m_{m},
+        k_{k},
+        n_{n},
+        beta_{beta} {}
+
+  void SNN_ALWAYS_INLINE operator()(cl::sycl::nd_item<3> item) const {
+    Index const batch = item.get_global_id(0);
+    Index const local_row = item.get_local_id(1);
+    Index const local_col = item.get_local_id(2);
+    Index const local_idx = local_row * WgCols + local_col;
+    Index const block_row = item.get_group(1) * BlockRows;
+    Index const block_col = item.get_group(2) * BlockCols;
+
+    auto lhs_ptr = lhs_.get_pointer() + batch * m_ * k_;
+    auto rhs_ptr = rhs_.get_pointer() + batch * k_ * n_;
+    auto local_ptr = local_.get_pointer();
+
+    auto out_block = VectorBlock<T, RowTile, ColTile>{};
+    Index const n_panels = (k_ + PanelDepth - 1) / PanelDepth;
+
+    // Every work-item in the work-group must reach each barrier, so there can
+    // be no early exit for work-items outside the output matrix.
+    load_panels(lhs_ptr, rhs_ptr, local_ptr, block_row, block_col, 0,
+                local_idx);
+    item.barrier(cl::sycl::access::fence_space::local_space);
+    for (Index panel = 0; panel < n_panels; ++panel) {
+      if (panel + 1 < n_panels) {
+        load_panels(lhs_ptr, rhs_ptr, local_ptr + ((panel + 1) % 2) * StageSize,
+                    block_row, block_col, (panel + 1) * PanelDepth, local_idx);
+      }
+      compute_panel(local_ptr + (panel % 2) * StageSize, local_row, local_col,
+                    out_block);
+      item.barrier(cl::sycl::access::fence_space::local_space);
+    }
+
+    Index const row = block_row + local_row * RowTile;
+    Index const col = block_col + local_col * ColTile;
+    if (row < m_ && col < n_) {
+      store_output(out_block, batch, row, col);
+    }
+  }
+
+ private:
+  using GlobalPtr =
+      cl::sycl::multi_ptr<T const,
+                          cl::sycl::access::address_space::global_space>;
+  using LocalPtr =
+      cl::sycl::multi_ptr<T, cl::sycl::access::address_space::local_space>;
+  using ConstLocalPtr =
+      cl::sycl::multi_ptr<T const,
+                          cl::sycl::access::address_space::local_space>;
+
+  /**
+   * Copy the LHS and RHS panels starting at the given accumulator index into
+   * one of the local memory buffers.
+   *
+   * Consecutive work-items load consecutive values from global memory, so the
+   * mapping from work-item to panel index depends on whether the matrix is
+   * transposed.
+   */
+  void SNN_ALWAYS_INLINE load_panels(GlobalPtr lhs_ptr, GlobalPtr rhs_ptr,
+                                     LocalPtr stage_ptr, Index block_row,
+                                     Index block_col, Index acc_start,
+                                     Index local_idx) const {
+    using Load = helpers::io::Load<T>;
+    using Store = helpers::io::Store<T>;
+    SNN_PRAGMA_UNROLL
+    for (int i = 0; i < LHSPanelSize / WorkGroupSize; ++i) {
+      Index const idx = local_idx + i * WorkGroupSize;
+      Index const panel_row = TransposeLHS ? idx % BlockRows : idx / PanelDepth;
+      Index const panel_acc = TransposeLHS ? idx / BlockRows : idx % PanelDepth;
+      Index const row = block_row + panel_row;
+      Index const acc = acc_start + panel_acc;
+      T value{0};
+      if (row < m_ && acc < k_) {
+        value = Load()(lhs_ptr, TransposeLHS ? acc * m_ + row : row * k_ + acc);
+      }
+      Store()(stage_ptr, panel_row * PanelDepth + panel_acc, value);
+    }
+    auto rhs_stage_ptr = stage_ptr + LHSPanelSize;
+    SNN_PRAGMA_UNROLL
+    for (int i = 0; i < RHSPanelSize / WorkGroupSize; ++i) {
+      Index const idx = local_idx + i * WorkGroupSize;
+      Index const panel_acc = TransposeRHS ? idx % PanelDepth : idx / BlockCols;
+      Index const panel_col = TransposeRHS ? idx / PanelDepth : idx % BlockCols;
+      Index const acc = acc_start + panel_acc;
+      Index const col = block_col + panel_col;
+      T value{0};
+      if (acc < k_ && col < n_) {
+        value = Load()(rhs_ptr, TransposeRHS ? col * k_ + acc : acc * n_ + col);
+      }
+      Store()(rhs_stage_ptr, panel_acc * BlockCols + panel_col, value);
+    }
+  }
+
+  /**
+   * Accumulate the product of the LHS and RHS panels held in local memory
+   * into this work-item's output tile.
+   */
+  void SNN_ALWAYS_INLINE
+  compute_panel(LocalPtr stage_ptr, Index local_row, Index local_col,
+                VectorBlock<T, RowTile, ColTile>& out_block) const {
+    ConstLocalPtr lhs_ptr =
+        helpers::internal::as_const_ptr(stage_ptr) +
+        local_row * RowTile * PanelDepth;
+    ConstLocalPtr rhs_ptr = helpers::internal::as_const_ptr(stage_ptr) +
+                            LHSPanelSize + local_col * ColTile;
+    SNN_PRAGMA_UNROLL
+    for (int acc = 0; acc < PanelDepth; acc += AccTile) {
+      auto lhs_block = load_block<RowTile, AccTile>(lhs_ptr, PanelDepth);
+      auto rhs_block = load_block<AccTile, ColTile>(rhs_ptr, BlockCols);
+      block_mmacc(lhs_block, rhs_block, out_block);
+      lhs_ptr += AccTile;
+      rhs_ptr += AccTile * BlockCols;
+    }
+  }
+
+  /**
+   * Write the output tile to global memory, adding in the existing output
+   * values scaled by beta.
+   */
+  void SNN_ALWAYS_INLINE store_output(VectorBlock<T, RowTile, ColTile>& block,
+                                      Index batch, Index row,
+                                      Index col) const {
+    auto out_ptr = output_.get_pointer() + batch * m_ * n_ + row * n_ + col;
+
+    std::array<bool, RowTile> valid_row;
+    for (int i = 0; i < RowTile; ++i) {
+      valid_row[i] = row + i < m_;
+    }
+    std::array<bool, ColTile> valid_col;
+    for (int i = 0; i < ColTile; ++i) {
+      valid_col[i] = col + i < n_;
+    }
+    bool const internal_block =
+        valid_row[RowTile - 1] && valid_col[ColTile - 1];
+
+    if (beta_ != static_cast<T>(0)) {
+      auto prev_block = load_block<RowTile, ColTile>(
+          helpers::internal::as_const_ptr(out_ptr), n_, valid_row, valid_col);
+      scalar_multiply(prev_block, beta_);
+      for (int i = 0; i < RowTile; ++i) {
+        block.data(i) += prev_block.data(i);
+      }
+    }
+    internal_block
+        ? store_block<RowTile, ColTile>(block, out_ptr, n_)
+        : store_block<RowTile, ColTile>(block, out_ptr, n_, valid_row,
+                                        valid_col);
+  }
+
+  ReadAccessor<T const> lhs_;
+  ReadAccessor<T const> rhs_;
+  ReadWriteAccessor<T> output_;
+  LocalAccessor<T> local_;
+  Index const batches_;
+  Index const m_;
+  Index const k_;
+  Index const n_;
+  T const beta_;
+};
+
+}  // namespace matmul
+}  // namespace sycldnn
+#endif  // SYCLDNN_SRC_MATMUL_LOCAL_KERNEL_H_
@@ -0,0 +1,184 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef SYCLDNN_SRC_MATMUL_PACKED_RHS_KERNEL_H_
+#define SYCLDNN_SRC_MATMUL_PACKED_RHS_KERNEL_H_
+
+#include "sycldnn/accessor_types.h"
+#include "sycldnn/status.h"
+
+#include "sycldnn/helpers/macros.h"
+
+#include "src/helpers/vector_io.h"
+#include "src/matmul/blocks.h"
+
+#include <array>
+
+namespace sycldnn {
+namespace matmul {
+
+/**
+ * Copy a row-major [k, n] right hand side matrix into the tile-blocked layout
+ * read by the \ref sycldnn::matmul::MatmulPackedRhsKernel.
+ *
+ * The packed matrix is split into panels of ColTile columns, and each panel
+ * is split into AccTile x ColTile tiles stored contiguously in row-major
+ * order. Both dimensions are padded with zeros up to a whole number of tiles,
+ * giving a [ceil(n / ColTile), ceil(k / AccTile), AccTile, ColTile] tensor.
+ */
+template <typename T, typename Index, int AccTile, int ColTile>
+struct PackRhsKernel {
+  PackRhsKernel(ReadAccessor<T const> const& rhs,
+                WriteAccessor<T> const& packed, Index k, Index n)
+      : rhs_{rhs},
+        packed_{packed},
+        k_{k},
+        n_{n},
+        acc_blocks_{(k + AccTile - 1) / AccTile} {}
+
+  void SNN_ALWAYS_INLINE operator()(cl::sycl::item<1> item) const {
+    Index const idx = item.get_id(0);
+    Index const tile_col = idx % ColTile;
+    Index const tile_row = (idx / ColTile) % AccTile;
+    Index const block = idx / (AccTile * ColTile);
+    Index const acc_block = block % acc_blocks_;
+    Index const panel = block / acc_blocks_;
+
+    Index const row = acc_block * AccTile + tile_row;
+    Index const col = panel * ColTile + tile_col;
+
+    using Load = helpers::io::Load<T>;
+    using Store = helpers::io::Store<T>;
+    T value{0};
+    if (row < k_ && col < n_) {
+      value = Load()(rhs_.get_pointer(), row * n_ + col);
+    }
+    Store()(packed_.get_pointer(), idx, value);
+  }
+
+ private:
+  ReadAccessor<T const> rhs_;
+  WriteAccessor<T> packed_;
+  Index const k_;
+  Index const n_;
+  Index const acc_blocks_;
+};
+
+/**
+ * Matrix multiply kernel computing lhs * rhs, where the right hand side has
+ * been packed by the \ref sycldnn::matmul::PackRhsKernel with the same AccTile
+ * and ColTile.
+ *
+ * Each work-item computes a RowTile x ColTile block of the output in the same
+ * way as the \ref sycldnn::matmul::MatmulKernel, but reads the right hand side
+ * from a single contiguous panel. The panel is padded with zeros, so the right
+ * hand side loads never need to be masked and only the left hand side needs
+ * to be bounds checked.
+ */
+template <typename T, typename Index, int RowTile, int AccTile, int ColTile,
+          bool CheckBounds>
+struct MatmulPackedRhsKernel {
+  MatmulPackedRhsKernel(ReadAccessor<T const> const& lhs,
+                        ReadAccessor<T const> const& rhs,
+                        ReadWriteAccessor<T> const& output, Index m, Index k,
+                        Index n, T beta)
+      : lhs_{lhs},
+        rhs_{rhs},
+        output_{output},
+        m_{m},
+        k_{k},
+        n_{n},
+        acc_blocks_{(k + AccTile - 1) / AccTile},
+        beta_{beta} {}
+
+  void SNN_ALWAYS_INLINE operator()(cl::sycl::nd_item<2> item) const {
+    Index const row = item.get_global_id(0) * RowTile;
+    Index const panel = item.get_global_id(1);
+    Index const col = panel * ColTile;
+
+    if (row < m_ && col < n_) {
+      auto lhs_ptr = lhs_.get_pointer() + row * k_;
+      auto rhs_ptr =
+          rhs_.get_pointer() + panel * acc_blocks_ * AccTile * ColTile;
+      auto out_ptr = output_.get_pointer() + row * n_ + col;
+
+      std::array<bool, RowTile> valid_row;
+      for (int i = 0; i < RowTile; ++i) {
+        valid_row[i] = row + i < m_;
+      }
+      std::array<bool, ColTile> valid_col;
+      for (int i = 0; i < ColTile; ++i) {
+        valid_col[i] = col + i < n_;
+      }
+      bool const internal_block =
+          valid_row[RowTile - 1] && valid_col[ColTile - 1];
+
+      auto out_block = VectorBlock<T, RowTile, ColTile>{};
+      if (beta_ != static_cast<T>(0)) {
+        auto const_out_ptr =
+            cl::sycl::multi_ptr<T const,
+                                cl::sycl::access::address_space::global_space>{
+                out_ptr.get()};
+        out_block = load_block<RowTile, ColTile>(const_out_ptr, n_, valid_row,
+                                                 valid_col);
+        scalar_multiply(out_block, beta_);
+      }
+
+      Index acc_idx = 0;
+      if (!CheckBounds || valid_row[RowTile - 1]) {
+        for (; acc_idx < k_ - AccTile + 1; acc_idx += AccTile) {
+          auto lhs_block = load<RowTile, AccTile, false>(lhs_ptr, k_);
+          auto rhs_block = load<AccTile, ColTile, false>(rhs_ptr, ColTile);
+          block_mmacc(lhs_block, rhs_block, out_block);
+          lhs_ptr += AccTile;
+          rhs_ptr += AccTile * ColTile;
+        }
+      }
+      if (CheckBounds) {
+        for (; acc_idx < k_; acc_idx += AccTile) {
+          std::array<bool, AccTile> valid_acc;
+          for (int i = 0; i < AccTile; ++i) {
+            valid_acc[i] = acc_idx + i < k_;
+          }
+          auto lhs_block =
+              load<RowTile, AccTile, false>(lhs_ptr, k_, valid_row, valid_acc);
+          auto rhs_block = load<AccTile, ColTile, false>(rhs_ptr, ColTile);
+          block_mmacc(lhs_block, rhs_block, out_block);
+          lhs_ptr += AccTile;
+          rhs_ptr += AccTile * ColTile;
+        }
+      }
+
+      (!CheckBounds || internal_block)
+          ? store_block<RowTile, ColTile>(out_block, out_ptr, n_)
+          : store_block<RowTile, ColTile>(out_block, out_ptr, n_, valid_row,
+                                          valid_col);
+    }
+  }
+
+ private:
+  ReadAccessor<T const> lhs_;
+  ReadAccessor<T const> rhs_;
+  ReadWriteAccessor<T> output_;
+  Index const m_;
+  Index const k_;
+  Index const n_;
+  Index const acc_blocks_;
+  T const beta_;
+};
+
+}  // namespace matmul
+}  // namespace sycldnn
+#endif  // SYCLDNN_SRC_MATMUL_PACKED_RHS_KERNEL_H_
@@ -31,6 +31,56 @@ SNNStatus queue_kernel(BaseMemObject<T const>& lhs, BaseMemObject<T const>& rhs,
                        int n, T beta, cl::sycl::queue& queue, size_t wg_row,
                        size_t wg_col, size_t wg_batch);
 
+/**
+ * Add a matrix multiply kernel which shares tiles of the matrices between
+ * work-items using local memory to the provided SYCL queue.
+ */
+template <typename T, typename Index, bool TransposeLHS, bool TransposeRHS,
+          int RowTile, int AccTile, int ColTile, int WgRows, int WgCols,
+          int PanelDepth>
+SNNStatus queue_local_kernel(BaseMemObject<T const>& lhs,
+                             BaseMemObject<T const>& rhs,
+                             BaseMemObject<T>& output, int batches, int m,
+                             int k, int n, T beta, cl::sycl::queue& queue);
+
+/**
+ * Add a pair of kernels to the provided SYCL queue which split the
+ * accumulation dimension into k_splits chunks, compute the partial products
+ * of each chunk into the workspace, then sum the partial products into the
+ * output. The workspace must hold batches * k_splits * m * n values.
+ */
+template <typename T, typename Index, bool TransposeLHS, bool TransposeRHS,
+          int RowTile, int AccTile, int ColTile>
+SNNStatus queue_split_k_kernel(BaseMemObject<T const>& lhs,
+                               BaseMemObject<T const>& rhs,
+                               BaseMemObject<T>& output,
+                               BaseMemObject<T>& workspace, int batches, int m,
+                               int k, int n, T beta, int k_splits,
+                               cl::sycl::queue& queue, size_t wg_row,
+                               size_t wg_col);
+
+/**
+ * Add a kernel to the provided SYCL queue which copies a [k, n] matrix into
+ * the tile-blocked layout read by queue_packed_rhs_kernel(). The packed buffer
+ * must hold round_up(k, AccTile) * round_up(n, ColTile) values.
+ */
+template <typename T, typename Index, int AccTile, int ColTile>
+SNNStatus queue_pack_rhs_kernel(BaseMemObject<T const>& rhs,
+                                BaseMemObject<T>& packed, int k, int n,
+                                cl::sycl::queue& queue);
+
+/**
+ * Add a matrix multiply kernel to the provided SYCL queue, which reads a right
+ * hand side packed by queue_pack_rhs_kernel() with the same tile sizes.
+ */
+template <typename T, typename Index, int RowTile, int AccTile, int ColTile,
+          bool CheckBounds>
+SNNStatus queue_packed_rhs_kernel(BaseMemObject<T const>& lhs,
+                                  BaseMemObject<T const>& packed_rhs,
+                                  BaseMemObject<T>& output, int m, int k, int n,
+                                  T beta, cl::sycl::queue& queue, size_t wg_row,
+                                  size_t wg_col);
+
 }  // namespace internal
 }  // namespace matmul
 }  // namespace sycldnn
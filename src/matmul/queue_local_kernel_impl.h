@@ -0,0 +1,69 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef SYCLDNN_SRC_MATMUL_QUEUE_LOCAL_KERNEL_IMPL_H_
+#define SYCLDNN_SRC_MATMUL_QUEUE_LOCAL_KERNEL_IMPL_H_
+
+#include "sycldnn/accessor_types.h"
+#include "sycldnn/mem_object.h"
+#include "sycldnn/status.h"
+
+#include "sycldnn/helpers/ratio.h"
+
+#include "src/matmul/local_kernel.h"
+#include "src/matmul/queue_kernel.h"
+
+namespace sycldnn {
+namespace matmul {
+namespace internal {
+
+template <typename T, typename Index, bool TransposeLHS, bool TransposeRHS,
+          int RowTile, int AccTile, int ColTile, int WgRows, int WgCols,
+          int PanelDepth>
+SNNStatus queue_local_kernel(BaseMemObject<T const>& lhs_mem,
+                             BaseMemObject<T const>& rhs_mem,
+                             BaseMemObject<T>& output_mem, int batches, int m,
+                             int k, int n, T beta, cl::sycl::queue& queue) {
+  using Functor =
+      LocalMatmulKernel<T, Index, TransposeLHS, TransposeRHS, RowTile, AccTile,
+                        ColTile, WgRows, WgCols, PanelDepth>;
+  size_t const n_row_threads =
+      helpers::round_ratio_up(m, Functor::BlockRows) * WgRows;
+  size_t const n_col_threads =
+      helpers::round_ratio_up(n, Functor::BlockCols) * WgCols;
+  size_t const n_batch_threads = batches;
+
+  auto event = queue.submit([&](cl::sycl::handler& cgh) {
+    auto lhs = lhs_mem.read_accessor(cgh);
+    auto rhs = rhs_mem.read_accessor(cgh);
+    auto output = output_mem.read_write_accessor(cgh);
+    LocalAccessor<T> local{cl::sycl::range<1>{Functor::LocalSize}, cgh};
+
+    Functor functor{lhs, rhs, output, local, batches, m, k, n, beta};
+
+    cgh.parallel_for(
+        cl::sycl::nd_range<3>{
+            cl::sycl::range<3>{n_batch_threads, n_row_threads, n_col_threads},
+            cl::sycl::range<3>{1, WgRows, WgCols},
+        },
+        functor);
+  });
+  return {event, StatusCode::OK};
+}
+
+}  // namespace internal
+}  // namespace matmul
+}  // namespace sycldnn
+#endif  // SYCLDNN_SRC_MATMUL_QUEUE_LOCAL_KERNEL_IMPL_H_
@@ -0,0 +1,94 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef SYCLDNN_SRC_MATMUL_QUEUE_SPLIT_K_KERNEL_IMPL_H_
+#define SYCLDNN_SRC_MATMUL_QUEUE_SPLIT_K_KERNEL_IMPL_H_
+
+#include "sycldnn/mem_object.h"
+#include "sycldnn/status.h"
+
+#include "sycldnn/helpers/ratio.h"
+
+#include "src/matmul/queue_kernel.h"
+#include "src/matmul/split_k_kernel.h"
+
+namespace sycldnn {
+namespace matmul {
+namespace internal {
+
+template <typename T, typename Index, bool TransposeLHS, bool TransposeRHS,
+          int RowTile, int AccTile, int ColTile>
+SNNStatus queue_split_k_kernel(BaseMemObject<T const>& lhs_mem,
+                               BaseMemObject<T const>& rhs_mem,
+                               BaseMemObject<T>& output_mem,
+                               BaseMemObject<T>& workspace_mem, int batches,
+                               int m, int k, int n, T beta, int k_splits,
+                               cl::sycl::queue& queue, size_t wg_row,
+                               size_t wg_col) {
+  // Each chunk must be a multiple of the accumulator tile, and the number of
+  // splits is recomputed from the chunk size so that no chunk is empty.
+  Index const chunk_size = helpers::round_up_to_nearest_multiple(
+      helpers::round_ratio_up(k, k_splits), AccTile);
+  Index const n_splits = helpers::round_ratio_up(k, chunk_size);
+
+  Index const output_size_row = helpers::round_ratio_up(m, RowTile);
+  Index const output_size_col = helpers::round_ratio_up(n, ColTile);
+  size_t const n_row_threads =
+      helpers::round_up_to_nearest_multiple(output_size_row, wg_row);
+  size_t const n_col_threads =
+      helpers::round_up_to_nearest_multiple(output_size_col, wg_col);
+  size_t const n_batch_threads = batches * n_splits;
+
+  // Each split writes a full matrix of partial products to the workspace.
+  // There are never more than k_splits splits, as the chunk size is at least
+  // k / k_splits.
+  size_t const matrix_size = m * n;
+
+  queue.submit([&](cl::sycl::handler& cgh) {
+    auto lhs = lhs_mem.read_accessor(cgh);
+    auto rhs = rhs_mem.read_accessor(cgh);
+    auto workspace = workspace_mem.write_accessor(cgh);
+
+    using Functor = SplitKMatmulKernel<T, Index, TransposeLHS, TransposeRHS,
+                                       RowTile, AccTile, ColTile>;
+
+    Functor functor{lhs, rhs, workspace, batches, m, k, n, n_splits,
+                    chunk_size};
+
+    cgh.parallel_for(
+        cl::sycl::nd_range<3>{
+            cl::sycl::range<3>{n_batch_threads, n_row_threads, n_col_threads},
+            cl::sycl::range<3>{1, std::min(wg_row, n_row_threads),
+                               std::min(wg_col, n_col_threads)},
+        },
+        functor);
+  });
+
+  auto event = queue.submit([&](cl::sycl::handler& cgh) {
+    auto workspace = workspace_mem.as_const().read_accessor(cgh);
+    auto output = output_mem.read_write_accessor(cgh);
+
+    SplitKReduceKernel<T, Index> functor{workspace, output, matrix_size,
+                                         n_splits, beta};
+
+    cgh.parallel_for(cl::sycl::range<1>{batches * matrix_size}, functor);
+  });
+  return {event, StatusCode::OK};
+}
+
+}  // namespace internal
+}  // namespace matmul
+}  // namespace sycldnn
+#endif  // SYCLDNN_SRC_MATMUL_QUEUE_SPLIT_K_KERNEL_IMPL_H_
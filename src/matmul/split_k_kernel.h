@@ -0,0 +1,191 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef SYCLDNN_SRC_MATMUL_SPLIT_K_KERNEL_H_
+#define SYCLDNN_SRC_MATMUL_SPLIT_K_KERNEL_H_
+
+#include "sycldnn/accessor_types.h"
+#include "sycldnn/status.h"
+
+#include "sycldnn/helpers/macros.h"
+
+#include "src/helpers/vector_io.h"
+#include "src/matmul/blocks.h"
+
+#include <array>
+
+namespace sycldnn {
+namespace matmul {
+
+/**
+ * Matrix multiply kernel which computes the partial products of a single
+ * chunk of the accumulation dimension.
+ *
+ * The accumulation dimension is split into k_splits chunks of chunk_size
+ * values, where chunk_size is a multiple of AccTile. The first dimension of
+ * the kernel range covers both the batches and the chunks, so that a batch of
+ * small matrices with a large accumulation dimension can still fill the
+ * device. Each work-item computes a RowTile x ColTile block of the partial
+ * product for its chunk, and writes it to a workspace of size
+ * [batches, k_splits, m, n]. The partial products are then summed by the
+ * \ref sycldnn::matmul::SplitKReduceKernel.
+ */
+template <typename T, typename Index, bool TransposeLHS, bool TransposeRHS,
+          int RowTile, int AccTile, int ColTile>
+struct SplitKMatmulKernel {
+  SplitKMatmulKernel(ReadAccessor<T const> const& lhs,
+                     ReadAccessor<T const> const& rhs,
+                     WriteAccessor<T> const& workspace, Index batches, Index m,
+                     Index k, Index n, Index k_splits, Index chunk_size)
+      : lhs_{lhs},
+        rhs_{rhs},
+        workspace_{workspace},
+        batches_{batches},
+        m_{m},
+        k_{k},
+        n_{n},
+        k_splits_{k_splits},
+        chunk_size_{chunk_size} {}
+
+  void SNN_ALWAYS_INLINE operator()(cl::sycl::nd_item<3> item) const {
+    Index const batch_split = item.get_global_id(0);
+    Index const row = item.get_global_id(1) * RowTile;
+    Index const col = item.get_global_id(2) * ColTile;
+
+    if (batch_split < batches_ * k_splits_ && row < m_ && col < n_) {
+      Index const batch = batch_split / k_splits_;
+      Index const split = batch_split % k_splits_;
+      Index const acc_start = split * chunk_size_;
+      Index const acc_end = cl::sycl::min(acc_start + chunk_size_, k_);
+
+      auto lhs_ptr = lhs_.get_pointer() + batch * m_ * k_;
+      auto rhs_ptr = rhs_.get_pointer() + batch * k_ * n_;
+      auto out_ptr = workspace_.get_pointer() + batch_split * m_ * n_;
+
+      auto const lhs_ld = TransposeLHS ? m_ : k_;
+      auto const lhs_step = (TransposeLHS ? m_ : 1) * AccTile;
+      auto const rhs_ld = TransposeRHS ? k_ : n_;
+      auto const rhs_step = (TransposeRHS ? 1 : n_) * AccTile;
+      auto const out_ld = n_;
+
+      lhs_ptr += TransposeLHS ? acc_start * m_ + row : row * k_ + acc_start;
+      rhs_ptr += TransposeRHS ? col * k_ + acc_start : acc_start * n_ + col;
+      out_ptr += out_ld * row + col;
+
+      std::array<bool, RowTile> valid_row;
+      for (int i = 0; i < RowTile; ++i) {
+        valid_row[i] = row + i < m_;
+      }
+      std::array<bool, ColTile> valid_col;
+      for (int i = 0; i < ColTile; ++i) {
+        valid_col[i] = col + i < n_;
+      }
+      bool const internal_block =
+          valid_row[RowTile - 1] && valid_col[ColTile - 1];
+
+      auto out_block = VectorBlock<T, RowTile, ColTile>{};
+      Index acc_idx = acc_start;
+      if (internal_block) {
+        for (; acc_idx < acc_end - AccTile + 1; acc_idx += AccTile) {
+          auto lhs_block =
+              load<RowTile, AccTile, TransposeLHS>(lhs_ptr, lhs_ld);
+          auto rhs_block =
+              load<AccTile, ColTile, TransposeRHS>(rhs_ptr, rhs_ld);
+          block_mmacc(lhs_block, rhs_block, out_block);
+          lhs_ptr += lhs_step;
+          rhs_ptr += rhs_step;
+        }
+      }
+      for (; acc_idx < acc_end; acc_idx += AccTile) {
+        std::array<bool, AccTile> valid_acc;
+        for (int i = 0; i < AccTile; ++i) {
+          valid_acc[i] = acc_idx + i < acc_end;
+        }
+        auto lhs_block = load<RowTile, AccTile, TransposeLHS>(
+            lhs_ptr, lhs_ld, valid_row, valid_acc);
+        auto rhs_block = load<AccTile, ColTile, TransposeRHS>(
+            rhs_ptr, rhs_ld, valid_acc, valid_col);
+        block_mmacc(lhs_block, rhs_block, out_block);
+        lhs_ptr += lhs_step;
+        rhs_ptr += rhs_step;
+      }
+
+      internal_block
+          ? store_block<RowTile, ColTile>(out_block, out_ptr, out_ld)
+          : store_block<RowTile, ColTile>(out_block, out_ptr, out_ld, valid_row,
+                                          valid_col);
+    }
+  }
+
+ private:
+  ReadAccessor<T const> lhs_;
+  ReadAccessor<T const> rhs_;
+  WriteAccessor<T> workspace_;
+  Index const batches_;
+  Index const m_;
+  Index const k_;
+  Index const n_;
+  Index const k_splits_;
+  Index const chunk_size_;
+};
+
+/**
+ * Sum the partial products computed by the
+ * \ref sycldnn::matmul::SplitKMatmulKernel into the output, adding in the
+ * existing output values scaled by beta.
+ */
+template <typename T, typename Index>
+struct SplitKReduceKernel {
+  SplitKReduceKernel(ReadAccessor<T const> const& workspace,
+                     ReadWriteAccessor<T> const& output, Index matrix_size,
+                     Index k_splits, T beta)
+      : workspace_{workspace},
+        output_{output},
+        matrix_size_{matrix_size},
+        k_splits_{k_splits},
+        beta_{beta} {}
+
+  void SNN_ALWAYS_INLINE operator()(cl::sycl::item<1> item) const {
+    Index const idx = item.get_id(0);
+    Index const batch = idx / matrix_size_;
+    Index const offset = idx % matrix_size_;
+
+    using Load = helpers::io::Load<T>;
+    using Store = helpers::io::Store<T>;
+    auto in_ptr = workspace_.get_pointer();
+    auto out_ptr = output_.get_pointer();
+    Index const in_offset = batch * k_splits_ * matrix_size_ + offset;
+
+    T value{0};
+    for (Index split = 0; split < k_splits_; ++split) {
+      value += Load()(in_ptr, in_offset + split * matrix_size_);
+    }
+    if (beta_ != static_cast<T>(0)) {
+      value += beta_ * Load()(helpers::internal::as_const_ptr(out_ptr), idx);
+    }
+    Store()(out_ptr, idx, value);
+  }
+
+ private:
+  ReadAccessor<T const> workspace_;
+  ReadWriteAccessor<T> output_;
+  Index const matrix_size_;
+  Index const k_splits_;
+  T const beta_;
+};
+
+}  // namespace matmul
+}  // namespace sycldnn
+#endif  // SYCLDNN_SRC_MATMUL_SPLIT_K_KERNEL_H_
@@ -0,0 +1,116 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "sycldnn/matmul/tile_config.h"
+
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "sycldnn/export.h"
+
+namespace sycldnn {
+namespace matmul {
+
+SNN_EXPORT std::string to_string(TileConfig const& config) {
+  std::ostringstream str;
+  str << config.row_tile << "," << config.acc_tile << "," << config.col_tile
+      << "," << config.wg_rows << "," << config.wg_cols << ","
+      << config.wg_batch << "," << (config.local_memory ? 1 : 0) << ","
+      << config.k_splits;
+  return str.str();
+}
+
+SNN_EXPORT bool tile_config_from_string(std::string const& str,
+                                        TileConfig& config) {
+  std::istringstream stream{str};
+  int values[8];
+  for (int i = 0; i < 8; ++i) {
+    if (i > 0 && stream.get() != ',') {
+      return false;
+    }
+    if (!(stream >> values[i])) {
+      return false;
+    }
+  }
+  config.row_tile = values[0];
+  config.acc_tile = values[1];
+  config.col_tile = values[2];
+  config.wg_rows = values[3];
+  config.wg_cols = values[4];
+  config.wg_batch = values[5];
+  config.local_memory = values[6] != 0;
+  config.k_splits = values[7];
+  return true;
+}
+
+SNN_EXPORT bool is_compiled(TileConfig const& config) {
+  if (config.wg_rows <= 0 || config.wg_cols <= 0 || config.wg_batch <= 0 ||
+      config.k_splits <= 0) {
+    return false;
+  }
+  if (config.k_splits > 1) {
+    return !config.local_memory && config.row_tile == 4 &&
+           config.acc_tile == 4 && config.col_tile == 4 &&
+           config.wg_batch == 1;
+  }
+  if (config.local_memory) {
+    return config.row_tile == 4 && config.acc_tile == 4 &&
+           config.col_tile == 4 && config.wg_rows == 8 && config.wg_cols == 8 &&
+           config.wg_batch == 1;
+  }
+  // This must match the tile shapes generated in src/matmul/CMakeLists.txt.
+  if (config.acc_tile != 4) {
+    return false;
+  }
+  return (config.row_tile == 1 && config.col_tile == 4) ||
+         (config.row_tile == 4 && config.col_tile == 1) ||
+         (config.row_tile == 4 && config.col_tile == 4) ||
+         (config.row_tile == 8 && config.col_tile == 4);
+}
+
+SNN_EXPORT std::vector<TileConfig> get_tile_candidates() {
+  struct Shape {
+    int rows;
+    int cols;
+  };
+  Shape const tile_shapes[] = {{1, 4}, {4, 1}, {4, 4}, {8, 4}};
+  Shape const wg_shapes[] = {{8, 4},  {4, 8},  {16, 8},
+                             {8, 16}, {1, 64}, {64, 1}};
+  std::vector<TileConfig> candidates;
+  for (auto tile : tile_shapes) {
+    for (auto wg : wg_shapes) {
+      TileConfig config;
+      config.row_tile = tile.rows;
+      config.col_tile = tile.cols;
+      config.wg_rows = wg.rows;
+      config.wg_cols = wg.cols;
+      candidates.push_back(config);
+    }
+  }
+  TileConfig local_config;
+  local_config.wg_cols = 8;
+  local_config.local_memory = true;
+  candidates.push_back(local_config);
+  for (int k_splits : {4, 16, 64}) {
+    TileConfig split_config;
+    split_config.k_splits = k_splits;
+    candidates.push_back(split_config);
+  }
+  return candidates;
+}
+
+}  // namespace matmul
+}  // namespace sycldnn
@@ -0,0 +1,113 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "sycldnn/matmul/tile_table.h"
+
+#include "sycldnn/matmul/tile_config.h"
+
+#include <fstream>
+#include <sstream>
+#include <string>
+
+#include "sycldnn/export.h"
+
+namespace sycldnn {
+namespace matmul {
+namespace {
+
+/** Round a positive value up to the next power of two. */
+int round_up_to_power_of_two(int value) {
+  int result = 1;
+  while (result < value && result < (1 << 30)) {
+    result <<= 1;
+  }
+  return result;
+}
+
+}  // namespace
+
+SNN_EXPORT std::string get_device_id(cl::sycl::device const& device) {
+  return device.get_info<cl::sycl::info::device::name>() + " (" +
+         device.get_info<cl::sycl::info::device::driver_version>() + ")";
+}
+
+SNN_EXPORT std::string make_tile_table_key(std::string const& device_id,
+                                           std::string const& data_type,
+                                           bool transpose_lhs,
+                                           bool transpose_rhs, int batches,
+                                           int m, int k, int n) {
+  std::ostringstream key;
+  // The key must not contain the tab separator used in the table file.
+  for (char c : device_id) {
+    key << (c == '\t' || c == '\n' ? ' ' : c);
+  }
+  key << ";" << data_type << ";" << (transpose_lhs ? "T" : "N")
+      << (transpose_rhs ? "T" : "N") << ";"
+      << round_up_to_power_of_two(batches) << ","
+      << round_up_to_power_of_two(m) << ","
+      << round_up_to_power_of_two(k) << "," << round_up_to_power_of_two(n);
+  return key.str();
+}
+
+TileTable::TileTable(std::string filename)
+    : filename_{std::move(filename)}, entries_{} {
+  load();
+}
+
+bool TileTable::lookup(std::string const& key, TileConfig& config) const {
+  auto entry = entries_.find(key);
+  if (entry == entries_.end()) {
+    return false;
+  }
+  config = entry->second;
+  return true;
+}
+
+bool TileTable::insert(std::string const& key, TileConfig const& config) {
+  entries_[key] = config;
+  if (filename_.empty()) {
+    return false;
+  }
+  std::ofstream file{filename_, std::ios::app};
+  if (!file) {
+    return false;
+  }
+  file << key << '\t' << to_string(config) << '\n';
+  return static_cast<bool>(file);
+}
+
+void TileTable::load() {
+  if (filename_.empty()) {
+    return;
+  }
+  std::ifstream file{filename_};
+  std::string line;
+  while (std::getline(file, line)) {
+    auto separator = line.rfind('\t');
+    if (separator == std::string::npos) {
+      continue;
+    }
+    TileConfig config;
+    // Skip any entries which refer to kernels not compiled into this build.
+    if (tile_config_from_string(line.substr(separator + 1), config) &&
+        is_compiled(config)) {
+      // Later entries take precedence, so re-tuned results override old ones.
+      entries_[line.substr(0, separator)] = config;
+    }
+  }
+}
+
+}  // namespace matmul
+}  // namespace sycldnn
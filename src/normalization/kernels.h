@@ -0,0 +1,429 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef SYCLDNN_SRC_NORMALIZATION_KERNELS_H_
+#define SYCLDNN_SRC_NORMALIZATION_KERNELS_H_
+
+#include "sycldnn/accessor_types.h"
+
+#include "sycldnn/helpers/macros.h"
+#include "sycldnn/internal/helpers/stat_type.h"
+
+#include "src/helpers/vector_io.h"
+#include "src/helpers/workgroup_reduce.h"
+
+#include <CL/sycl.hpp>
+
+namespace sycldnn {
+namespace normalization {
+namespace internal {
+
+using ::sycldnn::internal::helpers::StatType;
+
+/**
+ * Maps the values of each normalization group to their offsets in the tensor.
+ *
+ * The groups are numbered batch * groups + group. In NCHW each group is
+ * contiguous in memory. In NHWC each pixel holds a contiguous run of
+ * group_channels values from the group, so the values are visited pixel by
+ * pixel with the channels innermost.
+ */
+template <typename Index, bool IsNCHW>
+struct GroupLayout {
+  /** The number of channels in the tensor. */
+  Index channels;
+  /** The number of channels in each group. */
+  Index group_channels;
+  /** The number of pixels in each tensor. */
+  Index spatial;
+  /** The number of groups in each tensor. */
+  Index groups;
+
+  /** The number of values in each group. */
+  Index SNN_ALWAYS_INLINE size() const { return group_channels * spatial; }
+
+  /** The offset in the tensor of value idx of the given group. */
+  Index SNN_ALWAYS_INLINE offset(Index group, Index idx) const {
+    if (IsNCHW) {
+      return group * size() + idx;
+    }
+    Index const batch = group / groups;
+    Index const first_channel = (group % groups) * group_channels;
+    Index const pixel = idx / group_channels;
+    Index const channel = idx % group_channels;
+    return (batch * spatial + pixel) * channels + first_channel + channel;
+  }
+
+  /** The channel of value idx of the given group. */
+  Index SNN_ALWAYS_INLINE channel(Index group, Index idx) const {
+    Index const first_channel = (group % groups) * group_channels;
+    return first_channel +
+           (IsNCHW ? idx / spatial : idx % group_channels);
+  }
+};
+
+/**
+ * Splits each reduction across a work-group of WorkGroupSize work-items,
+ * summing their partial results in local memory.
+ *
+ * Work-group g computes reduction g, with each work-item reducing a strided
+ * subset of the values so that adjacent work-items read adjacent values.
+ */
+template <typename Index, int WorkGroupSize>
+struct GroupReducer {
+  /** The reduction computed by the work-item. */
+  static Index SNN_ALWAYS_INLINE reduction(cl::sycl::nd_item<1> item) {
+    return item.get_group(0);
+  }
+
+  /** The first value of the reduction read by the work-item. */
+  static Index SNN_ALWAYS_INLINE first(cl::sycl::nd_item<1> item) {
+    return item.get_local_id(0);
+  }
+
+  /**
+   * Sum a scalar or vector value across the work-group, returning the total
+   * to every work-item.
+   *
+   * The total is broadcast through the start of the workspace, which the
+   * reduction never writes. Every work-item has read the previous total
+   * before the barriers in the next reduction, so consecutive sums of the
+   * same type can share the workspace.
+   */
+  template <typename DataType, typename Workspace>
+  static DataType SNN_ALWAYS_INLINE sum(DataType value,
+                                        cl::sycl::nd_item<1> item,
+                                        Workspace workspace) {
+    using Load = helpers::io::Load<DataType>;
+    using Store = helpers::io::Store<DataType>;
+    value = helpers::reduce::workgroup_reduce<helpers::reduce::Sum, Index>(
+        value, item, workspace);
+    if (item.get_local_id(0) == 0) {
+      Store()(workspace, helpers::io::as_vec_index(0), value);
+    }
+    item.barrier(cl::sycl::access::fence_space::local_space);
+    return Load()(helpers::internal::as_const_ptr(workspace),
+                  helpers::io::as_vec_index(0));
+  }
+};
+
+/**
+ * Computes each reduction in a single work-item, used when the reductions are
+ * too short to be worth splitting across a work-group.
+ */
+template <typename Index>
+struct GroupReducer<Index, 1> {
+  static Index SNN_ALWAYS_INLINE reduction(cl::sycl::nd_item<1> item) {
+    return item.get_global_id(0);
+  }
+
+  static Index SNN_ALWAYS_INLINE first(cl::sycl::nd_item<1> /*item*/) {
+    return 0;
+  }
+
+  template <typename DataType, typename Workspace>
+  static DataType SNN_ALWAYS_INLINE sum(DataType value,
+                                        cl::sycl::nd_item<1> /*item*/,
+                                        Workspace /*workspace*/) {
+    return value;
+  }
+};
+
+/**
+ * Normalize each group of the input, then scale and shift by the per-channel
+ * gamma and beta.
+ *
+ * The mean is computed in a first pass over the group, and the variance is
+ * computed from the differences to the mean in a second pass, which avoids
+ * the cancellation in computing the variance from the sum of squares. The
+ * third pass writes the output.
+ *
+ * Each group is computed by a work-group of WorkGroupSize work-items, or by a
+ * single work-item if WorkGroupSize is 1.
+ */
+template <typename T, typename Index, bool IsNCHW, int WorkGroupSize>
+struct NormalizeKernel {
+  using Stat = typename StatType<T>::type;
+  using Reducer = GroupReducer<Index, WorkGroupSize>;
+
+  /** The number of values required in local memory. */
+  static constexpr int LocalSize = WorkGroupSize;
+
+  NormalizeKernel(ReadAccessor<T const> const& input,
+                  ReadAccessor<T const> const& beta,
+                  ReadAccessor<T const> const& gamma,
+                  WriteAccessor<T> const& output,
+                  LocalAccessor<Stat> const& workspace,
+                  GroupLayout<Index, IsNCHW> const& layout, Index n_groups,
+                  float epsilon)
+      : input_{input},
+        beta_{beta},
+        gamma_{gamma},
+        output_{output},
+        workspace_{workspace},
+        layout_{layout},
+        n_groups_{n_groups},
+        epsilon_{epsilon} {}
+
+  void SNN_ALWAYS_INLINE operator()(cl::sycl::nd_item<1> item) const {
+    Index const group = Reducer::reduction(item);
+    if (group < n_groups_) {
+      Index const first = Reducer::first(item);
+      Index const size = layout_.size();
+      auto in_ptr = input_.get_pointer();
+      auto beta_ptr = beta_.get_pointer();
+      auto gamma_ptr = gamma_.get_pointer();
+      auto out_ptr = output_.get_pointer();
+      auto workspace = workspace_.get_pointer();
+
+      Stat sum{0};
+      for (Index idx = first; idx < size; idx += WorkGroupSize) {
+        sum += static_cast<Stat>(in_ptr[layout_.offset(group, idx)]);
+      }
+      Stat const mean =
+          Reducer::sum(sum, item, workspace) / static_cast<Stat>(size);
+
+      Stat square_sum{0};
+      for (Index idx = first; idx < size; idx += WorkGroupSize) {
+        Stat const diff =
+            static_cast<Stat>(in_ptr[layout_.offset(group, idx)]) - mean;
+        square_sum += diff * diff;
+      }
+      Stat const variance = Reducer::sum(square_sum, item, workspace) /
+                            static_cast<Stat>(size);
+      Stat const inv_stddev =
+          cl::sycl::rsqrt(variance + static_cast<Stat>(epsilon_));
+
+      for (Index idx = first; idx < size; idx += WorkGroupSize) {
+        Index const offset = layout_.offset(group, idx);
+        Index const channel = layout_.channel(group, idx);
+        Stat const normalized =
+            (static_cast<Stat>(in_ptr[offset]) - mean) * inv_stddev;
+        out_ptr[offset] =
+            static_cast<T>(normalized * static_cast<Stat>(gamma_ptr[channel]) +
+                           static_cast<Stat>(beta_ptr[channel]));
+      }
+    }
+  }
+
+ private:
+  ReadAccessor<T const> input_;
+  ReadAccessor<T const> beta_;
+  ReadAccessor<T const> gamma_;
+  WriteAccessor<T> output_;
+  LocalAccessor<Stat> workspace_;
+  GroupLayout<Index, IsNCHW> const layout_;
+  Index const n_groups_;
+  float const epsilon_;
+};
+
+/**
+ * Compute the gradient of the normalization with respect to its input.
+ *
+ * With g = gamma * dy and x_hat the normalized input, the first pass sums the
+ * input and g, and the second pass sums the squared differences of the input
+ * to the mean and g * (x - mean), giving the variance and mean(g * x_hat)
+ * together. The third pass writes:
+ *   dx = (g - mean(g) - x_hat * mean(g * x_hat)) / sqrt(variance + epsilon)
+ *
+ * The mean and inverse standard deviation of each group are also written to
+ * the statistics tensor, for the beta and gamma gradients.
+ *
+ * Each group is computed by a work-group of WorkGroupSize work-items, or by a
+ * single work-item if WorkGroupSize is 1.
+ */
+template <typename T, typename Index, bool IsNCHW, int WorkGroupSize>
+struct InputGradientKernel {
+  using Stat = typename StatType<T>::type;
+  using Stat2 = cl::sycl::vec<Stat, 2>;
+  using Reducer = GroupReducer<Index, WorkGroupSize>;
+
+  /** The number of values required in local memory, a pair per work-item. */
+  static constexpr int LocalSize = 2 * WorkGroupSize;
+
+  InputGradientKernel(ReadAccessor<T const> const& input,
+                      ReadAccessor<T const> const& gradient,
+                      ReadAccessor<T const> const& gamma,
+                      WriteAccessor<Stat> const& stats,
+                      WriteAccessor<T> const& output,
+                      LocalAccessor<Stat> const& workspace,
+                      GroupLayout<Index, IsNCHW> const& layout,
+                      Index n_groups, float epsilon)
+      : input_{input},
+        gradient_{gradient},
+        gamma_{gamma},
+        stats_{stats},
+        output_{output},
+        workspace_{workspace},
+        layout_{layout},
+        n_groups_{n_groups},
+        epsilon_{epsilon} {}
+
+  void SNN_ALWAYS_INLINE operator()(cl::sycl::nd_item<1> item) const {
+    Index const group = Reducer::reduction(item);
+    if (group < n_groups_) {
+      Index const first = Reducer::first(item);
+      Index const size = layout_.size();
+      Stat const n_values = static_cast<Stat>(size);
+      auto in_ptr = input_.get_pointer();
+      auto grad_ptr = gradient_.get_pointer();
+      auto gamma_ptr = gamma_.get_pointer();
+      auto out_ptr = output_.get_pointer();
+      auto workspace = workspace_.get_pointer();
+
+      Stat2 sums{0, 0};
+      for (Index idx = first; idx < size; idx += WorkGroupSize) {
+        Index const offset = layout_.offset(group, idx);
+        Index const channel = layout_.channel(group, idx);
+        sums += Stat2{static_cast<Stat>(in_ptr[offset]),
+                      static_cast<Stat>(grad_ptr[offset]) *
+                          static_cast<Stat>(gamma_ptr[channel])};
+      }
+      sums = Reducer::sum(sums, item, workspace);
+      Stat const mean = sums.s0() / n_values;
+      Stat const grad_mean = sums.s1() / n_values;
+
+      Stat2 centered{0, 0};
+      for (Index idx = first; idx < size; idx += WorkGroupSize) {
+        Index const offset = layout_.offset(group, idx);
+        Index const channel = layout_.channel(group, idx);
+        Stat const diff = static_cast<Stat>(in_ptr[offset]) - mean;
+        Stat const grad = static_cast<Stat>(grad_ptr[offset]) *
+                          static_cast<Stat>(gamma_ptr[channel]);
+        centered += Stat2{diff * diff, grad * diff};
+      }
+      centered = Reducer::sum(centered, item, workspace);
+      Stat const inv_stddev = cl::sycl::rsqrt(
+          centered.s0() / n_values + static_cast<Stat>(epsilon_));
+      Stat const grad_x_hat_mean = centered.s1() * inv_stddev / n_values;
+
+      if (first == 0) {
+        auto stats_ptr = stats_.get_pointer();
+        stats_ptr[2 * group] = mean;
+        stats_ptr[2 * group + 1] = inv_stddev;
+      }
+
+      for (Index idx = first; idx < size; idx += WorkGroupSize) {
+        Index const offset = layout_.offset(group, idx);
+        Index const channel = layout_.channel(group, idx);
+        Stat const x_hat = (static_cast<Stat>(in_ptr[offset]) - mean) *
+                           inv_stddev;
+        Stat const grad = static_cast<Stat>(grad_ptr[offset]) *
+                          static_cast<Stat>(gamma_ptr[channel]);
+        out_ptr[offset] = static_cast<T>(
+            inv_stddev * (grad - grad_mean - x_hat * grad_x_hat_mean));
+      }
+    }
+  }
+
+ private:
+  ReadAccessor<T const> input_;
+  ReadAccessor<T const> gradient_;
+  ReadAccessor<T const> gamma_;
+  WriteAccessor<Stat> stats_;
+  WriteAccessor<T> output_;
+  LocalAccessor<Stat> workspace_;
+  GroupLayout<Index, IsNCHW> const layout_;
+  Index const n_groups_;
+  float const epsilon_;
+};
+
+/**
+ * Compute the gradients with respect to beta and gamma, by summing dy and
+ * dy * x_hat over the batch and spatial dimensions of each channel, using the
+ * group statistics written by the InputGradientKernel.
+ *
+ * Each channel is computed by a work-group of WorkGroupSize work-items, or by
+ * a single work-item if WorkGroupSize is 1.
+ */
+template <typename T, typename Index, bool IsNCHW, int WorkGroupSize>
+struct ScaleGradientKernel {
+  using Stat = typename StatType<T>::type;
+  using Stat2 = cl::sycl::vec<Stat, 2>;
+  using Reducer = GroupReducer<Index, WorkGroupSize>;
+
+  /** The number of values required in local memory, a pair per work-item. */
+  static constexpr int LocalSize = 2 * WorkGroupSize;
+
+  ScaleGradientKernel(ReadAccessor<T const> const& input,
+                      ReadAccessor<T const> const& gradient,
+                      ReadAccessor<Stat const> const& stats,
+                      WriteAccessor<T> const& beta_grad,
+                      WriteAccessor<T> const& gamma_grad,
+                      LocalAccessor<Stat> const& workspace, Index batch,
+                      Index channels, Index spatial, Index group_channels)
+      : input_{input},
+        gradient_{gradient},
+        stats_{stats},
+        beta_grad_{beta_grad},
+        gamma_grad_{gamma_grad},
+        workspace_{workspace},
+        batch_{batch},
+        channels_{channels},
+        spatial_{spatial},
+        group_channels_{group_channels} {}
+
+  void SNN_ALWAYS_INLINE operator()(cl::sycl::nd_item<1> item) const {
+    Index const channel = Reducer::reduction(item);
+    if (channel < channels_) {
+      Index const n_reduce = batch_ * spatial_;
+      Index const groups = channels_ / group_channels_;
+      Index const group = channel / group_channels_;
+      auto in_ptr = input_.get_pointer();
+      auto grad_ptr = gradient_.get_pointer();
+      auto stats_ptr = stats_.get_pointer();
+
+      Stat2 sums{0, 0};
+      for (Index idx = Reducer::first(item); idx < n_reduce;
+           idx += WorkGroupSize) {
+        Index const batch = idx / spatial_;
+        Index const pixel = idx % spatial_;
+        Index const offset =
+            IsNCHW ? (batch * channels_ + channel) * spatial_ + pixel
+                   : idx * channels_ + channel;
+        Index const stat_idx = 2 * (batch * groups + group);
+        Stat const grad = static_cast<Stat>(grad_ptr[offset]);
+        Stat const x_hat =
+            (static_cast<Stat>(in_ptr[offset]) - stats_ptr[stat_idx]) *
+            stats_ptr[stat_idx + 1];
+        sums += Stat2{grad, grad * x_hat};
+      }
+      sums = Reducer::sum(sums, item, workspace_.get_pointer());
+
+      if (Reducer::first(item) == 0) {
+        beta_grad_.get_pointer()[channel] = static_cast<T>(sums.s0());
+        gamma_grad_.get_pointer()[channel] = static_cast<T>(sums.s1());
+      }
+    }
+  }
+
+ private:
+  ReadAccessor<T const> input_;
+  ReadAccessor<T const> gradient_;
+  ReadAccessor<Stat const> stats_;
+  WriteAccessor<T> beta_grad_;
+  WriteAccessor<T> gamma_grad_;
+  LocalAccessor<Stat> workspace_;
+  Index const batch_;
+  Index const channels_;
+  Index const spatial_;
+  Index const group_channels_;
+};
+
+}  // namespace internal
+}  // namespace normalization
+}  // namespace sycldnn
+
+#endif  // SYCLDNN_SRC_NORMALIZATION_KERNELS_H_
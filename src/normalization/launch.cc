@@ -0,0 +1,335 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "sycldnn/internal/normalization/launch.h"
+
+#include "sycldnn/mem_object.h"
+#include "sycldnn/status.h"
+
+#include "sycldnn/normalization/params.h"
+
+#include "sycldnn/helpers/ratio.h"
+
+#include "src/normalization/kernels.h"
+
+#include <CL/sycl.hpp>
+
+#include <stddef.h>
+#include <cstdint>
+#include <limits>
+
+#include "sycldnn/export.h"
+
+namespace sycldnn {
+namespace normalization {
+namespace internal {
+namespace {
+
+// The work-group size used to split long reductions across a work-group.
+constexpr int norm_work_group_size = 256;
+// Reductions of at least this many values use a work-group per reduction.
+constexpr int min_work_group_reduce_size = 4 * norm_work_group_size;
+// Shorter reductions also use a work-group per reduction when there are
+// fewer than this many of them, as a work-item per reduction would not have
+// enough work-items to fill the device.
+constexpr int min_serial_reductions = 2048;
+// The work-group size used when each work-item computes a whole reduction.
+constexpr int serial_work_group_size = 64;
+
+template <typename Index, bool IsNCHW>
+GroupLayout<Index, IsNCHW> get_layout(NormalizationParams const& params) {
+  Index const groups = get_groups(params);
+  Index const spatial = static_cast<Index>(params.rows) * params.cols;
+  return {params.channels, params.channels / groups, spatial, groups};
+}
+
+bool can_use_work_group_kernel(cl::sycl::device const& device) {
+  if (device.get_info<cl::sycl::info::device::local_mem_type>() ==
+      cl::sycl::info::local_mem_type::none) {
+    return false;
+  }
+  return device.get_info<cl::sycl::info::device::max_work_group_size>() >=
+         static_cast<size_t>(norm_work_group_size);
+}
+
+/** Whether to use a work-group for each of n_reductions of size values. */
+template <typename Index>
+bool use_work_group(Index n_reductions, Index size, cl::sycl::queue& queue) {
+  return size > 1 &&
+         (size >= min_work_group_reduce_size ||
+          n_reductions < min_serial_reductions) &&
+         can_use_work_group_kernel(queue.get_device());
+}
+
+/**
+ * Get the nd_range to launch n_reductions reductions, with a work-group for
+ * each reduction or a work-item for each if WorkGroupSize is 1.
+ */
+template <int WorkGroupSize, typename Index>
+cl::sycl::nd_range<1> get_nd_range(Index n_reductions) {
+  if (WorkGroupSize == 1) {
+    size_t const n_threads = helpers::round_up_to_nearest_multiple(
+        n_reductions, static_cast<Index>(serial_work_group_size));
+    return {cl::sycl::range<1>{n_threads},
+            cl::sycl::range<1>{serial_work_group_size}};
+  }
+  size_t const n_threads = static_cast<size_t>(n_reductions) * WorkGroupSize;
+  return {cl::sycl::range<1>{n_threads}, cl::sycl::range<1>{WorkGroupSize}};
+}
+
+template <typename T, typename Index, bool IsNCHW, int WorkGroupSize>
+SNNStatus queue_normalize(BaseMemObject<T const>& input_mem,
+                          BaseMemObject<T const>& beta_mem,
+                          BaseMemObject<T const>& gamma_mem,
+                          BaseMemObject<T>& output_mem,
+                          GroupLayout<Index, IsNCHW> const& layout,
+                          Index n_groups, float epsilon,
+                          cl::sycl::queue& queue) {
+  using Kernel = NormalizeKernel<T, Index, IsNCHW, WorkGroupSize>;
+  using Stat = typename Kernel::Stat;
+  auto event = queue.submit([&](cl::sycl::handler& cgh) {
+    auto input = input_mem.read_accessor(cgh);
+    auto beta = beta_mem.read_accessor(cgh);
+    auto gamma = gamma_mem.read_accessor(cgh);
+    auto output = output_mem.write_accessor(cgh);
+    LocalAccessor<Stat> workspace{cl::sycl::range<1>{Kernel::LocalSize}, cgh};
+    Kernel functor{input,  beta,   gamma,    output, workspace,
+                   layout, n_groups, epsilon};
+    cgh.parallel_for(get_nd_range<WorkGroupSize>(n_groups), functor);
+  });
+  return {event, StatusCode::OK};
+}
+
+template <typename T, typename Index, bool IsNCHW>
+SNNStatus launch_forward_with_layout(BaseMemObject<T const>& input,
+                                     BaseMemObject<T const>& beta,
+                                     BaseMemObject<T const>& gamma,
+                                     BaseMemObject<T>& output,
+                                     NormalizationParams const& params,
+                                     cl::sycl::queue& queue) {
+  auto const layout = get_layout<Index, IsNCHW>(params);
+  Index const n_groups = params.batch * layout.groups;
+  if (use_work_group(n_groups, layout.size(), queue)) {
+    return queue_normalize<T, Index, IsNCHW, norm_work_group_size>(
+        input, beta, gamma, output, layout, n_groups, params.epsilon, queue);
+  } else {
+    return queue_normalize<T, Index, IsNCHW, 1>(
+        input, beta, gamma, output, layout, n_groups, params.epsilon, queue);
+  }
+}
+
+template <typename T, typename Index>
+SNNStatus launch_forward_with_index(BaseMemObject<T const>& input,
+                                    BaseMemObject<T const>& beta,
+                                    BaseMemObject<T const>& gamma,
+                                    BaseMemObject<T>& output,
+                                    NormalizationParams const& params,
+                                    cl::sycl::queue& queue) {
+  if (params.input_format == DataFormat::NCHW) {
+    return launch_forward_with_layout<T, Index, true>(input, beta, gamma,
+                                                      output, params, queue);
+  } else {
+    return launch_forward_with_layout<T, Index, false>(input, beta, gamma,
+                                                       output, params, queue);
+  }
+}
+
+template <typename T, typename Index, bool IsNCHW, int WorkGroupSize>
+SNNStatus queue_input_gradient(
+    BaseMemObject<T const>& input_mem, BaseMemObject<T const>& gradient_mem,
+    BaseMemObject<T const>& gamma_mem,
+    BaseMemObject<typename StatType<T>::type>& stats_mem,
+    BaseMemObject<T>& output_mem, GroupLayout<Index, IsNCHW> const& layout,
+    Index n_groups, float epsilon, cl::sycl::queue& queue) {
+  using Kernel = InputGradientKernel<T, Index, IsNCHW, WorkGroupSize>;
+  using Stat = typename Kernel::Stat;
+  auto event = queue.submit([&](cl::sycl::handler& cgh) {
+    auto input = input_mem.read_accessor(cgh);
+    auto gradient = gradient_mem.read_accessor(cgh);
+    auto gamma = gamma_mem.read_accessor(cgh);
+    auto stats = stats_mem.write_accessor(cgh);
+    auto output = output_mem.write_accessor(cgh);
+    LocalAccessor<Stat> workspace{cl::sycl::range<1>{Kernel::LocalSize}, cgh};
+    Kernel functor{input,     gradient, gamma,    stats,  output,
+                   workspace, layout,   n_groups, epsilon};
+    cgh.parallel_for(get_nd_range<WorkGroupSize>(n_groups), functor);
+  });
+  return {event, StatusCode::OK};
+}
+
+template <typename T, typename Index, bool IsNCHW, int WorkGroupSize>
+SNNStatus queue_scale_gradient(
+    BaseMemObject<T const>& input_mem, BaseMemObject<T const>& gradient_mem,
+    BaseMemObject<typename StatType<T>::type const>& stats_mem,
+    BaseMemObject<T>& beta_grad_mem, BaseMemObject<T>& gamma_grad_mem,
+    GroupLayout<Index, IsNCHW> const& layout, Index batch,
+    cl::sycl::queue& queue) {
+  using Kernel = ScaleGradientKernel<T, Index, IsNCHW, WorkGroupSize>;
+  using Stat = typename Kernel::Stat;
+  auto event = queue.submit([&](cl::sycl::handler& cgh) {
+    auto input = input_mem.read_accessor(cgh);
+    auto gradient = gradient_mem.read_accessor(cgh);
+    auto stats = stats_mem.read_accessor(cgh);
+    auto beta_grad = beta_grad_mem.write_accessor(cgh);
+    auto gamma_grad = gamma_grad_mem.write_accessor(cgh);
+    LocalAccessor<Stat> workspace{cl::sycl::range<1>{Kernel::LocalSize}, cgh};
+    Kernel functor{input,     gradient,        stats,          beta_grad,
+                   gamma_grad, workspace,      batch,          layout.channels,
+                   layout.spatial, layout.group_channels};
+    cgh.parallel_for(get_nd_range<WorkGroupSize>(layout.channels), functor);
+  });
+  return {event, StatusCode::OK};
+}
+
+template <typename T, typename Index, bool IsNCHW>
+SNNStatus launch_gradient_with_layout(
+    BaseMemObject<T const>& input, BaseMemObject<T const>& gradient,
+    BaseMemObject<T const>& gamma, BaseMemObject<T>& beta_grad,
+    BaseMemObject<T>& gamma_grad, BaseMemObject<T>& output,
+    StatMemObject<T>& stats, NormalizationParams const& params,
+    cl::sycl::queue& queue) {
+  auto const layout = get_layout<Index, IsNCHW>(params);
+  Index const n_groups = params.batch * layout.groups;
+
+  // The input gradient kernel recomputes the statistics of each group, and
+  // stores them in the workspace so that the scale gradient kernel does not
+  // need a third pass over the input to normalize it.
+  SNNStatus status;
+  if (use_work_group(n_groups, layout.size(), queue)) {
+    status = queue_input_gradient<T, Index, IsNCHW, norm_work_group_size>(
+        input, gradient, gamma, stats, output, layout, n_groups,
+        params.epsilon, queue);
+  } else {
+    status = queue_input_gradient<T, Index, IsNCHW, 1>(
+        input, gradient, gamma, stats, output, layout, n_groups,
+        params.epsilon, queue);
+  }
+  if (status.status != StatusCode::OK) {
+    return status;
+  }
+
+  auto const_stats = stats.as_const();
+  Index const batch = params.batch;
+  if (use_work_group(layout.channels, batch * layout.spatial, queue)) {
+    return queue_scale_gradient<T, Index, IsNCHW, norm_work_group_size>(
+        input, gradient, const_stats, beta_grad, gamma_grad, layout, batch,
+        queue);
+  } else {
+    return queue_scale_gradient<T, Index, IsNCHW, 1>(
+        input, gradient, const_stats, beta_grad, gamma_grad, layout, batch,
+        queue);
+  }
+}
+
+template <typename T, typename Index>
+SNNStatus launch_gradient_with_index(
+    BaseMemObject<T const>& input, BaseMemObject<T const>& gradient,
+    BaseMemObject<T const>& gamma, BaseMemObject<T>& beta_grad,
+    BaseMemObject<T>& gamma_grad, BaseMemObject<T>& output,
+    StatMemObject<T>& workspace, NormalizationParams const& params,
+    cl::sycl::queue& queue) {
+  if (params.input_format == DataFormat::NCHW) {
+    return launch_gradient_with_layout<T, Index, true>(
+        input, gradient, gamma, beta_grad, gamma_grad, output, workspace,
+        params, queue);
+  } else {
+    return launch_gradient_with_layout<T, Index, false>(
+        input, gradient, gamma, beta_grad, gamma_grad, output, workspace,
+        params, queue);
+  }
+}
+
+bool exceeds_int32(NormalizationParams const& params) {
+  size_t const n_items = static_cast<size_t>(params.batch) * params.rows *
+                         params.cols * params.channels;
+  return n_items > static_cast<size_t>(std::numeric_limits<int32_t>::max());
+}
+}  // namespace
+
+template <typename T>
+SNNStatus launch_forward(BaseMemObject<T const>& input,
+                         BaseMemObject<T const>& beta,
+                         BaseMemObject<T const>& gamma,
+                         BaseMemObject<T>& output,
+                         NormalizationParams const& params,
+                         cl::sycl::queue& queue) {
+  if (exceeds_int32(params)) {
+#ifdef SNN_USE_INT64
+    return launch_forward_with_index<T, int64_t>(input, beta, gamma, output,
+                                                 params, queue);
+#else
+    return StatusCode::IndexExceeded;
+#endif  // SNN_USE_INT64
+  } else {
+    return launch_forward_with_index<T, int32_t>(input, beta, gamma, output,
+                                                 params, queue);
+  }
+}
+
+template <typename T>
+SNNStatus launch_gradient(BaseMemObject<T const>& input,
+                          BaseMemObject<T const>& gradient,
+                          BaseMemObject<T const>& gamma,
+                          BaseMemObject<T>& beta_grad,
+                          BaseMemObject<T>& gamma_grad,
+                          BaseMemObject<T>& output,
+                          StatMemObject<T>& workspace,
+                          NormalizationParams const& params,
+                          cl::sycl::queue& queue) {
+  if (exceeds_int32(params)) {
+#ifdef SNN_USE_INT64
+    return launch_gradient_with_index<T, int64_t>(input, gradient, gamma,
+                                                  beta_grad, gamma_grad,
+                                                  output, workspace, params,
+                                                  queue);
+#else
+    return StatusCode::IndexExceeded;
+#endif  // SNN_USE_INT64
+  } else {
+    return launch_gradient_with_index<T, int32_t>(input, gradient, gamma,
+                                                  beta_grad, gamma_grad,
+                                                  output, workspace, params,
+                                                  queue);
+  }
+}
+
+#define INSTANTIATE_LAUNCHERS(DTYPE)                                         \
+  template SNN_EXPORT SNNStatus launch_forward<DTYPE>(                       \
+      BaseMemObject<DTYPE const> & input, BaseMemObject<DTYPE const> & beta, \
+      BaseMemObject<DTYPE const> & gamma, BaseMemObject<DTYPE> & output,     \
+      NormalizationParams const& params, cl::sycl::queue& queue);            \
+  template SNN_EXPORT SNNStatus launch_gradient<DTYPE>(                      \
+      BaseMemObject<DTYPE const> & input,                                    \
+      BaseMemObject<DTYPE const> & gradient,                                 \
+      BaseMemObject<DTYPE const> & gamma, BaseMemObject<DTYPE> & beta_grad,  \
+      BaseMemObject<DTYPE> & gamma_grad, BaseMemObject<DTYPE> & output,      \
+      StatMemObject<DTYPE> & workspace, NormalizationParams const& params,   \
+      cl::sycl::queue& queue)
+
+INSTANTIATE_LAUNCHERS(float);
+
+#ifdef SNN_USE_DOUBLE
+INSTANTIATE_LAUNCHERS(double);
+#endif  // SNN_USE_DOUBLE
+
+#ifdef SNN_USE_HALF
+INSTANTIATE_LAUNCHERS(cl::sycl::half);
+#endif  // SNN_USE_HALF
+
+#undef INSTANTIATE_LAUNCHERS
+
+}  // namespace internal
+}  // namespace normalization
+}  // namespace sycldnn
@@ -13,21 +13,71 @@
  * See the License for the specific language governing permissions and
  * limitations under the License.
  */
+#include "src/helpers/math.h"
 #include "src/reduce/queue_reduction.h"
 #include "sycldnn/internal/helpers/types.h"
 #include "sycldnn/internal/reduce/launch.h"
 #include "sycldnn/mem_object.h"
 #include "sycldnn/reduce/operators.h"
 
+#include <algorithm>
+
 namespace sycldnn {
 namespace reduce {
 namespace internal {
 
+namespace {
+
+/** Work-group size used in the first stage of the two-stage reduction. */
+constexpr int tree_work_group_size = 256;
+/**
+ * Number of work-groups the two-stage reduction aims to launch. Reductions
+ * with at least this many outputs already fill the device with one work-item
+ * per output.
+ */
+constexpr int tree_target_work_groups = 1024;
+/** Minimum number of values reduced by each work-item in the first stage. */
+constexpr int tree_min_values_per_item = 8;
+
+/**
+ * Get the number of chunks to split each output's reduction into for the
+ * two-stage reduction, or 0 if the single kernel reductions should be used.
+ */
+int get_tree_chunks(int batches, int outer, int inner,
+                    cl::sycl::queue& queue) {
+  using helpers::math::divide_ceil;
+  int const n_outputs = batches * inner;
+  if (n_outputs >= tree_target_work_groups) {
+    return 0;
+  }
+  int const max_chunks =
+      outer / (tree_work_group_size * tree_min_values_per_item);
+  if (max_chunks < 1) {
+    return 0;
+  }
+  auto device = queue.get_device();
+  if (device.get_info<cl::sycl::info::device::local_mem_type>() ==
+          cl::sycl::info::local_mem_type::none ||
+      device.get_info<cl::sycl::info::device::max_work_group_size>() <
+          static_cast<size_t>(tree_work_group_size)) {
+    return 0;
+  }
+  return std::min(max_chunks,
+                  divide_ceil(tree_target_work_groups, n_outputs));
+}
+
+}  // namespace
+
 #ifdef SNN_DISABLE_SYCL_PROGRAM
 // Launch the reduce kernel for the passed parameters.
 template <typename T, typename Op>
 SNNStatus launch(BaseMemObject<T const>& input, BaseMemObject<T>& output,
                  int batches, int outer, int inner, cl::sycl::queue& queue) {
+  int const n_chunks = get_tree_chunks(batches, outer, inner, queue);
+  if (n_chunks > 0) {
+    return queue_tree_kernel<T, int, Op>(input, output, batches, outer, inner,
+                                         n_chunks, tree_work_group_size, queue);
+  }
   return queue_default_kernel<T, int, Op>(input, output, batches, outer, inner,
                                           outer, queue);
 }
@@ -39,6 +89,11 @@ SNNStatus launch(BaseMemObject<T const>& input, BaseMemObject<T>& output,
                  cl::sycl::program& program, bool supports_subgroup,
                  sycldnn::internal::types::KernelSubgroupSizesMap&
                      max_kernel_sub_group_sizes) {
+  int const n_chunks = get_tree_chunks(batches, outer, inner, queue);
+  if (n_chunks > 0) {
+    return queue_tree_kernel<T, int, Op>(input, output, batches, outer, inner,
+                                         n_chunks, tree_work_group_size, queue);
+  }
 #if SNN_ENABLE_SUBGROUPS
   if (supports_subgroup && inner == 1) {
     return queue_subgroup_kernel<T, int, Op>(input, output, batches, outer,
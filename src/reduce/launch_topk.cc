@@ -0,0 +1,171 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "sycldnn/mem_object.h"
+#include "sycldnn/status.h"
+
+#include "sycldnn/internal/reduce/launch.h"
+
+#include "sycldnn/reduce/operators.h"
+
+#include "src/reduce/topk_kernel.h"
+
+#include <CL/sycl.hpp>
+
+#include <cstdint>
+#include <type_traits>
+
+namespace sycldnn {
+namespace reduce {
+namespace internal {
+
+namespace {
+
+/**
+ * The number of outputs below which arg reductions use a work-group per output
+ * rather than a work-item per output.
+ */
+constexpr int min_arg_outputs = 1024;
+/** The minimum reduction size to use a work-group per arg reduction output. */
+constexpr int min_arg_work_group_outer = 2048;
+
+template <typename T, int MaxK, bool Largest>
+bool can_use_topk_kernel(cl::sycl::device const& device) {
+  using Kernel = TopKKernel<T, int, MaxK, Largest>;
+  if (device.get_info<cl::sycl::info::device::local_mem_type>() ==
+      cl::sycl::info::local_mem_type::none) {
+    return false;
+  }
+  size_t const local_size = Kernel::LocalSize * (sizeof(T) + sizeof(int32_t));
+  return device.get_info<cl::sycl::info::device::max_work_group_size>() >=
+             static_cast<size_t>(Kernel::WorkGroupSize) &&
+         device.get_info<cl::sycl::info::device::local_mem_size>() >=
+             local_size;
+}
+
+template <typename T, int MaxK, bool Largest>
+SNNStatus queue_topk(BaseMemObject<T const>& input_mem,
+                     BaseMemObject<T>& values_mem,
+                     BaseMemObject<int32_t>& indices_mem, int batches,
+                     int outer, int inner, int k, cl::sycl::queue& queue) {
+  using Kernel = TopKKernel<T, int, MaxK, Largest>;
+  if (!can_use_topk_kernel<T, MaxK, Largest>(queue.get_device())) {
+    return StatusCode::InvalidAlgorithm;
+  }
+  auto event = queue.submit([&](cl::sycl::handler& cgh) {
+    auto input = input_mem.read_accessor(cgh);
+    auto values = values_mem.write_accessor(cgh);
+    auto indices = indices_mem.write_accessor(cgh);
+    LocalAccessor<T> local_values{cl::sycl::range<1>{Kernel::LocalSize}, cgh};
+    LocalAccessor<int32_t> local_indices{
+        cl::sycl::range<1>{Kernel::LocalSize}, cgh};
+    Kernel functor{input, values, indices, local_values, local_indices,
+                   outer, inner, k};
+
+    size_t const n_rows = static_cast<size_t>(batches) * inner;
+    cl::sycl::nd_range<1> nd_range{
+        cl::sycl::range<1>{n_rows * Kernel::WorkGroupSize},
+        cl::sycl::range<1>{Kernel::WorkGroupSize}};
+    cgh.parallel_for(nd_range, functor);
+  });
+  return {event, StatusCode::OK};
+}
+
+template <typename T, bool Largest>
+SNNStatus queue_arg(BaseMemObject<T const>& input_mem,
+                    BaseMemObject<int32_t>& output_mem, int batches,
+                    int outer, int inner, cl::sycl::queue& queue) {
+  int const n_outputs = batches * inner;
+  if (n_outputs < min_arg_outputs && outer >= min_arg_work_group_outer &&
+      can_use_topk_kernel<T, 1, Largest>(queue.get_device())) {
+    // Only the indices are needed, so the values are discarded.
+    cl::sycl::buffer<T, 1> values_buf((cl::sycl::range<1>(n_outputs)));
+    auto values_mem = make_mem_object(values_buf, n_outputs);
+    return queue_topk<T, 1, Largest>(input_mem, values_mem, output_mem,
+                                     batches, outer, inner, 1, queue);
+  }
+  auto event = queue.submit([&](cl::sycl::handler& cgh) {
+    auto input = input_mem.read_accessor(cgh);
+    auto output = output_mem.write_accessor(cgh);
+    ArgReduceKernel<T, int, Largest> functor{input, output, outer, inner};
+    cgh.parallel_for(cl::sycl::range<2>(batches, inner), functor);
+  });
+  return {event, StatusCode::OK};
+}
+
+}  // namespace
+
+template <typename T, typename Op>
+SNNStatus launch_arg(BaseMemObject<T const>& input,
+                     BaseMemObject<int32_t>& output, int batches, int outer,
+                     int inner, cl::sycl::queue& queue) {
+  return queue_arg<T, std::is_same<Op, ArgMax>::value>(input, output, batches,
+                                                       outer, inner, queue);
+}
+
+template <typename T>
+SNNStatus launch_topk(BaseMemObject<T const>& input, BaseMemObject<T>& values,
+                      BaseMemObject<int32_t>& indices, int batches, int outer,
+                      int inner, int k, cl::sycl::queue& queue) {
+  if (k <= 1) {
+    return queue_topk<T, 1, true>(input, values, indices, batches, outer,
+                                  inner, k, queue);
+  } else if (k <= 2) {
+    return queue_topk<T, 2, true>(input, values, indices, batches, outer,
+                                  inner, k, queue);
+  } else if (k <= 4) {
+    return queue_topk<T, 4, true>(input, values, indices, batches, outer,
+                                  inner, k, queue);
+  } else if (k <= 8) {
+    return queue_topk<T, 8, true>(input, values, indices, batches, outer,
+                                  inner, k, queue);
+  } else if (k <= 16) {
+    return queue_topk<T, 16, true>(input, values, indices, batches, outer,
+                                   inner, k, queue);
+  } else {
+    return queue_topk<T, 32, true>(input, values, indices, batches, outer,
+                                   inner, k, queue);
+  }
+}
+
+#define INSTANTIATE_ARG_LAUNCHER(DTYPE, OP)                                \
+  template SNN_EXPORT SNNStatus launch_arg<DTYPE, OP>(                     \
+      BaseMemObject<DTYPE const> & input, BaseMemObject<int32_t> & output, \
+      int batches, int outer, int inner, cl::sycl::queue& queue);
+
+#define INSTANTIATE_FOR_TYPE(DTYPE)                                        \
+  INSTANTIATE_ARG_LAUNCHER(DTYPE, ArgMax)                                  \
+  INSTANTIATE_ARG_LAUNCHER(DTYPE, ArgMin)                                  \
+  template SNN_EXPORT SNNStatus launch_topk<DTYPE>(                        \
+      BaseMemObject<DTYPE const> & input, BaseMemObject<DTYPE> & values,   \
+      BaseMemObject<int32_t> & indices, int batches, int outer, int inner, \
+      int k, cl::sycl::queue& queue);
+
+INSTANTIATE_FOR_TYPE(float);
+
+#ifdef SNN_USE_DOUBLE
+INSTANTIATE_FOR_TYPE(double);
+#endif  // SNN_USE_DOUBLE
+
+#ifdef SNN_USE_HALF
+INSTANTIATE_FOR_TYPE(cl::sycl::half);
+#endif  // SNN_USE_HALF
+
+#undef INSTANTIATE_FOR_TYPE
+#undef INSTANTIATE_ARG_LAUNCHER
+
+}  // namespace internal
+}  // namespace reduce
+}  // namespace sycldnn
@@ -33,6 +33,19 @@ SNNStatus queue_default_kernel(BaseMemObject<T const>& input,
                                int inner, int finalizeParam,
                                cl::sycl::queue& queue);
 
+/**
+ * Add a two-stage reduce to the provided SYCL queue. Each output is split into
+ * n_chunks chunks which are reduced by separate work-groups, then the partial
+ * results are reduced by a second kernel.
+ *
+ * The work-group size must be a power of two.
+ */
+template <typename T, typename Index, typename Op>
+SNNStatus queue_tree_kernel(BaseMemObject<T const>& input,
+                            BaseMemObject<T>& output, int batches, int outer,
+                            int inner, int n_chunks, int work_group_size,
+                            cl::sycl::queue& queue);
+
 #ifndef SNN_DISABLE_SYCL_PROGRAM
 template <typename T, typename Index, typename Op>
 SNNStatus queue_subgroup_kernel(
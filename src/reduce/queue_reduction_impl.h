@@ -25,6 +25,7 @@
 #include "src/helpers/math.h"
 #include "src/reduce/default_kernel.h"
 #include "src/reduce/queue_reduction.h"
+#include "src/reduce/tree_kernel.h"
 
 #ifndef SNN_DISABLE_SYCL_PROGRAM
 #include "src/reduce/subgroup_kernel.h"
@@ -60,6 +61,43 @@ SNNStatus queue_default_kernel(BaseMemObject<T const>& input_mem,
   return {event, StatusCode::OK};
 }
 
+template <typename T, typename Index, typename Op>
+SNNStatus queue_tree_kernel(BaseMemObject<T const>& input_mem,
+                            BaseMemObject<T>& output_mem, int batches,
+                            int outer, int inner, int n_chunks,
+                            int work_group_size, cl::sycl::queue& queue) {
+  using namespace sycldnn::helpers::math;
+  int const chunk_size = divide_ceil(outer, n_chunks);
+  n_chunks = divide_ceil(outer, chunk_size);
+  int const n_outputs = batches * inner;
+  size_t const n_partials = static_cast<size_t>(n_outputs) * n_chunks;
+
+  cl::sycl::buffer<T, 1> partials_buf((cl::sycl::range<1>(n_partials)));
+  auto partials_mem = make_mem_object(partials_buf, n_partials);
+  queue.submit([&](cl::sycl::handler& cgh) {
+    auto input = input_mem.read_accessor(cgh);
+    auto partials = partials_mem.write_accessor(cgh);
+    LocalAccessor<T> workspace{cl::sycl::range<1>(work_group_size), cgh};
+
+    ReducePartialKernel<T, Index, Op> functor{
+        input, partials, workspace, outer, inner, n_chunks, chunk_size,
+        init_val<T, Op>};
+
+    cl::sycl::nd_range<1> nd_range{
+        cl::sycl::range<1>(n_partials * work_group_size),
+        cl::sycl::range<1>(work_group_size)};
+    cgh.parallel_for(nd_range, functor);
+  });
+
+  // The partials for each output are contiguous, so the second stage is a
+  // reduction of [n_outputs, n_chunks, 1]. This also applies the finalization
+  // using the full reduction size.
+  auto const_partials_mem = partials_mem.as_const();
+  return queue_default_kernel<T, Index, Op>(const_partials_mem, output_mem,
+                                            n_outputs, n_chunks, 1, outer,
+                                            queue);
+}
+
 #ifndef SNN_DISABLE_SYCL_PROGRAM
 template <typename T, typename Index, typename Op>
 SNNStatus queue_subgroup_kernel(
@@ -0,0 +1,225 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef SYCLDNN_SRC_REDUCE_TOPK_KERNEL_H_
+#define SYCLDNN_SRC_REDUCE_TOPK_KERNEL_H_
+
+#include "sycldnn/accessor_types.h"
+#include "sycldnn/helpers/macros.h"
+
+#include <CL/sycl.hpp>
+
+#include <cstdint>
+
+namespace sycldnn {
+namespace reduce {
+
+namespace internal {
+
+/**
+ * Whether the value a at index a_idx should be ordered before the value b at
+ * index b_idx. Larger values come first if Largest is true, and smaller values
+ * come first otherwise. Equal values are ordered by index, and entries with a
+ * negative index are empty and ordered after all others.
+ */
+template <bool Largest, typename T>
+SNN_ALWAYS_INLINE bool is_before(T a, int32_t a_idx, T b, int32_t b_idx) {
+  if (b_idx < 0) {
+    return a_idx >= 0;
+  }
+  if (a_idx < 0) {
+    return false;
+  }
+  if (a == b) {
+    return a_idx < b_idx;
+  }
+  return Largest ? a > b : a < b;
+}
+
+/**
+ * Insert a value into a sorted list of K values, dropping the last value if
+ * the new value is ordered before it.
+ */
+template <bool Largest, int K, typename T>
+SNN_ALWAYS_INLINE void insert_sorted(T (&values)[K], int32_t (&indices)[K],
+                                     T value, int32_t idx) {
+  if (!is_before<Largest>(value, idx, values[K - 1], indices[K - 1])) {
+    return;
+  }
+  int pos = K - 1;
+  for (; pos > 0 &&
+         is_before<Largest>(value, idx, values[pos - 1], indices[pos - 1]);
+       --pos) {
+    values[pos] = values[pos - 1];
+    indices[pos] = indices[pos - 1];
+  }
+  values[pos] = value;
+  indices[pos] = idx;
+}
+
+}  // namespace internal
+
+/**
+ * Compute the index of the largest or smallest value in the outer dimension of
+ * a [batches, outer, inner] tensor, with one work-item per output. The first
+ * index is used when the value occurs more than once.
+ */
+template <typename T, typename Index, bool Largest>
+struct ArgReduceKernel {
+  ArgReduceKernel(ReadAccessor<T const> const& input,
+                  WriteAccessor<int32_t> const& output, Index outer,
+                  Index inner)
+      : input_{input}, output_{output}, outer_{outer}, inner_{inner} {}
+
+  void SNN_ALWAYS_INLINE operator()(cl::sycl::item<2> item) const {
+    Index batch = item.get_id(0);
+    Index inner = item.get_id(1);
+
+    const auto input = input_.get_pointer().get();
+    auto output = output_.get_pointer().get();
+
+    const auto input_n = input + batch * outer_ * inner_ + inner;
+    T best = input_n[0];
+    int32_t best_idx = 0;
+    for (Index i = 1; i < outer_; ++i) {
+      T value = input_n[i * inner_];
+      if (Largest ? value > best : value < best) {
+        best = value;
+        best_idx = static_cast<int32_t>(i);
+      }
+    }
+    output[batch * inner_ + inner] = best_idx;
+  }
+
+ private:
+  ReadAccessor<T const> input_;
+  WriteAccessor<int32_t> output_;
+  Index const outer_;
+  Index const inner_;
+};
+
+/**
+ * Compute the k largest or smallest values in the outer dimension of a
+ * [batches, outer, inner] tensor, along with their indices, writing them in
+ * order to a [batches, k, inner] tensor.
+ *
+ * Each work-group computes a single output row. Every work-item keeps a sorted
+ * list of the best MaxK values it has seen, then the lists of the whole
+ * work-group are sorted in local memory with a bitonic sorting network and the
+ * first k values are written out.
+ *
+ * MaxK must be a power of two which is at least k.
+ */
+template <typename T, typename Index, int MaxK, bool Largest>
+struct TopKKernel {
+  /** The number of work-items in each work-group. */
+  static constexpr int WorkGroupSize = 64;
+  /** The number of values and indices required in local memory. */
+  static constexpr int LocalSize = WorkGroupSize * MaxK;
+
+  TopKKernel(ReadAccessor<T const> const& input, WriteAccessor<T> const& values,
+             WriteAccessor<int32_t> const& indices,
+             LocalAccessor<T> const& local_values,
+             LocalAccessor<int32_t> const& local_indices, Index outer,
+             Index inner, Index k)
+      : input_{input},
+        values_{values},
+        indices_{indices},
+        local_values_{local_values},
+        local_indices_{local_indices},
+        outer_{outer},
+        inner_{inner},
+        k_{k} {}
+
+  void SNN_ALWAYS_INLINE operator()(cl::sycl::nd_item<1> item) const {
+    Index const row = item.get_group(0);
+    int const local_idx = item.get_local_id(0);
+    Index const batch = row / inner_;
+    Index const inner = row % inner_;
+
+    const auto input = input_.get_pointer().get();
+    const auto input_n = input + batch * outer_ * inner_ + inner;
+
+    T top_values[MaxK];
+    int32_t top_indices[MaxK];
+    for (int i = 0; i < MaxK; ++i) {
+      top_values[i] = T{0};
+      top_indices[i] = -1;
+    }
+    for (Index i = local_idx; i < outer_; i += WorkGroupSize) {
+      internal::insert_sorted<Largest>(top_values, top_indices,
+                                       input_n[i * inner_],
+                                       static_cast<int32_t>(i));
+    }
+
+    auto local_values = local_values_.get_pointer();
+    auto local_indices = local_indices_.get_pointer();
+    for (int i = 0; i < MaxK; ++i) {
+      local_values[local_idx * MaxK + i] = top_values[i];
+      local_indices[local_idx * MaxK + i] = top_indices[i];
+    }
+
+    for (int size = 2; size <= LocalSize; size *= 2) {
+      for (int stride = size / 2; stride > 0; stride /= 2) {
+        item.barrier(cl::sycl::access::fence_space::local_space);
+        for (int pair = local_idx; pair < LocalSize / 2;
+             pair += WorkGroupSize) {
+          int const lo = 2 * pair - (pair & (stride - 1));
+          int const hi = lo + stride;
+          T const lo_value = local_values[lo];
+          T const hi_value = local_values[hi];
+          int32_t const lo_idx = local_indices[lo];
+          int32_t const hi_idx = local_indices[hi];
+          bool const in_order = (lo & size) == 0;
+          bool const swap =
+              in_order
+                  ? internal::is_before<Largest>(hi_value, hi_idx, lo_value,
+                                                 lo_idx)
+                  : internal::is_before<Largest>(lo_value, lo_idx, hi_value,
+                                                 hi_idx);
+          if (swap) {
+            local_values[lo] = hi_value;
+            local_values[hi] = lo_value;
+            local_indices[lo] = hi_idx;
+            local_indices[hi] = lo_idx;
+          }
+        }
+      }
+    }
+    item.barrier(cl::sycl::access::fence_space::local_space);
+
+    auto values = values_.get_pointer().get();
+    auto indices = indices_.get_pointer().get();
+    for (Index i = local_idx; i < k_; i += WorkGroupSize) {
+      Index const out_idx = (batch * k_ + i) * inner_ + inner;
+      values[out_idx] = local_values[i];
+      indices[out_idx] = local_indices[i];
+    }
+  }
+
+ private:
+  ReadAccessor<T const> input_;
+  WriteAccessor<T> values_;
+  WriteAccessor<int32_t> indices_;
+  LocalAccessor<T> local_values_;
+  LocalAccessor<int32_t> local_indices_;
+  Index const outer_;
+  Index const inner_;
+  Index const k_;
+};
+
+}  // namespace reduce
+}  // namespace sycldnn
+#endif  // SYCLDNN_SRC_REDUCE_TOPK_KERNEL_H_
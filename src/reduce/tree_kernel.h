@@ -0,0 +1,128 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef SYCLDNN_SRC_REDUCE_TREE_KERNEL_H_
+#define SYCLDNN_SRC_REDUCE_TREE_KERNEL_H_
+
+#include "sycldnn/accessor_types.h"
+#include "sycldnn/reduce/operators.h"
+#include "sycldnn/status.h"
+
+#include "src/helpers/workgroup_reduce.h"
+
+#include <CL/sycl.hpp>
+
+namespace sycldnn {
+namespace reduce {
+
+namespace internal {
+
+/**
+ * Binary operation combining two partial results of a reduction. Mean is
+ * accumulated as a sum and only divided once all partials are combined.
+ */
+template <typename Op>
+struct Combine {
+  template <typename T>
+  SNN_ALWAYS_INLINE T operator()(T lhs, T rhs) {
+    return lhs + rhs;
+  }
+};
+
+template <>
+struct Combine<Max> {
+  template <typename T>
+  SNN_ALWAYS_INLINE T operator()(T lhs, T rhs) {
+    return cl::sycl::max(lhs, rhs);
+  }
+};
+
+template <>
+struct Combine<Min> {
+  template <typename T>
+  SNN_ALWAYS_INLINE T operator()(T lhs, T rhs) {
+    return cl::sycl::min(lhs, rhs);
+  }
+};
+
+}  // namespace internal
+
+/**
+ * First stage of a two-stage reduction of [batches, outer, inner] over the
+ * outer dimension, used when there are too few outputs to fill the device.
+ *
+ * The outer dimension of each output is split into n_chunks chunks, and each
+ * chunk is reduced by a whole work-group. Work-group g computes chunk
+ * g % n_chunks of output g / n_chunks and writes the unfinalized partial result
+ * to partials[g], so the partials form a [batches * inner, n_chunks] tensor to
+ * be reduced by a second launch.
+ *
+ * The work-group size must be a power of two.
+ */
+template <typename T, typename Index, typename Op>
+struct ReducePartialKernel {
+  ReducePartialKernel(ReadAccessor<T const> const& input,
+                      WriteAccessor<T> const& partials,
+                      LocalAccessor<T> const& workspace, Index outer,
+                      Index inner, Index n_chunks, Index chunk_size, T init)
+      : input_{input},
+        partials_{partials},
+        workspace_{workspace},
+        outer_{outer},
+        inner_{inner},
+        n_chunks_{n_chunks},
+        chunk_size_{chunk_size},
+        init_{init} {}
+
+  void SNN_ALWAYS_INLINE operator()(cl::sycl::nd_item<1> item) const {
+    Index const group = item.get_group(0);
+    Index const local_idx = item.get_local_id(0);
+    Index const work_group_size = item.get_local_range(0);
+    Index const output_idx = group / n_chunks_;
+    Index const chunk = group % n_chunks_;
+    Index const batch = output_idx / inner_;
+    Index const inner = output_idx % inner_;
+
+    const auto input = input_.get_pointer().get();
+    const auto input_n = input + batch * outer_ * inner_ + inner;
+    Index const start = chunk * chunk_size_;
+    Index const end = cl::sycl::min(start + chunk_size_, outer_);
+
+    using Combine = internal::Combine<Op>;
+    T value = init_;
+    for (Index i = start + local_idx; i < end; i += work_group_size) {
+      value = Combine()(value, input_n[i * inner_]);
+    }
+    value = helpers::reduce::workgroup_reduce<Combine, Index>(
+        value, item, workspace_.get_pointer());
+    if (local_idx == 0) {
+      partials_.get_pointer().get()[group] = value;
+    }
+  }
+
+ private:
+  ReadAccessor<T const> input_;
+  WriteAccessor<T> partials_;
+  LocalAccessor<T> workspace_;
+  Index const outer_;
+  Index const inner_;
+  Index const n_chunks_;
+  Index const chunk_size_;
+  T const init_;
+};
+
+}  // namespace reduce
+}  // namespace sycldnn
+#endif  // SYCLDNN_SRC_REDUCE_TREE_KERNEL_H_
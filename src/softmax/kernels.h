@@ -0,0 +1,557 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef SYCLDNN_SRC_SOFTMAX_KERNELS_H_
+#define SYCLDNN_SRC_SOFTMAX_KERNELS_H_
+
+#include "sycldnn/accessor_types.h"
+
+#include "sycldnn/helpers/macros.h"
+
+#include "src/helpers/vector_element.h"
+#include "src/helpers/vector_io.h"
+#include "src/helpers/vector_type.h"
+#include "src/helpers/workgroup_reduce.h"
+
+#include <CL/sycl.hpp>
+
+#include <limits>
+
+namespace sycldnn {
+namespace softmax {
+namespace internal {
+
+/**
+ * Rescale a sum of exponentials taken relative to one maximum to be relative
+ * to a new, larger maximum.
+ *
+ * While every value seen is -inf the maximum is also -inf, and
+ * exp(-inf - -inf) is NaN. Each such value is instead counted as exp(0), so
+ * the sum stays finite and is scaled to zero by the first finite maximum. A
+ * sum of zero is left as it is, as it has no maximum to rescale from.
+ */
+template <typename DataType>
+inline SNN_ALWAYS_INLINE DataType rescale_sum(DataType sum, DataType max,
+                                              DataType new_max) {
+  DataType const neg_inf{-std::numeric_limits<float>::infinity()};
+  DataType const scaled = sum * cl::sycl::exp(max - new_max);
+  DataType const nonzero =
+      cl::sycl::select(scaled, sum, cl::sycl::isequal(sum, DataType{0}));
+  return cl::sycl::select(nonzero, sum, cl::sycl::isequal(new_max, neg_inf));
+}
+
+/**
+ * Add a value to a running maximum and sum of exponentials.
+ *
+ * The sum is kept relative to the running maximum, so whenever the maximum
+ * increases the existing sum is rescaled to the new maximum. This allows the
+ * softmax denominator to be computed in a single pass over the data without
+ * overflowing the exponential.
+ */
+template <typename DataType>
+inline SNN_ALWAYS_INLINE void online_update(DataType value, DataType& max,
+                                            DataType& sum) {
+  DataType const new_max = cl::sycl::fmax(max, value);
+  sum = rescale_sum(sum, max, new_max) +
+        rescale_sum(DataType{1}, value, new_max);
+  max = new_max;
+}
+
+/**
+ * Merge one running maximum and sum of exponentials into another.
+ */
+template <typename T>
+inline SNN_ALWAYS_INLINE void online_merge(T other_max, T other_sum, T& max,
+                                           T& sum) {
+  T const new_max = cl::sycl::fmax(max, other_max);
+  sum = rescale_sum(sum, max, new_max) +
+        rescale_sum(other_sum, other_max, new_max);
+  max = new_max;
+}
+
+/**
+ * Get the scale applied to each value in a row when normalizing, given the sum
+ * of exponentials of the row. This is the reciprocal of the sum for the
+ * softmax, and the logarithm of the sum for the log-softmax.
+ */
+template <bool Log, typename DataType>
+inline SNN_ALWAYS_INLINE DataType row_scale(DataType sum) {
+  return Log ? cl::sycl::log(sum) : DataType{1} / sum;
+}
+
+/**
+ * Compute the softmax output for a value, given the maximum of its row and
+ * the scale from \ref sycldnn::softmax::internal::row_scale.
+ *
+ * For the log-softmax the output is computed directly as
+ *   value - max - log(sum)
+ * rather than as the logarithm of the softmax, so that small probabilities do
+ * not underflow to zero.
+ */
+template <bool Log, typename DataType>
+inline SNN_ALWAYS_INLINE DataType normalize(DataType value, DataType max,
+                                            DataType scale) {
+  return Log ? value - max - scale : cl::sycl::exp(value - max) * scale;
+}
+
+/**
+ * Get the term summed along each row in the softmax gradient, given the
+ * forward output y and the gradient dy.
+ *
+ * For the softmax this is y * dy, while for the log-softmax it is dy.
+ */
+template <bool Log, typename DataType>
+inline SNN_ALWAYS_INLINE DataType gradient_term(DataType output,
+                                                DataType gradient) {
+  return Log ? gradient : output * gradient;
+}
+
+/**
+ * Compute the gradient with respect to the softmax input, given the forward
+ * output y, the gradient dy and the row sum of the gradient terms:
+ *   softmax:     y * (dy - sum(y * dy))
+ *   log-softmax: dy - exp(y) * sum(dy)
+ */
+template <bool Log, typename DataType>
+inline SNN_ALWAYS_INLINE DataType input_gradient(DataType output,
+                                                 DataType gradient,
+                                                 DataType sum) {
+  return Log ? gradient - cl::sycl::exp(output) * sum
+             : output * (gradient - sum);
+}
+
+/**
+ * Reduction operator to merge (max, sum) pairs across a work-group, with the
+ * maximum in the first element of the vector and the sum in the second.
+ */
+struct OnlineMerge {
+  template <typename T>
+  SNN_ALWAYS_INLINE cl::sycl::vec<T, 2> operator()(cl::sycl::vec<T, 2> lhs,
+                                                   cl::sycl::vec<T, 2> rhs) {
+    T max = lhs.s0();
+    T sum = lhs.s1();
+    online_merge(rhs.s0(), rhs.s1(), max, sum);
+    return cl::sycl::vec<T, 2>{max, sum};
+  }
+};
+
+/**
+ * Softmax kernel for rows which are contiguous in memory, such as the channels
+ * of an NHWC tensor.
+ *
+ * Each work-item computes the softmax of a whole row. The first pass over the
+ * row computes the maximum and sum of exponentials of each vector lane, which
+ * are then merged. The second pass writes the normalized exponentials.
+ *
+ * If Log is true then the log-softmax is computed instead.
+ *
+ * The row length must be a multiple of the vector width.
+ */
+template <typename T, typename Index, int VectorWidth, bool Log>
+struct ContiguousSoftmaxKernel {
+  ContiguousSoftmaxKernel(ReadAccessor<T const> const& input,
+                          WriteAccessor<T> const& output, Index n_rows,
+                          Index row_size)
+      : input_{input},
+        output_{output},
+        n_rows_{n_rows},
+        row_size_{row_size} {}
+
+  void SNN_ALWAYS_INLINE operator()(cl::sycl::item<1> item) const {
+    Index const row = item.get_id(0);
+    if (row < n_rows_) {
+      using DataType = typename helpers::VectorType<T, VectorWidth>::type;
+      using Load = helpers::io::Load<DataType>;
+      using Store = helpers::io::Store<DataType>;
+
+      Index const offset = row * row_size_;
+      auto in_ptr = input_.get_pointer() + offset;
+      auto out_ptr = output_.get_pointer() + offset;
+
+      DataType lane_max = Load()(in_ptr, 0);
+      DataType lane_sum{1};
+      for (Index idx = VectorWidth; idx < row_size_; idx += VectorWidth) {
+        online_update(Load()(in_ptr, idx), lane_max, lane_sum);
+      }
+
+      T max = helpers::vector_element::get(lane_max, 0);
+      T sum = helpers::vector_element::get(lane_sum, 0);
+      SNN_PRAGMA_UNROLL
+      for (int i = 1; i < VectorWidth; ++i) {
+        online_merge(helpers::vector_element::get(lane_max, i),
+                     helpers::vector_element::get(lane_sum, i), max, sum);
+      }
+
+      DataType const row_max{max};
+      DataType const scale{row_scale<Log>(sum)};
+      for (Index idx = 0; idx < row_size_; idx += VectorWidth) {
+        DataType const value = Load()(in_ptr, idx);
+        Store()(out_ptr, idx, normalize<Log>(value, row_max, scale));
+      }
+    }
+  }
+
+ private:
+  ReadAccessor<T const> input_;
+  WriteAccessor<T> output_;
+  Index const n_rows_;
+  Index const row_size_;
+};
+
+/**
+ * Softmax kernel for long rows.
+ *
+ * Each work-group computes the softmax of a single row. Each work-item
+ * computes the maximum and sum of exponentials of a strided subset of the
+ * row, so that for contiguous rows adjacent work-items read adjacent values.
+ * These partial results are then merged across the work-group in local memory,
+ * before every work-item writes its subset of the normalized exponentials.
+ *
+ * Using the [outer, row_size, inner] view of the tensor, work-group g computes
+ * the row starting at inner position g % inner_size in outer index
+ * g / inner_size. Strided rows are only split across a work-group when there
+ * are too few rows to otherwise fill the device.
+ *
+ * The row length must be at least the work-group size.
+ */
+template <typename T, typename Index, int WorkGroupSize, bool Log>
+struct WorkGroupSoftmaxKernel {
+  /**
+   * The number of values required in local memory. The reduction stores a
+   * (max, sum) pair for each work-item.
+   */
+  static constexpr int LocalSize = 2 * WorkGroupSize;
+
+  WorkGroupSoftmaxKernel(ReadAccessor<T const> const& input,
+                         WriteAccessor<T> const& output,
+                         LocalAccessor<T> const& workspace, Index row_size,
+                         Index inner_size)
+      : input_{input},
+        output_{output},
+        workspace_{workspace},
+        row_size_{row_size},
+        inner_size_{inner_size} {}
+
+  void SNN_ALWAYS_INLINE operator()(cl::sycl::nd_item<1> item) const {
+    Index const row = item.get_group(0);
+    Index const local_idx = item.get_local_id(0);
+    Index const outer = row / inner_size_;
+    Index const inner = row % inner_size_;
+
+    using Load = helpers::io::Load<T>;
+    using Store = helpers::io::Store<T>;
+    using MaxSum = cl::sycl::vec<T, 2>;
+
+    Index const offset = outer * row_size_ * inner_size_ + inner;
+    auto in_ptr = input_.get_pointer() + offset;
+    auto out_ptr = output_.get_pointer() + offset;
+
+    T max = Load()(in_ptr, local_idx * inner_size_);
+    T sum{1};
+    for (Index idx = local_idx + WorkGroupSize; idx < row_size_;
+         idx += WorkGroupSize) {
+      online_update(Load()(in_ptr, idx * inner_size_), max, sum);
+    }
+
+    auto workspace = workspace_.get_pointer();
+    MaxSum row_stats =
+        helpers::reduce::workgroup_reduce<OnlineMerge, Index>(
+            MaxSum{max, sum}, item, workspace);
+
+    // Only the first work-item holds the merged result, so it is broadcast
+    // through the start of the workspace, which the reduction never reads.
+    if (local_idx == 0) {
+      helpers::io::Store<MaxSum>()(workspace, helpers::io::as_vec_index(0),
+                                   row_stats);
+    }
+    item.barrier(cl::sycl::access::fence_space::local_space);
+    row_stats = helpers::io::Load<MaxSum>()(
+        helpers::internal::as_const_ptr(workspace),
+        helpers::io::as_vec_index(0));
+
+    T const row_max = row_stats.s0();
+    T const scale = row_scale<Log>(row_stats.s1());
+    for (Index idx = local_idx; idx < row_size_; idx += WorkGroupSize) {
+      Index const row_idx = idx * inner_size_;
+      T const value = Load()(in_ptr, row_idx);
+      Store()(out_ptr, row_idx, normalize<Log>(value, row_max, scale));
+    }
+  }
+
+ private:
+  ReadAccessor<T const> input_;
+  WriteAccessor<T> output_;
+  LocalAccessor<T> workspace_;
+  Index const row_size_;
+  Index const inner_size_;
+};
+
+/**
+ * Softmax kernel for rows which are strided in memory, such as the channels of
+ * an NCHW tensor.
+ *
+ * The tensor is viewed as [outer, row_size, inner], with the softmax computed
+ * along the middle dimension. Each work-item computes the softmax for
+ * VectorWidth adjacent inner positions, with each vector lane holding an
+ * independent row, so adjacent work-items read adjacent values in memory.
+ *
+ * The inner size must be a multiple of the vector width.
+ */
+template <typename T, typename Index, int VectorWidth, bool Log>
+struct StridedSoftmaxKernel {
+  StridedSoftmaxKernel(ReadAccessor<T const> const& input,
+                       WriteAccessor<T> const& output, Index n_vecs,
+                       Index row_size, Index inner_size)
+      : input_{input},
+        output_{output},
+        n_vecs_{n_vecs},
+        row_size_{row_size},
+        inner_size_{inner_size} {}
+
+  void SNN_ALWAYS_INLINE operator()(cl::sycl::item<1> item) const {
+    Index const idx = item.get_id(0);
+    if (idx < n_vecs_) {
+      using DataType = typename helpers::VectorType<T, VectorWidth>::type;
+      using Load = helpers::io::Load<DataType>;
+      using Store = helpers::io::Store<DataType>;
+
+      Index const inner_vecs = inner_size_ / VectorWidth;
+      Index const outer = idx / inner_vecs;
+      Index const inner = (idx % inner_vecs) * VectorWidth;
+      Index const offset = outer * row_size_ * inner_size_ + inner;
+      auto in_ptr = input_.get_pointer() + offset;
+      auto out_ptr = output_.get_pointer() + offset;
+
+      DataType max = Load()(in_ptr, 0);
+      DataType sum{1};
+      for (Index i = 1; i < row_size_; ++i) {
+        online_update(Load()(in_ptr, i * inner_size_), max, sum);
+      }
+
+      DataType const scale = row_scale<Log>(sum);
+      for (Index i = 0; i < row_size_; ++i) {
+        DataType const value = Load()(in_ptr, i * inner_size_);
+        Store()(out_ptr, i * inner_size_, normalize<Log>(value, max, scale));
+      }
+    }
+  }
+
+ private:
+  ReadAccessor<T const> input_;
+  WriteAccessor<T> output_;
+  Index const n_vecs_;
+  Index const row_size_;
+  Index const inner_size_;
+};
+
+/**
+ * Softmax gradient kernel for rows which are contiguous in memory.
+ *
+ * Given the softmax output y and the incoming gradient dy, each work-item
+ * computes dx = y * (dy - sum(dy * y)) for a whole row, in one pass to compute
+ * the sum and a second to write the output. If Log is true then y is the
+ * output of the log-softmax, and dx = dy - exp(y) * sum(dy).
+ *
+ * The row length must be a multiple of the vector width.
+ */
+template <typename T, typename Index, int VectorWidth, bool Log>
+struct ContiguousSoftmaxGradientKernel {
+  ContiguousSoftmaxGradientKernel(ReadAccessor<T const> const& input,
+                                  ReadAccessor<T const> const& gradient,
+                                  WriteAccessor<T> const& output, Index n_rows,
+                                  Index row_size)
+      : input_{input},
+        gradient_{gradient},
+        output_{output},
+        n_rows_{n_rows},
+        row_size_{row_size} {}
+
+  void SNN_ALWAYS_INLINE operator()(cl::sycl::item<1> item) const {
+    Index const row = item.get_id(0);
+    if (row < n_rows_) {
+      using DataType = typename helpers::VectorType<T, VectorWidth>::type;
+      using Load = helpers::io::Load<DataType>;
+      using Store = helpers::io::Store<DataType>;
+
+      Index const offset = row * row_size_;
+      auto in_ptr = input_.get_pointer() + offset;
+      auto grad_ptr = gradient_.get_pointer() + offset;
+      auto out_ptr = output_.get_pointer() + offset;
+
+      DataType lane_sum{0};
+      for (Index idx = 0; idx < row_size_; idx += VectorWidth) {
+        lane_sum +=
+            gradient_term<Log>(Load()(in_ptr, idx), Load()(grad_ptr, idx));
+      }
+      T sum = helpers::vector_element::get(lane_sum, 0);
+      SNN_PRAGMA_UNROLL
+      for (int i = 1; i < VectorWidth; ++i) {
+        sum += helpers::vector_element::get(lane_sum, i);
+      }
+
+      DataType const row_sum{sum};
+      for (Index idx = 0; idx < row_size_; idx += VectorWidth) {
+        DataType const value = Load()(in_ptr, idx);
+        DataType const grad = Load()(grad_ptr, idx);
+        Store()(out_ptr, idx, input_gradient<Log>(value, grad, row_sum));
+      }
+    }
+  }
+
+ private:
+  ReadAccessor<T const> input_;
+  ReadAccessor<T const> gradient_;
+  WriteAccessor<T> output_;
+  Index const n_rows_;
+  Index const row_size_;
+};
+
+/**
+ * Softmax gradient kernel for long rows.
+ *
+ * Each work-group computes the gradient of a single row, using the same
+ * mapping of work-groups to rows as the
+ * \ref sycldnn::softmax::internal::WorkGroupSoftmaxKernel, with the sum of the
+ * gradient terms reduced across the work-group in local memory.
+ */
+template <typename T, typename Index, int WorkGroupSize, bool Log>
+struct WorkGroupSoftmaxGradientKernel {
+  /** The number of values required in local memory. */
+  static constexpr int LocalSize = WorkGroupSize;
+
+  WorkGroupSoftmaxGradientKernel(ReadAccessor<T const> const& input,
+                                 ReadAccessor<T const> const& gradient,
+                                 WriteAccessor<T> const& output,
+                                 LocalAccessor<T> const& workspace,
+                                 Index row_size, Index inner_size)
+      : input_{input},
+        gradient_{gradient},
+        output_{output},
+        workspace_{workspace},
+        row_size_{row_size},
+        inner_size_{inner_size} {}
+
+  void SNN_ALWAYS_INLINE operator()(cl::sycl::nd_item<1> item) const {
+    Index const row = item.get_group(0);
+    Index const local_idx = item.get_local_id(0);
+    Index const outer = row / inner_size_;
+    Index const inner = row % inner_size_;
+
+    using Load = helpers::io::Load<T>;
+    using Store = helpers::io::Store<T>;
+
+    Index const offset = outer * row_size_ * inner_size_ + inner;
+    auto in_ptr = input_.get_pointer() + offset;
+    auto grad_ptr = gradient_.get_pointer() + offset;
+    auto out_ptr = output_.get_pointer() + offset;
+
+    T sum{0};
+    for (Index idx = local_idx; idx < row_size_; idx += WorkGroupSize) {
+      Index const row_idx = idx * inner_size_;
+      sum += gradient_term<Log>(Load()(in_ptr, row_idx),
+                                Load()(grad_ptr, row_idx));
+    }
+
+    auto workspace = workspace_.get_pointer();
+    sum = helpers::reduce::workgroup_reduce<helpers::reduce::Sum, Index>(
+        sum, item, workspace);
+
+    // Only the first work-item holds the reduced sum, so it is broadcast
+    // through the start of the workspace, which the reduction never reads.
+    if (local_idx == 0) {
+      Store()(workspace, 0, sum);
+    }
+    item.barrier(cl::sycl::access::fence_space::local_space);
+    sum = Load()(helpers::internal::as_const_ptr(workspace), 0);
+
+    for (Index idx = local_idx; idx < row_size_; idx += WorkGroupSize) {
+      Index const row_idx = idx * inner_size_;
+      T const value = Load()(in_ptr, row_idx);
+      T const grad = Load()(grad_ptr, row_idx);
+      Store()(out_ptr, row_idx, input_gradient<Log>(value, grad, sum));
+    }
+  }
+
+ private:
+  ReadAccessor<T const> input_;
+  ReadAccessor<T const> gradient_;
+  WriteAccessor<T> output_;
+  LocalAccessor<T> workspace_;
+  Index const row_size_;
+  Index const inner_size_;
+};
+
+/**
+ * Softmax gradient kernel for rows which are strided in memory, using the
+ * same [outer, row_size, inner] view and vectorization across independent
+ * rows as the \ref sycldnn::softmax::internal::StridedSoftmaxKernel.
+ */
+template <typename T, typename Index, int VectorWidth, bool Log>
+struct StridedSoftmaxGradientKernel {
+  StridedSoftmaxGradientKernel(ReadAccessor<T const> const& input,
+                               ReadAccessor<T const> const& gradient,
+                               WriteAccessor<T> const& output, Index n_vecs,
+                               Index row_size, Index inner_size)
+      : input_{input},
+        gradient_{gradient},
+        output_{output},
+        n_vecs_{n_vecs},
+        row_size_{row_size},
+        inner_size_{inner_size} {}
+
+  void SNN_ALWAYS_INLINE operator()(cl::sycl::item<1> item) const {
+    Index const idx = item.get_id(0);
+    if (idx < n_vecs_) {
+      using DataType = typename helpers::VectorType<T, VectorWidth>::type;
+      using Load = helpers::io::Load<DataType>;
+      using Store = helpers::io::Store<DataType>;
+
+      Index const inner_vecs = inner_size_ / VectorWidth;
+      Index const outer = idx / inner_vecs;
+      Index const inner = (idx % inner_vecs) * VectorWidth;
+      Index const offset = outer * row_size_ * inner_size_ + inner;
+      auto in_ptr = input_.get_pointer() + offset;
+      auto grad_ptr = gradient_.get_pointer() + offset;
+      auto out_ptr = output_.get_pointer() + offset;
+
+      DataType sum{0};
+      for (Index i = 0; i < row_size_; ++i) {
+        Index const row_idx = i * inner_size_;
+        sum += gradient_term<Log>(Load()(in_ptr, row_idx),
+                                  Load()(grad_ptr, row_idx));
+      }
+
+      for (Index i = 0; i < row_size_; ++i) {
+        DataType const value = Load()(in_ptr, i * inner_size_);
+        DataType const grad = Load()(grad_ptr, i * inner_size_);
+        Store()(out_ptr, i * inner_size_,
+                input_gradient<Log>(value, grad, sum));
+      }
+    }
+  }
+
+ private:
+  ReadAccessor<T const> input_;
+  ReadAccessor<T const> gradient_;
+  WriteAccessor<T> output_;
+  Index const n_vecs_;
+  Index const row_size_;
+  Index const inner_size_;
+};
+
+}  // namespace internal
+}  // namespace softmax
+}  // namespace sycldnn
+#endif  // SYCLDNN_SRC_SOFTMAX_KERNELS_H_
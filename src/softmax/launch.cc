@@ -0,0 +1,350 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "sycldnn/internal/softmax/launch.h"
+
+#include "sycldnn/mem_object.h"
+#include "sycldnn/status.h"
+
+#include "sycldnn/softmax/direction.h"
+#include "sycldnn/softmax/params.h"
+
+#include "sycldnn/helpers/ratio.h"
+
+#include "src/softmax/kernels.h"
+
+#include <CL/sycl.hpp>
+
+#include <stddef.h>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+#include "sycldnn/export.h"
+
+namespace sycldnn {
+namespace softmax {
+namespace internal {
+namespace {
+
+// The work-group size used to compute the softmax of long contiguous rows.
+constexpr int row_work_group_size = 256;
+// Contiguous rows of at least this length use a work-group per row.
+constexpr int min_work_group_row_size = 4 * row_work_group_size;
+// Long strided rows use a work-group per row when there are fewer than this
+// many rows, as the strided kernel would not have enough work-items to fill
+// the device.
+constexpr int min_strided_rows = 2048;
+
+/** Whether the direction computes the log-softmax, or its gradient. */
+template <typename Direction>
+struct IsLog : std::false_type {};
+
+template <>
+struct IsLog<LogForward> : std::true_type {};
+
+template <>
+struct IsLog<LogGradient> : std::true_type {};
+
+/**
+ * The softmax is computed along the middle dimension of a tensor viewed as
+ * [outer, row_size, inner]. NHWC tensors have an inner size of one, while
+ * N-D tensors flatten the dimensions either side of the softmax axis.
+ */
+template <typename Index>
+struct SoftmaxShape {
+  Index outer;
+  Index row_size;
+  Index inner;
+};
+
+template <typename Index>
+SoftmaxShape<Index> get_shape(SoftmaxParams const& params) {
+  if (!params.dims.empty()) {
+    int const n_dims = static_cast<int>(params.dims.size());
+    int const axis = params.axis < 0 ? params.axis + n_dims : params.axis;
+    SoftmaxShape<Index> shape{1, params.dims[axis], 1};
+    for (int i = 0; i < axis; ++i) {
+      shape.outer *= params.dims[i];
+    }
+    for (int i = axis + 1; i < n_dims; ++i) {
+      shape.inner *= params.dims[i];
+    }
+    return shape;
+  }
+  Index const spatial = static_cast<Index>(params.rows) * params.cols;
+  if (params.input_format == DataFormat::NCHW) {
+    return {params.batch, params.channels, spatial};
+  }
+  return {params.batch * spatial, params.channels, 1};
+}
+
+/** Get the nd_range to launch a work-group for each row. */
+template <typename Index>
+cl::sycl::nd_range<1> get_work_group_range(SoftmaxShape<Index> const& shape) {
+  size_t const n_threads = static_cast<size_t>(shape.outer) * shape.inner *
+                           row_work_group_size;
+  return {cl::sycl::range<1>{n_threads},
+          cl::sycl::range<1>{row_work_group_size}};
+}
+
+/**
+ * Enqueue the forward softmax or log-softmax kernels for each row layout.
+ */
+template <typename T, typename Index, bool Log>
+struct ForwardLauncher {
+  BaseMemObject<T const>& input_mem;
+  BaseMemObject<T>& output_mem;
+  cl::sycl::queue& queue;
+
+  template <int VectorWidth>
+  SNNStatus contiguous(SoftmaxShape<Index> const& shape) {
+    auto event = queue.submit([&](cl::sycl::handler& cgh) {
+      auto input = input_mem.read_accessor(cgh);
+      auto output = output_mem.write_accessor(cgh);
+      size_t const n_threads =
+          helpers::round_up_to_nearest_multiple(shape.outer, 64);
+      ContiguousSoftmaxKernel<T, Index, VectorWidth, Log> functor{
+          input, output, shape.outer, shape.row_size};
+      cgh.parallel_for(cl::sycl::range<1>{n_threads}, functor);
+    });
+    return {event, StatusCode::OK};
+  }
+
+  SNNStatus work_group(SoftmaxShape<Index> const& shape) {
+    using Kernel = WorkGroupSoftmaxKernel<T, Index, row_work_group_size, Log>;
+    auto event = queue.submit([&](cl::sycl::handler& cgh) {
+      auto input = input_mem.read_accessor(cgh);
+      auto output = output_mem.write_accessor(cgh);
+      LocalAccessor<T> workspace{cl::sycl::range<1>{Kernel::LocalSize}, cgh};
+      Kernel functor{input, output, workspace, shape.row_size, shape.inner};
+      cgh.parallel_for(get_work_group_range(shape), functor);
+    });
+    return {event, StatusCode::OK};
+  }
+
+  template <int VectorWidth>
+  SNNStatus strided(SoftmaxShape<Index> const& shape) {
+    auto event = queue.submit([&](cl::sycl::handler& cgh) {
+      auto input = input_mem.read_accessor(cgh);
+      auto output = output_mem.write_accessor(cgh);
+      Index const n_vecs = shape.outer * (shape.inner / VectorWidth);
+      size_t const n_threads =
+          helpers::round_up_to_nearest_multiple(n_vecs, 64);
+      StridedSoftmaxKernel<T, Index, VectorWidth, Log> functor{
+          input, output, n_vecs, shape.row_size, shape.inner};
+      cgh.parallel_for(cl::sycl::range<1>{n_threads}, functor);
+    });
+    return {event, StatusCode::OK};
+  }
+};
+
+/**
+ * Enqueue the softmax or log-softmax gradient kernels for each row layout.
+ */
+template <typename T, typename Index, bool Log>
+struct GradientLauncher {
+  BaseMemObject<T const>& input_mem;
+  BaseMemObject<T const>& gradient_mem;
+  BaseMemObject<T>& output_mem;
+  cl::sycl::queue& queue;
+
+  template <int VectorWidth>
+  SNNStatus contiguous(SoftmaxShape<Index> const& shape) {
+    auto event = queue.submit([&](cl::sycl::handler& cgh) {
+      auto input = input_mem.read_accessor(cgh);
+      auto gradient = gradient_mem.read_accessor(cgh);
+      auto output = output_mem.write_accessor(cgh);
+      size_t const n_threads =
+          helpers::round_up_to_nearest_multiple(shape.outer, 64);
+      ContiguousSoftmaxGradientKernel<T, Index, VectorWidth, Log> functor{
+          input, gradient, output, shape.outer, shape.row_size};
+      cgh.parallel_for(cl::sycl::range<1>{n_threads}, functor);
+    });
+    return {event, StatusCode::OK};
+  }
+
+  SNNStatus work_group(SoftmaxShape<Index> const& shape) {
+    using Kernel =
+        WorkGroupSoftmaxGradientKernel<T, Index, row_work_group_size, Log>;
+    auto event = queue.submit([&](cl::sycl::handler& cgh) {
+      auto input = input_mem.read_accessor(cgh);
+      auto gradient = gradient_mem.read_accessor(cgh);
+      auto output = output_mem.write_accessor(cgh);
+      LocalAccessor<T> workspace{cl::sycl::range<1>{Kernel::LocalSize}, cgh};
+      Kernel functor{input,    gradient,       output,
+                     workspace, shape.row_size, shape.inner};
+      cgh.parallel_for(get_work_group_range(shape), functor);
+    });
+    return {event, StatusCode::OK};
+  }
+
+  template <int VectorWidth>
+  SNNStatus strided(SoftmaxShape<Index> const& shape) {
+    auto event = queue.submit([&](cl::sycl::handler& cgh) {
+      auto input = input_mem.read_accessor(cgh);
+      auto gradient = gradient_mem.read_accessor(cgh);
+      auto output = output_mem.write_accessor(cgh);
+      Index const n_vecs = shape.outer * (shape.inner / VectorWidth);
+      size_t const n_threads =
+          helpers::round_up_to_nearest_multiple(n_vecs, 64);
+      StridedSoftmaxGradientKernel<T, Index, VectorWidth, Log> functor{
+          input, gradient, output, n_vecs, shape.row_size, shape.inner};
+      cgh.parallel_for(cl::sycl::range<1>{n_threads}, functor);
+    });
+    return {event, StatusCode::OK};
+  }
+};
+
+bool can_use_work_group_kernel(cl::sycl::device const& device) {
+  if (device.get_info<cl::sycl::info::device::local_mem_type>() ==
+      cl::sycl::info::local_mem_type::none) {
+    return false;
+  }
+  return device.get_info<cl::sycl::info::device::max_work_group_size>() >=
+         static_cast<size_t>(row_work_group_size);
+}
+
+/**
+ * Select the kernel for the tensor's row layout and enqueue it with the given
+ * launcher.
+ */
+template <typename Index, typename Launcher>
+SNNStatus dispatch(Launcher launcher, SoftmaxShape<Index> const& shape,
+                   cl::sycl::queue& queue) {
+  bool const use_work_group =
+      shape.row_size >= min_work_group_row_size &&
+      (shape.inner == 1 || shape.outer * shape.inner < min_strided_rows) &&
+      can_use_work_group_kernel(queue.get_device());
+  if (use_work_group) {
+    return launcher.work_group(shape);
+  }
+  if (shape.inner == 1) {
+    if (shape.row_size % 4 == 0) {
+      return launcher.template contiguous<4>(shape);
+    } else if (shape.row_size % 2 == 0) {
+      return launcher.template contiguous<2>(shape);
+    } else {
+      return launcher.template contiguous<1>(shape);
+    }
+  }
+  if (shape.inner % 4 == 0) {
+    return launcher.template strided<4>(shape);
+  } else if (shape.inner % 2 == 0) {
+    return launcher.template strided<2>(shape);
+  } else {
+    return launcher.template strided<1>(shape);
+  }
+}
+
+template <typename T, typename Direction, typename Index>
+SNNStatus launch_forward_with_index(BaseMemObject<T const>& input,
+                                    BaseMemObject<T>& output,
+                                    SoftmaxParams const& params,
+                                    cl::sycl::queue& queue) {
+  using Launcher = ForwardLauncher<T, Index, IsLog<Direction>::value>;
+  return dispatch(Launcher{input, output, queue}, get_shape<Index>(params),
+                  queue);
+}
+
+template <typename T, typename Direction, typename Index>
+SNNStatus launch_gradient_with_index(BaseMemObject<T const>& input,
+                                     BaseMemObject<T const>& gradient,
+                                     BaseMemObject<T>& output,
+                                     SoftmaxParams const& params,
+                                     cl::sycl::queue& queue) {
+  using Launcher = GradientLauncher<T, Index, IsLog<Direction>::value>;
+  return dispatch(Launcher{input, gradient, output, queue},
+                  get_shape<Index>(params), queue);
+}
+
+bool exceeds_int32(SoftmaxParams const& params) {
+  auto const shape = get_shape<int64_t>(params);
+  size_t const n_items = static_cast<size_t>(shape.outer) * shape.row_size *
+                         shape.inner;
+  return n_items > static_cast<size_t>(std::numeric_limits<int32_t>::max());
+}
+}  // namespace
+
+template <typename T, typename Direction>
+SNNStatus launch_forward(BaseMemObject<T const>& input,
+                         BaseMemObject<T>& output, SoftmaxParams const& params,
+                         cl::sycl::queue& queue) {
+  if (exceeds_int32(params)) {
+#ifdef SNN_USE_INT64
+    return launch_forward_with_index<T, Direction, int64_t>(input, output,
+                                                           params, queue);
+#else
+    return StatusCode::IndexExceeded;
+#endif  // SNN_USE_INT64
+  } else {
+    return launch_forward_with_index<T, Direction, int32_t>(input, output,
+                                                           params, queue);
+  }
+}
+
+template <typename T, typename Direction>
+SNNStatus launch_gradient(BaseMemObject<T const>& input,
+                          BaseMemObject<T const>& gradient,
+                          BaseMemObject<T>& output,
+                          SoftmaxParams const& params,
+                          cl::sycl::queue& queue) {
+  if (exceeds_int32(params)) {
+#ifdef SNN_USE_INT64
+    return launch_gradient_with_index<T, Direction, int64_t>(
+        input, gradient, output, params, queue);
+#else
+    return StatusCode::IndexExceeded;
+#endif  // SNN_USE_INT64
+  } else {
+    return launch_gradient_with_index<T, Direction, int32_t>(
+        input, gradient, output, params, queue);
+  }
+}
+
+#define INSTANTIATE_FORWARD(DTYPE, DIRECTION)                                \
+  template SNN_EXPORT SNNStatus launch_forward<DTYPE, DIRECTION>(            \
+      BaseMemObject<DTYPE const> & input, BaseMemObject<DTYPE> & output,     \
+      SoftmaxParams const& params, cl::sycl::queue& queue)
+
+#define INSTANTIATE_GRADIENT(DTYPE, DIRECTION)                               \
+  template SNN_EXPORT SNNStatus launch_gradient<DTYPE, DIRECTION>(           \
+      BaseMemObject<DTYPE const> & input,                                    \
+      BaseMemObject<DTYPE const> & gradient, BaseMemObject<DTYPE> & output,  \
+      SoftmaxParams const& params, cl::sycl::queue& queue)
+
+#define INSTANTIATE_LAUNCHERS(DTYPE)      \
+  INSTANTIATE_FORWARD(DTYPE, Forward);    \
+  INSTANTIATE_FORWARD(DTYPE, LogForward); \
+  INSTANTIATE_GRADIENT(DTYPE, Gradient);  \
+  INSTANTIATE_GRADIENT(DTYPE, LogGradient)
+
+INSTANTIATE_LAUNCHERS(float);
+
+#ifdef SNN_USE_DOUBLE
+INSTANTIATE_LAUNCHERS(double);
+#endif  // SNN_USE_DOUBLE
+
+#ifdef SNN_USE_HALF
+INSTANTIATE_LAUNCHERS(cl::sycl::half);
+#endif  // SNN_USE_HALF
+
+#undef INSTANTIATE_LAUNCHERS
+#undef INSTANTIATE_GRADIENT
+#undef INSTANTIATE_FORWARD
+
+}  // namespace internal
+}  // namespace softmax
+}  // namespace sycldnn
@@ -19,7 +19,9 @@
 #include "sycldnn/accessor_types.h"
 #include "sycldnn/status.h"
 
+#include "src/helpers/vector_element.h"
 #include "src/helpers/vector_io.h"
+#include "src/helpers/vector_type.h"
 
 #include <algorithm>
 #include <numeric>
@@ -87,6 +89,91 @@ struct TransposeKernel {
   std::array<int, ND> permutation_;
 };
 
+/**
+ * Transpose the last two dimensions of a [batch, rows, cols] tensor, giving a
+ * [batch, cols, rows] tensor.
+ *
+ * Each work-group transposes a TileSize x TileSize tile, staging it in local
+ * memory so that both the loads from the input and the stores to the output
+ * are contiguous. Each work-item loads and stores vectors of VectorWidth
+ * elements, so both rows and cols must be multiples of VectorWidth. The tile in
+ * local memory is padded by one element per row to avoid bank conflicts when
+ * reading it transposed.
+ *
+ * Expects a 3D range of [batch, TileRows * n_row_tiles, TileSize / VectorWidth
+ * * n_col_tiles] with work-groups of [1, TileRows, TileSize / VectorWidth].
+ */
+template <typename T, typename Index, int VectorWidth>
+struct TiledTransposeKernel {
+  /** The number of rows and columns in each tile. */
+  static constexpr int TileSize = 32;
+  /** The number of work-items in the row dimension of each work-group. */
+  static constexpr int TileRows = 8;
+  /** The number of work-items in the column dimension of each work-group. */
+  static constexpr int TileCols = TileSize / VectorWidth;
+  /** The number of elements required in local memory. */
+  static constexpr int LocalSize = TileSize * (TileSize + 1);
+
+  using VecType = typename helpers::VectorType<T, VectorWidth>::type;
+  using Load = helpers::io::Load<VecType>;
+  using Store = helpers::io::Store<VecType>;
+
+  TiledTransposeKernel(ReadAccessor<T const> const& input,
+                       WriteAccessor<T> const& output,
+                       LocalAccessor<T> const& tile, Index rows, Index cols)
+      : input_{input}, output_{output}, tile_{tile}, rows_{rows}, cols_{cols} {}
+
+  void SNN_ALWAYS_INLINE operator()(cl::sycl::nd_item<3> item) const {
+    Index const batch = item.get_global_id(0);
+    int const local_row = item.get_local_id(1);
+    int const local_col = item.get_local_id(2) * VectorWidth;
+    Index const tile_row = item.get_group(1) * TileSize;
+    Index const tile_col = item.get_group(2) * TileSize;
+
+    auto in_ptr = input_.get_pointer() + batch * rows_ * cols_;
+    auto out_ptr = output_.get_pointer() + batch * rows_ * cols_;
+    auto tile = tile_.get_pointer();
+
+    Index const in_col = tile_col + local_col;
+    if (in_col < cols_) {
+      for (int row = local_row; row < TileSize; row += TileRows) {
+        Index const in_row = tile_row + row;
+        if (in_row < rows_) {
+          VecType value = Load()(in_ptr, in_row * cols_ + in_col);
+          for (int i = 0; i < VectorWidth; ++i) {
+            tile[row * (TileSize + 1) + local_col + i] =
+                helpers::vector_element::get(value, i);
+          }
+        }
+      }
+    }
+
+    item.barrier(cl::sycl::access::fence_space::local_space);
+
+    Index const out_col = tile_row + local_col;
+    if (out_col < rows_) {
+      for (int row = local_row; row < TileSize; row += TileRows) {
+        Index const out_row = tile_col + row;
+        if (out_row < cols_) {
+          VecType value;
+          for (int i = 0; i < VectorWidth; ++i) {
+            helpers::vector_element::set(
+                value, i, tile[(local_col + i) * (TileSize + 1) + row]);
+          }
+          Store()(out_ptr, out_row * rows_ + out_col, value);
+        }
+      }
+    }
+  }
+
+ private:
+  ReadAccessor<T const> input_;
+  WriteAccessor<T> output_;
+  LocalAccessor<T> tile_;
+  Index const rows_;
+  Index const cols_;
+};
+
 }  // namespace internal
 }  // namespace transpose
 }  // namespace sycldnn
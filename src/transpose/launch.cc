@@ -19,6 +19,7 @@
 
 #include "src/transpose/queue_kernel.h"
 
+#include <algorithm>
 #include <iterator>
 #include <vector>
 
@@ -60,6 +61,18 @@ struct Transposer<T, Index, 1> {
   }
 };
 
+void remove_dimension(int dimension, std::vector<int>& dimensions,
+                      std::vector<int>& permutation) {
+  dimensions.erase(begin(dimensions) + dimension);
+  permutation.erase(
+      std::find(begin(permutation), end(permutation), dimension));
+  for (int& perm : permutation) {
+    if (perm > dimension) {
+      perm -= 1;
+    }
+  }
+}
+
 void merge_consecutive_indices(int index, std::vector<int>& dimensions,
                                std::vector<int>& permutation) {
   int permuted_index = permutation[index];
@@ -82,8 +95,16 @@ void merge_consecutive_indices(int index, std::vector<int>& dimensions,
 // e.g. The two following transposes are equivalent:
 // dim: [a, b, c, d]  perm: [3, 1, 2, 0]
 // dim: [a, b * c, d] perm: [2, 1, 0]
+//
+// Dimensions of size one do not affect the layout, so are removed first.
 void simplify_transpose(std::vector<int>& dimensions,
                         std::vector<int>& permutation) {
+  for (int idx = dimensions.size() - 1; idx >= 0 && dimensions.size() > 1;
+       --idx) {
+    if (dimensions[idx] == 1) {
+      remove_dimension(idx, dimensions, permutation);
+    }
+  }
   bool changed = false;
   do {
     changed = false;
@@ -100,6 +121,46 @@ void simplify_transpose(std::vector<int>& dimensions,
   } while (changed);
 }
 
+/** The work-group size required by the tiled transpose kernel. */
+constexpr size_t tiled_work_group_size = 256;
+/**
+ * The smallest number of rows and columns to use the tiled transpose kernel.
+ * Narrower transposes leave most of each tile empty.
+ */
+constexpr int min_tiled_size = 16;
+
+bool can_use_tiled_kernel(cl::sycl::device const& device) {
+  if (device.get_info<cl::sycl::info::device::local_mem_type>() ==
+      cl::sycl::info::local_mem_type::none) {
+    return false;
+  }
+  return device.get_info<cl::sycl::info::device::max_work_group_size>() >=
+         tiled_work_group_size;
+}
+
+// After simplifying, any transpose which swaps two blocks of dimensions, such
+// as NHWC <-> NCHW, is a transpose of the last two dimensions of a 2D or 3D
+// tensor.
+bool is_batched_2d_transpose(std::vector<int> const& permutation) {
+  return permutation == std::vector<int>{1, 0} ||
+         permutation == std::vector<int>{0, 2, 1};
+}
+
+template <typename T>
+SNNStatus launch_tiled(BaseMemObject<T const>& input, BaseMemObject<T>& output,
+                       int batch, int rows, int cols, cl::sycl::queue& queue) {
+  if (rows % 4 == 0 && cols % 4 == 0) {
+    return queue_tiled_kernel<T, int, 4>(input, output, batch, rows, cols,
+                                         queue);
+  } else if (rows % 2 == 0 && cols % 2 == 0) {
+    return queue_tiled_kernel<T, int, 2>(input, output, batch, rows, cols,
+                                         queue);
+  } else {
+    return queue_tiled_kernel<T, int, 1>(input, output, batch, rows, cols,
+                                         queue);
+  }
+}
+
 }  // namespace
 
 template <typename T>
@@ -107,6 +168,15 @@ SNNStatus launch_impl(BaseMemObject<T const>& input, BaseMemObject<T>& output,
                       std::vector<int> dimensions, std::vector<int> permutation,
                       cl::sycl::queue& queue) {
   simplify_transpose(dimensions, permutation);
+  if (is_batched_2d_transpose(permutation)) {
+    int const batch = dimensions.size() == 3 ? dimensions[0] : 1;
+    int const rows = dimensions[dimensions.size() - 2];
+    int const cols = dimensions[dimensions.size() - 1];
+    if (rows >= min_tiled_size && cols >= min_tiled_size &&
+        can_use_tiled_kernel(queue.get_device())) {
+      return launch_tiled(input, output, batch, rows, cols, queue);
+    }
+  }
   switch (dimensions.size()) {
     case 6:
       return Transposer<T, int, 6>::transpose(input, output, dimensions,
@@ -29,6 +29,15 @@ SNNStatus queue_kernel(BaseMemObject<T const>& input, BaseMemObject<T>& output,
                        std::vector<int> const& permutation,
                        cl::sycl::queue& queue);
 
+/**
+ * Queue a tiled transpose of the last two dimensions of a [batch, rows, cols]
+ * tensor. Both rows and cols must be multiples of VectorWidth.
+ */
+template <typename T, typename Index, int VectorWidth>
+SNNStatus queue_tiled_kernel(BaseMemObject<T const>& input,
+                             BaseMemObject<T>& output, int batch, int rows,
+                             int cols, cl::sycl::queue& queue);
+
 }  // namespace internal
 }  // namespace transpose
 }  // namespace sycldnn
@@ -50,6 +50,33 @@ SNNStatus queue_kernel(BaseMemObject<T const>& input_mem,
   return {event, StatusCode::OK};
 }
 
+template <typename T, typename Index, int VectorWidth>
+SNNStatus queue_tiled_kernel(BaseMemObject<T const>& input_mem,
+                             BaseMemObject<T>& output_mem, int batch, int rows,
+                             int cols, cl::sycl::queue& queue) {
+  using Functor = TiledTransposeKernel<T, Index, VectorWidth>;
+  auto event = queue.submit([&](cl::sycl::handler& cgh) {
+    auto input = input_mem.read_accessor(cgh);
+    auto output = output_mem.write_accessor(cgh);
+    LocalAccessor<T> tile{cl::sycl::range<1>{Functor::LocalSize}, cgh};
+
+    size_t const n_row_tiles =
+        helpers::round_ratio_up_above_zero(rows, Functor::TileSize);
+    size_t const n_col_tiles =
+        helpers::round_ratio_up_above_zero(cols, Functor::TileSize);
+    cl::sycl::range<3> local_range{1, Functor::TileRows, Functor::TileCols};
+    cl::sycl::range<3> global_range{static_cast<size_t>(batch),
+                                    n_row_tiles * Functor::TileRows,
+                                    n_col_tiles * Functor::TileCols};
+
+    Functor functor{input, output, tile, rows, cols};
+
+    cgh.parallel_for(cl::sycl::nd_range<3>{global_range, local_range},
+                     functor);
+  });
+  return {event, StatusCode::OK};
+}
+
 }  // namespace internal
 }  // namespace transpose
 }  // namespace sycldnn
@@ -0,0 +1,224 @@
+/*
+ * Copyright Codeplay Software Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use these files except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <gtest/gtest.h>
+
+#include "sycldnn/data_format.h"
+#include "sycldnn/status.h"
+
+#include "sycldnn/backend/snn_backend.h"
+
+#include "sycldnn/batchnorm/direction.h"
+#include "sycldnn/batchnorm/launch.h"
+#include "sycldnn/batchnorm/params.h"
+
+#include "sycldnn/helpers/scope_exit.h"
+
+#include "sycldnn/transpose/launch.h"
+
+#include "test/backend/backend_test_fixture.h"
+#include "test/gen/iota_initialised_data.h"
+#include "test/helpers/float_comparison.h"
+
+#include "test/types/kernel_data_types.h"
+
+#include <stddef.h>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <CL/sycl.hpp>
+
+namespace {
+
+using sycldnn::batchnorm::BatchNormParams;
+
+BatchNormParams get_params(int channels, bool is_training) {
+  BatchNormParams params;
+  params.batch = 2;
+  params.rows = 5;
+  params.cols = 3;
+  params.channels = channels;
+  params.is_training = is_training;
+  params.momentum = 0.99f;
+  params.epsilon = 0.001f;
+  params.input_format = sycldnn::DataFormat::NHWC;
+  return params;
+}
+
+}  // namespace
+
+template <typename DataType>
+struct BlockedBatchNorm
+    : public BackendTestFixture<sycldnn::backend::SNNBackend> {
+  using Backend = sycldnn::backend::SNNBackend;
+  using ConstPointer = Backend::pointer_type<DataType const>;
+  using Pointer = Backend::pointer_type<DataType>;
+
+ protected:
+  /** Convert a tensor on the device between NHWC and the given format. */
+  void convert(ConstPointer input, Pointer output,
+               BatchNormParams const& params, sycldnn::DataFormat from,
+               sycldnn::DataFormat to) {
+    auto& backend = this->provider_.get_backend();
+    std::vector<int> dims = {params.batch, params.rows, params.cols,
+                             params.channels};
+    auto status = sycldnn::transpose::convert_layout<DataType>(
+        input, output, dims, from, to, backend);
+    ASSERT_EQ(sycldnn::StatusCode::OK, status.status);
+    status.event.wait_and_throw();
+  }
+
+  /**
+   * Check that a batchnorm on channel blocked tensors gives the same output
+   * and the same per-channel results as the batchnorm on NHWC tensors.
+   */
+  template <typename Direction>
+  void test_blocked(BatchNormParams params, sycldnn::DataFormat format) {
+    size_t const n_items =
+        params.batch * params.rows * params.cols * params.channels;
+    size_t const n_channels = params.channels;
+    DataType const max_val = static_cast<DataType>(8);
+
+    std::vector<DataType> input = iota_initialised_data(n_items, max_val);
+    std::vector<DataType> beta_or_grad =
+        sycldnn::batchnorm::internal::IsGradient<Direction>
+            ? iota_initialised_data(n_items, static_cast<DataType>(5))
+            : iota_initialised_data(n_channels, static_cast<DataType>(3));
+    std::vector<DataType> gamma = iota_initialised_data(n_channels, max_val);
+    std::vector<DataType> mean =
+        iota_initialised_data(n_channels, static_cast<DataType>(4));
+    std::vector<DataType> variance =
+        iota_initialised_data(n_channels, static_cast<DataType>(6));
+    std::vector<DataType> zeros(n_items, static_cast<DataType>(0));
+    size_t const beta_or_grad_size = beta_or_grad.size();
+
+    auto& provider = this->provider_;
+    auto& backend = provider.get_backend();
+
+    auto inp_gpu = provider.get_initialised_device_memory(n_items, input);
+    auto beta_gpu =
+        provider.get_initialised_device_memory(beta_or_grad_size, beta_or_grad);
+    auto gamma_gpu = provider.get_initialised_device_memory(n_channels, gamma);
+    auto mean_gpu = provider.get_initialised_device_memory(n_channels, mean);
+    auto var_gpu = provider.get_initialised_device_memory(n_channels, variance);
+    auto exp_mean_gpu =
+        provider.get_initialised_device_memory(n_channels, mean);
+    auto exp_var_gpu =
+        provider.get_initialised_device_memory(n_channels, variance);
+    auto exp_out_gpu = provider.get_initialised_device_memory(n_items, zeros);
+    auto blocked_inp_gpu =
+        provider.get_initialised_device_memory(n_items, zeros);
+    auto blocked_beta_gpu =
+        provider.get_initialised_device_memory(beta_or_grad_size, beta_or_grad);
+    auto blocked_mean_gpu =
+        provider.get_initialised_device_memory(n_channels, mean);
+    auto blocked_var_gpu =
+        provider.get_initialised_device_memory(n_channels, variance);
+    auto blocked_out_gpu =
+        provider.get_initialised_device_memory(n_items, zeros);
+    auto out_gpu = provider.get_initialised_device_memory(n_items, zeros);
+    SNN_ON_SCOPE_EXIT {
+      provider.deallocate_ptr(inp_gpu);
+      provider.deallocate_ptr(beta_gpu);
+      provider.deallocate_ptr(gamma_gpu);
+      provider.deallocate_ptr(mean_gpu);
+      provider.deallocate_ptr(var_gpu);
+      provider.deallocate_ptr(exp_mean_gpu);
+      provider.deallocate_ptr(exp_var_gpu);
+      provider.deallocate_ptr(exp_out_gpu);
+      provider.deallocate_ptr(blocked_inp_gpu);
+      provider.deallocate_ptr(blocked_beta_gpu);
+      provider.deallocate_ptr(blocked_mean_gpu);
+      provider.deallocate_ptr(blocked_var_gpu);
+      provider.deallocate_ptr(blocked_out_gpu);
+      provider.deallocate_ptr(out_gpu);
+    };
+
+    try {
+      auto status = sycldnn::batchnorm::launch<DataType, Backend, Direction>(
+          inp_gpu, beta_gpu, gamma_gpu, mean_gpu, var_gpu, exp_mean_gpu,
+          exp_var_gpu, exp_out_gpu, params, backend);
+      ASSERT_EQ(sycldnn::StatusCode::OK, status.status);
+      status.event.wait_and_throw();
+
+      auto const nhwc = sycldnn::DataFormat::NHWC;
+      convert(inp_gpu, blocked_inp_gpu, params, nhwc, format);
+      if (sycldnn::batchnorm::internal::IsGradient<Direction>) {
+        convert(beta_gpu, blocked_beta_gpu, params, nhwc, format);
+      }
+
+      auto blocked_params = params;
+      blocked_params.input_format = format;
+      status = sycldnn::batchnorm::launch<DataType, Backend, Direction>(
+          blocked_inp_gpu, blocked_beta_gpu, gamma_gpu, mean_gpu, var_gpu,
+          blocked_mean_gpu, blocked_var_gpu, blocked_out_gpu, blocked_params,
+          backend);
+      ASSERT_EQ(sycldnn::StatusCode::OK, status.status);
+      status.event.wait_and_throw();
+
+      convert(blocked_out_gpu, out_gpu, params, format, nhwc);
+    } catch (cl::sycl::exception const& e) {
+      throw std::runtime_error(e.what());
+    }
+
+    std::vector<DataType> expected(n_items);
+    std::vector<DataType> actual(n_items);
+    provider.copy_device_data_to_host(n_items, exp_out_gpu, expected);
+    provider.copy_device_data_to_host(n_items, out_gpu, actual);
+    for (size_t i = 0; i < n_items; ++i) {
+      SCOPED_TRACE("Output element: " + std::to_string(i));
+      SNN_ALMOST_EQUAL_EPS(expected[i], actual[i], 30u, 1e-3);
+    }
+
+    if (!params.is_training &&
+        !sycldnn::batchnorm::internal::IsGradient<Direction>) {
+      return;
+    }
+    std::vector<DataType> exp_channel(n_channels);
+    std::vector<DataType> channel(n_channels);
+    provider.copy_device_data_to_host(n_channels, exp_mean_gpu, exp_channel);
+    provider.copy_device_data_to_host(n_channels, blocked_mean_gpu, channel);
+    for (size_t i = 0; i < n_channels; ++i) {
+      SCOPED_TRACE("Mean or beta grad element: " + std::to_string(i));
+      SNN_ALMOST_EQUAL_EPS(exp_channel[i], channel[i], 30u, 1e-3);
+    }
+    provider.copy_device_data_to_host(n_channels, exp_var_gpu, exp_channel);
+    provider.copy_device_data_to_host(n_channels, blocked_var_gpu, channel);
+    for (size_t i = 0; i < n_channels; ++i) {
+      SCOPED_TRACE("Variance or gamma grad element: " + std::to_string(i));
+      SNN_ALMOST_EQUAL_EPS(exp_channel[i], channel[i], 30u, 1e-3);
+    }
+  }
+};
+
+TYPED_TEST_SUITE(BlockedBatchNorm, sycldnn::types::GTestKernelDataTypes);
+
+TYPED_TEST(BlockedBatchNorm, ForwardTrainingNCHW4) {
+  this->template test_blocked<sycldnn::batchnorm::Forward>(
+      get_params(8, true), sycldnn::DataFormat::NCHW4);
+}
+TYPED_TEST(BlockedBatchNorm, ForwardFrozenNCHW8) {
+  this->template test_blocked<sycldnn::batchnorm::Forward>(
+      get_params(16, false), sycldnn::DataFormat::NCHW8);
+}
+TYPED_TEST(BlockedBatchNorm, GradientTrainingNCHW16) {
+  this->template test_blocked<sycldnn::batchnorm::Gradient>(
+      get_params(32, true), sycldnn::DataFormat::NCHW16);
+}
+TYPED_TEST(BlockedBatchNorm, GradientFrozenNCHW4) {
+  this->template test_blocked<sycldnn::batchnorm::Gradient>(
+      get_params(4, false), sycldnn::DataFormat::NCHW4);
+}
@@ -0,0 +1,187 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <gtest/gtest.h>
+
+#include "sycldnn/data_format.h"
+#include "sycldnn/status.h"
+
+#include "sycldnn/backend/snn_backend.h"
+
+#include "sycldnn/batchnorm/fold.h"
+#include "sycldnn/batchnorm/params.h"
+
+#include "sycldnn/conv2d/params.h"
+
+#include "sycldnn/helpers/scope_exit.h"
+
+#include "test/backend/backend_test_fixture.h"
+#include "test/gen/iota_initialised_data.h"
+#include "test/helpers/float_comparison.h"
+
+#include "test/types/kernel_data_types.h"
+#include "test/types/to_gtest_types.h"
+
+#include <stddef.h>
+#include <cmath>
+#include <string>
+#include <vector>
+
+namespace {
+
+sycldnn::conv2d::Conv2DParams get_conv_params(int window, int channels,
+                                              int features, int groups,
+                                              sycldnn::FilterFormat format) {
+  sycldnn::conv2d::Conv2DParams params;
+  params.channels = channels;
+  params.features = features;
+  params.batch = 1;
+  params.in_rows = 8;
+  params.in_cols = 8;
+  params.window_rows = window;
+  params.window_cols = window;
+  params.stride_rows = 1;
+  params.stride_cols = 1;
+  params.out_rows = 8;
+  params.out_cols = 8;
+  params.pad_rows = window / 2;
+  params.pad_cols = window / 2;
+  params.groups = groups;
+  params.filter_format = format;
+  return params;
+}
+
+sycldnn::batchnorm::BatchNormParams get_batchnorm_params(
+    sycldnn::conv2d::Conv2DParams const& conv_params) {
+  sycldnn::batchnorm::BatchNormParams params;
+  params.batch = conv_params.batch;
+  params.rows = conv_params.out_rows;
+  params.cols = conv_params.out_cols;
+  params.channels = conv_params.features;
+  params.is_training = false;
+  params.epsilon = 0.001f;
+  return params;
+}
+
+}  // namespace
+
+template <typename T>
+struct BatchNormFold : public BackendTestFixture<sycldnn::backend::SNNBackend> {
+  using DataType = T;
+
+ protected:
+  /**
+   * Fold a frozen batchnorm into a convolution filter and bias, and compare
+   * the rewritten tensors against a host reference.
+   */
+  void test_fold(sycldnn::conv2d::Conv2DParams const& conv_params) {
+    auto params = get_batchnorm_params(conv_params);
+    size_t const features = conv_params.features;
+    size_t const filter_per_feature = conv_params.window_rows *
+                                      conv_params.window_cols *
+                                      conv_params.channels / conv_params.groups;
+    size_t const filter_size = filter_per_feature * features;
+    bool const is_fchw =
+        conv_params.filter_format == sycldnn::FilterFormat::FCHW;
+
+    std::vector<DataType> filter =
+        iota_initialised_data(filter_size, static_cast<DataType>(4));
+    std::vector<DataType> bias =
+        iota_initialised_data(features, static_cast<DataType>(1));
+    std::vector<DataType> beta =
+        iota_initialised_data(features, static_cast<DataType>(3));
+    std::vector<DataType> gamma =
+        iota_initialised_data(features, static_cast<DataType>(2));
+    std::vector<DataType> mean =
+        iota_initialised_data(features, static_cast<DataType>(2));
+    std::vector<DataType> variance =
+        iota_initialised_data(features, static_cast<DataType>(3));
+    for (auto& value : variance) {
+      value += DataType{1};
+    }
+
+    std::vector<double> scale(features);
+    for (size_t f = 0; f < features; ++f) {
+      scale[f] = static_cast<double>(gamma[f]) /
+                 std::sqrt(static_cast<double>(variance[f]) + params.epsilon);
+    }
+    std::vector<DataType> exp_filter(filter_size);
+    for (size_t i = 0; i < filter_size; ++i) {
+      size_t const f = is_fchw ? i / filter_per_feature : i % features;
+      exp_filter[i] =
+          static_cast<DataType>(static_cast<double>(filter[i]) * scale[f]);
+    }
+    std::vector<DataType> exp_bias(features);
+    for (size_t f = 0; f < features; ++f) {
+      exp_bias[f] = static_cast<DataType>(
+          (static_cast<double>(bias[f]) - static_cast<double>(mean[f])) *
+              scale[f] +
+          static_cast<double>(beta[f]));
+    }
+
+    auto& provider = this->provider_;
+    auto& backend = provider.get_backend();
+    auto filter_gpu =
+        provider.get_initialised_device_memory(filter_size, filter);
+    auto bias_gpu = provider.get_initialised_device_memory(features, bias);
+    auto beta_gpu = provider.get_initialised_device_memory(features, beta);
+    auto gamma_gpu = provider.get_initialised_device_memory(features, gamma);
+    auto mean_gpu = provider.get_initialised_device_memory(features, mean);
+    auto variance_gpu =
+        provider.get_initialised_device_memory(features, variance);
+    SNN_ON_SCOPE_EXIT {
+      provider.deallocate_ptr(filter_gpu);
+      provider.deallocate_ptr(bias_gpu);
+      provider.deallocate_ptr(beta_gpu);
+      provider.deallocate_ptr(gamma_gpu);
+      provider.deallocate_ptr(mean_gpu);
+      provider.deallocate_ptr(variance_gpu);
+    };
+
+    auto status = sycldnn::batchnorm::fold_into_conv2d<DataType>(
+        filter_gpu, bias_gpu, beta_gpu, gamma_gpu, mean_gpu, variance_gpu,
+        conv_params, params, backend);
+    ASSERT_EQ(sycldnn::StatusCode::OK, status.status);
+    status.event.wait_and_throw();
+
+    provider.copy_device_data_to_host(filter_size, filter_gpu, filter);
+    for (size_t i = 0; i < filter_size; ++i) {
+      SCOPED_TRACE("Filter element: " + std::to_string(i));
+      SNN_ALMOST_EQUAL(exp_filter[i], filter[i], 10u);
+    }
+    provider.copy_device_data_to_host(features, bias_gpu, bias);
+    for (size_t f = 0; f < features; ++f) {
+      SCOPED_TRACE("Bias element: " + std::to_string(f));
+      SNN_ALMOST_EQUAL(exp_bias[f], bias[f], 10u);
+    }
+  }
+};
+
+using DataTypeList = sycldnn::types::KernelDataTypes;
+using GTestTypeList = sycldnn::types::ToGTestTypes<DataTypeList>::type;
+TYPED_TEST_SUITE(BatchNormFold, GTestTypeList);
+
+TYPED_TEST(BatchNormFold, Window1HWCF) {
+  this->test_fold(get_conv_params(1, 16, 8, 1, sycldnn::FilterFormat::HWCF));
+}
+TYPED_TEST(BatchNormFold, Window3HWCF) {
+  this->test_fold(get_conv_params(3, 5, 7, 1, sycldnn::FilterFormat::HWCF));
+}
+TYPED_TEST(BatchNormFold, Window3FCHW) {
+  this->test_fold(get_conv_params(3, 6, 4, 1, sycldnn::FilterFormat::FCHW));
+}
+TYPED_TEST(BatchNormFold, Window3Groups2HWCF) {
+  this->test_fold(get_conv_params(3, 8, 6, 2, sycldnn::FilterFormat::HWCF));
+}
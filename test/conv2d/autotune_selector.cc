@@ -0,0 +1,151 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <gtest/gtest.h>
+
+#include "sycldnn/conv2d/launch.h"
+#include "sycldnn/conv2d/selector/algorithm_cache.h"
+#include "sycldnn/conv2d/selector/autotune_selector.h"
+#include "sycldnn/conv2d/selector/default_selector.h"
+#include "sycldnn/conv2d/sizes.h"
+
+#include "sycldnn/helpers/scope_exit.h"
+
+#include "src/backend/snn_backend_provider.h"
+#include "sycldnn/backend/snn_backend.h"
+
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <CL/sycl.hpp>
+
+namespace {
+sycldnn::conv2d::Conv2DParams get_3x3_params() {
+  sycldnn::conv2d::Conv2DParams params;
+  params.channels = 16;
+  params.features = 16;
+  params.batch = 1;
+  params.in_rows = 16;
+  params.in_cols = 16;
+  params.window_rows = 3;
+  params.window_cols = 3;
+  params.stride_rows = 1;
+  params.stride_cols = 1;
+  params.out_rows = 16;
+  params.out_cols = 16;
+  params.pad_rows = 1;
+  params.pad_cols = 1;
+  params.dilation_rows = 1;
+  params.dilation_cols = 1;
+  return params;
+}
+
+/** Temporary cache file which is removed at the end of each test. */
+struct TempCacheFile {
+  explicit TempCacheFile(std::string name) : filename{std::move(name)} {
+    std::remove(filename.c_str());
+  }
+  ~TempCacheFile() { std::remove(filename.c_str()); }
+  std::string filename;
+};
+}  // namespace
+
+TEST(AlgorithmCacheTest, AlgorithmNamesRoundTrip) {
+  using sycldnn::conv2d::Algorithm;
+  for (auto algo : {Algorithm::Direct, Algorithm::Tiled, Algorithm::Im2col,
+                    Algorithm::Winograd, Algorithm::WinogradLarge,
+                    Algorithm::Matmul}) {
+    EXPECT_EQ(algo, sycldnn::conv2d::algorithm_from_string(
+                        sycldnn::conv2d::to_string(algo)));
+  }
+  EXPECT_EQ(Algorithm::NotSupported,
+            sycldnn::conv2d::algorithm_from_string("NotAnAlgorithm"));
+}
+
+TEST(AlgorithmCacheTest, KeysDependOnAllInputs) {
+  using sycldnn::conv2d::make_algorithm_cache_key;
+  auto params = get_3x3_params();
+  auto key = make_algorithm_cache_key("dev", "float", "Forward", params);
+  EXPECT_NE(key, make_algorithm_cache_key("dev2", "float", "Forward", params));
+  EXPECT_NE(key, make_algorithm_cache_key("dev", "double", "Forward", params));
+  EXPECT_NE(key,
+            make_algorithm_cache_key("dev", "float", "InputBackprop", params));
+  params.batch = 2;
+  EXPECT_NE(key, make_algorithm_cache_key("dev", "float", "Forward", params));
+}
+
+TEST(AlgorithmCacheTest, EntriesPersistToFile) {
+  using sycldnn::conv2d::Algorithm;
+  TempCacheFile file{"snn_algorithm_cache_test.txt"};
+  auto params = get_3x3_params();
+  auto key = sycldnn::conv2d::make_algorithm_cache_key("dev", "float",
+                                                       "Forward", params);
+  {
+    sycldnn::conv2d::AlgorithmCache cache{file.filename};
+    EXPECT_EQ(Algorithm::NotSupported, cache.lookup(key));
+    EXPECT_TRUE(cache.insert(key, Algorithm::Tiled));
+    EXPECT_EQ(Algorithm::Tiled, cache.lookup(key));
+  }
+  sycldnn::conv2d::AlgorithmCache reloaded{file.filename};
+  EXPECT_EQ(1u, reloaded.size());
+  EXPECT_EQ(Algorithm::Tiled, reloaded.lookup(key));
+}
+
+TEST(AutotuneSelectorTest, SelectsLaunchableAlgorithmAndCachesIt) {
+  using Backend = sycldnn::backend::SNNBackend;
+  using BackendProvider = sycldnn::backend::BackendProvider<Backend>;
+  using ConvType = sycldnn::conv2d::conv_type::Forward;
+  using HostData = std::vector<float>;
+
+  TempCacheFile file{"snn_autotune_selector_test.txt"};
+  BackendProvider provider;
+  auto& backend = provider.get_backend();
+  auto device = backend.get_queue().get_device();
+  auto params = get_3x3_params();
+
+  sycldnn::conv2d::AutotuneSelector<float, Backend> selector{
+      backend, sycldnn::conv2d::get_default_selector(device), file.filename};
+  auto algo = selector.select<ConvType>(params);
+  ASSERT_NE(sycldnn::conv2d::Algorithm::NotSupported, algo);
+  // A second query must be served from the cache.
+  EXPECT_EQ(algo, selector.select<ConvType>(params));
+
+  sycldnn::conv2d::AlgorithmCache cache{file.filename};
+  EXPECT_EQ(1u, cache.size());
+
+  auto sizes = sycldnn::conv2d::get_sizes<ConvType>(params);
+  HostData input(sizes.input_size);
+  HostData filter(sizes.filter_size);
+  HostData output(sizes.output_size);
+  auto input_gpu =
+      provider.get_initialised_device_memory(sizes.input_size, input);
+  auto filter_gpu =
+      provider.get_initialised_device_memory(sizes.filter_size, filter);
+  auto output_gpu =
+      provider.get_initialised_device_memory(sizes.output_size, output);
+  SNN_ON_SCOPE_EXIT {
+    provider.deallocate_ptr(input_gpu);
+    provider.deallocate_ptr(filter_gpu);
+    provider.deallocate_ptr(output_gpu);
+  };
+
+  auto status = sycldnn::conv2d::launch<float, ConvType>(
+      input_gpu, filter_gpu, output_gpu, params, selector, backend);
+  ASSERT_EQ(sycldnn::StatusCode::OK, status.status);
+  status.event.wait_and_throw();
+}
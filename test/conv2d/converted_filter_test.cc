@@ -0,0 +1,205 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <gtest/gtest.h>
+
+#include "sycldnn/data_format.h"
+#include "sycldnn/filter_format.h"
+#include "sycldnn/padding_mode.h"
+#include "sycldnn/status.h"
+
+#include "sycldnn/backend/snn_backend.h"
+
+#include "sycldnn/conv2d/conv_type.h"
+#include "sycldnn/conv2d/launch.h"
+#include "sycldnn/conv2d/params.h"
+#include "sycldnn/conv2d/sizes.h"
+#include "sycldnn/conv2d/workspace_size.h"
+
+#include "sycldnn/conv2d/selector/im2col_selector.h"
+
+#include "sycldnn/helpers/padding.h"
+#include "sycldnn/helpers/scope_exit.h"
+
+#include "test/backend/backend_test_fixture.h"
+#include "test/gen/iota_initialised_data.h"
+#include "test/helpers/float_comparison.h"
+
+#include "test/types/cartesian_product.h"
+#include "test/types/kernel_data_types.h"
+#include "test/types/to_gtest_types.h"
+#include "test/types/type_list.h"
+
+#include <stddef.h>
+#include <algorithm>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <CL/sycl.hpp>
+
+namespace {
+
+template <typename Pair>
+struct ConvertedFilterConv2D
+    : public BackendTestFixture<sycldnn::backend::SNNBackend> {
+  using DataType = typename Pair::FirstType;
+  using ConvType = typename Pair::SecondType;
+
+ protected:
+  /**
+   * Compare the output of an NCHW convolution which transposes its FCHW filter
+   * on every launch to the output of a convolution using a filter which has
+   * been converted to HWCF up front.
+   *
+   * \param params Convolution parameters to test, using the NCHW format.
+   * \param use_workspace Whether to provide a workspace buffer to the
+   * convolution using the converted filter.
+   */
+  void test_conv(sycldnn::conv2d::Conv2DParams const& params,
+                 bool use_workspace) {
+    auto conv_sizes = sycldnn::conv2d::get_sizes<ConvType>(params);
+    DataType const max_val = static_cast<DataType>(2048);
+
+    std::vector<DataType> input =
+        iota_initialised_data(conv_sizes.input_size, max_val);
+    std::for_each(begin(input), end(input), [](DataType& val) { val /= 1000; });
+    std::vector<DataType> filter =
+        iota_initialised_data(conv_sizes.filter_size, max_val);
+    std::for_each(begin(filter), end(filter),
+                  [](DataType& val) { val /= 1000; });
+    std::vector<DataType> exp_output(conv_sizes.output_size,
+                                     static_cast<DataType>(0));
+    std::vector<DataType> output(conv_sizes.output_size,
+                                 static_cast<DataType>(0));
+
+    auto& provider = this->provider_;
+    auto& backend = provider.get_backend();
+
+    auto inp_gpu =
+        provider.get_initialised_device_memory(conv_sizes.input_size, input);
+    auto fil_gpu =
+        provider.get_initialised_device_memory(conv_sizes.filter_size, filter);
+    auto hwcf_fil_gpu =
+        provider.get_initialised_device_memory(conv_sizes.filter_size, filter);
+    auto exp_out_gpu = provider.get_initialised_device_memory(
+        conv_sizes.output_size, exp_output);
+    auto out_gpu =
+        provider.get_initialised_device_memory(conv_sizes.output_size, output);
+    SNN_ON_SCOPE_EXIT {
+      provider.deallocate_ptr(inp_gpu);
+      provider.deallocate_ptr(fil_gpu);
+      provider.deallocate_ptr(hwcf_fil_gpu);
+      provider.deallocate_ptr(exp_out_gpu);
+      provider.deallocate_ptr(out_gpu);
+    };
+
+    sycldnn::conv2d::Im2colSelector selector{};
+    try {
+      auto status = sycldnn::conv2d::launch<DataType, ConvType>(
+          inp_gpu, fil_gpu, exp_out_gpu, params, selector, backend);
+      ASSERT_EQ(sycldnn::StatusCode::OK, status.status);
+      status.event.wait_and_throw();
+
+      status = sycldnn::conv2d::convert_filter<DataType>(fil_gpu, hwcf_fil_gpu,
+                                                         params, backend);
+      ASSERT_EQ(sycldnn::StatusCode::OK, status.status);
+      status.event.wait_and_throw();
+    } catch (cl::sycl::exception const& e) {
+      throw std::runtime_error(e.what());
+    }
+    provider.copy_device_data_to_host(conv_sizes.output_size, exp_out_gpu,
+                                      exp_output);
+
+    auto hwcf_params = params;
+    hwcf_params.filter_format = sycldnn::FilterFormat::HWCF;
+    auto fchw_workspace =
+        sycldnn::conv2d::query_workspace_size<ConvType>(params, selector);
+    auto hwcf_workspace =
+        sycldnn::conv2d::query_workspace_size<ConvType>(hwcf_params, selector);
+    // The converted filter does not need a temporary copy in the workspace.
+    EXPECT_EQ(fchw_workspace.required_size - conv_sizes.filter_size,
+              hwcf_workspace.required_size);
+
+    auto workspace_size = use_workspace ? hwcf_workspace.recommended_size : 0;
+    std::vector<DataType> workspace_vals(workspace_size);
+    auto workspace =
+        provider.get_initialised_device_memory(workspace_size, workspace_vals);
+    SNN_ON_SCOPE_EXIT { provider.deallocate_ptr(workspace); };
+
+    // The converted filter should be reusable for any number of launches.
+    for (int launch = 0; launch < 2; ++launch) {
+      try {
+        auto status = sycldnn::conv2d::launch<DataType, ConvType>(
+            inp_gpu, hwcf_fil_gpu, out_gpu, hwcf_params, selector, backend,
+            workspace, workspace_size);
+        ASSERT_EQ(sycldnn::StatusCode::OK, status.status);
+        status.event.wait_and_throw();
+      } catch (cl::sycl::exception const& e) {
+        throw std::runtime_error(e.what());
+      }
+      provider.copy_device_data_to_host(conv_sizes.output_size, out_gpu,
+                                        output);
+
+      for (size_t i = 0; i < exp_output.size(); ++i) {
+        SCOPED_TRACE("Launch: " + std::to_string(launch) +
+                     ", Element: " + std::to_string(i));
+        SNN_ALMOST_EQUAL(exp_output[i], output[i], 16u);
+      }
+    }
+  }
+};
+
+using DataTypeList = sycldnn::types::KernelDataTypes;
+using ConvTypeList =
+    sycldnn::types::TypeList<sycldnn::conv2d::conv_type::Forward,
+                             sycldnn::conv2d::conv_type::InputBackprop>;
+
+using SNNTestPairs =
+    sycldnn::types::CartesianProduct<DataTypeList, ConvTypeList>::type;
+
+using GTestTypePairs = sycldnn::types::ToGTestTypes<SNNTestPairs>::type;
+TYPED_TEST_SUITE(ConvertedFilterConv2D, GTestTypePairs);
+
+sycldnn::conv2d::Conv2DParams get_params(int batch) {
+  sycldnn::conv2d::Conv2DParams params;
+  params.channels = 16;
+  params.features = 32;
+  params.batch = batch;
+  params.in_rows = 14;
+  params.in_cols = 14;
+  params.window_rows = 3;
+  params.window_cols = 3;
+  params.stride_rows = 2;
+  params.stride_cols = 2;
+  params.input_format = sycldnn::DataFormat::NCHW;
+  params.filter_format = sycldnn::FilterFormat::FCHW;
+  return sycldnn::helpers::add_padding_to(params, sycldnn::PaddingMode::SAME);
+}
+
+}  // namespace
+
+TYPED_TEST(ConvertedFilterConv2D, Batch1) {
+  this->test_conv(get_params(1), false);
+}
+
+TYPED_TEST(ConvertedFilterConv2D, Batch4) {
+  this->test_conv(get_params(4), false);
+}
+
+TYPED_TEST(ConvertedFilterConv2D, Batch4Workspace) {
+  this->test_conv(get_params(4), true);
+}
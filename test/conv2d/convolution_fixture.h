@@ -84,7 +84,8 @@ struct transpose_helper {
     if (params.filter_format == sycldnn::FilterFormat::FCHW) {
       // HWCF -> HWFC
       transpose(trFilterData, filterData, conv_spatial_sizes.filter_size,
-                params.channels, params.features, filter_offset);
+                params.channels / params.groups, params.features,
+                filter_offset);
       // HWFC -> FCHW
       transpose(filterData, trFilterData, conv_batch_sizes.filter_size,
                 conv_spatial_sizes.filter_size, conv_channel_sizes.filter_size,
@@ -167,7 +168,8 @@ transpose_helper<sycldnn::conv2d::conv_type::FilterBackprop>::transpose_output(
               output_offset);
     // HWFC -> HWCF
     transpose(outputData, trOutputData, conv_spatial_sizes.output_size,
-              params.features, params.channels, output_offset);
+              params.features, params.channels / params.groups,
+              output_offset);
   }
   return outputData;
 }
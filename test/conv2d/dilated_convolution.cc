@@ -0,0 +1,181 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <gtest/gtest.h>
+
+#include "sycldnn/padding_mode.h"
+
+#include "sycldnn/backend/snn_backend.h"
+
+#include "sycldnn/conv2d/conv_type.h"
+#include "sycldnn/conv2d/params.h"
+
+#include "sycldnn/helpers/padding.h"
+
+#include "test/conv2d/convolution_fixture.h"
+#include "test/conv2d/selector_list.h"
+
+#include "test/types/cartesian_product.h"
+#include "test/types/data_format_types.h"
+#include "test/types/kernel_data_types.h"
+#include "test/types/nested_pairs_to_tuple4.h"
+#include "test/types/to_gtest_types.h"
+#include "test/types/type_list.h"
+
+#include <vector>
+
+template <typename Tuple>
+using DilatedConvolutionTest = ConvolutionFixture<Tuple>;
+
+using DataTypeList = sycldnn::types::KernelDataTypes;
+using Selectors = sycldnn::types::SelectorList;
+using Backends = sycldnn::types::TypeList<sycldnn::backend::SNNBackend>;
+using DataFormats = sycldnn::types::DataFormatTypes;
+
+using SNNTypePairs =
+    sycldnn::types::CartesianProduct<Selectors, DataTypeList>::type;
+using BackendTypePairs =
+    sycldnn::types::CartesianProduct<SNNTypePairs, Backends>::type;
+using DataFormatBackendTypePairs =
+    sycldnn::types::CartesianProduct<BackendTypePairs, DataFormats>::type;
+using TestTuple4 =
+    sycldnn::types::NestedPairsToTuple4<DataFormatBackendTypePairs>::type;
+
+using GTestTypeTuple4s = sycldnn::types::ToGTestTypes<TestTuple4>::type;
+TYPED_TEST_SUITE(DilatedConvolutionTest, GTestTypeTuple4s);
+
+sycldnn::conv2d::Conv2DParams get_dilated_3x3_params(
+    int size, int stride, sycldnn::PaddingMode padding) {
+  sycldnn::conv2d::Conv2DParams params;
+  params.channels = 1;
+  params.features = 1;
+  params.batch = 1;
+  params.in_rows = size;
+  params.in_cols = size;
+  params.window_rows = 3;
+  params.window_cols = 3;
+  params.stride_rows = stride;
+  params.stride_cols = stride;
+  params.dilation_rows = 2;
+  params.dilation_cols = 2;
+  return sycldnn::helpers::add_padding_to(params, padding);
+}
+
+TEST(DilatedPadding, OutputUsesDilatedWindow) {
+  auto valid = get_dilated_3x3_params(6, 1, sycldnn::PaddingMode::VALID);
+  EXPECT_EQ(2, valid.out_rows);
+  EXPECT_EQ(2, valid.out_cols);
+  EXPECT_EQ(0, valid.pad_rows);
+  EXPECT_EQ(0, valid.pad_cols);
+
+  auto same = get_dilated_3x3_params(5, 1, sycldnn::PaddingMode::SAME);
+  EXPECT_EQ(5, same.out_rows);
+  EXPECT_EQ(5, same.out_cols);
+  EXPECT_EQ(2, same.pad_rows);
+  EXPECT_EQ(2, same.pad_cols);
+}
+/**
+ * Input:  1  2  3  4  5  6   Filter:  1  2  3
+ *         7  8  9 10 11 12            4  5  6
+ *        13 14 15 16 17 18            7  8  9
+ *        19 20 21 22 23 24
+ *        25 26 27 28 29 30
+ *        31 32 33 34 35 36
+ *
+ * Output: 1x1+2x3+3x5+4x13+5x15+6x17+7x25+8x27+9x29     ...
+ */
+TYPED_TEST(DilatedConvolutionTest, Forward3x3Valid) {
+  using DataType = typename TestFixture::DataType;
+  std::vector<DataType> exp = {903, 948, 1173, 1218};
+  auto params = get_dilated_3x3_params(6, 1, sycldnn::PaddingMode::VALID);
+  this->template test_conv<sycldnn::conv2d::conv_type::Forward>(exp, params);
+}
+TYPED_TEST(DilatedConvolutionTest, Forward3x3Same) {
+  using DataType = typename TestFixture::DataType;
+  std::vector<DataType> exp = {228, 256, 365, 224, 248, 368, 396, 560, 344,
+                               368, 519, 552, 777, 474, 501, 224, 240, 326,
+                               188, 200, 304, 320, 431, 248, 260};
+  auto params = get_dilated_3x3_params(5, 1, sycldnn::PaddingMode::SAME);
+  this->template test_conv<sycldnn::conv2d::conv_type::Forward>(exp, params);
+}
+TYPED_TEST(DilatedConvolutionTest, Forward3x3Stride2) {
+  using DataType = typename TestFixture::DataType;
+  std::vector<DataType> exp = {1029, 1119, 1659, 1749};
+  auto params = get_dilated_3x3_params(7, 2, sycldnn::PaddingMode::VALID);
+  this->template test_conv<sycldnn::conv2d::conv_type::Forward>(exp, params);
+}
+/**
+ * Input: 1   2  Filter:  1  2  3
+ *        3   4           4  5  6
+ *                        7  8  9
+ *
+ * Each filter value is spread out by the dilation, so the output is made up
+ * of four interleaved copies of the filter scaled by each input value.
+ */
+TYPED_TEST(DilatedConvolutionTest, InputBackprop3x3Valid) {
+  using DataType = typename TestFixture::DataType;
+  std::vector<DataType> exp = {1,  2,  2,  4,  3,  6,  3,  4,  6,  8,  9,  12,
+                               4,  8,  5,  10, 6,  12, 12, 16, 15, 20, 18, 24,
+                               7,  14, 8,  16, 9,  18, 21, 28, 24, 32, 27, 36};
+  auto params = get_dilated_3x3_params(6, 1, sycldnn::PaddingMode::VALID);
+  this->template test_conv<sycldnn::conv2d::conv_type::InputBackprop>(exp,
+                                                                      params);
+}
+TYPED_TEST(DilatedConvolutionTest, InputBackprop3x3Same) {
+  using DataType = typename TestFixture::DataType;
+  std::vector<DataType> exp = {52,  64,  115, 96,  112, 112, 124, 220, 176,
+                               192, 201, 228, 393, 306, 339, 256, 280, 454,
+                               332, 360, 376, 400, 649, 472, 500};
+  auto params = get_dilated_3x3_params(5, 1, sycldnn::PaddingMode::SAME);
+  this->template test_conv<sycldnn::conv2d::conv_type::InputBackprop>(exp,
+                                                                      params);
+}
+/**
+ * With a stride of 2 and a dilation of 2 only the even input positions are
+ * used, so the output matches the undilated 3x3 stride 1 input backprop
+ * spread out over every other row and column.
+ */
+TYPED_TEST(DilatedConvolutionTest, InputBackprop3x3Stride2) {
+  using DataType = typename TestFixture::DataType;
+  std::vector<DataType> exp = {
+      1,  0, 4,  0, 7,  0, 6,  0, 0, 0, 0, 0, 0, 0, 7,  0, 23,
+      0,  33, 0, 24, 0, 0, 0, 0, 0, 0, 0, 19, 0, 53, 0, 63, 0,
+      42, 0, 0, 0, 0, 0, 0, 0, 21, 0, 52, 0, 59, 0, 36};
+  auto params = get_dilated_3x3_params(7, 2, sycldnn::PaddingMode::VALID);
+  this->template test_conv<sycldnn::conv2d::conv_type::InputBackprop>(exp,
+                                                                      params);
+}
+TYPED_TEST(DilatedConvolutionTest, FilterBackprop3x3Valid) {
+  using DataType = typename TestFixture::DataType;
+  std::vector<DataType> exp = {58, 78, 98, 178, 198, 218, 298, 318, 338};
+  auto params = get_dilated_3x3_params(6, 1, sycldnn::PaddingMode::VALID);
+  this->template test_conv<sycldnn::conv2d::conv_type::FilterBackprop>(exp,
+                                                                       params);
+}
+TYPED_TEST(DilatedConvolutionTest, FilterBackprop3x3Same) {
+  using DataType = typename TestFixture::DataType;
+  std::vector<DataType> exp = {1353, 2440, 1533, 3280, 5525,
+                               3280, 1533, 2440, 1353};
+  auto params = get_dilated_3x3_params(5, 1, sycldnn::PaddingMode::SAME);
+  this->template test_conv<sycldnn::conv2d::conv_type::FilterBackprop>(exp,
+                                                                       params);
+}
+TYPED_TEST(DilatedConvolutionTest, FilterBackprop3x3Stride2) {
+  using DataType = typename TestFixture::DataType;
+  std::vector<DataType> exp = {120, 140, 160, 260, 280, 300, 400, 420, 440};
+  auto params = get_dilated_3x3_params(7, 2, sycldnn::PaddingMode::VALID);
+  this->template test_conv<sycldnn::conv2d::conv_type::FilterBackprop>(exp,
+                                                                       params);
+}
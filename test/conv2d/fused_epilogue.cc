@@ -0,0 +1,248 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <gtest/gtest.h>
+
+#include "sycldnn/padding_mode.h"
+#include "sycldnn/status.h"
+
+#include "sycldnn/backend/snn_backend.h"
+
+#include "sycldnn/conv2d/algorithm.h"
+#include "sycldnn/conv2d/conv_type.h"
+#include "sycldnn/conv2d/epilogue.h"
+#include "sycldnn/conv2d/launch.h"
+#include "sycldnn/conv2d/params.h"
+#include "sycldnn/conv2d/sizes.h"
+
+#include "sycldnn/conv2d/selector/winograd_selector.h"
+
+#include "sycldnn/helpers/padding.h"
+#include "sycldnn/helpers/scope_exit.h"
+
+#include "test/backend/backend_test_fixture.h"
+#include "test/conv2d/selector_list.h"
+#include "test/gen/iota_initialised_data.h"
+#include "test/helpers/float_comparison.h"
+
+#include "test/types/cartesian_product.h"
+#include "test/types/concatenate.h"
+#include "test/types/kernel_data_types.h"
+#include "test/types/to_gtest_types.h"
+#include "test/types/type_list.h"
+
+#include <stddef.h>
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <CL/sycl.hpp>
+
+namespace {
+
+template <typename Pair>
+struct FusedEpilogueConv2D
+    : public BackendTestFixture<sycldnn::backend::SNNBackend> {
+  using SelectorType = typename Pair::FirstType;
+  using DataType = typename Pair::SecondType;
+  using Backend = sycldnn::backend::SNNBackend;
+  using Forward = sycldnn::conv2d::conv_type::Forward;
+
+ protected:
+  /** Get the output feature of the element at the given output index. */
+  static size_t get_feature(sycldnn::conv2d::Conv2DParams const& params,
+                            size_t index) {
+    if (params.input_format == sycldnn::DataFormat::NCHW) {
+      return (index / (params.out_rows * params.out_cols)) % params.features;
+    }
+    return index % params.features;
+  }
+
+  /**
+   * Compare the output of a convolution with a fused epilogue to the output of
+   * the same convolution without an epilogue, with the bias and activation
+   * then applied on the host.
+   *
+   * The bias is negative and grows with the feature index, so that the
+   * activations clamp a range of the convolution outputs.
+   */
+  void test_fused(sycldnn::conv2d::Conv2DParams const& params,
+                  sycldnn::conv2d::EpilogueParams const& epilogue) {
+    auto conv_sizes = sycldnn::conv2d::get_sizes<Forward>(params);
+    DataType const max_val = static_cast<DataType>(8);
+
+    std::vector<DataType> input =
+        iota_initialised_data(conv_sizes.input_size, max_val);
+    std::vector<DataType> filter =
+        iota_initialised_data(conv_sizes.filter_size, max_val);
+    std::vector<DataType> bias(params.features);
+    for (int i = 0; i < params.features; ++i) {
+      bias[i] = static_cast<DataType>(-16 * (i + 1));
+    }
+    std::vector<DataType> exp_output(conv_sizes.output_size,
+                                     static_cast<DataType>(0));
+    std::vector<DataType> output(conv_sizes.output_size,
+                                 static_cast<DataType>(0));
+
+    auto& provider = this->provider_;
+    auto& backend = provider.get_backend();
+
+    auto inp_gpu =
+        provider.get_initialised_device_memory(conv_sizes.input_size, input);
+    auto fil_gpu =
+        provider.get_initialised_device_memory(conv_sizes.filter_size, filter);
+    auto bias_gpu = provider.get_initialised_device_memory(bias.size(), bias);
+    auto exp_out_gpu = provider.get_initialised_device_memory(
+        conv_sizes.output_size, exp_output);
+    auto out_gpu =
+        provider.get_initialised_device_memory(conv_sizes.output_size, output);
+    SNN_ON_SCOPE_EXIT {
+      provider.deallocate_ptr(inp_gpu);
+      provider.deallocate_ptr(fil_gpu);
+      provider.deallocate_ptr(bias_gpu);
+      provider.deallocate_ptr(exp_out_gpu);
+      provider.deallocate_ptr(out_gpu);
+    };
+
+    SelectorType selector{};
+    if (selector.template select<Forward>(params) ==
+        sycldnn::conv2d::Algorithm::NotSupported) {
+      // Do not run the test if the implementation is not supported.
+      return;
+    }
+    try {
+      auto status = sycldnn::conv2d::launch<DataType, Forward>(
+          inp_gpu, fil_gpu, exp_out_gpu, params, selector, backend);
+      if (status.status == sycldnn::StatusCode::InvalidAlgorithm) {
+        // Do not check results if the implementation is not supported.
+        return;
+      }
+      ASSERT_EQ(sycldnn::StatusCode::OK, status.status);
+      status.event.wait_and_throw();
+
+      status = sycldnn::conv2d::launch<DataType, Forward>(
+          inp_gpu, fil_gpu, bias_gpu, out_gpu, params, epilogue, selector,
+          backend);
+      ASSERT_EQ(sycldnn::StatusCode::OK, status.status);
+      status.event.wait_and_throw();
+    } catch (cl::sycl::exception const& e) {
+      throw std::runtime_error(e.what());
+    }
+    provider.copy_device_data_to_host(conv_sizes.output_size, exp_out_gpu,
+                                      exp_output);
+    provider.copy_device_data_to_host(conv_sizes.output_size, out_gpu, output);
+
+    for (size_t i = 0; i < exp_output.size(); ++i) {
+      DataType val = exp_output[i];
+      if (epilogue.bias) {
+        val += bias[get_feature(params, i)];
+      }
+      switch (epilogue.activation) {
+        case sycldnn::conv2d::Activation::Relu:
+          val = std::max(val, DataType{0});
+          break;
+        case sycldnn::conv2d::Activation::Clamp:
+          val = std::max(val, static_cast<DataType>(epilogue.clamp_min));
+          val = std::min(val, static_cast<DataType>(epilogue.clamp_max));
+          break;
+        case sycldnn::conv2d::Activation::None:
+        default:
+          break;
+      }
+      SCOPED_TRACE("Element: " + std::to_string(i));
+      SNN_ALMOST_EQUAL(val, output[i], 10u);
+    }
+  }
+};
+
+using DataTypeList = sycldnn::types::KernelDataTypes;
+using SelectorList = sycldnn::types::Concatenate<
+    sycldnn::types::SelectorList,
+    sycldnn::types::TypeList<sycldnn::conv2d::WinogradLargeSelector>>::type;
+
+using SNNTestPairs =
+    sycldnn::types::CartesianProduct<SelectorList, DataTypeList>::type;
+using GTestTypePairs = sycldnn::types::ToGTestTypes<SNNTestPairs>::type;
+TYPED_TEST_SUITE(FusedEpilogueConv2D, GTestTypePairs);
+
+sycldnn::conv2d::Conv2DParams get_params(int window, int stride, int features) {
+  sycldnn::conv2d::Conv2DParams params;
+  params.channels = 4;
+  params.features = features;
+  params.batch = 2;
+  params.in_rows = 9;
+  params.in_cols = 9;
+  params.window_rows = window;
+  params.window_cols = window;
+  params.stride_rows = stride;
+  params.stride_cols = stride;
+  return sycldnn::helpers::add_padding_to(params, sycldnn::PaddingMode::SAME);
+}
+
+sycldnn::conv2d::Conv2DParams get_nchw_params(int window, int stride,
+                                              int features) {
+  auto params = get_params(window, stride, features);
+  params.input_format = sycldnn::DataFormat::NCHW;
+  params.filter_format = sycldnn::FilterFormat::FCHW;
+  return params;
+}
+
+sycldnn::conv2d::EpilogueParams get_epilogue(
+    bool bias, sycldnn::conv2d::Activation activation) {
+  sycldnn::conv2d::EpilogueParams epilogue;
+  epilogue.bias = bias;
+  epilogue.activation = activation;
+  return epilogue;
+}
+
+}  // namespace
+
+TYPED_TEST(FusedEpilogueConv2D, Window3BiasOnly) {
+  this->test_fused(get_params(3, 1, 8),
+                   get_epilogue(true, sycldnn::conv2d::Activation::None));
+}
+TYPED_TEST(FusedEpilogueConv2D, Window3Relu) {
+  this->test_fused(get_params(3, 1, 8),
+                   get_epilogue(false, sycldnn::conv2d::Activation::Relu));
+}
+TYPED_TEST(FusedEpilogueConv2D, Window3BiasRelu) {
+  this->test_fused(get_params(3, 1, 8),
+                   get_epilogue(true, sycldnn::conv2d::Activation::Relu));
+}
+TYPED_TEST(FusedEpilogueConv2D, Window3BiasRelu6OddFeatures) {
+  this->test_fused(get_params(3, 1, 5),
+                   get_epilogue(true, sycldnn::conv2d::Activation::Clamp));
+}
+TYPED_TEST(FusedEpilogueConv2D, Window1Stride2BiasClamp) {
+  auto epilogue = get_epilogue(true, sycldnn::conv2d::Activation::Clamp);
+  epilogue.clamp_min = -64.f;
+  epilogue.clamp_max = 64.f;
+  this->test_fused(get_params(1, 2, 6), epilogue);
+}
+TYPED_TEST(FusedEpilogueConv2D, Window5BiasRelu) {
+  this->test_fused(get_params(5, 2, 4),
+                   get_epilogue(true, sycldnn::conv2d::Activation::Relu));
+}
+TYPED_TEST(FusedEpilogueConv2D, NCHWWindow3BiasRelu) {
+  this->test_fused(get_nchw_params(3, 1, 8),
+                   get_epilogue(true, sycldnn::conv2d::Activation::Relu));
+}
+TYPED_TEST(FusedEpilogueConv2D, NCHWWindow1BiasClamp) {
+  auto epilogue = get_epilogue(true, sycldnn::conv2d::Activation::Clamp);
+  epilogue.clamp_min = -64.f;
+  epilogue.clamp_max = 64.f;
+  this->test_fused(get_nchw_params(1, 1, 6), epilogue);
+}
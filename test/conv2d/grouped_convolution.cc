@@ -0,0 +1,164 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <gtest/gtest.h>
+
+#include "sycldnn/padding_mode.h"
+
+#include "sycldnn/backend/snn_backend.h"
+
+#include "sycldnn/conv2d/conv_type.h"
+#include "sycldnn/conv2d/params.h"
+#include "sycldnn/conv2d/sizes.h"
+
+#include "sycldnn/helpers/padding.h"
+
+#include "test/conv2d/convolution_fixture.h"
+#include "test/conv2d/selector_list.h"
+
+#include "test/types/cartesian_product.h"
+#include "test/types/data_format_types.h"
+#include "test/types/kernel_data_types.h"
+#include "test/types/nested_pairs_to_tuple4.h"
+#include "test/types/to_gtest_types.h"
+#include "test/types/type_list.h"
+
+#include <vector>
+
+template <typename Tuple>
+using GroupedConvolutionTest = ConvolutionFixture<Tuple>;
+
+using DataTypeList = sycldnn::types::KernelDataTypes;
+using Selectors = sycldnn::types::SelectorList;
+using Backends = sycldnn::types::TypeList<sycldnn::backend::SNNBackend>;
+using DataFormats = sycldnn::types::DataFormatTypes;
+
+using SNNTypePairs =
+    sycldnn::types::CartesianProduct<Selectors, DataTypeList>::type;
+using BackendTypePairs =
+    sycldnn::types::CartesianProduct<SNNTypePairs, Backends>::type;
+using DataFormatBackendTypePairs =
+    sycldnn::types::CartesianProduct<BackendTypePairs, DataFormats>::type;
+using TestTuple4 =
+    sycldnn::types::NestedPairsToTuple4<DataFormatBackendTypePairs>::type;
+
+using GTestTypeTuple4s = sycldnn::types::ToGTestTypes<TestTuple4>::type;
+TYPED_TEST_SUITE(GroupedConvolutionTest, GTestTypeTuple4s);
+
+sycldnn::conv2d::Conv2DParams get_grouped_params(int batch, int size,
+                                                 int window, int channels,
+                                                 int features, int groups) {
+  sycldnn::conv2d::Conv2DParams params;
+  params.channels = channels;
+  params.features = features;
+  params.batch = batch;
+  params.in_rows = size;
+  params.in_cols = size;
+  params.window_rows = window;
+  params.window_cols = window;
+  params.stride_rows = 1;
+  params.stride_cols = 1;
+  params.groups = groups;
+  return sycldnn::helpers::add_padding_to(params, sycldnn::PaddingMode::VALID);
+}
+
+TEST(GroupedSizes, FilterOnlyHoldsGroupChannels) {
+  auto params = get_grouped_params(1, 4, 3, 4, 6, 2);
+  auto sizes =
+      sycldnn::conv2d::get_sizes<sycldnn::conv2d::conv_type::Forward>(params);
+  EXPECT_EQ(4u * 4u * 4u, sizes.input_size);
+  EXPECT_EQ(3u * 3u * 2u * 6u, sizes.filter_size);
+  EXPECT_EQ(2u * 2u * 6u, sizes.output_size);
+}
+/**
+ * With two channels split into two groups each feature only uses a single
+ * channel of the input, so feature 0 only sees the odd input values and
+ * feature 1 only sees the even input values.
+ */
+TYPED_TEST(GroupedConvolutionTest, Forward3x3TwoGroups) {
+  using DataType = typename TestFixture::DataType;
+  std::vector<DataType> exp = {1203, 1392, 1365, 1572,
+                               1851, 2112, 2013, 2292};
+  auto params = get_grouped_params(1, 4, 3, 2, 2, 2);
+  this->template test_conv<sycldnn::conv2d::conv_type::Forward>(exp, params);
+}
+TYPED_TEST(GroupedConvolutionTest, Forward1x1TwoGroups) {
+  using DataType = typename TestFixture::DataType;
+  std::vector<DataType> exp = {11, 14, 37,  44,  35, 46,  77,  92,
+                               59, 78, 117, 140, 83, 110, 157, 188};
+  auto params = get_grouped_params(1, 2, 1, 4, 4, 2);
+  this->template test_conv<sycldnn::conv2d::conv_type::Forward>(exp, params);
+}
+TYPED_TEST(GroupedConvolutionTest, Forward3x3TwoGroupsBatch2) {
+  using DataType = typename TestFixture::DataType;
+  std::vector<DataType> exp = {7599, 8598, 19263, 20910};
+  auto params = get_grouped_params(2, 3, 3, 4, 2, 2);
+  this->template test_conv<sycldnn::conv2d::conv_type::Forward>(exp, params);
+}
+TYPED_TEST(GroupedConvolutionTest, InputBackprop3x3TwoGroups) {
+  using DataType = typename TestFixture::DataType;
+  std::vector<DataType> exp = {1,   4,   6,   16,  14,  28,  15,  24,
+                               12,  28,  52,  92,  84,  132, 68,  96,
+                               48,  76,  148, 212, 180, 252, 128, 168,
+                               65,  84,  166, 208, 190, 236, 119, 144};
+  auto params = get_grouped_params(1, 4, 3, 2, 2, 2);
+  this->template test_conv<sycldnn::conv2d::conv_type::InputBackprop>(exp,
+                                                                      params);
+}
+TYPED_TEST(GroupedConvolutionTest, InputBackprop1x1TwoGroups) {
+  using DataType = typename TestFixture::DataType;
+  std::vector<DataType> exp = {5,  17,  25, 53,  17, 61,  53,  113,
+                               29, 105, 81, 173, 41, 149, 109, 233};
+  auto params = get_grouped_params(1, 2, 1, 4, 4, 2);
+  this->template test_conv<sycldnn::conv2d::conv_type::InputBackprop>(exp,
+                                                                      params);
+}
+TYPED_TEST(GroupedConvolutionTest, InputBackprop3x3TwoGroupsBatch2) {
+  using DataType = typename TestFixture::DataType;
+  std::vector<DataType> exp = {
+      1,  3,  4,   8,   5,  7,  12,  16,  9,  11, 20,  24,  13, 15, 28,
+      32, 17, 19,  36,  40, 21, 23,  44,  48, 25, 27,  52,  56, 29, 31,
+      60, 64, 33,  35,  68, 72, 3,   9,   8,  16, 15,  21,  24, 32, 27,
+      33, 40, 48,  39,  45, 56, 64,  51,  57, 72, 80,  63,  69, 88, 96,
+      75, 81, 104, 112, 87, 93, 120, 128, 99, 105, 136, 144};
+  auto params = get_grouped_params(2, 3, 3, 4, 2, 2);
+  this->template test_conv<sycldnn::conv2d::conv_type::InputBackprop>(exp,
+                                                                      params);
+}
+TYPED_TEST(GroupedConvolutionTest, FilterBackprop3x3TwoGroups) {
+  using DataType = typename TestFixture::DataType;
+  std::vector<DataType> exp = {132, 176, 164, 216, 196, 256, 260, 336, 292,
+                               376, 324, 416, 388, 496, 420, 536, 452, 576};
+  auto params = get_grouped_params(1, 4, 3, 2, 2, 2);
+  this->template test_conv<sycldnn::conv2d::conv_type::FilterBackprop>(exp,
+                                                                       params);
+}
+TYPED_TEST(GroupedConvolutionTest, FilterBackprop1x1TwoGroups) {
+  using DataType = typename TestFixture::DataType;
+  std::vector<DataType> exp = {276, 304, 404, 440, 304, 336, 440, 480};
+  auto params = get_grouped_params(1, 2, 1, 4, 4, 2);
+  this->template test_conv<sycldnn::conv2d::conv_type::FilterBackprop>(exp,
+                                                                       params);
+}
+TYPED_TEST(GroupedConvolutionTest, FilterBackprop3x3TwoGroupsBatch2) {
+  using DataType = typename TestFixture::DataType;
+  std::vector<DataType> exp = {112, 162, 116, 168, 128, 186, 132, 192, 144,
+                               210, 148, 216, 160, 234, 164, 240, 176, 258,
+                               180, 264, 192, 282, 196, 288, 208, 306, 212,
+                               312, 224, 330, 228, 336, 240, 354, 244, 360};
+  auto params = get_grouped_params(2, 3, 3, 4, 2, 2);
+  this->template test_conv<sycldnn::conv2d::conv_type::FilterBackprop>(exp,
+                                                                       params);
+}
@@ -0,0 +1,261 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <gtest/gtest.h>
+
+#include "sycldnn/padding_mode.h"
+#include "sycldnn/status.h"
+
+#include "sycldnn/backend/snn_backend.h"
+
+#include "sycldnn/conv2d/algorithm.h"
+#include "sycldnn/conv2d/conv_type.h"
+#include "sycldnn/conv2d/launch.h"
+#include "sycldnn/conv2d/params.h"
+#include "sycldnn/conv2d/sizes.h"
+#include "sycldnn/conv2d/winograd_filter.h"
+#include "sycldnn/conv2d/workspace_size.h"
+
+#include "sycldnn/conv2d/selector/winograd_selector.h"
+
+#include "sycldnn/helpers/padding.h"
+#include "sycldnn/helpers/scope_exit.h"
+
+#include "test/backend/backend_test_fixture.h"
+#include "test/gen/iota_initialised_data.h"
+#include "test/helpers/float_comparison.h"
+
+#include "test/types/cartesian_product.h"
+#include "test/types/kernel_data_types.h"
+#include "test/types/nested_pairs_to_triple.h"
+#include "test/types/to_gtest_types.h"
+#include "test/types/type_list.h"
+
+#include <stddef.h>
+#include <algorithm>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <CL/sycl.hpp>
+
+namespace {
+
+template <typename Triple>
+struct WinogradFilterConv2D
+    : public BackendTestFixture<sycldnn::backend::SNNBackend> {
+  using SelectorType = typename Triple::FirstType;
+  using DataType = typename Triple::SecondType;
+  using Backend = sycldnn::backend::SNNBackend;
+  using ConvType = typename Triple::ThirdType;
+
+ protected:
+  /**
+   * Compare the output of a Winograd convolution which transforms the filter
+   * on every launch to the output of a number of convolutions using a
+   * pre-transformed filter.
+   *
+   * \param params Convolution parameters to test.
+   * \param use_workspace Whether to provide a workspace buffer to the
+   * convolutions using the pre-transformed filter.
+   * \param max_val The maximum value to use in the input tensors, as used by
+   * the iota_initialised_data function.
+   */
+  void test_conv(sycldnn::conv2d::Conv2DParams const& params,
+                 bool use_workspace,
+                 DataType max_val = static_cast<DataType>(2048)) {
+    auto conv_sizes = sycldnn::conv2d::get_sizes<ConvType>(params);
+
+    std::vector<DataType> input =
+        iota_initialised_data(conv_sizes.input_size, max_val);
+    std::for_each(begin(input), end(input), [](DataType& val) { val /= 1000; });
+    std::vector<DataType> filter =
+        iota_initialised_data(conv_sizes.filter_size, max_val);
+    std::for_each(begin(filter), end(filter),
+                  [](DataType& val) { val /= 1000; });
+    std::vector<DataType> exp_output(conv_sizes.output_size,
+                                     static_cast<DataType>(0));
+    std::vector<DataType> output(conv_sizes.output_size,
+                                 static_cast<DataType>(0));
+
+    auto& provider = this->provider_;
+    auto& backend = provider.get_backend();
+
+    auto inp_gpu =
+        provider.get_initialised_device_memory(conv_sizes.input_size, input);
+    auto fil_gpu =
+        provider.get_initialised_device_memory(conv_sizes.filter_size, filter);
+    auto exp_out_gpu = provider.get_initialised_device_memory(
+        conv_sizes.output_size, exp_output);
+    auto out_gpu =
+        provider.get_initialised_device_memory(conv_sizes.output_size, output);
+    SNN_ON_SCOPE_EXIT {
+      provider.deallocate_ptr(inp_gpu);
+      provider.deallocate_ptr(fil_gpu);
+      provider.deallocate_ptr(exp_out_gpu);
+      provider.deallocate_ptr(out_gpu);
+    };
+
+    SelectorType selector{};
+    auto algorithm = selector.template select<ConvType>(params);
+    ASSERT_NE(algorithm, sycldnn::conv2d::Algorithm::NotSupported);
+    try {
+      auto status = sycldnn::conv2d::launch<DataType, ConvType>(
+          inp_gpu, fil_gpu, exp_out_gpu, params, selector, backend);
+
+      ASSERT_EQ(sycldnn::StatusCode::OK, status.status);
+      status.event.wait_and_throw();
+    } catch (cl::sycl::exception const& e) {
+      throw std::runtime_error(e.what());
+    }
+    provider.copy_device_data_to_host(conv_sizes.output_size, exp_out_gpu,
+                                      exp_output);
+
+    sycldnn::conv2d::WinogradFilter<DataType, ConvType, Backend> transformed{
+        params, algorithm, backend};
+    ASSERT_TRUE(transformed.is_valid());
+    try {
+      auto status = sycldnn::conv2d::transform_winograd_filter<DataType>(
+          fil_gpu, transformed, backend);
+      ASSERT_EQ(sycldnn::StatusCode::OK, status.status);
+      status.event.wait_and_throw();
+    } catch (cl::sycl::exception const& e) {
+      throw std::runtime_error(e.what());
+    }
+
+    auto workspace_size =
+        use_workspace
+            ? sycldnn::conv2d::query_workspace_size(params, transformed)
+                  .recommended_size
+            : 0;
+    std::vector<DataType> workspace_vals(workspace_size);
+    auto workspace =
+        provider.get_initialised_device_memory(workspace_size, workspace_vals);
+    SNN_ON_SCOPE_EXIT { provider.deallocate_ptr(workspace); };
+
+    // The transformed filter should be reusable for any number of launches.
+    for (int launch = 0; launch < 2; ++launch) {
+      try {
+        auto status = sycldnn::conv2d::launch<DataType, ConvType>(
+            inp_gpu, transformed, out_gpu, params, backend, workspace,
+            workspace_size);
+
+        ASSERT_EQ(sycldnn::StatusCode::OK, status.status);
+        status.event.wait_and_throw();
+      } catch (cl::sycl::exception const& e) {
+        throw std::runtime_error(e.what());
+      }
+      provider.copy_device_data_to_host(conv_sizes.output_size, out_gpu,
+                                        output);
+
+      for (size_t i = 0; i < exp_output.size(); ++i) {
+        SCOPED_TRACE("Launch: " + std::to_string(launch) +
+                     ", Element: " + std::to_string(i));
+        // Both convolutions use the same kernels, so the results should only
+        // differ by the rounding in the batched matrix multiplies.
+        SNN_ALMOST_EQUAL(exp_output[i], output[i], 16u);
+      }
+    }
+  }
+};
+
+using DataTypeList = sycldnn::types::KernelDataTypes;
+using SelectorList =
+    sycldnn::types::TypeList<sycldnn::conv2d::WinogradSelector,
+                             sycldnn::conv2d::WinogradLargeSelector>;
+using ConvTypeList =
+    sycldnn::types::TypeList<sycldnn::conv2d::conv_type::Forward,
+                             sycldnn::conv2d::conv_type::InputBackprop>;
+
+using SNNTestPairs =
+    sycldnn::types::CartesianProduct<SelectorList, DataTypeList>::type;
+using TestPairsWithConvType =
+    sycldnn::types::CartesianProduct<SNNTestPairs, ConvTypeList>::type;
+using TestTriples =
+    sycldnn::types::NestedPairsToTriple<TestPairsWithConvType>::type;
+
+using GTestTypeTriples = sycldnn::types::ToGTestTypes<TestTriples>::type;
+TYPED_TEST_SUITE(WinogradFilterConv2D, GTestTypeTriples);
+
+sycldnn::conv2d::Conv2DParams get_3x3_params(int batch) {
+  sycldnn::conv2d::Conv2DParams params;
+  params.channels = 16;
+  params.features = 32;
+  params.batch = batch;
+  params.in_rows = 14;
+  params.in_cols = 14;
+  params.window_rows = 3;
+  params.window_cols = 3;
+  params.stride_rows = 1;
+  params.stride_cols = 1;
+  return sycldnn::helpers::add_padding_to(params, sycldnn::PaddingMode::SAME);
+}
+
+}  // namespace
+
+TYPED_TEST(WinogradFilterConv2D, Batch1) {
+  this->test_conv(get_3x3_params(1), false);
+}
+
+TYPED_TEST(WinogradFilterConv2D, Batch4) {
+  this->test_conv(get_3x3_params(4), false);
+}
+
+TYPED_TEST(WinogradFilterConv2D, Batch4Workspace) {
+  this->test_conv(get_3x3_params(4), true);
+}
+
+TEST(WinogradFilterSize, UnsupportedWindowIsInvalid) {
+  using Backend = sycldnn::backend::SNNBackend;
+  using ConvType = sycldnn::conv2d::conv_type::Forward;
+  sycldnn::backend::BackendProvider<Backend> provider;
+  auto params = get_3x3_params(1);
+  params.window_rows = 5;
+  params.window_cols = 5;
+  sycldnn::conv2d::WinogradFilter<float, ConvType, Backend> transformed{
+      params, sycldnn::conv2d::Algorithm::Winograd, provider.get_backend()};
+  EXPECT_FALSE(transformed.is_valid());
+  EXPECT_EQ(0u, transformed.size());
+}
+
+TEST(WinogradFilterLaunch, StridedOrDilatedConvIsInvalid) {
+  using Backend = sycldnn::backend::SNNBackend;
+  using ConvType = sycldnn::conv2d::conv_type::Forward;
+  using ConstPointer = Backend::pointer_type<float const>;
+  using Pointer = Backend::pointer_type<float>;
+  sycldnn::backend::BackendProvider<Backend> provider;
+  auto& backend = provider.get_backend();
+  auto params = get_3x3_params(1);
+  sycldnn::conv2d::WinogradFilter<float, ConvType, Backend> transformed{
+      params, sycldnn::conv2d::Algorithm::Winograd, backend};
+  ASSERT_TRUE(transformed.is_valid());
+
+  auto strided = params;
+  strided.stride_rows = 2;
+  strided.stride_cols = 2;
+  strided = sycldnn::helpers::add_padding_to(strided,
+                                             sycldnn::PaddingMode::SAME);
+  auto status = sycldnn::conv2d::launch<float, ConvType>(
+      ConstPointer{}, transformed, Pointer{}, strided, backend);
+  EXPECT_EQ(sycldnn::StatusCode::InvalidAlgorithm, status.status);
+
+  auto dilated = params;
+  dilated.dilation_rows = 2;
+  dilated.dilation_cols = 2;
+  status = sycldnn::conv2d::launch<float, ConvType>(
+      ConstPointer{}, transformed, Pointer{}, dilated, backend);
+  EXPECT_EQ(sycldnn::StatusCode::InvalidAlgorithm, status.status);
+}
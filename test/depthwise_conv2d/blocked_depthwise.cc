@@ -0,0 +1,249 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <gtest/gtest.h>
+
+#include "sycldnn/data_format.h"
+#include "sycldnn/status.h"
+
+#include "sycldnn/backend/snn_backend.h"
+
+#include "sycldnn/conv2d/conv_type.h"
+
+#include "sycldnn/depthwise_conv2d/algorithm.h"
+#include "sycldnn/depthwise_conv2d/launch.h"
+#include "sycldnn/depthwise_conv2d/params.h"
+#include "sycldnn/depthwise_conv2d/sizes.h"
+
+#include "sycldnn/helpers/scope_exit.h"
+
+#include "sycldnn/transpose/launch.h"
+
+#include "test/backend/backend_test_fixture.h"
+#include "test/gen/iota_initialised_data.h"
+#include "test/helpers/float_comparison.h"
+
+#include "test/types/kernel_data_types.h"
+
+#include <stddef.h>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <CL/sycl.hpp>
+
+namespace {
+
+using Forward = sycldnn::conv2d::conv_type::Forward;
+using InputBackprop = sycldnn::conv2d::conv_type::InputBackprop;
+using FilterBackprop = sycldnn::conv2d::conv_type::FilterBackprop;
+using sycldnn::depthwise_conv2d::DepthwiseConv2DParams;
+
+std::vector<int> in_image(DepthwiseConv2DParams const& params) {
+  return {params.batch, params.in_rows, params.in_cols, params.channels};
+}
+
+std::vector<int> out_image(DepthwiseConv2DParams const& params) {
+  return {params.batch, params.out_rows, params.out_cols,
+          params.channels * params.channel_multiplier};
+}
+
+/**
+ * The NHWC dimensions of the input, filter and output tensors of a depthwise
+ * convolution, with empty dimensions for tensors which are filters and so are
+ * not stored in the blocked data format.
+ */
+struct ImageDims {
+  std::vector<int> input;
+  std::vector<int> filter;
+  std::vector<int> output;
+};
+
+template <typename ConvType>
+ImageDims get_image_dims(DepthwiseConv2DParams const& params);
+
+template <>
+ImageDims get_image_dims<Forward>(DepthwiseConv2DParams const& params) {
+  return {in_image(params), {}, out_image(params)};
+}
+
+template <>
+ImageDims get_image_dims<InputBackprop>(DepthwiseConv2DParams const& params) {
+  return {out_image(params), {}, in_image(params)};
+}
+
+template <>
+ImageDims get_image_dims<FilterBackprop>(DepthwiseConv2DParams const& params) {
+  return {in_image(params), out_image(params), {}};
+}
+
+DepthwiseConv2DParams get_params(int window, int stride, int channels,
+                                 int multiplier) {
+  DepthwiseConv2DParams params;
+  params.channels = channels;
+  params.channel_multiplier = multiplier;
+  params.batch = 2;
+  params.in_rows = 9;
+  params.in_cols = 7;
+  params.window_rows = window;
+  params.window_cols = window;
+  params.stride_rows = stride;
+  params.stride_cols = stride;
+  params.pad_rows = window / 2;
+  params.pad_cols = window / 2;
+  params.out_rows =
+      (params.in_rows + 2 * params.pad_rows - window) / stride + 1;
+  params.out_cols =
+      (params.in_cols + 2 * params.pad_cols - window) / stride + 1;
+  return params;
+}
+
+}  // namespace
+
+template <typename DataType>
+struct BlockedDepthwise
+    : public BackendTestFixture<sycldnn::backend::SNNBackend> {
+  using Backend = sycldnn::backend::SNNBackend;
+  using ConstPointer = Backend::pointer_type<DataType const>;
+  using Pointer = Backend::pointer_type<DataType>;
+
+ protected:
+  /**
+   * Convert an NHWC tensor on the device to the given format. Tensors with
+   * empty dimensions are copied unchanged.
+   */
+  void convert(ConstPointer input, Pointer output, std::vector<int> dims,
+               size_t size, sycldnn::DataFormat from, sycldnn::DataFormat to) {
+    auto& backend = this->provider_.get_backend();
+    if (dims.empty()) {
+      dims = {1, 1, 1, static_cast<int>(size)};
+      from = sycldnn::DataFormat::NHWC;
+      to = sycldnn::DataFormat::NHWC;
+    }
+    auto status = sycldnn::transpose::convert_layout<DataType>(
+        input, output, dims, from, to, backend);
+    ASSERT_EQ(sycldnn::StatusCode::OK, status.status);
+    status.event.wait_and_throw();
+  }
+
+  /**
+   * Check that a depthwise convolution on channel blocked tensors gives the
+   * same result as the depthwise convolution on NHWC tensors.
+   */
+  template <typename ConvType>
+  void test_blocked(DepthwiseConv2DParams params, sycldnn::DataFormat format) {
+    auto conv_sizes = sycldnn::depthwise_conv2d::get_sizes<ConvType>(params);
+    auto dims = get_image_dims<ConvType>(params);
+    DataType const max_val = static_cast<DataType>(8);
+
+    std::vector<DataType> input =
+        iota_initialised_data(conv_sizes.input_size, max_val);
+    std::vector<DataType> filter =
+        iota_initialised_data(conv_sizes.filter_size, max_val);
+    std::vector<DataType> exp_output(conv_sizes.output_size,
+                                     static_cast<DataType>(0));
+    std::vector<DataType> output(conv_sizes.output_size,
+                                 static_cast<DataType>(0));
+
+    auto& provider = this->provider_;
+    auto& backend = provider.get_backend();
+
+    auto inp_gpu =
+        provider.get_initialised_device_memory(conv_sizes.input_size, input);
+    auto fil_gpu =
+        provider.get_initialised_device_memory(conv_sizes.filter_size, filter);
+    auto exp_out_gpu = provider.get_initialised_device_memory(
+        conv_sizes.output_size, exp_output);
+    auto blocked_inp_gpu =
+        provider.get_initialised_device_memory(conv_sizes.input_size, input);
+    auto blocked_fil_gpu =
+        provider.get_initialised_device_memory(conv_sizes.filter_size, filter);
+    auto blocked_out_gpu =
+        provider.get_initialised_device_memory(conv_sizes.output_size, output);
+    auto out_gpu =
+        provider.get_initialised_device_memory(conv_sizes.output_size, output);
+    SNN_ON_SCOPE_EXIT {
+      provider.deallocate_ptr(inp_gpu);
+      provider.deallocate_ptr(fil_gpu);
+      provider.deallocate_ptr(exp_out_gpu);
+      provider.deallocate_ptr(blocked_inp_gpu);
+      provider.deallocate_ptr(blocked_fil_gpu);
+      provider.deallocate_ptr(blocked_out_gpu);
+      provider.deallocate_ptr(out_gpu);
+    };
+
+    try {
+      auto status = sycldnn::depthwise_conv2d::launch<DataType, ConvType>(
+          inp_gpu, fil_gpu, exp_out_gpu, params, backend);
+      ASSERT_EQ(sycldnn::StatusCode::OK, status.status);
+      status.event.wait_and_throw();
+
+      auto const nhwc = sycldnn::DataFormat::NHWC;
+      convert(inp_gpu, blocked_inp_gpu, dims.input, conv_sizes.input_size,
+              nhwc, format);
+      convert(fil_gpu, blocked_fil_gpu, dims.filter, conv_sizes.filter_size,
+              nhwc, format);
+
+      auto blocked_params = params;
+      blocked_params.input_format = format;
+      status = sycldnn::depthwise_conv2d::launch<DataType, ConvType>(
+          blocked_inp_gpu, blocked_fil_gpu, blocked_out_gpu, blocked_params,
+          backend);
+      ASSERT_EQ(sycldnn::StatusCode::OK, status.status);
+      status.event.wait_and_throw();
+
+      convert(blocked_out_gpu, out_gpu, dims.output, conv_sizes.output_size,
+              format, nhwc);
+    } catch (cl::sycl::exception const& e) {
+      throw std::runtime_error(e.what());
+    }
+    provider.copy_device_data_to_host(conv_sizes.output_size, exp_out_gpu,
+                                      exp_output);
+    provider.copy_device_data_to_host(conv_sizes.output_size, out_gpu, output);
+
+    for (size_t i = 0; i < exp_output.size(); ++i) {
+      SCOPED_TRACE("Element: " + std::to_string(i));
+      SNN_ALMOST_EQUAL(exp_output[i], output[i], 10u);
+    }
+  }
+};
+
+TYPED_TEST_SUITE(BlockedDepthwise, sycldnn::types::GTestKernelDataTypes);
+
+TYPED_TEST(BlockedDepthwise, ForwardWindow3NCHW4) {
+  this->template test_blocked<Forward>(get_params(3, 1, 8, 1),
+                                       sycldnn::DataFormat::NCHW4);
+}
+TYPED_TEST(BlockedDepthwise, ForwardWindow3Stride2Multiplier2NCHW8) {
+  this->template test_blocked<Forward>(get_params(3, 2, 8, 2),
+                                       sycldnn::DataFormat::NCHW8);
+}
+TYPED_TEST(BlockedDepthwise, ForwardWindow5NCHW16) {
+  this->template test_blocked<Forward>(get_params(5, 1, 32, 1),
+                                       sycldnn::DataFormat::NCHW16);
+}
+TYPED_TEST(BlockedDepthwise, ForwardRegisterTiledWindow3NCHW8) {
+  auto params = get_params(3, 1, 16, 1);
+  params.algorithm = sycldnn::depthwise_conv2d::Algorithm::RegisterTiled;
+  this->template test_blocked<Forward>(params, sycldnn::DataFormat::NCHW8);
+}
+TYPED_TEST(BlockedDepthwise, InputBackpropWindow3NCHW4) {
+  this->template test_blocked<InputBackprop>(get_params(3, 1, 8, 1),
+                                             sycldnn::DataFormat::NCHW4);
+}
+TYPED_TEST(BlockedDepthwise, FilterBackpropWindow3NCHW8) {
+  this->template test_blocked<FilterBackprop>(get_params(3, 1, 16, 1),
+                                              sycldnn::DataFormat::NCHW8);
+}
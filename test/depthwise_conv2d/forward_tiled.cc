@@ -0,0 +1,207 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <gtest/gtest.h>
+
+#include "sycldnn/conv2d/conv_type.h"
+
+#include "sycldnn/backend/snn_backend.h"
+
+#include "sycldnn/depthwise_conv2d/algorithm.h"
+#include "sycldnn/depthwise_conv2d/params.h"
+#include "sycldnn/depthwise_conv2d/sizes.h"
+
+#include "test/depthwise_conv2d/depthwise_conv2d_fixture.h"
+#include "test/gen/iota_initialised_data.h"
+
+#include "test/types/cartesian_product.h"
+#include "test/types/kernel_data_types.h"
+#include "test/types/to_gtest_types.h"
+#include "test/types/type_list.h"
+
+#include <vector>
+
+namespace {
+
+sycldnn::depthwise_conv2d::DepthwiseConv2DParams get_params(
+    int batch, int rows, int cols, int channels, int window, int stride,
+    bool same_padding) {
+  sycldnn::depthwise_conv2d::DepthwiseConv2DParams params;
+  params.channels = channels;
+  params.channel_multiplier = 1;
+  params.batch = batch;
+  params.in_rows = rows;
+  params.in_cols = cols;
+  params.window_rows = window;
+  params.window_cols = window;
+  params.stride_rows = stride;
+  params.stride_cols = stride;
+  params.pad_rows = same_padding ? window / 2 : 0;
+  params.pad_cols = same_padding ? window / 2 : 0;
+  params.out_rows = (rows + 2 * params.pad_rows - window) / stride + 1;
+  params.out_cols = (cols + 2 * params.pad_cols - window) / stride + 1;
+  return params;
+}
+
+/**
+ * Compute the forward depthwise convolution on the host, for the input and
+ * filter values used by the fixture.
+ */
+template <typename DataType>
+std::vector<DataType> reference_forward(
+    sycldnn::depthwise_conv2d::DepthwiseConv2DParams const& p,
+    DataType max_val) {
+  using ConvType = sycldnn::conv2d::conv_type::Forward;
+  auto sizes = sycldnn::depthwise_conv2d::get_sizes<ConvType>(p);
+  std::vector<DataType> input =
+      iota_initialised_data(sizes.input_size, max_val);
+  std::vector<DataType> filter =
+      iota_initialised_data(sizes.filter_size, max_val);
+  std::vector<DataType> output(sizes.output_size);
+  for (int b = 0; b < p.batch; ++b) {
+    for (int r = 0; r < p.out_rows; ++r) {
+      for (int c = 0; c < p.out_cols; ++c) {
+        for (int ch = 0; ch < p.channels; ++ch) {
+          double sum = 0;
+          for (int i = 0; i < p.window_rows; ++i) {
+            int const in_r = r * p.stride_rows - p.pad_rows + i;
+            for (int j = 0; j < p.window_cols; ++j) {
+              int const in_c = c * p.stride_cols - p.pad_cols + j;
+              if (in_r >= 0 && in_r < p.in_rows && in_c >= 0 &&
+                  in_c < p.in_cols) {
+                size_t const in_idx =
+                    ((static_cast<size_t>(b) * p.in_rows + in_r) * p.in_cols +
+                     in_c) *
+                        p.channels +
+                    ch;
+                size_t const fil_idx =
+                    (static_cast<size_t>(i) * p.window_cols + j) * p.channels +
+                    ch;
+                sum += static_cast<double>(input[in_idx]) *
+                       static_cast<double>(filter[fil_idx]);
+              }
+            }
+          }
+          size_t const out_idx =
+              ((static_cast<size_t>(b) * p.out_rows + r) * p.out_cols + c) *
+                  p.channels +
+              ch;
+          output[out_idx] = static_cast<DataType>(sum);
+        }
+      }
+    }
+  }
+  return output;
+}
+
+}  // namespace
+
+/**
+ * Forward depthwise convolutions with shapes which use the tiled kernels,
+ * including images and channel counts which do not fill the last tile. The
+ * expected values are computed on the host. The tiled kernel is requested
+ * explicitly, so the tests are skipped on devices which cannot run it rather
+ * than silently testing the direct kernel.
+ */
+template <typename Pair>
+struct TiledDepthwiseForward
+    : public sycldnn::depthwise_conv2d::DepthwiseConv2DFixture<Pair> {
+  using DataType = typename Pair::FirstType;
+
+ protected:
+  void run(int batch, int rows, int cols, int channels, int window, int stride,
+           bool same_padding,
+           sycldnn::depthwise_conv2d::Algorithm algorithm =
+               sycldnn::depthwise_conv2d::Algorithm::LocalTiled) {
+    auto params =
+        get_params(batch, rows, cols, channels, window, stride, same_padding);
+    params.algorithm = algorithm;
+    // Keep the values small so that the sums are exact in half precision.
+    DataType const max_val = static_cast<DataType>(4);
+    auto exp = reference_forward(params, max_val);
+    this->template test_conv<sycldnn::conv2d::conv_type::Forward>(exp, params,
+                                                                  max_val);
+  }
+};
+
+using DataTypeList = sycldnn::types::KernelDataTypes;
+using Backends = sycldnn::types::TypeList<sycldnn::backend::SNNBackend>;
+
+using BackendTypePairs =
+    sycldnn::types::CartesianProduct<DataTypeList, Backends>::type;
+using GTestTypePairs = sycldnn::types::ToGTestTypes<BackendTypePairs>::type;
+TYPED_TEST_SUITE(TiledDepthwiseForward, GTestTypePairs);
+
+template <typename Pair>
+struct RegisterTiledDepthwiseForward : public TiledDepthwiseForward<Pair> {
+ protected:
+  void run(int batch, int rows, int cols, int channels, int window, int stride,
+           bool same_padding) {
+    TiledDepthwiseForward<Pair>::run(
+        batch, rows, cols, channels, window, stride, same_padding,
+        sycldnn::depthwise_conv2d::Algorithm::RegisterTiled);
+  }
+};
+TYPED_TEST_SUITE(RegisterTiledDepthwiseForward, GTestTypePairs);
+
+TYPED_TEST(TiledDepthwiseForward, Window3Stride1Same) {
+  this->run(2, 16, 16, 32, 3, 1, true);
+}
+TYPED_TEST(TiledDepthwiseForward, Window3Stride1Valid) {
+  this->run(1, 11, 13, 24, 3, 1, false);
+}
+TYPED_TEST(TiledDepthwiseForward, Window3Stride2Same) {
+  this->run(1, 15, 17, 16, 3, 2, true);
+}
+TYPED_TEST(TiledDepthwiseForward, Window3Stride2Valid) {
+  this->run(2, 14, 14, 40, 3, 2, false);
+}
+TYPED_TEST(TiledDepthwiseForward, Window5Stride1Same) {
+  this->run(1, 7, 7, 48, 5, 1, true);
+}
+TYPED_TEST(TiledDepthwiseForward, Window5Stride1Valid) {
+  this->run(1, 12, 20, 8, 5, 1, false);
+}
+TYPED_TEST(TiledDepthwiseForward, Window5Stride2Same) {
+  this->run(2, 19, 19, 20, 5, 2, true);
+}
+TYPED_TEST(TiledDepthwiseForward, Window5Stride2Valid) {
+  this->run(1, 21, 18, 16, 5, 2, false);
+}
+
+TYPED_TEST(RegisterTiledDepthwiseForward, Window3Stride1Same) {
+  this->run(2, 16, 16, 32, 3, 1, true);
+}
+TYPED_TEST(RegisterTiledDepthwiseForward, Window3Stride1Valid) {
+  this->run(1, 11, 13, 6, 3, 1, false);
+}
+TYPED_TEST(RegisterTiledDepthwiseForward, Window3Stride2Same) {
+  this->run(1, 15, 17, 3, 3, 2, true);
+}
+TYPED_TEST(RegisterTiledDepthwiseForward, Window3Stride2Valid) {
+  this->run(2, 14, 14, 40, 3, 2, false);
+}
+TYPED_TEST(RegisterTiledDepthwiseForward, Window5Stride1Same) {
+  this->run(1, 7, 7, 12, 5, 1, true);
+}
+TYPED_TEST(RegisterTiledDepthwiseForward, Window5Stride1Valid) {
+  this->run(1, 12, 20, 5, 5, 1, false);
+}
+TYPED_TEST(RegisterTiledDepthwiseForward, Window5Stride2Same) {
+  this->run(2, 19, 19, 18, 5, 2, true);
+}
+TYPED_TEST(RegisterTiledDepthwiseForward, Window5Stride2Valid) {
+  this->run(1, 21, 18, 16, 5, 2, false);
+}
@@ -0,0 +1,170 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <gtest/gtest.h>
+#include <vector>
+
+#include "sycldnn/backend/snn_backend.h"
+#include "sycldnn/helpers/scope_exit.h"
+#include "sycldnn/matmul/launch.h"
+
+#include "test/backend/backend_test_fixture.h"
+#include "test/gen/iota_initialised_data.h"
+#include "test/helpers/float_comparison.h"
+#include "test/types/kernel_data_types.h"
+#include "test/types/to_gtest_types.h"
+
+/**
+ * Matrix multiplies which are large enough to use the work-group tiled kernel
+ * on devices with local memory. The expected values are computed on the host.
+ */
+template <typename T>
+struct MatmulLarge : public BackendTestFixture<sycldnn::backend::SNNBackend> {
+  using DataType = T;
+
+ protected:
+  template <bool TransposeLHS, bool TransposeRHS>
+  void run(int batches, int m, int k, int n, DataType beta,
+           DataType max_val = static_cast<DataType>(4),
+           bool use_workspace = false) {
+    // Keep the values small so that all results are exactly representable,
+    // even in half precision.
+    size_t lhs_size = batches * m * k;
+    size_t rhs_size = batches * k * n;
+    size_t out_size = batches * m * n;
+
+    std::vector<DataType> lhs_data = iota_initialised_data(lhs_size, max_val);
+    std::vector<DataType> rhs_data = iota_initialised_data(rhs_size, max_val);
+    std::vector<DataType> out_data = iota_initialised_data(out_size, max_val);
+
+    std::vector<DataType> exp(out_size);
+    for (int b = 0; b < batches; ++b) {
+      for (int row = 0; row < m; ++row) {
+        for (int col = 0; col < n; ++col) {
+          int const out_idx = b * m * n + row * n + col;
+          DataType val = beta * out_data[out_idx];
+          for (int acc = 0; acc < k; ++acc) {
+            int const lhs_idx = b * m * k + (TransposeLHS ? acc * m + row
+                                                          : row * k + acc);
+            int const rhs_idx = b * k * n + (TransposeRHS ? col * k + acc
+                                                          : acc * n + col);
+            val += lhs_data[lhs_idx] * rhs_data[rhs_idx];
+          }
+          exp[out_idx] = val;
+        }
+      }
+    }
+
+    auto& provider = this->provider_;
+    auto& backend = provider.get_backend();
+
+    {
+      auto lhs_gpu = provider.get_initialised_device_memory(lhs_size, lhs_data);
+      auto rhs_gpu = provider.get_initialised_device_memory(rhs_size, rhs_data);
+      auto out_gpu = provider.get_initialised_device_memory(out_size, out_data);
+      SNN_ON_SCOPE_EXIT {
+        provider.deallocate_ptr(lhs_gpu);
+        provider.deallocate_ptr(rhs_gpu);
+        provider.deallocate_ptr(out_gpu);
+      };
+
+      size_t const workspace_size =
+          use_workspace ? sycldnn::matmul::query_workspace_size<DataType>(
+                              batches, m, k, n, backend)
+                        : 0;
+      std::vector<DataType> workspace_data(workspace_size);
+      auto workspace_gpu = provider.get_initialised_device_memory(
+          workspace_size, workspace_data);
+      SNN_ON_SCOPE_EXIT { provider.deallocate_ptr(workspace_gpu); };
+
+      auto status =
+          use_workspace
+              ? sycldnn::matmul::launch<DataType, TransposeLHS, TransposeRHS>(
+                    lhs_gpu, rhs_gpu, out_gpu, workspace_gpu, batches, m, k, n,
+                    beta, workspace_size, backend)
+              : sycldnn::matmul::launch<DataType, TransposeLHS, TransposeRHS>(
+                    lhs_gpu, rhs_gpu, out_gpu, batches, m, k, n, beta,
+                    backend);
+
+      ASSERT_EQ(sycldnn::StatusCode::OK, status.status);
+      status.event.wait_and_throw();
+
+      provider.copy_device_data_to_host(out_size, out_gpu, out_data);
+    }
+
+    for (size_t i = 0; i < exp.size(); ++i) {
+      SCOPED_TRACE("Element: " + std::to_string(i));
+      SNN_ALMOST_EQUAL(exp[i], out_data[i], 10u);
+    }
+  }
+};
+
+using DataTypeList = sycldnn::types::KernelDataTypes;
+using GTestTypeList = sycldnn::types::ToGTestTypes<DataTypeList>::type;
+TYPED_TEST_SUITE(MatmulLarge, GTestTypeList);
+
+TYPED_TEST(MatmulLarge, M64xK48xN96) {
+  using DataType = typename TestFixture::DataType;
+  this->template run<false, false>(1, 64, 48, 96, DataType{0});
+}
+TYPED_TEST(MatmulLarge, M64xK48xN96TransposeLHS) {
+  using DataType = typename TestFixture::DataType;
+  this->template run<true, false>(1, 64, 48, 96, DataType{0});
+}
+TYPED_TEST(MatmulLarge, M64xK48xN96TransposeRHS) {
+  using DataType = typename TestFixture::DataType;
+  this->template run<false, true>(1, 64, 48, 96, DataType{0});
+}
+TYPED_TEST(MatmulLarge, M64xK48xN96TransposeBoth) {
+  using DataType = typename TestFixture::DataType;
+  this->template run<true, true>(1, 64, 48, 96, DataType{0});
+}
+TYPED_TEST(MatmulLarge, Batch2M37xK53xN70Beta1) {
+  using DataType = typename TestFixture::DataType;
+  this->template run<false, false>(2, 37, 53, 70, DataType{1});
+}
+TYPED_TEST(MatmulLarge, Batch2M37xK53xN70Beta1TransposeBoth) {
+  using DataType = typename TestFixture::DataType;
+  this->template run<true, true>(2, 37, 53, 70, DataType{1});
+}
+TYPED_TEST(MatmulLarge, M33xK7xN65) {
+  using DataType = typename TestFixture::DataType;
+  this->template run<false, true>(1, 33, 7, 65, DataType{0});
+}
+// Small outputs with a long accumulation dimension use the split-K kernels.
+// All values are one so that the long sums are exact in half precision.
+TYPED_TEST(MatmulLarge, M9xK2000xN16) {
+  using DataType = typename TestFixture::DataType;
+  this->template run<false, false>(1, 9, 2000, 16, DataType{0}, DataType{1});
+}
+TYPED_TEST(MatmulLarge, M9xK2000xN16TransposeLHS) {
+  using DataType = typename TestFixture::DataType;
+  this->template run<true, false>(1, 9, 2000, 16, DataType{0}, DataType{1});
+}
+TYPED_TEST(MatmulLarge, Batch2M16xK1537xN3Beta1TransposeRHS) {
+  using DataType = typename TestFixture::DataType;
+  this->template run<false, true>(2, 16, 1537, 3, DataType{1}, DataType{1});
+}
+// The split-K partial products can be held in a user provided workspace.
+TYPED_TEST(MatmulLarge, M9xK2000xN16Workspace) {
+  using DataType = typename TestFixture::DataType;
+  this->template run<false, false>(1, 9, 2000, 16, DataType{0}, DataType{1},
+                                   true);
+}
+TYPED_TEST(MatmulLarge, Batch2M16xK1537xN3Beta1WorkspaceTransposeRHS) {
+  using DataType = typename TestFixture::DataType;
+  this->template run<false, true>(2, 16, 1537, 3, DataType{1}, DataType{1},
+                                  true);
+}
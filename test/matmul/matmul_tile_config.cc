@@ -0,0 +1,210 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <gtest/gtest.h>
+
+#include "sycldnn/backend/snn_backend.h"
+#include "sycldnn/helpers/scope_exit.h"
+#include "sycldnn/matmul/launch.h"
+#include "sycldnn/matmul/tile_config.h"
+#include "sycldnn/matmul/tile_table.h"
+#include "sycldnn/matmul/tune.h"
+
+#include "test/backend/backend_test_fixture.h"
+#include "test/gen/iota_initialised_data.h"
+#include "test/helpers/float_comparison.h"
+
+#include <cstdio>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace {
+
+/** Temporary table file which is removed at the end of each test. */
+struct TempTableFile {
+  explicit TempTableFile(std::string name) : filename{std::move(name)} {
+    std::remove(filename.c_str());
+  }
+  ~TempTableFile() { std::remove(filename.c_str()); }
+  std::string filename;
+};
+
+/**
+ * Check that every candidate tile configuration which the device can run
+ * computes the same result as the host. The sizes are chosen so that all
+ * compiled tile shapes need bounds checks.
+ */
+struct MatmulTileConfig
+    : public BackendTestFixture<sycldnn::backend::SNNBackend> {
+ protected:
+  void run(sycldnn::matmul::TileConfig const& config, int m, int k, int n) {
+    auto const max_val = 4.f;
+    size_t lhs_size = m * k;
+    size_t rhs_size = k * n;
+    size_t out_size = m * n;
+
+    std::vector<float> lhs_data = iota_initialised_data(lhs_size, max_val);
+    std::vector<float> rhs_data = iota_initialised_data(rhs_size, max_val);
+    std::vector<float> out_data(out_size, 0.f);
+
+    std::vector<float> exp(out_size, 0.f);
+    for (int row = 0; row < m; ++row) {
+      for (int col = 0; col < n; ++col) {
+        for (int acc = 0; acc < k; ++acc) {
+          exp[row * n + col] +=
+              lhs_data[row * k + acc] * rhs_data[acc * n + col];
+        }
+      }
+    }
+
+    auto& provider = this->provider_;
+    auto& backend = provider.get_backend();
+    {
+      auto lhs_gpu = provider.get_initialised_device_memory(lhs_size, lhs_data);
+      auto rhs_gpu = provider.get_initialised_device_memory(rhs_size, rhs_data);
+      auto out_gpu = provider.get_initialised_device_memory(out_size, out_data);
+      SNN_ON_SCOPE_EXIT {
+        provider.deallocate_ptr(lhs_gpu);
+        provider.deallocate_ptr(rhs_gpu);
+        provider.deallocate_ptr(out_gpu);
+      };
+
+      auto status = sycldnn::matmul::launch<float, false, false>(
+          lhs_gpu, rhs_gpu, out_gpu, 1, m, k, n, 0.f, backend, config);
+      if (status.status == sycldnn::StatusCode::InvalidAlgorithm) {
+        // The device cannot run this configuration.
+        return;
+      }
+      ASSERT_EQ(sycldnn::StatusCode::OK, status.status);
+      status.event.wait_and_throw();
+
+      provider.copy_device_data_to_host(out_size, out_gpu, out_data);
+    }
+
+    for (size_t i = 0; i < exp.size(); ++i) {
+      SCOPED_TRACE("Element: " + std::to_string(i));
+      SNN_ALMOST_EQUAL(exp[i], out_data[i], 10u);
+    }
+  }
+};
+
+}  // namespace
+
+TEST(TileTableTest, ConfigStringsRoundTrip) {
+  for (auto const& config : sycldnn::matmul::get_tile_candidates()) {
+    EXPECT_TRUE(sycldnn::matmul::is_compiled(config));
+    sycldnn::matmul::TileConfig parsed;
+    ASSERT_TRUE(sycldnn::matmul::tile_config_from_string(
+        sycldnn::matmul::to_string(config), parsed));
+    EXPECT_EQ(config, parsed);
+  }
+  sycldnn::matmul::TileConfig parsed;
+  EXPECT_FALSE(sycldnn::matmul::tile_config_from_string("4,4,4", parsed));
+}
+
+TEST(TileTableTest, KeysAreBucketedByShape) {
+  using sycldnn::matmul::make_tile_table_key;
+  auto key =
+      make_tile_table_key("dev", "float", false, false, 3, 100, 200, 300);
+  auto float_key = [](int batches, int m, int k, int n) {
+    return make_tile_table_key("dev", "float", false, false, batches, m, k, n);
+  };
+  EXPECT_EQ(key, float_key(4, 128, 129, 512));
+  EXPECT_NE(key, float_key(3, 129, 200, 300));
+  EXPECT_NE(key, float_key(5, 100, 200, 300));
+  EXPECT_NE(key,
+            make_tile_table_key("dev", "float", true, false, 3, 100, 200, 300));
+  EXPECT_NE(key,
+            make_tile_table_key("dev", "float", false, true, 3, 100, 200, 300));
+  EXPECT_NE(key,
+            make_tile_table_key("dev", "half", false, false, 3, 100, 200, 300));
+  EXPECT_NE(key, make_tile_table_key("dev2", "float", false, false, 3, 100,
+                                     200, 300));
+}
+
+TEST(TileTableTest, EntriesPersistToFile) {
+  TempTableFile file{"snn_matmul_tile_table_test.txt"};
+  auto key = sycldnn::matmul::make_tile_table_key("dev", "float", false, true,
+                                                  1, 1, 64, 8);
+  sycldnn::matmul::TileConfig config;
+  config.row_tile = 1;
+  config.wg_rows = 1;
+  config.wg_cols = 64;
+  {
+    sycldnn::matmul::TileTable table{file.filename};
+    sycldnn::matmul::TileConfig found;
+    EXPECT_FALSE(table.lookup(key, found));
+    EXPECT_TRUE(table.insert(key, config));
+    ASSERT_TRUE(table.lookup(key, found));
+    EXPECT_EQ(config, found);
+  }
+  sycldnn::matmul::TileTable reloaded{file.filename};
+  EXPECT_EQ(1u, reloaded.size());
+  sycldnn::matmul::TileConfig found;
+  ASSERT_TRUE(reloaded.lookup(key, found));
+  EXPECT_EQ(config, found);
+}
+
+TEST_F(MatmulTileConfig, AllCandidatesMatchHost) {
+  for (auto const& config : sycldnn::matmul::get_tile_candidates()) {
+    SCOPED_TRACE("Config: " + sycldnn::matmul::to_string(config));
+    this->run(config, 37, 19, 45);
+  }
+}
+
+TEST_F(MatmulTileConfig, MatrixVectorCandidatesMatchHost) {
+  for (auto const& config : sycldnn::matmul::get_tile_candidates()) {
+    SCOPED_TRACE("Config: " + sycldnn::matmul::to_string(config));
+    this->run(config, 1, 67, 45);
+    this->run(config, 45, 67, 1);
+  }
+}
+
+TEST_F(MatmulTileConfig, UncompiledConfigIsRejected) {
+  sycldnn::matmul::TileConfig config;
+  config.row_tile = 3;
+  auto& provider = this->provider_;
+  auto& backend = provider.get_backend();
+  std::vector<float> data(16, 0.f);
+  auto gpu = provider.get_initialised_device_memory(data.size(), data);
+  SNN_ON_SCOPE_EXIT { provider.deallocate_ptr(gpu); };
+  auto status = sycldnn::matmul::launch<float, false, false>(
+      gpu, gpu, gpu, 1, 4, 4, 1, 0.f, backend, config);
+  EXPECT_EQ(sycldnn::StatusCode::InvalidAlgorithm, status.status);
+}
+
+TEST_F(MatmulTileConfig, TunedConfigIsStoredAndUsed) {
+  TempTableFile file{"snn_matmul_tune_test.txt"};
+  auto& backend = this->provider_.get_backend();
+  sycldnn::matmul::TileTable table{file.filename};
+  sycldnn::matmul::TileConfig best;
+  // No candidates means nothing can be timed.
+  EXPECT_FALSE((sycldnn::matmul::tune<float, false, false>(
+      1, 40, 24, 50, backend, table, best, {}, 1)));
+  EXPECT_EQ(0u, table.size());
+
+  ASSERT_TRUE((sycldnn::matmul::tune<float, false, false>(
+      1, 40, 24, 50, backend, table, best)));
+  EXPECT_TRUE(sycldnn::matmul::is_compiled(best));
+  EXPECT_EQ(1u, table.size());
+
+  auto key = sycldnn::matmul::make_tile_table_key(
+      sycldnn::matmul::get_device_id(backend.get_queue().get_device()),
+      "float", false, false, 1, 40, 24, 50);
+  sycldnn::matmul::TileConfig found;
+  ASSERT_TRUE(table.lookup(key, found));
+  EXPECT_EQ(best, found);
+}
@@ -0,0 +1,292 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef SYCLDNN_TEST_NORMALIZATION_NORMALIZATION_FIXTURE_H_
+#define SYCLDNN_TEST_NORMALIZATION_NORMALIZATION_FIXTURE_H_
+
+#include <gtest/gtest.h>
+
+#include "sycldnn/data_format.h"
+#include "sycldnn/status.h"
+
+#include "sycldnn/backend/snn_backend.h"
+
+#include "sycldnn/helpers/scope_exit.h"
+
+#include "sycldnn/normalization/direction.h"
+#include "sycldnn/normalization/launch.h"
+#include "sycldnn/normalization/params.h"
+
+#include "test/backend/backend_test_fixture.h"
+#include "test/gen/iota_initialised_data.h"
+#include "test/helpers/float_comparison.h"
+
+#include <stddef.h>
+#include <cmath>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+inline sycldnn::normalization::NormalizationParams get_norm_params(
+    sycldnn::normalization::NormType type, int batch, int rows, int cols,
+    int channels, int groups, sycldnn::DataFormat format) {
+  sycldnn::normalization::NormalizationParams params;
+  params.batch = batch;
+  params.rows = rows;
+  params.cols = cols;
+  params.channels = channels;
+  params.type = type;
+  params.groups = groups;
+  params.input_format = format;
+  return params;
+}
+
+/**
+ * Compares layer, group and instance normalizations and their gradients
+ * against a reference computed on the host in double precision.
+ */
+template <typename T>
+struct NormalizationFixture
+    : public BackendTestFixture<sycldnn::backend::SNNBackend> {
+  using DataType = T;
+
+ protected:
+  /** Absolute tolerance for values which are close to zero. */
+  static double tolerance() {
+    return std::is_same<DataType, double>::value
+               ? 1e-8
+               : std::is_same<DataType, float>::value ? 1e-4 : 2e-2;
+  }
+
+  void test_forward(sycldnn::normalization::NormalizationParams const& params) {
+    Shape const shape{params};
+    size_t const size = shape.size();
+    size_t const channels = params.channels;
+
+    std::vector<DataType> input =
+        iota_initialised_data(size, static_cast<DataType>(7));
+    std::vector<DataType> beta =
+        iota_initialised_data(channels, static_cast<DataType>(3));
+    std::vector<DataType> gamma =
+        iota_initialised_data(channels, static_cast<DataType>(2));
+    std::vector<DataType> output(size);
+
+    std::vector<DataType> exp(size);
+    for (int n = 0; n < params.batch; ++n) {
+      for (int g = 0; g < shape.groups; ++g) {
+        double mean, inv_stddev;
+        shape.statistics(input, n, g, params.epsilon, mean, inv_stddev);
+        for (int c = g * shape.group_channels;
+             c < (g + 1) * shape.group_channels; ++c) {
+          for (int p = 0; p < shape.spatial; ++p) {
+            size_t const idx = shape.offset(n, c, p);
+            double const x_hat =
+                (static_cast<double>(input[idx]) - mean) * inv_stddev;
+            exp[idx] = static_cast<DataType>(
+                x_hat * static_cast<double>(gamma[c]) +
+                static_cast<double>(beta[c]));
+          }
+        }
+      }
+    }
+
+    auto& provider = this->provider_;
+    auto& backend = provider.get_backend();
+    {
+      auto inp_gpu = provider.get_initialised_device_memory(size, input);
+      auto beta_gpu = provider.get_initialised_device_memory(channels, beta);
+      auto gamma_gpu = provider.get_initialised_device_memory(channels, gamma);
+      auto out_gpu = provider.get_initialised_device_memory(size, output);
+      SNN_ON_SCOPE_EXIT {
+        provider.deallocate_ptr(inp_gpu);
+        provider.deallocate_ptr(beta_gpu);
+        provider.deallocate_ptr(gamma_gpu);
+        provider.deallocate_ptr(out_gpu);
+      };
+
+      auto status = sycldnn::normalization::launch<
+          DataType, sycldnn::normalization::Forward>(
+          inp_gpu, beta_gpu, gamma_gpu, out_gpu, params, backend);
+      ASSERT_EQ(sycldnn::StatusCode::OK, status.status);
+      status.event.wait_and_throw();
+
+      provider.copy_device_data_to_host(size, out_gpu, output);
+    }
+
+    for (size_t i = 0; i < size; ++i) {
+      SCOPED_TRACE("Element: " + std::to_string(i));
+      SNN_ALMOST_EQUAL_EPS(exp[i], output[i], 10u, tolerance());
+    }
+  }
+
+  void test_gradient(
+      sycldnn::normalization::NormalizationParams const& params) {
+    Shape const shape{params};
+    size_t const size = shape.size();
+    size_t const channels = params.channels;
+
+    std::vector<DataType> input =
+        iota_initialised_data(size, static_cast<DataType>(7));
+    std::vector<DataType> gradient =
+        iota_initialised_data(size, static_cast<DataType>(3));
+    std::vector<DataType> gamma =
+        iota_initialised_data(channels, static_cast<DataType>(2));
+    std::vector<DataType> beta_grad(channels);
+    std::vector<DataType> gamma_grad(channels);
+    std::vector<DataType> output(size);
+
+    std::vector<DataType> exp(size);
+    std::vector<double> exp_beta_grad(channels);
+    std::vector<double> exp_gamma_grad(channels);
+    for (int n = 0; n < params.batch; ++n) {
+      for (int g = 0; g < shape.groups; ++g) {
+        double mean, inv_stddev;
+        shape.statistics(input, n, g, params.epsilon, mean, inv_stddev);
+        int const first_channel = g * shape.group_channels;
+        int const last_channel = first_channel + shape.group_channels;
+
+        double grad_sum = 0;
+        double grad_x_hat_sum = 0;
+        for (int c = first_channel; c < last_channel; ++c) {
+          for (int p = 0; p < shape.spatial; ++p) {
+            size_t const idx = shape.offset(n, c, p);
+            double const dy = static_cast<double>(gradient[idx]);
+            double const x_hat =
+                (static_cast<double>(input[idx]) - mean) * inv_stddev;
+            double const grad = dy * static_cast<double>(gamma[c]);
+            grad_sum += grad;
+            grad_x_hat_sum += grad * x_hat;
+            exp_beta_grad[c] += dy;
+            exp_gamma_grad[c] += dy * x_hat;
+          }
+        }
+        double const n_values =
+            static_cast<double>(shape.group_channels) * shape.spatial;
+        double const grad_mean = grad_sum / n_values;
+        double const grad_x_hat_mean = grad_x_hat_sum / n_values;
+        for (int c = first_channel; c < last_channel; ++c) {
+          for (int p = 0; p < shape.spatial; ++p) {
+            size_t const idx = shape.offset(n, c, p);
+            double const x_hat =
+                (static_cast<double>(input[idx]) - mean) * inv_stddev;
+            double const grad = static_cast<double>(gradient[idx]) *
+                                static_cast<double>(gamma[c]);
+            exp[idx] = static_cast<DataType>(
+                inv_stddev * (grad - grad_mean - x_hat * grad_x_hat_mean));
+          }
+        }
+      }
+    }
+
+    auto& provider = this->provider_;
+    auto& backend = provider.get_backend();
+    {
+      auto inp_gpu = provider.get_initialised_device_memory(size, input);
+      auto grad_gpu = provider.get_initialised_device_memory(size, gradient);
+      auto gamma_gpu = provider.get_initialised_device_memory(channels, gamma);
+      auto beta_grad_gpu =
+          provider.get_initialised_device_memory(channels, beta_grad);
+      auto gamma_grad_gpu =
+          provider.get_initialised_device_memory(channels, gamma_grad);
+      auto out_gpu = provider.get_initialised_device_memory(size, output);
+      SNN_ON_SCOPE_EXIT {
+        provider.deallocate_ptr(inp_gpu);
+        provider.deallocate_ptr(grad_gpu);
+        provider.deallocate_ptr(gamma_gpu);
+        provider.deallocate_ptr(beta_grad_gpu);
+        provider.deallocate_ptr(gamma_grad_gpu);
+        provider.deallocate_ptr(out_gpu);
+      };
+
+      auto status = sycldnn::normalization::launch<
+          DataType, sycldnn::normalization::Gradient>(
+          inp_gpu, grad_gpu, gamma_gpu, beta_grad_gpu, gamma_grad_gpu,
+          out_gpu, params, backend);
+      ASSERT_EQ(sycldnn::StatusCode::OK, status.status);
+      status.event.wait_and_throw();
+
+      provider.copy_device_data_to_host(size, out_gpu, output);
+      provider.copy_device_data_to_host(channels, beta_grad_gpu, beta_grad);
+      provider.copy_device_data_to_host(channels, gamma_grad_gpu, gamma_grad);
+    }
+
+    for (size_t i = 0; i < size; ++i) {
+      SCOPED_TRACE("Element: " + std::to_string(i));
+      SNN_ALMOST_EQUAL_EPS(exp[i], output[i], 10u, tolerance());
+    }
+    // The beta and gamma gradients sum over the batch and spatial dimensions,
+    // so the tolerance grows with the number of values summed.
+    double const sum_tolerance = tolerance() * params.batch * shape.spatial;
+    for (size_t c = 0; c < channels; ++c) {
+      SCOPED_TRACE("Channel: " + std::to_string(c));
+      SNN_ALMOST_EQUAL_EPS(static_cast<DataType>(exp_beta_grad[c]),
+                           beta_grad[c], 10u, sum_tolerance);
+      SNN_ALMOST_EQUAL_EPS(static_cast<DataType>(exp_gamma_grad[c]),
+                           gamma_grad[c], 10u, sum_tolerance);
+    }
+  }
+
+ private:
+  /** Host side view of the tensor and its normalization groups. */
+  struct Shape {
+    explicit Shape(sycldnn::normalization::NormalizationParams const& params)
+        : batch{params.batch},
+          channels{params.channels},
+          spatial{params.rows * params.cols},
+          groups{sycldnn::normalization::get_groups(params)},
+          group_channels{params.channels / groups},
+          is_nchw{params.input_format == sycldnn::DataFormat::NCHW} {}
+
+    size_t size() const {
+      return static_cast<size_t>(batch) * channels * spatial;
+    }
+
+    size_t offset(int n, int c, int p) const {
+      return is_nchw ? (static_cast<size_t>(n) * channels + c) * spatial + p
+                     : (static_cast<size_t>(n) * spatial + p) * channels + c;
+    }
+
+    /** Compute the mean and inverse standard deviation of a group. */
+    void statistics(std::vector<DataType> const& input, int n, int g,
+                    float epsilon, double& mean, double& inv_stddev) const {
+      double const n_values = static_cast<double>(group_channels) * spatial;
+      double sum = 0;
+      for (int c = g * group_channels; c < (g + 1) * group_channels; ++c) {
+        for (int p = 0; p < spatial; ++p) {
+          sum += static_cast<double>(input[offset(n, c, p)]);
+        }
+      }
+      mean = sum / n_values;
+      double square_sum = 0;
+      for (int c = g * group_channels; c < (g + 1) * group_channels; ++c) {
+        for (int p = 0; p < spatial; ++p) {
+          double const diff =
+              static_cast<double>(input[offset(n, c, p)]) - mean;
+          square_sum += diff * diff;
+        }
+      }
+      inv_stddev = 1. / std::sqrt(square_sum / n_values + epsilon);
+    }
+
+    int batch;
+    int channels;
+    int spatial;
+    int groups;
+    int group_channels;
+    bool is_nchw;
+  };
+};
+
+#endif  // SYCLDNN_TEST_NORMALIZATION_NORMALIZATION_FIXTURE_H_
@@ -0,0 +1,80 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <gtest/gtest.h>
+
+#include "sycldnn/data_format.h"
+
+#include "sycldnn/normalization/params.h"
+
+#include "test/normalization/normalization_fixture.h"
+
+#include "test/types/kernel_data_types.h"
+#include "test/types/to_gtest_types.h"
+
+using sycldnn::DataFormat;
+using sycldnn::normalization::NormType;
+
+template <typename T>
+using NormalizationForward = NormalizationFixture<T>;
+
+using DataTypeList = sycldnn::types::KernelDataTypes;
+using GTestTypeList = sycldnn::types::ToGTestTypes<DataTypeList>::type;
+TYPED_TEST_SUITE(NormalizationForward, GTestTypeList);
+
+TYPED_TEST(NormalizationForward, LayerNHWC) {
+  this->test_forward(
+      get_norm_params(NormType::Layer, 2, 3, 3, 8, 1, DataFormat::NHWC));
+}
+TYPED_TEST(NormalizationForward, LayerNCHW) {
+  this->test_forward(
+      get_norm_params(NormType::Layer, 2, 3, 3, 8, 1, DataFormat::NCHW));
+}
+TYPED_TEST(NormalizationForward, LayerHiddenSize768) {
+  this->test_forward(
+      get_norm_params(NormType::Layer, 6, 1, 1, 768, 1, DataFormat::NHWC));
+}
+TYPED_TEST(NormalizationForward, LayerLongNCHW) {
+  this->test_forward(
+      get_norm_params(NormType::Layer, 1, 16, 16, 16, 1, DataFormat::NCHW));
+}
+TYPED_TEST(NormalizationForward, Group4NHWC) {
+  this->test_forward(
+      get_norm_params(NormType::Group, 2, 5, 5, 16, 4, DataFormat::NHWC));
+}
+TYPED_TEST(NormalizationForward, Group4NCHW) {
+  this->test_forward(
+      get_norm_params(NormType::Group, 2, 5, 5, 16, 4, DataFormat::NCHW));
+}
+TYPED_TEST(NormalizationForward, Group2LongNHWC) {
+  this->test_forward(
+      get_norm_params(NormType::Group, 1, 16, 16, 8, 2, DataFormat::NHWC));
+}
+TYPED_TEST(NormalizationForward, InstanceNHWC) {
+  this->test_forward(
+      get_norm_params(NormType::Instance, 2, 4, 5, 6, 1, DataFormat::NHWC));
+}
+TYPED_TEST(NormalizationForward, InstanceNCHW) {
+  this->test_forward(
+      get_norm_params(NormType::Instance, 2, 4, 5, 6, 1, DataFormat::NCHW));
+}
+TYPED_TEST(NormalizationForward, InstanceManySmallNHWC) {
+  this->test_forward(
+      get_norm_params(NormType::Instance, 8, 2, 2, 256, 1, DataFormat::NHWC));
+}
+TYPED_TEST(NormalizationForward, InstanceManySmallNCHW) {
+  this->test_forward(
+      get_norm_params(NormType::Instance, 8, 2, 2, 256, 1, DataFormat::NCHW));
+}
@@ -0,0 +1,80 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <gtest/gtest.h>
+
+#include "sycldnn/data_format.h"
+
+#include "sycldnn/normalization/params.h"
+
+#include "test/normalization/normalization_fixture.h"
+
+#include "test/types/kernel_data_types.h"
+#include "test/types/to_gtest_types.h"
+
+using sycldnn::DataFormat;
+using sycldnn::normalization::NormType;
+
+template <typename T>
+using NormalizationGradient = NormalizationFixture<T>;
+
+using DataTypeList = sycldnn::types::KernelDataTypes;
+using GTestTypeList = sycldnn::types::ToGTestTypes<DataTypeList>::type;
+TYPED_TEST_SUITE(NormalizationGradient, GTestTypeList);
+
+TYPED_TEST(NormalizationGradient, LayerNHWC) {
+  this->test_gradient(
+      get_norm_params(NormType::Layer, 2, 3, 3, 8, 1, DataFormat::NHWC));
+}
+TYPED_TEST(NormalizationGradient, LayerNCHW) {
+  this->test_gradient(
+      get_norm_params(NormType::Layer, 2, 3, 3, 8, 1, DataFormat::NCHW));
+}
+TYPED_TEST(NormalizationGradient, LayerHiddenSize768) {
+  this->test_gradient(
+      get_norm_params(NormType::Layer, 6, 1, 1, 768, 1, DataFormat::NHWC));
+}
+TYPED_TEST(NormalizationGradient, LayerLongNCHW) {
+  this->test_gradient(
+      get_norm_params(NormType::Layer, 1, 16, 16, 16, 1, DataFormat::NCHW));
+}
+TYPED_TEST(NormalizationGradient, Group4NHWC) {
+  this->test_gradient(
+      get_norm_params(NormType::Group, 2, 5, 5, 16, 4, DataFormat::NHWC));
+}
+TYPED_TEST(NormalizationGradient, Group4NCHW) {
+  this->test_gradient(
+      get_norm_params(NormType::Group, 2, 5, 5, 16, 4, DataFormat::NCHW));
+}
+TYPED_TEST(NormalizationGradient, Group2LongNHWC) {
+  this->test_gradient(
+      get_norm_params(NormType::Group, 1, 16, 16, 8, 2, DataFormat::NHWC));
+}
+TYPED_TEST(NormalizationGradient, InstanceNHWC) {
+  this->test_gradient(
+      get_norm_params(NormType::Instance, 2, 4, 5, 6, 1, DataFormat::NHWC));
+}
+TYPED_TEST(NormalizationGradient, InstanceNCHW) {
+  this->test_gradient(
+      get_norm_params(NormType::Instance, 2, 4, 5, 6, 1, DataFormat::NCHW));
+}
+TYPED_TEST(NormalizationGradient, InstanceManySmallNHWC) {
+  this->test_gradient(
+      get_norm_params(NormType::Instance, 8, 2, 2, 256, 1, DataFormat::NHWC));
+}
+TYPED_TEST(NormalizationGradient, InstanceManySmallNCHW) {
+  this->test_gradient(
+      get_norm_params(NormType::Instance, 8, 2, 2, 256, 1, DataFormat::NCHW));
+}
@@ -0,0 +1,172 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <gtest/gtest.h>
+
+#include "sycldnn/data_format.h"
+#include "sycldnn/padding_mode.h"
+#include "sycldnn/status.h"
+
+#include "sycldnn/backend/snn_backend.h"
+
+#include "sycldnn/helpers/padding.h"
+#include "sycldnn/helpers/scope_exit.h"
+
+#include "sycldnn/pooling/launch.h"
+#include "sycldnn/pooling/operators.h"
+#include "sycldnn/pooling/params.h"
+#include "sycldnn/pooling/sizes.h"
+
+#include "test/backend/backend_test_fixture.h"
+#include "test/gen/iota_initialised_data.h"
+#include "test/helpers/float_comparison.h"
+
+#include "test/types/kernel_data_types.h"
+#include "test/types/to_gtest_types.h"
+
+#include <stddef.h>
+#include <algorithm>
+#include <limits>
+#include <string>
+#include <vector>
+
+namespace {
+
+/** Get the offset of an element in a channel blocked tensor. */
+size_t blocked_offset(int batch, int row, int col, int channel, int rows,
+                      int cols, int channels, int block) {
+  size_t const channel_block = channel / block;
+  size_t const blocks = channels / block;
+  return (((batch * blocks + channel_block) * rows + row) * cols + col) *
+             block +
+         channel % block;
+}
+
+sycldnn::pooling::PoolingParams get_params(int window, int stride,
+                                           int channels,
+                                           sycldnn::DataFormat format) {
+  sycldnn::pooling::PoolingParams params;
+  params.batch = 2;
+  params.in_rows = 9;
+  params.in_cols = 6;
+  params.channels = channels;
+  params.window_rows = window;
+  params.window_cols = window;
+  params.stride_rows = stride;
+  params.stride_cols = stride;
+  params.input_format = format;
+  return sycldnn::helpers::add_padding_to(params, sycldnn::PaddingMode::SAME);
+}
+
+}  // namespace
+
+template <typename T>
+struct PoolingBlocked
+    : public BackendTestFixture<sycldnn::backend::SNNBackend> {
+  using DataType = T;
+
+ protected:
+  /**
+   * Compare the forward pooling of a channel blocked tensor against a host
+   * reference computed on the same tensor.
+   */
+  template <template <typename> class Op>
+  void test_blocked(sycldnn::pooling::PoolingParams const& params,
+                    bool is_max) {
+    using sycldnn::pooling::Forward;
+    auto sizes = sycldnn::pooling::get_sizes<Forward>(params);
+    int const block = sycldnn::get_channel_block(params.input_format);
+    DataType const max_val = static_cast<DataType>(16);
+    std::vector<DataType> input =
+        iota_initialised_data(sizes.input_size, max_val);
+    std::vector<DataType> output(sizes.output_size, DataType{0});
+    std::vector<DataType> exp(sizes.output_size, DataType{0});
+
+    for (int n = 0; n < params.batch; ++n) {
+      for (int r = 0; r < params.out_rows; ++r) {
+        for (int c = 0; c < params.out_cols; ++c) {
+          for (int ch = 0; ch < params.channels; ++ch) {
+            int const row_start = r * params.stride_rows - params.pad_rows;
+            int const col_start = c * params.stride_cols - params.pad_cols;
+            int const row_end =
+                std::min(row_start + params.window_rows, params.in_rows);
+            int const col_end =
+                std::min(col_start + params.window_cols, params.in_cols);
+            float max = std::numeric_limits<float>::lowest();
+            float sum = 0;
+            int count = 0;
+            for (int i = std::max(row_start, 0); i < row_end; ++i) {
+              for (int j = std::max(col_start, 0); j < col_end; ++j) {
+                float val = static_cast<float>(
+                    input[blocked_offset(n, i, j, ch, params.in_rows,
+                                         params.in_cols, params.channels,
+                                         block)]);
+                max = std::max(max, val);
+                sum += val;
+                ++count;
+              }
+            }
+            exp[blocked_offset(n, r, c, ch, params.out_rows, params.out_cols,
+                               params.channels, block)] =
+                static_cast<DataType>(is_max ? max : sum / count);
+          }
+        }
+      }
+    }
+
+    auto& provider = this->provider_;
+    auto& backend = provider.get_backend();
+    auto inp_gpu =
+        provider.get_initialised_device_memory(sizes.input_size, input);
+    auto out_gpu =
+        provider.get_initialised_device_memory(sizes.output_size, output);
+    SNN_ON_SCOPE_EXIT {
+      provider.deallocate_ptr(inp_gpu);
+      provider.deallocate_ptr(out_gpu);
+    };
+
+    auto status = sycldnn::pooling::launch<DataType, Op, Forward>(
+        inp_gpu, out_gpu, params, backend);
+    ASSERT_EQ(sycldnn::StatusCode::OK, status.status);
+    status.event.wait_and_throw();
+    provider.copy_device_data_to_host(sizes.output_size, out_gpu, output);
+
+    for (size_t i = 0; i < exp.size(); ++i) {
+      SCOPED_TRACE("Element: " + std::to_string(i));
+      SNN_ALMOST_EQUAL(exp[i], output[i], 8u);
+    }
+  }
+};
+
+using DataTypeList = sycldnn::types::KernelDataTypes;
+using GTestTypeList = sycldnn::types::ToGTestTypes<DataTypeList>::type;
+TYPED_TEST_SUITE(PoolingBlocked, GTestTypeList);
+
+TYPED_TEST(PoolingBlocked, MaxWindow3NCHW4) {
+  this->template test_blocked<sycldnn::pooling::Max>(
+      get_params(3, 1, 8, sycldnn::DataFormat::NCHW4), true);
+}
+TYPED_TEST(PoolingBlocked, MaxWindow3Stride2NCHW8) {
+  this->template test_blocked<sycldnn::pooling::Max>(
+      get_params(3, 2, 16, sycldnn::DataFormat::NCHW8), true);
+}
+TYPED_TEST(PoolingBlocked, AvgWindow3NCHW4) {
+  this->template test_blocked<sycldnn::pooling::Average>(
+      get_params(3, 1, 8, sycldnn::DataFormat::NCHW4), false);
+}
+TYPED_TEST(PoolingBlocked, AvgWindow5Stride2NCHW16) {
+  this->template test_blocked<sycldnn::pooling::Average>(
+      get_params(5, 2, 16, sycldnn::DataFormat::NCHW16), false);
+}
@@ -17,6 +17,9 @@
 #define SYCLDNN_TEST_REDUCE_FIXTURE_H_
 
 #include <gtest/gtest.h>
+#include <algorithm>
+#include <string>
+#include <type_traits>
 #include <vector>
 
 #include "sycldnn/helpers/scope_exit.h"
@@ -69,6 +72,101 @@ struct ReduceFixture : public BackendTestFixture<typename Pair::SecondType> {
       SNN_ALMOST_EQUAL(exp[i], output_data[i], 10u);
     }
   }
+
+  /**
+   * Reduce the given axes of an N-D tensor, comparing against the expected
+   * values computed on the host.
+   */
+  void run_axes(std::vector<int> const& dims, std::vector<int> const& axes,
+                DataType max_val) {
+    size_t input_size = 1;
+    for (int dim : dims) {
+      input_size *= dim;
+    }
+    std::vector<bool> is_reduced(dims.size(), false);
+    size_t reduce_size = 1;
+    for (int axis : axes) {
+      is_reduced[axis] = true;
+      reduce_size *= dims[axis];
+    }
+    size_t output_size = input_size / reduce_size;
+
+    std::vector<DataType> input_data =
+        iota_initialised_data(input_size, max_val);
+    std::vector<DataType> exp = get_expected(input_data, dims, is_reduced,
+                                             output_size, reduce_size);
+    std::vector<DataType> output_data(output_size);
+
+    auto& provider = this->provider_;
+    auto& backend = provider.get_backend();
+
+    {
+      auto input_gpu =
+          provider.get_initialised_device_memory(input_size, input_data);
+      auto output_gpu =
+          provider.get_initialised_device_memory(output_size, output_data);
+      SNN_ON_SCOPE_EXIT {
+        provider.deallocate_ptr(input_gpu);
+        provider.deallocate_ptr(output_gpu);
+      };
+
+      auto status = sycldnn::reduce::launch<DataType, Op>(
+          input_gpu, output_gpu, dims, axes, backend);
+
+      ASSERT_EQ(sycldnn::StatusCode::OK, status.status);
+      status.event.wait_and_throw();
+
+      provider.copy_device_data_to_host(output_size, output_gpu, output_data);
+    }
+
+    for (size_t i = 0; i < exp.size(); ++i) {
+      SCOPED_TRACE("Element: " + std::to_string(i));
+      SNN_ALMOST_EQUAL(exp[i], output_data[i], 10u);
+    }
+  }
+
+ private:
+  std::vector<DataType> get_expected(std::vector<DataType> const& input,
+                                     std::vector<int> const& dims,
+                                     std::vector<bool> const& is_reduced,
+                                     size_t output_size, size_t reduce_size) {
+    bool const is_max = std::is_same<Op, sycldnn::reduce::Max>::value;
+    bool const is_min = std::is_same<Op, sycldnn::reduce::Min>::value;
+    bool const is_mean = std::is_same<Op, sycldnn::reduce::Mean>::value;
+    std::vector<double> result(output_size);
+    std::vector<bool> seen(output_size, false);
+    for (size_t i = 0; i < input.size(); ++i) {
+      // Map the input index to the output index by dropping reduced axes.
+      size_t remaining = i;
+      size_t out_idx = 0;
+      size_t out_stride = 1;
+      for (size_t d = dims.size(); d-- > 0;) {
+        size_t coord = remaining % dims[d];
+        remaining /= dims[d];
+        if (!is_reduced[d]) {
+          out_idx += coord * out_stride;
+          out_stride *= dims[d];
+        }
+      }
+      double value = static_cast<double>(input[i]);
+      if (!seen[out_idx]) {
+        result[out_idx] = value;
+        seen[out_idx] = true;
+      } else if (is_max) {
+        result[out_idx] = std::max(result[out_idx], value);
+      } else if (is_min) {
+        result[out_idx] = std::min(result[out_idx], value);
+      } else {
+        result[out_idx] += value;
+      }
+    }
+    std::vector<DataType> exp(output_size);
+    for (size_t i = 0; i < output_size; ++i) {
+      exp[i] = static_cast<DataType>(is_mean ? result[i] / reduce_size
+                                             : result[i]);
+    }
+    return exp;
+  }
 };
 
 #endif  // SYCLDNN_TEST_REDUCE_FIXTURE_H_
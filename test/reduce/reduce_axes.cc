@@ -0,0 +1,89 @@
+/*
+ * Copyright Codeplay Software Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use these files except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <string>
+#include <vector>
+
+#include "sycldnn/reduce/operators.h"
+#include "test/reduce/fixture.h"
+#include "test/types/cartesian_product.h"
+#include "test/types/kernel_data_types.h"
+#include "test/types/test_backend_types.h"
+#include "test/types/to_gtest_types.h"
+
+using DataTypeList = sycldnn::types::KernelDataTypes;
+using Backends = sycldnn::types::AllBackendTypes;
+
+using TypeBackendPairs =
+    sycldnn::types::CartesianProduct<DataTypeList, Backends>::type;
+
+using GTestTypePair = sycldnn::types::ToGTestTypes<TypeBackendPairs>::type;
+
+/**
+ * Reductions over sets of axes of N-D tensors, covering the layouts which are
+ * split into more than one [batches, outer, inner] pass and the reductions
+ * with few enough outputs to use the two-stage kernels.
+ */
+template <typename Pair>
+using ReduceAxesAdd = ReduceFixture<Pair, sycldnn::reduce::Add>;
+template <typename Pair>
+using ReduceAxesMean = ReduceFixture<Pair, sycldnn::reduce::Mean>;
+template <typename Pair>
+using ReduceAxesMax = ReduceFixture<Pair, sycldnn::reduce::Max>;
+template <typename Pair>
+using ReduceAxesMin = ReduceFixture<Pair, sycldnn::reduce::Min>;
+TYPED_TEST_SUITE(ReduceAxesAdd, GTestTypePair);
+TYPED_TEST_SUITE(ReduceAxesMean, GTestTypePair);
+TYPED_TEST_SUITE(ReduceAxesMax, GTestTypePair);
+TYPED_TEST_SUITE(ReduceAxesMin, GTestTypePair);
+
+#define REDUCE_AXES_TEST(SUITE, NAME, DIMS, AXES)     \
+  TYPED_TEST(SUITE, NAME) {                          \
+    using DataType = typename TestFixture::DataType; \
+    const DataType max_input_val = 8.0;              \
+    this->run_axes(DIMS, AXES, max_input_val);       \
+  }
+
+#define REDUCE_AXES_TESTS(SUITE)                                             \
+  REDUCE_AXES_TEST(SUITE, NCHWOverNHW, (std::vector<int>{2, 3, 4, 5}),       \
+                   (std::vector<int>{0, 2, 3}))                              \
+  REDUCE_AXES_TEST(SUITE, NHWCOverNHW, (std::vector<int>{2, 3, 4, 5}),       \
+                   (std::vector<int>{0, 1, 2}))                              \
+  REDUCE_AXES_TEST(SUITE, Alternating, (std::vector<int>{3, 4, 5, 6}),       \
+                   (std::vector<int>{1, 3}))                                 \
+  REDUCE_AXES_TEST(SUITE, Unsorted, (std::vector<int>{3, 4, 5, 6, 2}),       \
+                   (std::vector<int>{4, 0, 2}))                              \
+  REDUCE_AXES_TEST(SUITE, SizeOneDims, (std::vector<int>{1, 4, 1, 6}),       \
+                   (std::vector<int>{0, 2}))                                 \
+  REDUCE_AXES_TEST(SUITE, MiddleAxis, (std::vector<int>{2, 7, 3}),           \
+                   (std::vector<int>{1}))                                    \
+  REDUCE_AXES_TEST(SUITE, AllAxes, (std::vector<int>{3, 5, 7}),              \
+                   (std::vector<int>{0, 1, 2}))                              \
+  REDUCE_AXES_TEST(SUITE, NoAxes, (std::vector<int>{3, 5, 7}),               \
+                   (std::vector<int>{}))                                     \
+  REDUCE_AXES_TEST(SUITE, TwoStage, (std::vector<int>{2, 4096}),             \
+                   (std::vector<int>{1}))                                    \
+  REDUCE_AXES_TEST(SUITE, TwoStageStrided, (std::vector<int>{8192, 3}),      \
+                   (std::vector<int>{0}))
+
+REDUCE_AXES_TESTS(ReduceAxesAdd)
+REDUCE_AXES_TESTS(ReduceAxesMean)
+REDUCE_AXES_TESTS(ReduceAxesMax)
+REDUCE_AXES_TESTS(ReduceAxesMin)
+
+#undef REDUCE_AXES_TESTS
+#undef REDUCE_AXES_TEST
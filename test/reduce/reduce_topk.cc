@@ -0,0 +1,205 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <gtest/gtest.h>
+
+#include "sycldnn/helpers/scope_exit.h"
+#include "sycldnn/reduce/launch.h"
+#include "sycldnn/reduce/operators.h"
+
+#include "test/backend/backend_test_fixture.h"
+#include "test/gen/iota_initialised_data.h"
+#include "test/types/cartesian_product.h"
+#include "test/types/kernel_data_types.h"
+#include "test/types/test_backend_types.h"
+#include "test/types/to_gtest_types.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+using DataTypeList = sycldnn::types::KernelDataTypes;
+using Backends = sycldnn::types::AllBackendTypes;
+
+using TypeBackendPairs =
+    sycldnn::types::CartesianProduct<DataTypeList, Backends>::type;
+
+using GTestTypePair = sycldnn::types::ToGTestTypes<TypeBackendPairs>::type;
+
+/**
+ * ArgMax, ArgMin and top-k over the outer dimension of [batch, outer, inner]
+ * tensors. The input values repeat, so that the ordering of equal values is
+ * checked. The expected values are computed on the host.
+ */
+template <typename Pair>
+struct ReduceTopK : public BackendTestFixture<typename Pair::SecondType> {
+  using DataType = typename Pair::FirstType;
+  using Backend = typename Pair::SecondType;
+
+ protected:
+  template <typename Op>
+  void run_arg(int batches, int outer, int inner, DataType max_val) {
+    size_t input_size = batches * outer * inner;
+    size_t output_size = batches * inner;
+    std::vector<DataType> input_data =
+        iota_initialised_data(input_size, max_val);
+    bool const largest = std::is_same<Op, sycldnn::reduce::ArgMax>::value;
+    std::vector<int32_t> exp = get_expected_indices(input_data, batches, outer,
+                                                    inner, 1, largest);
+    std::vector<int32_t> output_data(output_size, -1);
+
+    auto& provider = this->provider_;
+    auto& backend = provider.get_backend();
+    {
+      auto input_gpu =
+          provider.get_initialised_device_memory(input_size, input_data);
+      auto output_gpu =
+          provider.get_initialised_device_memory(output_size, output_data);
+      SNN_ON_SCOPE_EXIT {
+        provider.deallocate_ptr(input_gpu);
+        provider.deallocate_ptr(output_gpu);
+      };
+
+      auto status = sycldnn::reduce::launch_arg<DataType, Op>(
+          input_gpu, output_gpu, batches, outer, inner, backend);
+
+      ASSERT_EQ(sycldnn::StatusCode::OK, status.status);
+      status.event.wait_and_throw();
+
+      provider.copy_device_data_to_host(output_size, output_gpu, output_data);
+    }
+
+    for (size_t i = 0; i < exp.size(); ++i) {
+      SCOPED_TRACE("Element: " + std::to_string(i));
+      EXPECT_EQ(exp[i], output_data[i]);
+    }
+  }
+
+  void run_topk(int batches, int outer, int inner, int k, DataType max_val) {
+    size_t input_size = batches * outer * inner;
+    size_t output_size = batches * k * inner;
+    std::vector<DataType> input_data =
+        iota_initialised_data(input_size, max_val);
+    std::vector<int32_t> exp = get_expected_indices(input_data, batches, outer,
+                                                    inner, k, true);
+    std::vector<DataType> values_data(output_size);
+    std::vector<int32_t> indices_data(output_size, -1);
+
+    auto& provider = this->provider_;
+    auto& backend = provider.get_backend();
+    {
+      auto input_gpu =
+          provider.get_initialised_device_memory(input_size, input_data);
+      auto values_gpu =
+          provider.get_initialised_device_memory(output_size, values_data);
+      auto indices_gpu =
+          provider.get_initialised_device_memory(output_size, indices_data);
+      SNN_ON_SCOPE_EXIT {
+        provider.deallocate_ptr(input_gpu);
+        provider.deallocate_ptr(values_gpu);
+        provider.deallocate_ptr(indices_gpu);
+      };
+
+      auto status = sycldnn::reduce::launch_topk<DataType>(
+          input_gpu, values_gpu, indices_gpu, batches, outer, inner, k,
+          backend);
+
+      ASSERT_EQ(sycldnn::StatusCode::OK, status.status);
+      status.event.wait_and_throw();
+
+      provider.copy_device_data_to_host(output_size, values_gpu, values_data);
+      provider.copy_device_data_to_host(output_size, indices_gpu,
+                                        indices_data);
+    }
+
+    for (size_t i = 0; i < exp.size(); ++i) {
+      SCOPED_TRACE("Element: " + std::to_string(i));
+      EXPECT_EQ(exp[i], indices_data[i]);
+      size_t batch = i / (k * inner);
+      size_t in_idx = (batch * outer + exp[i]) * inner + i % inner;
+      EXPECT_EQ(input_data[in_idx], values_data[i]);
+    }
+  }
+
+ private:
+  /**
+   * Get the indices of the k largest or smallest values in the outer
+   * dimension, with equal values ordered by index.
+   */
+  std::vector<int32_t> get_expected_indices(std::vector<DataType> const& input,
+                                            int batches, int outer, int inner,
+                                            int k, bool largest) {
+    std::vector<int32_t> exp(batches * k * inner);
+    std::vector<int32_t> order(outer);
+    for (int batch = 0; batch < batches; ++batch) {
+      for (int inner_idx = 0; inner_idx < inner; ++inner_idx) {
+        auto value = [&](int32_t i) {
+          return input[(batch * outer + i) * inner + inner_idx];
+        };
+        for (int i = 0; i < outer; ++i) {
+          order[i] = i;
+        }
+        std::stable_sort(order.begin(), order.end(),
+                         [&](int32_t a, int32_t b) {
+                           return largest ? value(a) > value(b)
+                                          : value(a) < value(b);
+                         });
+        for (int i = 0; i < k; ++i) {
+          exp[(batch * k + i) * inner + inner_idx] = order[i];
+        }
+      }
+    }
+    return exp;
+  }
+};
+TYPED_TEST_SUITE(ReduceTopK, GTestTypePair);
+TYPED_TEST(ReduceTopK, ArgMaxSmall) {
+  using DataType = typename TestFixture::DataType;
+  this->template run_arg<sycldnn::reduce::ArgMax>(2, 10, 3, DataType{7});
+}
+TYPED_TEST(ReduceTopK, ArgMinSmall) {
+  using DataType = typename TestFixture::DataType;
+  this->template run_arg<sycldnn::reduce::ArgMin>(2, 10, 3, DataType{7});
+}
+TYPED_TEST(ReduceTopK, ArgMaxLarge) {
+  using DataType = typename TestFixture::DataType;
+  this->template run_arg<sycldnn::reduce::ArgMax>(1, 5000, 2, DataType{999});
+}
+TYPED_TEST(ReduceTopK, ArgMinLarge) {
+  using DataType = typename TestFixture::DataType;
+  this->template run_arg<sycldnn::reduce::ArgMin>(2, 4099, 1, DataType{999});
+}
+TYPED_TEST(ReduceTopK, TopK1) {
+  using DataType = typename TestFixture::DataType;
+  this->run_topk(1, 7, 1, 1, DataType{5});
+}
+TYPED_TEST(ReduceTopK, TopK3) {
+  using DataType = typename TestFixture::DataType;
+  this->run_topk(2, 10, 3, 3, DataType{7});
+}
+TYPED_TEST(ReduceTopK, TopK5Large) {
+  using DataType = typename TestFixture::DataType;
+  this->run_topk(1, 5000, 1, 5, DataType{999});
+}
+TYPED_TEST(ReduceTopK, TopK32) {
+  using DataType = typename TestFixture::DataType;
+  this->run_topk(2, 100, 2, 32, DataType{40});
+}
+TYPED_TEST(ReduceTopK, TopKAll) {
+  using DataType = typename TestFixture::DataType;
+  this->run_topk(3, 20, 1, 20, DataType{9});
+}
@@ -30,6 +30,9 @@
 #include "test/helpers/float_comparison.h"
 #include "test/helpers/transpose.h"
 
+#include <array>
+#include <vector>
+
 inline sycldnn::softmax::SoftmaxParams getSoftmaxParams(
     std::array<int, 4> in_shape) {
   sycldnn::softmax::SoftmaxParams params;
@@ -0,0 +1,371 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <gtest/gtest.h>
+
+#include "sycldnn/data_format.h"
+
+#include "sycldnn/backend/snn_backend.h"
+
+#include "sycldnn/helpers/scope_exit.h"
+
+#include "sycldnn/softmax/direction.h"
+#include "sycldnn/softmax/launch.h"
+#include "sycldnn/softmax/params.h"
+#include "sycldnn/softmax/sizes.h"
+
+#include "test/backend/backend_test_fixture.h"
+#include "test/gen/iota_initialised_data.h"
+#include "test/helpers/float_comparison.h"
+#include "test/types/kernel_data_types.h"
+#include "test/types/to_gtest_types.h"
+
+#include <cmath>
+#include <limits>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+/**
+ * Softmax, log-softmax and their gradients over rows which are long enough to
+ * be split across a work-group, or which have shapes that exercise each of the
+ * vectorized kernels, including softmax along any axis of an N-D tensor. The
+ * expected values are computed on the host.
+ */
+template <typename T>
+struct SoftmaxRows : public BackendTestFixture<sycldnn::backend::SNNBackend> {
+  using DataType = T;
+
+ protected:
+  /**
+   * Check the forward softmax, with the first `masked` values of each row set
+   * to -inf.
+   */
+  template <typename Direction = sycldnn::softmax::Forward>
+  void run(int batch, int rows, int cols, int channels,
+           sycldnn::DataFormat format, int masked = 0) {
+    auto params = get_params(batch, rows, cols, channels, format);
+    bool const is_nchw = format == sycldnn::DataFormat::NCHW;
+    int const spatial = rows * cols;
+    int const outer = is_nchw ? batch : batch * spatial;
+    int const inner = is_nchw ? spatial : 1;
+    check_forward<Direction>(params, outer, channels, inner, masked);
+  }
+
+  template <typename Direction = sycldnn::softmax::Gradient>
+  void run_gradient(int batch, int rows, int cols, int channels,
+                    sycldnn::DataFormat format) {
+    auto params = get_params(batch, rows, cols, channels, format);
+    bool const is_nchw = format == sycldnn::DataFormat::NCHW;
+    int const spatial = rows * cols;
+    int const outer = is_nchw ? batch : batch * spatial;
+    int const inner = is_nchw ? spatial : 1;
+    check_gradient<Direction>(params, outer, channels, inner);
+  }
+
+  template <typename Direction = sycldnn::softmax::Forward>
+  void run_nd(std::vector<int> const& dims, int axis, int masked = 0) {
+    int outer, row_size, inner;
+    auto params = get_nd_params(dims, axis, outer, row_size, inner);
+    check_forward<Direction>(params, outer, row_size, inner, masked);
+  }
+
+  template <typename Direction = sycldnn::softmax::Gradient>
+  void run_nd_gradient(std::vector<int> const& dims, int axis) {
+    int outer, row_size, inner;
+    auto params = get_nd_params(dims, axis, outer, row_size, inner);
+    check_gradient<Direction>(params, outer, row_size, inner);
+  }
+
+ private:
+  template <typename Direction>
+  void check_forward(sycldnn::softmax::SoftmaxParams const& params, int outer,
+                     int channels, int inner, int masked) {
+    bool const log = std::is_same<Direction, sycldnn::softmax::LogForward>();
+    size_t const size = static_cast<size_t>(outer) * channels * inner;
+    size_t const workspace_size =
+        sycldnn::softmax::get_sizes(params).workspace_size;
+
+    std::vector<DataType> input =
+        iota_initialised_data(size, static_cast<DataType>(9));
+    for (int o = 0; o < outer; ++o) {
+      for (int c = 0; c < masked; ++c) {
+        for (int i = 0; i < inner; ++i) {
+          input[(static_cast<size_t>(o) * channels + c) * inner + i] =
+              static_cast<DataType>(-std::numeric_limits<float>::infinity());
+        }
+      }
+    }
+    std::vector<DataType> workspace(workspace_size);
+    std::vector<DataType> output(size);
+
+    std::vector<DataType> exp(size);
+    for (int o = 0; o < outer; ++o) {
+      for (int i = 0; i < inner; ++i) {
+        size_t const offset = static_cast<size_t>(o) * channels * inner + i;
+        double max = static_cast<double>(input[offset]);
+        for (int c = 1; c < channels; ++c) {
+          max = std::max(max, static_cast<double>(input[offset + c * inner]));
+        }
+        double sum = 0;
+        for (int c = 0; c < channels; ++c) {
+          sum += std::exp(static_cast<double>(input[offset + c * inner]) - max);
+        }
+        for (int c = 0; c < channels; ++c) {
+          double const value = static_cast<double>(input[offset + c * inner]);
+          exp[offset + c * inner] = static_cast<DataType>(
+              log ? value - max - std::log(sum) : std::exp(value - max) / sum);
+        }
+      }
+    }
+
+    auto& provider = this->provider_;
+    auto& backend = provider.get_backend();
+
+    {
+      auto inp_gpu = provider.get_initialised_device_memory(size, input);
+      auto workspace_gpu =
+          provider.get_initialised_device_memory(workspace_size, workspace);
+      auto out_gpu = provider.get_initialised_device_memory(size, output);
+      SNN_ON_SCOPE_EXIT {
+        provider.deallocate_ptr(inp_gpu);
+        provider.deallocate_ptr(workspace_gpu);
+        provider.deallocate_ptr(out_gpu);
+      };
+
+      auto status = sycldnn::softmax::launch<DataType, Direction>(
+          inp_gpu, workspace_gpu, out_gpu, params, backend);
+
+      ASSERT_EQ(sycldnn::StatusCode::OK, status.status);
+      status.event.wait_and_throw();
+
+      provider.copy_device_data_to_host(size, out_gpu, output);
+    }
+
+    for (size_t i = 0; i < size; ++i) {
+      SCOPED_TRACE("Element: " + std::to_string(i));
+      // A row of only -inf has no finite maximum, so its outputs are NaN, as
+      // they are when computed on the host.
+      if (std::isnan(static_cast<double>(exp[i]))) {
+        EXPECT_TRUE(std::isnan(static_cast<double>(output[i])));
+      } else {
+        SNN_ALMOST_EQUAL(exp[i], output[i], 10u);
+      }
+    }
+  }
+
+  template <typename Direction>
+  void check_gradient(sycldnn::softmax::SoftmaxParams const& params, int outer,
+                      int channels, int inner) {
+    bool const log = std::is_same<Direction, sycldnn::softmax::LogGradient>();
+    size_t const size = static_cast<size_t>(outer) * channels * inner;
+
+    // Keep the values small so that the row sums fit in half precision. The
+    // outputs of a log-softmax are negative.
+    std::vector<DataType> input =
+        iota_initialised_data(size, static_cast<DataType>(3));
+    if (log) {
+      for (auto& value : input) {
+        value = -value;
+      }
+    }
+    std::vector<DataType> gradient =
+        iota_initialised_data(size, static_cast<DataType>(2));
+    std::vector<DataType> workspace(size);
+    std::vector<DataType> output(size);
+
+    std::vector<DataType> exp(size);
+    for (int o = 0; o < outer; ++o) {
+      for (int i = 0; i < inner; ++i) {
+        size_t const offset = static_cast<size_t>(o) * channels * inner + i;
+        double sum = 0;
+        for (int c = 0; c < channels; ++c) {
+          size_t const idx = offset + c * inner;
+          double const grad = static_cast<double>(gradient[idx]);
+          sum += log ? grad : static_cast<double>(input[idx]) * grad;
+        }
+        for (int c = 0; c < channels; ++c) {
+          size_t const idx = offset + c * inner;
+          double const value = static_cast<double>(input[idx]);
+          double const grad = static_cast<double>(gradient[idx]);
+          exp[idx] = static_cast<DataType>(
+              log ? grad - std::exp(value) * sum : value * (grad - sum));
+        }
+      }
+    }
+
+    auto& provider = this->provider_;
+    auto& backend = provider.get_backend();
+
+    {
+      auto inp_gpu = provider.get_initialised_device_memory(size, input);
+      auto grad_gpu = provider.get_initialised_device_memory(size, gradient);
+      auto workspace_gpu =
+          provider.get_initialised_device_memory(size, workspace);
+      auto out_gpu = provider.get_initialised_device_memory(size, output);
+      SNN_ON_SCOPE_EXIT {
+        provider.deallocate_ptr(inp_gpu);
+        provider.deallocate_ptr(grad_gpu);
+        provider.deallocate_ptr(workspace_gpu);
+        provider.deallocate_ptr(out_gpu);
+      };
+
+      auto status = sycldnn::softmax::launch<DataType, Direction>(
+          inp_gpu, grad_gpu, workspace_gpu, out_gpu, params, backend);
+
+      ASSERT_EQ(sycldnn::StatusCode::OK, status.status);
+      status.event.wait_and_throw();
+
+      provider.copy_device_data_to_host(size, out_gpu, output);
+    }
+
+    for (size_t i = 0; i < size; ++i) {
+      SCOPED_TRACE("Element: " + std::to_string(i));
+      SNN_ALMOST_EQUAL(exp[i], output[i], 10u);
+    }
+  }
+
+  sycldnn::softmax::SoftmaxParams get_nd_params(std::vector<int> const& dims,
+                                                int axis, int& outer,
+                                                int& row_size, int& inner) {
+    sycldnn::softmax::SoftmaxParams params;
+    params.dims = dims;
+    params.axis = axis;
+    int const n_dims = static_cast<int>(dims.size());
+    int const pos_axis = axis < 0 ? axis + n_dims : axis;
+    outer = 1;
+    for (int i = 0; i < pos_axis; ++i) {
+      outer *= dims[i];
+    }
+    row_size = dims[pos_axis];
+    inner = 1;
+    for (int i = pos_axis + 1; i < n_dims; ++i) {
+      inner *= dims[i];
+    }
+    return params;
+  }
+
+  sycldnn::softmax::SoftmaxParams get_params(int batch, int rows, int cols,
+                                             int channels,
+                                             sycldnn::DataFormat format) {
+    sycldnn::softmax::SoftmaxParams params;
+    params.batch = batch;
+    params.rows = rows;
+    params.cols = cols;
+    params.channels = channels;
+    params.input_format = format;
+    return params;
+  }
+};
+
+using DataTypeList = sycldnn::types::KernelDataTypes;
+using GTestTypeList = sycldnn::types::ToGTestTypes<DataTypeList>::type;
+TYPED_TEST_SUITE(SoftmaxRows, GTestTypeList);
+
+TYPED_TEST(SoftmaxRows, NHWC2x1x1x2000) {
+  this->run(2, 1, 1, 2000, sycldnn::DataFormat::NHWC);
+}
+TYPED_TEST(SoftmaxRows, NHWC1x1x3x1027) {
+  this->run(1, 1, 3, 1027, sycldnn::DataFormat::NHWC);
+}
+TYPED_TEST(SoftmaxRows, NHWC3x2x5x18) {
+  this->run(3, 2, 5, 18, sycldnn::DataFormat::NHWC);
+}
+TYPED_TEST(SoftmaxRows, NCHW2x1x1x2000) {
+  this->run(2, 1, 1, 2000, sycldnn::DataFormat::NCHW);
+}
+TYPED_TEST(SoftmaxRows, NCHW2x4x5x37) {
+  this->run(2, 4, 5, 37, sycldnn::DataFormat::NCHW);
+}
+TYPED_TEST(SoftmaxRows, NCHW2x3x5x6) {
+  this->run(2, 3, 5, 6, sycldnn::DataFormat::NCHW);
+}
+TYPED_TEST(SoftmaxRows, GradientNHWC2x1x1x2000) {
+  this->run_gradient(2, 1, 1, 2000, sycldnn::DataFormat::NHWC);
+}
+TYPED_TEST(SoftmaxRows, GradientNHWC3x2x5x18) {
+  this->run_gradient(3, 2, 5, 18, sycldnn::DataFormat::NHWC);
+}
+TYPED_TEST(SoftmaxRows, GradientNCHW2x4x5x37) {
+  this->run_gradient(2, 4, 5, 37, sycldnn::DataFormat::NCHW);
+}
+TYPED_TEST(SoftmaxRows, LogNHWC2x1x1x2000) {
+  this->template run<sycldnn::softmax::LogForward>(2, 1, 1, 2000,
+                                                   sycldnn::DataFormat::NHWC);
+}
+TYPED_TEST(SoftmaxRows, LogNHWC3x2x5x18) {
+  this->template run<sycldnn::softmax::LogForward>(3, 2, 5, 18,
+                                                   sycldnn::DataFormat::NHWC);
+}
+TYPED_TEST(SoftmaxRows, LogNCHW2x4x5x37) {
+  this->template run<sycldnn::softmax::LogForward>(2, 4, 5, 37,
+                                                   sycldnn::DataFormat::NCHW);
+}
+TYPED_TEST(SoftmaxRows, LogGradientNHWC2x1x1x2000) {
+  this->template run_gradient<sycldnn::softmax::LogGradient>(
+      2, 1, 1, 2000, sycldnn::DataFormat::NHWC);
+}
+TYPED_TEST(SoftmaxRows, LogGradientNCHW2x4x5x37) {
+  this->template run_gradient<sycldnn::softmax::LogGradient>(
+      2, 4, 5, 37, sycldnn::DataFormat::NCHW);
+}
+TYPED_TEST(SoftmaxRows, Dims2x3x4x37Axis3) {
+  this->run_nd({2, 3, 4, 37}, 3);
+}
+TYPED_TEST(SoftmaxRows, Dims2x3x37x4AxisMinus2) {
+  this->run_nd({2, 3, 37, 4}, -2);
+}
+TYPED_TEST(SoftmaxRows, Dims5x7x3Axis0) {
+  this->run_nd({5, 7, 3}, 0);
+}
+TYPED_TEST(SoftmaxRows, Dims1x1500x3Axis1) {
+  this->run_nd({1, 1500, 3}, 1);
+}
+TYPED_TEST(SoftmaxRows, LogDims4x6x10Axis1) {
+  this->template run_nd<sycldnn::softmax::LogForward>({4, 6, 10}, 1);
+}
+TYPED_TEST(SoftmaxRows, GradientDims1x1500x3Axis1) {
+  this->run_nd_gradient({1, 1500, 3}, 1);
+}
+TYPED_TEST(SoftmaxRows, LogGradientDims3x9x2Axis1) {
+  this->template run_nd_gradient<sycldnn::softmax::LogGradient>({3, 9, 2},
+                                                                  1);
+}
+TYPED_TEST(SoftmaxRows, MaskedNHWC3x2x5x18) {
+  this->run(3, 2, 5, 18, sycldnn::DataFormat::NHWC, 16);
+}
+TYPED_TEST(SoftmaxRows, MaskedNHWC2x1x1x2000) {
+  this->run(2, 1, 1, 2000, sycldnn::DataFormat::NHWC, 1998);
+}
+TYPED_TEST(SoftmaxRows, MaskedNCHW2x4x5x37) {
+  this->run(2, 4, 5, 37, sycldnn::DataFormat::NCHW, 2);
+}
+TYPED_TEST(SoftmaxRows, LogMaskedNCHW2x3x5x6) {
+  this->template run<sycldnn::softmax::LogForward>(
+      2, 3, 5, 6, sycldnn::DataFormat::NCHW, 5);
+}
+TYPED_TEST(SoftmaxRows, MaskedDims1x1500x3Axis1) {
+  this->run_nd({1, 1500, 3}, 1, 1499);
+}
+TYPED_TEST(SoftmaxRows, FullyMaskedNHWC3x2x5x18) {
+  this->run(3, 2, 5, 18, sycldnn::DataFormat::NHWC, 18);
+}
+TYPED_TEST(SoftmaxRows, FullyMaskedNHWC2x1x1x2000) {
+  this->run(2, 1, 1, 2000, sycldnn::DataFormat::NHWC, 2000);
+}
+TYPED_TEST(SoftmaxRows, LogFullyMaskedNCHW2x4x5x37) {
+  this->template run<sycldnn::softmax::LogForward>(
+      2, 4, 5, 37, sycldnn::DataFormat::NCHW, 37);
+}
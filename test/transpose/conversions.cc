@@ -28,6 +28,8 @@
 
 #include "sycldnn/backend/snn_backend.h"
 
+#include "sycldnn/data_format.h"
+
 #include "sycldnn/helpers/scope_exit.h"
 #include "sycldnn/status.h"
 #include "sycldnn/transpose/launch.h"
@@ -41,11 +43,99 @@
 using DataTypeList = sycldnn::types::KernelDataTypes;
 using GTestTypeList = sycldnn::types::ToGTestTypes<DataTypeList>::type;
 
+namespace {
+
+/**
+ * Get the offset of an element in a tensor with the given batch, row, column
+ * and channel sizes stored in the given data format.
+ */
+size_t get_offset(std::vector<int> const& sizes, sycldnn::DataFormat format,
+                  int batch, int row, int col, int channel) {
+  int const rows = sizes[1];
+  int const cols = sizes[2];
+  int const channels = sizes[3];
+  int const block = sycldnn::get_channel_block(format);
+  switch (format) {
+    case sycldnn::DataFormat::NHWC:
+      return ((batch * rows + row) * cols + col) * channels + channel;
+    case sycldnn::DataFormat::NCHW:
+      return ((batch * channels + channel) * rows + row) * cols + col;
+    default:
+      return ((((batch * (channels / block)) + channel / block) * rows + row) *
+                  cols +
+              col) *
+                 block +
+             channel % block;
+  }
+}
+
+}  // namespace
+
 template <typename T>
 struct TransposeConversion
     : public BackendTestFixture<sycldnn::backend::SNNBackend> {
  public:
   using DataType = T;
+
+ protected:
+  /**
+   * Convert a tensor between two data formats and check each element is
+   * moved to the offset it should have in the new format.
+   */
+  void test_convert_layout(std::vector<int> const& sizes,
+                           sycldnn::DataFormat from, sycldnn::DataFormat to) {
+    size_t tensor_size = std::accumulate(begin(sizes), end(sizes), 1,
+                                         [](int a, int b) { return a * b; });
+    const DataType max_val = 2048.0;
+    std::vector<DataType> in_data =
+        iota_initialised_data(tensor_size, max_val);
+    std::vector<DataType> out_data(tensor_size, DataType{0});
+    std::vector<DataType> exp(tensor_size);
+    for (int n = 0; n < sizes[0]; ++n) {
+      for (int h = 0; h < sizes[1]; ++h) {
+        for (int w = 0; w < sizes[2]; ++w) {
+          for (int c = 0; c < sizes[3]; ++c) {
+            exp[get_offset(sizes, to, n, h, w, c)] =
+                in_data[get_offset(sizes, from, n, h, w, c)];
+          }
+        }
+      }
+    }
+
+    auto& provider = this->provider_;
+    auto& backend = provider.get_backend();
+    {
+      auto in_gpu =
+          provider.get_initialised_device_memory(tensor_size, in_data);
+      auto out_gpu =
+          provider.get_initialised_device_memory(tensor_size, out_data);
+      SNN_ON_SCOPE_EXIT {
+        provider.deallocate_ptr(in_gpu);
+        provider.deallocate_ptr(out_gpu);
+      };
+
+      try {
+        auto status = sycldnn::transpose::convert_layout<DataType>(
+            in_gpu, out_gpu, sizes, from, to, backend);
+
+        ASSERT_EQ(sycldnn::StatusCode::OK, status.status);
+        status.event.wait_and_throw();
+      } catch (cl::sycl::exception const& e) {
+        throw std::runtime_error(e.what());
+      }
+
+      provider.copy_device_data_to_host(tensor_size, out_gpu, out_data);
+    }
+
+    for (size_t i = 0; i < exp.size(); ++i) {
+      SCOPED_TRACE("Element: " + std::to_string(i));
+      if (std::is_same<DataType, double>::value) {
+        EXPECT_DOUBLE_EQ(exp[i], out_data[i]);
+      } else {
+        EXPECT_FLOAT_EQ(exp[i], out_data[i]);
+      }
+    }
+  }
 };
 
 TYPED_TEST_SUITE(TransposeConversion, GTestTypeList);
@@ -166,3 +256,28 @@ TYPED_TEST(TransposeConversion, NCHWToNHWC) {
     }
   }
 }
+
+TYPED_TEST(TransposeConversion, NHWCToNCHW4) {
+  this->test_convert_layout({2, 3, 5, 8}, sycldnn::DataFormat::NHWC,
+                            sycldnn::DataFormat::NCHW4);
+}
+
+TYPED_TEST(TransposeConversion, NCHW4ToNHWC) {
+  this->test_convert_layout({2, 3, 5, 8}, sycldnn::DataFormat::NCHW4,
+                            sycldnn::DataFormat::NHWC);
+}
+
+TYPED_TEST(TransposeConversion, NCHWToNCHW8) {
+  this->test_convert_layout({3, 4, 3, 16}, sycldnn::DataFormat::NCHW,
+                            sycldnn::DataFormat::NCHW8);
+}
+
+TYPED_TEST(TransposeConversion, NCHW16ToNCHW) {
+  this->test_convert_layout({1, 7, 2, 32}, sycldnn::DataFormat::NCHW16,
+                            sycldnn::DataFormat::NCHW);
+}
+
+TYPED_TEST(TransposeConversion, NCHW8ToNCHW8) {
+  this->test_convert_layout({2, 2, 2, 8}, sycldnn::DataFormat::NCHW8,
+                            sycldnn::DataFormat::NCHW8);
+}
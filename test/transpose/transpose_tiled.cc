@@ -0,0 +1,81 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <gtest/gtest.h>
+#include <vector>
+
+#include "test/transpose/transpose_fixture.h"
+#include "test/types/kernel_data_types.h"
+#include "test/types/to_gtest_types.h"
+
+using GTestTypeList = sycldnn::types::GTestKernelDataTypes;
+
+/**
+ * Transposes which simplify to swapping the last two dimensions of a batched
+ * 2D tensor, with sizes that exercise each vector width of the tiled kernel
+ * and partial tiles. The expected values are computed on the host.
+ */
+template <typename DataType>
+struct TransposeTiled : public TransposeFixture<DataType> {
+ protected:
+  void run_tiled(std::vector<int> const& sizes,
+                 std::vector<int> const& permutation) {
+    int const n_dims = sizes.size();
+    size_t tensor_size = 1;
+    for (int size : sizes) {
+      tensor_size *= size;
+    }
+    std::vector<DataType> in_data =
+        iota_initialised_data(tensor_size, DataType{0});
+
+    std::vector<size_t> in_strides(n_dims, 1);
+    for (int i = n_dims - 2; i >= 0; --i) {
+      in_strides[i] = in_strides[i + 1] * sizes[i + 1];
+    }
+    std::vector<DataType> exp_out(tensor_size);
+    for (size_t out_idx = 0; out_idx < tensor_size; ++out_idx) {
+      size_t remaining = out_idx;
+      size_t in_idx = 0;
+      for (int i = n_dims - 1; i >= 0; --i) {
+        int const out_size = sizes[permutation[i]];
+        in_idx += (remaining % out_size) * in_strides[permutation[i]];
+        remaining /= out_size;
+      }
+      exp_out[out_idx] = in_data[in_idx];
+    }
+    this->run(exp_out, sizes, permutation, DataType{0}, 0, 0);
+  }
+};
+TYPED_TEST_SUITE(TransposeTiled, GTestTypeList);
+TYPED_TEST(TransposeTiled, Matrix64x128) {
+  this->run_tiled({64, 128}, {1, 0});
+}
+TYPED_TEST(TransposeTiled, Matrix50x34) { this->run_tiled({50, 34}, {1, 0}); }
+TYPED_TEST(TransposeTiled, Matrix37x45) { this->run_tiled({37, 45}, {1, 0}); }
+TYPED_TEST(TransposeTiled, Batched3x40x36) {
+  this->run_tiled({3, 40, 36}, {0, 2, 1});
+}
+TYPED_TEST(TransposeTiled, NHWCToNCHW) {
+  this->run_tiled({2, 7, 5, 24}, {0, 3, 1, 2});
+}
+TYPED_TEST(TransposeTiled, NCHWToNHWC) {
+  this->run_tiled({2, 24, 7, 5}, {0, 2, 3, 1});
+}
+TYPED_TEST(TransposeTiled, SizeOneDimensions) {
+  this->run_tiled({1, 33, 1, 17}, {3, 2, 0, 1});
+}
+TYPED_TEST(TransposeTiled, NarrowUsesGenericKernel) {
+  this->run_tiled({2, 100, 3}, {0, 2, 1});
+}
@@ -30,6 +30,7 @@
 #include "sycldnn/binaryop/launch.h"
 #include "sycldnn/binaryop/operators.h"
 
+#include "sycldnn/batchnorm/fold.h"
 #include "sycldnn/batchnorm/launch.h"
 
 #include "sycldnn/matmul/launch.h"
@@ -96,6 +97,51 @@ struct ConvolutionLayer : Layer<DType, Backend> {
         workspace_, workspace_size_);
   }
 };
+
+// Convolution with the bias add and activation fused into the convolution
+template <typename DType, typename Backend>
+struct FusedConvolutionLayer : Layer<DType, Backend> {
+  using DeviceMem = typename Backend::template pointer_type<DType>;
+  sycldnn::conv2d::Conv2DParams params_;
+  sycldnn::conv2d::EpilogueParams epilogue_;
+  sycldnn::conv2d::ConvSizes sizes_;
+  DeviceMem input_;
+  DeviceMem filter_;
+  DeviceMem bias_;
+  DeviceMem output_;
+  DeviceMem workspace_;
+  size_t workspace_size_;
+  sycldnn::conv2d::Selector& selector_;
+
+  FusedConvolutionLayer(sycldnn::conv2d::Conv2DParams const& params,
+                        sycldnn::conv2d::EpilogueParams const& epilogue,
+                        DeviceMem const input, DeviceMem const weights,
+                        DeviceMem const bias, DeviceMem output,
+                        DeviceMem workspace, size_t workspace_size, Backend& b,
+                        sycldnn::conv2d::Selector& selector)
+      : Layer<DType, Backend>(b),
+        params_{params},
+        epilogue_{epilogue},
+        sizes_{sycldnn::conv2d::get_sizes<sycldnn::conv2d::conv_type::Forward>(
+            params_)},
+        input_{input},
+        filter_{weights},
+        bias_{bias},
+        output_{output},
+        workspace_{workspace},
+        workspace_size_{workspace_size},
+        selector_{selector} {}
+
+  DeviceMem get_output() override { return output_; }
+  size_t get_output_size() const override { return sizes_.output_size; }
+
+  sycldnn::SNNStatus run() override {
+    return sycldnn::conv2d::launch<DType, sycldnn::conv2d::conv_type::Forward>(
+        input_, filter_, bias_, output_, params_, epilogue_, selector_,
+        this->backend_, workspace_, workspace_size_);
+  }
+};
+
 template <typename DType, typename Backend>
 struct BiasAddLayer : Layer<DType, Backend> {
   using DeviceMem = typename Backend::template pointer_type<DType>;
@@ -200,6 +246,16 @@ struct BatchNormFrozenLayer : Layer<DType, Backend> {
         input_, beta_, gamma_, mean_, variance_, output_, params_,
         this->backend_);
   }
+
+  // Rewrites the filter and bias of the convolution producing this layer's
+  // input so that the batchnorm no longer needs to be run
+  sycldnn::SNNStatus fold_into(
+      sycldnn::conv2d::Conv2DParams const& conv_params, DeviceMem filter,
+      DeviceMem bias) {
+    return sycldnn::batchnorm::fold_into_conv2d<DType>(
+        filter, bias, beta_, gamma_, mean_, variance_, conv_params, params_,
+        this->backend_);
+  }
 };
 
 template <typename DType, typename Backend,
@@ -18,6 +18,9 @@
 
 #include <CL/sycl.hpp>
 
+#include <memory>
+#include <vector>
+
 namespace sycldnn {
 template <typename DType, typename Backend>
 class Network {
@@ -30,8 +33,15 @@ class Network {
   Network(Backend& backend, std::vector<DType>& output)
       : network_{}, output_{output}, backend_{backend} {}
 
-  // Layers are their own types, number of parameters differs between each
-  void add_layer(Layer<DType, Backend>* layer) { network_.emplace_back(layer); }
+  // Layers are their own types, number of parameters differs between each.
+  // Frozen batchnorms following a convolution are folded into its weights
+  // instead of being added as a separate layer.
+  void add_layer(Layer<DType, Backend>* layer) {
+    std::unique_ptr<Layer<DType, Backend>> new_layer{layer};
+    if (!fold_batchnorm(*new_layer)) {
+      network_.push_back(std::move(new_layer));
+    }
+  }
 
   // Runs each layer, checks for exceptions after every layer
   sycldnn::SNNStatus test() {
@@ -75,5 +85,62 @@ class Network {
     });
     return {event, sycldnn::StatusCode::OK};
   }
+
+ private:
+  using ConvLayer = ConvolutionLayer<DType, Backend>;
+  using FusedConvLayer = FusedConvolutionLayer<DType, Backend>;
+  using BiasLayer = BiasAddLayer<DType, Backend>;
+  using BatchNormLayer = BatchNormFrozenLayer<DType, Backend>;
+
+  static bool same_memory(DeviceMem lhs, DeviceMem rhs) {
+    return lhs.get_buffer() == rhs.get_buffer() &&
+           lhs.get_offset() == rhs.get_offset();
+  }
+
+  // Folds a frozen batchnorm into the filter and bias of the convolution at
+  // the end of the network, returning false if the batchnorm does not
+  // directly follow a convolution with a bias and has to be run as a layer
+  bool fold_batchnorm(Layer<DType, Backend>& layer) {
+    auto batchnorm = dynamic_cast<BatchNormLayer*>(&layer);
+    if (batchnorm == nullptr || network_.empty() ||
+        !same_memory(batchnorm->input_, network_.back()->get_output())) {
+      return false;
+    }
+
+    auto fused_conv = dynamic_cast<FusedConvLayer*>(network_.back().get());
+    if (fused_conv != nullptr) {
+      // An activation in the epilogue is applied before the batchnorm, so
+      // cannot be folded through
+      if (!fused_conv->epilogue_.bias ||
+          fused_conv->epilogue_.activation !=
+              sycldnn::conv2d::Activation::None) {
+        return false;
+      }
+      return fold_into(*batchnorm, fused_conv->params_, fused_conv->filter_,
+                       fused_conv->bias_);
+    }
+
+    auto bias = dynamic_cast<BiasLayer*>(network_.back().get());
+    if (bias == nullptr || network_.size() < 2) {
+      return false;
+    }
+    auto conv = dynamic_cast<ConvLayer*>(network_[network_.size() - 2].get());
+    if (conv == nullptr || !same_memory(bias->input_, conv->output_) ||
+        bias->params_.rhs_dims != std::vector<int>{conv->params_.features}) {
+      return false;
+    }
+    return fold_into(*batchnorm, conv->params_, conv->filter_, bias->biases_);
+  }
+
+  bool fold_into(BatchNormLayer& batchnorm,
+                 sycldnn::conv2d::Conv2DParams const& conv_params,
+                 DeviceMem filter, DeviceMem bias) {
+    auto status = batchnorm.fold_into(conv_params, filter, bias);
+    if (status.status != sycldnn::StatusCode::OK) {
+      return false;
+    }
+    status.event.wait_and_throw();
+    return true;
+  }
 };
 }  // namespace sycldnn